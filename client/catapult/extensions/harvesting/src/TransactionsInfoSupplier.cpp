@@ -22,6 +22,7 @@
 #include "TransactionsInfoSupplier.h"
 #include "HarvestingUtFacadeFactory.h"
 #include "TransactionFeeMaximizer.h"
+#include "catapult/crypto/IncrementalMerkleHashBuilder.h"
 #include "catapult/model/FeeUtils.h"
 
 namespace catapult { namespace harvesting {
@@ -42,31 +43,18 @@ namespace catapult { namespace harvesting {
 			}
 		};
 
-		TransactionsInfo ToTransactionsInfo(const TransactionInfoPointers& transactionInfoPointers, BlockFeeMultiplier feeMultiplier) {
-			TransactionsInfo transactionsInfo;
-			transactionsInfo.FeeMultiplier = feeMultiplier;
-			transactionsInfo.Transactions.reserve(transactionInfoPointers.size());
-			transactionsInfo.TransactionHashes.reserve(transactionInfoPointers.size());
-
-			for (const auto* pTransactionInfo : transactionInfoPointers) {
-				transactionsInfo.Transactions.push_back(pTransactionInfo->pEntity);
-				transactionsInfo.TransactionHashes.push_back(pTransactionInfo->EntityHash);
-			}
-
-			CalculateBlockTransactionsHash(transactionInfoPointers, transactionsInfo.TransactionsHash);
-			return transactionsInfo;
-		}
-
 		struct SupplyInput {
 		public:
 			SupplyInput(
 					const cache::MemoryUtCacheView& utCacheView,
 					const cache::EmbeddedCountRetriever& embeddedCountRetriever,
 					HarvestingUtFacade& utFacade,
+					crypto::IncrementalMerkleHashBuilder& transactionsHashBuilder,
 					uint32_t transactionLimit)
 					: UtCacheView(utCacheView)
 					, EmbeddedCountRetriever(embeddedCountRetriever)
 					, UtFacade(utFacade)
+					, TransactionsHashBuilder(transactionsHashBuilder)
 					, TransactionLimit(transactionLimit)
 			{}
 
@@ -74,9 +62,42 @@ namespace catapult { namespace harvesting {
 			const cache::MemoryUtCacheView& UtCacheView;
 			cache::EmbeddedCountRetriever EmbeddedCountRetriever;
 			HarvestingUtFacade& UtFacade;
+			crypto::IncrementalMerkleHashBuilder& TransactionsHashBuilder;
 			uint32_t TransactionLimit;
 		};
 
+		// transactions hash tree mirrors the transactions applied to the facade, so truncation only rehashes changed paths
+		bool Apply(const SupplyInput& input, const model::TransactionInfo& transactionInfo) {
+			if (!input.UtFacade.apply(transactionInfo))
+				return false;
+
+			input.TransactionsHashBuilder.update(transactionInfo.MerkleComponentHash);
+			return true;
+		}
+
+		void Unapply(const SupplyInput& input) {
+			input.UtFacade.unapply();
+			input.TransactionsHashBuilder.removeLast();
+		}
+
+		TransactionsInfo ToTransactionsInfo(
+				const SupplyInput& input,
+				const TransactionInfoPointers& transactionInfoPointers,
+				BlockFeeMultiplier feeMultiplier) {
+			TransactionsInfo transactionsInfo;
+			transactionsInfo.FeeMultiplier = feeMultiplier;
+			transactionsInfo.Transactions.reserve(transactionInfoPointers.size());
+			transactionsInfo.TransactionHashes.reserve(transactionInfoPointers.size());
+
+			for (const auto* pTransactionInfo : transactionInfoPointers) {
+				transactionsInfo.Transactions.push_back(pTransactionInfo->pEntity);
+				transactionsInfo.TransactionHashes.push_back(pTransactionInfo->EntityHash);
+			}
+
+			input.TransactionsHashBuilder.final(transactionsInfo.TransactionsHash);
+			return transactionsInfo;
+		}
+
 		auto GetFirstTransactionInfoPointers(const SupplyInput& input, const predicate<const model::TransactionInfo&>& filter) {
 			return cache::GetFirstTransactionInfoPointers(input.UtCacheView, input.TransactionLimit, input.EmbeddedCountRetriever, filter);
 		}
@@ -95,8 +116,8 @@ namespace catapult { namespace harvesting {
 
 		TransactionsInfo SupplyOldest(const SupplyInput& input) {
 			// 1. get first transactions from the ut cache
-			auto candidates = GetFirstTransactionInfoPointers(input, [&utFacade = input.UtFacade](const auto& transactionInfo) {
-				return utFacade.apply(transactionInfo);
+			auto candidates = GetFirstTransactionInfoPointers(input, [&input](const auto& transactionInfo) {
+				return Apply(input, transactionInfo);
 			});
 
 			// 2. pick the smallest multiplier so that all transactions pass validation
@@ -107,14 +128,14 @@ namespace catapult { namespace harvesting {
 				minFeeMultiplier = model::CalculateTransactionMaxFeeMultiplier(*(*minIter)->pEntity);
 			}
 
-			return ToTransactionsInfo(candidates, minFeeMultiplier);
+			return ToTransactionsInfo(input, candidates, minFeeMultiplier);
 		}
 
 		TransactionsInfo SupplyMinimumFee(const SupplyInput& input) {
 			// 1. get all transactions from the ut cache
 			auto comparer = MaxFeeMultiplierComparer<SortDirection::Ascending>();
-			auto candidates = GetFirstTransactionInfoPointers(input, comparer, [&utFacade = input.UtFacade](const auto& transactionInfo) {
-				return utFacade.apply(transactionInfo);
+			auto candidates = GetFirstTransactionInfoPointers(input, comparer, [&input](const auto& transactionInfo) {
+				return Apply(input, transactionInfo);
 			});
 
 			// 2. pick the smallest multiplier so that all transactions pass validation
@@ -122,16 +143,15 @@ namespace catapult { namespace harvesting {
 			if (!candidates.empty())
 				minFeeMultiplier = model::CalculateTransactionMaxFeeMultiplier(*candidates[0]->pEntity);
 
-			return ToTransactionsInfo(candidates, minFeeMultiplier);
+			return ToTransactionsInfo(input, candidates, minFeeMultiplier);
 		}
 
 		TransactionsInfo SupplyMaximumFee(const SupplyInput& input) {
 			// 1. get all transactions from the ut cache
 			auto comparer = MaxFeeMultiplierComparer<SortDirection::Descending>();
 			auto maximizer = TransactionFeeMaximizer();
-			auto candidates = GetFirstTransactionInfoPointers(input, comparer, [&utFacade = input.UtFacade, &maximizer](
-					const auto& transactionInfo) {
-				if (!utFacade.apply(transactionInfo))
+			auto candidates = GetFirstTransactionInfoPointers(input, comparer, [&input, &maximizer](const auto& transactionInfo) {
+				if (!Apply(input, transactionInfo))
 					return false;
 
 				maximizer.apply(transactionInfo);
@@ -142,9 +162,9 @@ namespace catapult { namespace harvesting {
 			const auto& bestFeePolicy = maximizer.best();
 			candidates.resize(bestFeePolicy.NumTransactions);
 			while (input.UtFacade.size() > bestFeePolicy.NumTransactions)
-				input.UtFacade.unapply();
+				Unapply(input);
 
-			return ToTransactionsInfo(candidates, bestFeePolicy.FeeMultiplier);
+			return ToTransactionsInfo(input, candidates, bestFeePolicy.FeeMultiplier);
 		}
 	}
 
@@ -154,7 +174,8 @@ namespace catapult { namespace harvesting {
 			const cache::ReadWriteUtCache& utCache) {
 		return [strategy, countRetriever, &utCache](auto& utFacade, auto transactionLimit) {
 			auto utCacheView = utCache.view();
-			SupplyInput supplyInput(utCacheView, countRetriever, utFacade, transactionLimit);
+			crypto::IncrementalMerkleHashBuilder transactionsHashBuilder;
+			SupplyInput supplyInput(utCacheView, countRetriever, utFacade, transactionsHashBuilder, transactionLimit);
 
 			switch (strategy) {
 			case model::TransactionSelectionStrategy::Minimize_Fee:
@@ -346,6 +346,25 @@ namespace catapult { namespace harvesting {
 		context.assertValidatorCalls(6 * 2);
 	}
 
+	TEST(TEST_CLASS, MaximizeStrategy_TransactionsHashExcludesUnappliedTransactions) {
+		// Arrange:
+		TestContext context(TransactionSelectionStrategy::Maximize_Fee);
+		context.seedCacheForSelectionTests();
+
+		// Act: six transactions are applied and the two with the lowest multipliers are unapplied
+		auto transactionsInfo = context.supply(6);
+
+		// Assert:
+		Hash256 appliedTransactionsHash;
+		CalculateBlockTransactionsHash(context.extractUtInfos({ 2, 3, 8, 9, 4, 5 }), appliedTransactionsHash);
+
+		Hash256 selectedTransactionsHash;
+		CalculateBlockTransactionsHash(context.extractUtInfos({ 2, 3, 8, 9 }), selectedTransactionsHash);
+
+		EXPECT_EQ(selectedTransactionsHash, transactionsInfo.TransactionsHash);
+		EXPECT_NE(appliedTransactionsHash, transactionsInfo.TransactionsHash);
+	}
+
 	TEST(TEST_CLASS, MaximizeStrategy_CanSelectTransactionsWhereSomeFailValidation) {
 		// Arrange: trigger the second half of transactions to fail
 		TestContext context(TransactionSelectionStrategy::Maximize_Fee);
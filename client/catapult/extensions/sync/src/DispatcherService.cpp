@@ -31,6 +31,7 @@
 #include "catapult/chain/BlockExecutor.h"
 #include "catapult/chain/BlockScorer.h"
 #include "catapult/chain/ChainUtils.h"
+#include "catapult/chain/StatePrefetcher.h"
 #include "catapult/chain/TransactionUpdateResultUtils.h"
 #include "catapult/chain/UtUpdater.h"
 #include "catapult/config/CatapultDataDirectory.h"
@@ -58,6 +59,7 @@
 #include "catapult/subscribers/StateChangeSubscriber.h"
 #include "catapult/subscribers/TransactionStatusSubscriber.h"
 #include "catapult/thread/MultiServicePool.h"
+#include "catapult/thread/ParallelFor.h"
 #include <filesystem>
 
 using namespace catapult::consumers;
@@ -74,12 +76,25 @@ namespace catapult { namespace sync {
 			};
 		}
 
+		thread::ParallelForStrategy GetValidationStrategy(const config::NodeConfiguration& config) {
+			return config.EnableWorkStealingValidation ? thread::ParallelForStrategy::Work_Stealing : thread::ParallelForStrategy::Static;
+		}
+
+		BatchSignatureOptions CreateBatchSignatureOptions(const config::NodeConfiguration& config) {
+			return { GetValidationStrategy(config), config.MinSignatureBatchSize };
+		}
+
 		std::shared_ptr<const validators::ParallelValidationPolicy> CreateParallelValidationPolicy(
 				thread::IoThreadPool& validatorPool,
-				const plugins::PluginManager& pluginManager) {
+				const extensions::ServiceState& state) {
 			return validators::CreateParallelValidationPolicy(
 					validatorPool,
-					extensions::CreateStatelessEntityValidator(pluginManager, model::SignatureNotification::Notification_Type));
+					extensions::CreateStatelessEntityValidator(state.pluginManager(), model::SignatureNotification::Notification_Type),
+					GetValidationStrategy(state.config().Node));
+		}
+
+		bool IsStatePrefetchEnabled(const config::NodeConfiguration& config) {
+			return config.EnableCacheDatabaseStorage && 0 != config.StatePrefetchBlockCount;
 		}
 
 		ConsumerDispatcherOptions CreateBlockConsumerDispatcherOptions(const config::NodeConfiguration& config) {
@@ -101,7 +116,8 @@ namespace catapult { namespace sync {
 		std::unique_ptr<ConsumerDispatcher> CreateConsumerDispatcher(
 				extensions::ServiceState& state,
 				const ConsumerDispatcherOptions& options,
-				std::vector<DisruptorConsumer>&& disruptorConsumers) {
+				std::vector<DisruptorConsumerStage>&& consumerStages,
+				std::vector<std::string>& consumerNames) {
 			auto& nodeSubscriber = state.nodeSubscriber();
 			auto& statusSubscriber = state.transactionStatusSubscriber();
 			auto reclaimMemoryInspector = CreateReclaimMemoryInspector();
@@ -110,18 +126,28 @@ namespace catapult { namespace sync {
 					auto& input,
 					const auto& completionResult) {
 				statusSubscriber.flush();
-				auto interactionResult = consumers::ToNodeInteractionResult(input.sourceIdentity(), completionResult);
-				extensions::IncrementNodeInteraction(nodes, interactionResult);
+
+				// coalesced inputs contain entities from multiple sources, each with its own result
+				consumers::ForEachSourceCompletionResult(input, completionResult, [&nodes](
+						const auto& identity,
+						const auto& sourceCompletionResult) {
+					auto interactionResult = consumers::ToNodeInteractionResult(identity, sourceCompletionResult);
+					extensions::IncrementNodeInteraction(nodes, interactionResult);
+				});
 
 				nodes.modifier().pruneBannedNodes();
 
-				if (ConsumerResultSeverity::Fatal == completionResult.ResultSeverity) {
-					const auto& identity = input.sourceIdentity();
+				consumers::ForEachSourceCompletionResult(input, completionResult, [&nodeSubscriber, &localNetworks](
+						const auto& identity,
+						const auto& sourceCompletionResult) {
+					if (ConsumerResultSeverity::Fatal != sourceCompletionResult.ResultSeverity)
+						return;
+
 					if (config::IsLocalHost(identity.Host, localNetworks))
 						CATAPULT_LOG(debug) << "bypassing banning of " << identity << " because host is contained in local networks";
 					else
-						nodeSubscriber.notifyBan(identity, completionResult.CompletionCode);
-				}
+						nodeSubscriber.notifyBan(identity, sourceCompletionResult.CompletionCode);
+				});
 
 				reclaimMemoryInspector(input, completionResult);
 			};
@@ -134,10 +160,15 @@ namespace catapult { namespace sync {
 				CATAPULT_LOG(debug) << "enabling auditing to " << auditPath;
 
 				config::CatapultDirectory(auditPath).createAll();
-				disruptorConsumers.insert(disruptorConsumers.begin(), CreateAuditConsumer(auditPath.generic_string()));
+				consumerStages.insert(consumerStages.begin(), { CreateAuditConsumer(auditPath.generic_string()) });
+				consumerNames.insert(consumerNames.begin(), "AUD");
 			}
 
-			return std::make_unique<ConsumerDispatcher>(options, disruptorConsumers, inspector);
+			auto pDispatcher = std::make_unique<ConsumerDispatcher>(options, consumerStages, inspector);
+			if (consumerNames.size() != pDispatcher->size())
+				CATAPULT_THROW_INVALID_ARGUMENT_2("consumer names do not match consumers", consumerNames.size(), pDispatcher->size());
+
+			return pDispatcher;
 		}
 
 		// endregion
@@ -149,8 +180,10 @@ namespace catapult { namespace sync {
 		}
 
 		BlockchainProcessor CreateSyncProcessor(
-				const model::BlockchainConfiguration& blockchainConfig,
-				const chain::ExecutionConfiguration& executionConfig) {
+				const config::CatapultConfiguration& config,
+				const chain::ExecutionConfiguration& executionConfig,
+				const supplier<model::HeightHashPair>& networkFinalizedHeightHashPairSupplier) {
+			const auto& blockchainConfig = config.Blockchain;
 			BlockHitPredicateFactory blockHitPredicateFactory = [&blockchainConfig](const cache::ReadOnlyCatapultCache& cache) {
 				cache::ImportanceView view(cache.sub<cache::AccountStateCache>());
 				return chain::BlockHitPredicate(blockchainConfig, [view](const auto& publicKey, auto height) {
@@ -160,7 +193,9 @@ namespace catapult { namespace sync {
 			return CreateBlockchainProcessor(
 					blockHitPredicateFactory,
 					chain::CreateBatchEntityProcessor(executionConfig),
-					GetReceiptValidationMode(blockchainConfig));
+					GetReceiptValidationMode(blockchainConfig),
+					config.Node.StateHashCalculationInterval,
+					networkFinalizedHeightHashPairSupplier);
 		}
 
 		BlockchainSyncHandlers CreateBlockchainSyncHandlers(extensions::ServiceState& state, RollbackInfo& rollbackInfo) {
@@ -187,7 +222,10 @@ namespace catapult { namespace sync {
 				auto resolverContext = pluginManager.createResolverContext(readOnlyCache);
 				UndoBlock(blockElement, { *pUndoObserver, resolverContext, observerState }, undoBlockType);
 			};
-			syncHandlers.Processor = CreateSyncProcessor(blockchainConfig, extensions::CreateExecutionConfiguration(pluginManager));
+			syncHandlers.Processor = CreateSyncProcessor(
+					state.config(),
+					extensions::CreateExecutionConfiguration(pluginManager),
+					syncHandlers.NetworkFinalizedHeightHashPairSupplier);
 
 			syncHandlers.StateChange = [&rollbackInfo, &localScore = state.score(), &subscriber = state.stateChangeSubscriber()](
 					const auto& changeInfo) {
@@ -201,13 +239,18 @@ namespace catapult { namespace sync {
 			};
 
 			auto dataDirectory = config::CatapultDataDirectory(state.config().User.DataDirectory);
+			syncHandlers.PreBlocksWritten = []() {};
 			syncHandlers.PreStateWritten = [](const auto&, auto) {};
 			syncHandlers.TransactionsChange = state.hooks().transactionsChangeHandler();
 			syncHandlers.CommitStep = extensions::CreateCommitStepHandler(dataDirectory);
 
-			if (state.config().Node.EnableCacheDatabaseStorage)
+			if (state.config().Node.EnableCacheDatabaseStorage) {
 				AddSupplementalDataResiliency(syncHandlers, dataDirectory, state.cache(), state.score());
 
+				if (state.config().Node.CacheDatabase.EnableAsyncCommit)
+					AddAsyncCommitResiliency(syncHandlers, state.cache());
+			}
+
 			return syncHandlers;
 		}
 
@@ -218,57 +261,95 @@ namespace catapult { namespace sync {
 					, m_nodeConfig(m_state.config().Node)
 			{}
 
+		public:
+			const std::vector<std::string>& consumerNames() const {
+				return m_consumerNames;
+			}
+
 		public:
 			void addHashConsumers() {
-				m_consumers.push_back(CreateBlockHashCalculatorConsumer(
+				addStage({ "HASH" }, { CreateBlockHashCalculatorConsumer(
 						m_state.config().Blockchain.Network.GenerationHashSeed,
-						m_state.pluginManager().transactionRegistry()));
-				m_consumers.push_back(CreateBlockHashCheckConsumer(
+						m_state.pluginManager().transactionRegistry()) });
+				addStage({ "HCHK" }, { CreateBlockHashCheckConsumer(
 						m_state.timeSupplier(),
-						extensions::CreateHashCheckOptions(m_nodeConfig.ShortLivedCacheBlockDuration, m_nodeConfig)));
+						extensions::CreateHashCheckOptions(m_nodeConfig.ShortLivedCacheBlockDuration, m_nodeConfig)) });
 			}
 
-			std::shared_ptr<ConsumerDispatcher> build(thread::IoThreadPool& validatorPool, RollbackInfo& rollbackInfo) {
+			std::shared_ptr<ConsumerDispatcher> build(
+					thread::IoThreadPool& validatorPool,
+					thread::IoThreadPool* pPrefetchPool,
+					RollbackInfo& rollbackInfo) {
 				const auto& utCache = const_cast<const extensions::ServiceState&>(m_state).utCache();
 				auto requiresValidationPredicate = ToRequiresValidationPredicate(m_state.hooks().knownHashPredicate(utCache));
-				m_consumers.push_back(CreateBlockchainCheckConsumer(
+
+				// cheap chain checks reject malformed input before any expensive validation is performed
+				addStage({ "CHN" }, { CreateBlockchainCheckConsumer(
 						m_state.config().Blockchain.MaxBlockFutureTime,
-						m_state.timeSupplier()));
-				m_consumers.push_back(CreateBlockStatelessValidationConsumer(
-						CreateParallelValidationPolicy(validatorPool, m_state.pluginManager()),
-						requiresValidationPredicate));
-				m_consumers.push_back(CreateBlockBatchSignatureConsumer(
-						m_state.config().Blockchain.Network.GenerationHashSeed,
-						CreateRandomFiller(),
-						m_state.pluginManager().createNotificationPublisher(),
-						validatorPool,
-						requiresValidationPredicate));
+						m_state.timeSupplier()) });
+
+				// independent (const) validations of the same blocks are run in parallel
+				addStage({ "SVAL", "SIG" }, {
+					CreateBlockStatelessValidationConsumer(
+							CreateParallelValidationPolicy(validatorPool, m_state),
+							requiresValidationPredicate),
+					CreateBlockBatchSignatureConsumer(
+							m_state.config().Blockchain.Network.GenerationHashSeed,
+							CreateRandomFiller(),
+							m_state.pluginManager().createNotificationPublisher(),
+							validatorPool,
+							CreateBatchSignatureOptions(m_nodeConfig),
+							requiresValidationPredicate)
+				});
 
-				auto disruptorConsumers = DisruptorConsumersFromBlockConsumers(m_consumers);
-				disruptorConsumers.push_back(CreateBlockchainSyncConsumer(
+				// start loading state of validated blocks on prefetch pool threads while preceding blocks are executed
+				if (pPrefetchPool) {
+					addStage({ "PREF" }, { CreateBlockStatePrefetchConsumer(
+							m_state.cache(),
+							extensions::CreateExecutionConfiguration(m_state.pluginManager()),
+							m_state.pluginManager().createNotificationPublisher(),
+							*pPrefetchPool,
+							m_nodeConfig.StatePrefetchBlockCount,
+							chain::CreateDetachedStateLoader(m_state.cache())) });
+				}
+
+				addStage("SYNC", CreateBlockchainSyncConsumer(
 						m_state.config().Blockchain.ImportanceGrouping,
 						m_state.cache(),
 						m_state.storage(),
 						CreateBlockchainSyncHandlers(m_state, rollbackInfo)));
 
 				if (m_state.config().Node.EnableAutoSyncCleanup)
-					disruptorConsumers.push_back(CreateBlockchainSyncCleanupConsumer(m_state.config().User.DataDirectory));
+					addStage("CLN", CreateBlockchainSyncCleanupConsumer(m_state.config().User.DataDirectory));
 
 				// forward locally harvested blocks and blocks pushed by partners
 				auto newBlockSinkSourceMask = static_cast<InputSource>(
 						utils::to_underlying_type(InputSource::Local)
 						| utils::to_underlying_type(InputSource::Remote_Push));
-				disruptorConsumers.push_back(CreateNewBlockConsumer(m_state.hooks().newBlockSink(), newBlockSinkSourceMask));
+				addStage("NEW", CreateNewBlockConsumer(m_state.hooks().newBlockSink(), newBlockSinkSourceMask));
 				return CreateConsumerDispatcher(
 						m_state,
 						CreateBlockConsumerDispatcherOptions(m_nodeConfig),
-						std::move(disruptorConsumers));
+						std::move(m_consumerStages),
+						m_consumerNames);
+			}
+
+		private:
+			void addStage(const std::vector<std::string>& consumerNames, const std::vector<BlockConsumer>& consumers) {
+				m_consumerStages.push_back(DisruptorConsumersFromBlockConsumers(consumers));
+				m_consumerNames.insert(m_consumerNames.end(), consumerNames.cbegin(), consumerNames.cend());
+			}
+
+			void addStage(const std::string& consumerName, const DisruptorConsumer& consumer) {
+				m_consumerStages.push_back({ consumer });
+				m_consumerNames.push_back(consumerName);
 			}
 
 		private:
 			extensions::ServiceState& m_state;
 			const config::NodeConfiguration& m_nodeConfig;
-			std::vector<BlockConsumer> m_consumers;
+			std::vector<DisruptorConsumerStage> m_consumerStages;
+			std::vector<std::string> m_consumerNames; // short names used for diagnostic counters
 		};
 
 		void RegisterBlockDispatcherService(
@@ -306,13 +387,18 @@ namespace catapult { namespace sync {
 					, m_nodeConfig(m_state.config().Node)
 			{}
 
+		public:
+			const std::vector<std::string>& consumerNames() const {
+				return m_consumerNames;
+			}
+
 		public:
 			void addHashConsumers() {
 				const auto& utCache = const_cast<const extensions::ServiceState&>(m_state).utCache();
-				m_consumers.push_back(CreateTransactionHashCalculatorConsumer(
+				addConsumer("HASH", CreateTransactionHashCalculatorConsumer(
 						m_state.config().Blockchain.Network.GenerationHashSeed,
 						m_state.pluginManager().transactionRegistry()));
-				m_consumers.push_back(CreateTransactionHashCheckConsumer(
+				addConsumer("HCHK", CreateTransactionHashCheckConsumer(
 						m_state.timeSupplier(),
 						extensions::CreateHashCheckOptions(m_nodeConfig.ShortLivedCacheTransactionDuration, m_nodeConfig),
 						m_state.hooks().knownHashPredicate(utCache)));
@@ -320,14 +406,15 @@ namespace catapult { namespace sync {
 
 			std::shared_ptr<ConsumerDispatcher> build(thread::IoThreadPool& validatorPool, chain::UtUpdater& utUpdater) {
 				auto failedTransactionSink = extensions::SubscriberToSink(m_state.transactionStatusSubscriber());
-				m_consumers.push_back(CreateTransactionStatelessValidationConsumer(
-						CreateParallelValidationPolicy(validatorPool, m_state.pluginManager()),
+				addConsumer("SVAL", CreateTransactionStatelessValidationConsumer(
+						CreateParallelValidationPolicy(validatorPool, m_state),
 						failedTransactionSink));
-				m_consumers.push_back(CreateTransactionBatchSignatureConsumer(
+				addConsumer("SIG", CreateTransactionBatchSignatureConsumer(
 						m_state.config().Blockchain.Network.GenerationHashSeed,
 						CreateRandomFiller(),
 						m_state.pluginManager().createNotificationPublisher(),
 						validatorPool,
+						CreateBatchSignatureOptions(m_nodeConfig),
 						failedTransactionSink));
 
 				const auto& banningConfig = m_nodeConfig.Banning;
@@ -341,17 +428,31 @@ namespace catapult { namespace sync {
 							newTransactionsSink(chain::SelectValid(std::move(transactionInfos), updateResults));
 							return chain::AggregateUpdateResults(updateResults);
 						}));
+				m_consumerNames.push_back("NEW");
+
+				// transaction consumers modify per transaction result severities, so they cannot run in parallel
+				std::vector<DisruptorConsumerStage> consumerStages;
+				for (const auto& disruptorConsumer : disruptorConsumers)
+					consumerStages.push_back({ disruptorConsumer });
 
 				return CreateConsumerDispatcher(
 						m_state,
 						CreateTransactionConsumerDispatcherOptions(m_nodeConfig),
-						std::move(disruptorConsumers));
+						std::move(consumerStages),
+						m_consumerNames);
+			}
+
+		private:
+			void addConsumer(const std::string& consumerName, const TransactionConsumer& consumer) {
+				m_consumers.push_back(consumer);
+				m_consumerNames.push_back(consumerName);
 			}
 
 		private:
 			extensions::ServiceState& m_state;
 			const config::NodeConfiguration& m_nodeConfig;
 			std::vector<TransactionConsumer> m_consumers;
+			std::vector<std::string> m_consumerNames; // short names used for diagnostic counters
 		};
 
 		void RegisterTransactionDispatcherService(
@@ -364,7 +465,8 @@ namespace catapult { namespace sync {
 
 			auto pBatchRangeDispatcher = std::make_shared<extensions::TransactionBatchRangeDispatcher>(
 					*pDispatcher,
-					state.config().Blockchain.Network.NodeEqualityStrategy);
+					state.config().Blockchain.Network.NodeEqualityStrategy,
+					state.config().Node.TransactionDisruptorMaxCoalescedSize);
 			locator.registerRootedService("dispatcher.transaction.batch", pBatchRangeDispatcher);
 
 			auto shouldProcessTransactions = extensions::CreateShouldProcessTransactionsPredicate(state);
@@ -451,10 +553,11 @@ namespace catapult { namespace sync {
 			void registerServices(extensions::ServiceLocator& locator, extensions::ServiceState& state) override {
 				// create shared services
 				auto* pValidatorPool = state.pool().pushIsolatedPool("validator");
+				auto* pPrefetchPool = IsStatePrefetchEnabled(state.config().Node) ? state.pool().pushIsolatedPool("prefetch") : nullptr;
 				auto& utUpdater = CreateAndRegisterUtUpdater(locator, state);
 
 				// create the block and transaction dispatchers and related services
-				// (notice that the dispatcher service group must be after the validator isolated pool in order to allow proper shutdown)
+				// (notice that the dispatcher service group must be after the isolated pools in order to allow proper shutdown)
 				auto pServiceGroup = state.pool().pushServiceGroup("dispatcher service");
 
 				BlockDispatcherBuilder blockDispatcherBuilder(state);
@@ -464,11 +567,16 @@ namespace catapult { namespace sync {
 				transactionDispatcherBuilder.addHashConsumers();
 
 				auto pRollbackInfo = CreateAndRegisterRollbackService(locator, state.timeSupplier(), state.config().Blockchain);
-				auto pBlockDispatcher = blockDispatcherBuilder.build(*pValidatorPool, *pRollbackInfo);
+				auto pBlockDispatcher = blockDispatcherBuilder.build(*pValidatorPool, pPrefetchPool, *pRollbackInfo);
 				RegisterBlockDispatcherService(pBlockDispatcher, *pServiceGroup, locator, state);
+				extensions::AddDispatcherConsumerCounters(locator, "dispatcher.block", "BLK", blockDispatcherBuilder.consumerNames());
 
 				auto pTransactionDispatcher = transactionDispatcherBuilder.build(*pValidatorPool, utUpdater);
 				RegisterTransactionDispatcherService(pTransactionDispatcher, *pServiceGroup, locator, state);
+
+				// per consumer counters depend on the consumers actually created, so they are registered after the dispatchers
+				auto transactionConsumerNames = transactionDispatcherBuilder.consumerNames();
+				extensions::AddDispatcherConsumerCounters(locator, "dispatcher.transaction", "TX", transactionConsumerNames);
 			}
 		};
 	}
@@ -54,4 +54,24 @@ namespace catapult { namespace sync {
 			commitStepHandler(step);
 		};
 	}
+
+	void AddAsyncCommitResiliency(consumers::BlockchainSyncHandlers& syncHandlers, const cache::CatapultCache& cache) {
+		// previous commit must be completely written before next one can start overwriting recovery data
+		auto preBlocksWrittenHandler = syncHandlers.PreBlocksWritten;
+		syncHandlers.PreBlocksWritten = [preBlocksWrittenHandler, &cache]() {
+			cache.waitForPendingWrites();
+			preBlocksWrittenHandler();
+		};
+
+		// until all changes are written, recovery needs to treat them as State_Written
+		auto commitStepHandler = syncHandlers.CommitStep;
+		syncHandlers.CommitStep = [commitStepHandler, &cache](auto step) {
+			if (consumers::CommitOperationStep::All_Updated != step) {
+				commitStepHandler(step);
+				return;
+			}
+
+			cache.onPendingWritesComplete([commitStepHandler, step]() { commitStepHandler(step); });
+		};
+	}
 }}
@@ -35,4 +35,8 @@ namespace catapult { namespace sync {
 			const config::CatapultDataDirectory& dataDirectory,
 			const cache::CatapultCache& cache,
 			const extensions::LocalNodeChainScore& score);
+
+	/// Updates \a syncHandlers to support asynchronous commits of \a cache.
+	/// \note All_Updated is only signaled after all cache changes have been written, so recovery can replay unwritten changes.
+	void AddAsyncCommitResiliency(consumers::BlockchainSyncHandlers& syncHandlers, const cache::CatapultCache& cache);
 }}
@@ -48,7 +48,7 @@ namespace catapult { namespace sync {
 
 	namespace {
 		constexpr auto Num_Expected_Services = 5u;
-		constexpr auto Num_Expected_Counters = 10u;
+		constexpr auto Num_Expected_Counters = 10u + 3 * (7 + 5); // 3 counters for each of 7 block and 5 transaction consumers
 		constexpr auto Num_Expected_Tasks = 1u;
 
 		constexpr auto Block_Elements_Counter_Name = "BLK ELEM TOT";
@@ -363,6 +363,15 @@ namespace catapult { namespace sync {
 		EXPECT_EQ(0u, context.counter(Rollback_Elements_Committed_Recent));
 		EXPECT_EQ(0u, context.counter(Rollback_Elements_Ignored_All));
 		EXPECT_EQ(0u, context.counter(Rollback_Elements_Ignored_Recent));
+		for (const auto* consumerName : { "HASH", "HCHK", "CHN", "SVAL", "SIG", "SYNC", "NEW" }) {
+			for (const auto* counterSuffix : { " WAIT", " PROC", " LAG" })
+				EXPECT_EQ(0u, context.counter(std::string("BLK ") + consumerName + counterSuffix)) << consumerName << counterSuffix;
+		}
+
+		for (const auto* consumerName : { "HASH", "HCHK", "SVAL", "SIG", "NEW" }) {
+			for (const auto* counterSuffix : { " WAIT", " PROC", " LAG" })
+				EXPECT_EQ(0u, context.counter(std::string("TX ") + consumerName + counterSuffix)) << consumerName << counterSuffix;
+		}
 
 		// - block dispatcher should be initialized
 		auto blockDispatcherStatus = GetBlockDispatcherStatus(context.locator());
@@ -387,12 +396,16 @@ namespace catapult { namespace sync {
 
 		// Assert:
 		EXPECT_EQ(Num_Expected_Services, context.locator().numServices());
-		EXPECT_EQ(Num_Expected_Counters, context.locator().counters().size());
+		EXPECT_EQ(Num_Expected_Counters + 2 * 3, context.locator().counters().size());
 		EXPECT_EQ(Num_Expected_Tasks, context.testState().state().tasks().size());
 
 		EXPECT_EQ(8u, GetBlockDispatcherStatus(context.locator()).Size);
 		EXPECT_EQ(6u, GetTransactionDispatcherStatus(context.locator()).Size);
 
+		// - audit consumers have counters
+		EXPECT_EQ(0u, context.counter("BLK AUD LAG"));
+		EXPECT_EQ(0u, context.counter("TX AUD LAG"));
+
 		// - auditing directories were created
 		auto auditDirectory = context.tempPath() / "audit";
 		EXPECT_TRUE(std::filesystem::is_directory(auditDirectory / "block dispatcher"));
@@ -409,11 +422,14 @@ namespace catapult { namespace sync {
 
 		// Assert:
 		EXPECT_EQ(Num_Expected_Services, context.locator().numServices());
-		EXPECT_EQ(Num_Expected_Counters, context.locator().counters().size());
+		EXPECT_EQ(Num_Expected_Counters + 3, context.locator().counters().size());
 		EXPECT_EQ(Num_Expected_Tasks, context.testState().state().tasks().size());
 
 		EXPECT_EQ(8u, GetBlockDispatcherStatus(context.locator()).Size);
 		EXPECT_EQ(5u, GetTransactionDispatcherStatus(context.locator()).Size);
+
+		// - cleanup consumer has counters
+		EXPECT_EQ(0u, context.counter("BLK CLN LAG"));
 	}
 
 	TEST(TEST_CLASS, CanShutdownService) {
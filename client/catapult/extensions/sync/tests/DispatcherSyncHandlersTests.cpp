@@ -21,11 +21,13 @@
 
 #include "sync/src/DispatcherSyncHandlers.h"
 #include "catapult/cache/CatapultCache.h"
+#include "catapult/cache_db/RocksBackgroundWriter.h"
 #include "catapult/config/CatapultDataDirectory.h"
 #include "catapult/extensions/LocalNodeChainScore.h"
 #include "tests/test/nodeps/Filesystem.h"
 #include "tests/TestHarness.h"
 #include <filesystem>
+#include <future>
 
 namespace catapult { namespace sync {
 
@@ -142,4 +144,150 @@ namespace catapult { namespace sync {
 	}
 
 	// endregion
+
+	// region AddAsyncCommitResiliency - test context
+
+	namespace {
+		class AddAsyncCommitResiliencyTestContext {
+		public:
+			struct Counters {
+				size_t NumPreBlocksWrittenCalls = 0;
+				std::vector<consumers::CommitOperationStep> CommitSteps;
+			};
+
+		public:
+			explicit AddAsyncCommitResiliencyTestContext(bool useBackgroundWriter)
+					: m_pBackgroundWriter(useBackgroundWriter ? std::make_shared<cache::RocksBackgroundWriter>(5) : nullptr)
+					, m_cache({}, nullptr, m_pBackgroundWriter) {
+				m_syncHandlers.PreBlocksWritten = [&counters = m_counters]() {
+					++counters.NumPreBlocksWrittenCalls;
+				};
+				m_syncHandlers.CommitStep = [&counters = m_counters](auto step) {
+					counters.CommitSteps.push_back(step);
+				};
+
+				AddAsyncCommitResiliency(m_syncHandlers, m_cache);
+			}
+
+		public:
+			const auto& counters() const {
+				return m_counters;
+			}
+
+			const auto& syncHandlers() const {
+				return m_syncHandlers;
+			}
+
+			const auto& cache() const {
+				return m_cache;
+			}
+
+		public:
+			void blockWriter(std::shared_future<void> unblockFuture) {
+				m_pBackgroundWriter->post([unblockFuture]() { unblockFuture.wait(); });
+			}
+
+		private:
+			std::shared_ptr<cache::RocksBackgroundWriter> m_pBackgroundWriter;
+			cache::CatapultCache m_cache;
+			Counters m_counters;
+			consumers::BlockchainSyncHandlers m_syncHandlers;
+		};
+	}
+
+	// endregion
+
+	// region AddAsyncCommitResiliency - tests
+
+	TEST(TEST_CLASS, AddAsyncCommitResiliency_PreBlocksWrittenForwardsWhenNoWritesArePending) {
+		// Arrange:
+		AddAsyncCommitResiliencyTestContext context(true);
+
+		// Act:
+		context.syncHandlers().PreBlocksWritten();
+
+		// Assert:
+		EXPECT_EQ(1u, context.counters().NumPreBlocksWrittenCalls);
+		EXPECT_TRUE(context.counters().CommitSteps.empty());
+	}
+
+	TEST(TEST_CLASS, AddAsyncCommitResiliency_PreBlocksWrittenWaitsForPendingWrites) {
+		// Arrange:
+		AddAsyncCommitResiliencyTestContext context(true);
+		std::promise<void> unblockPromise;
+		context.blockWriter(unblockPromise.get_future().share());
+
+		// Act:
+		auto preBlocksWrittenFuture = std::async(std::launch::async, [&context]() { context.syncHandlers().PreBlocksWritten(); });
+		auto status = preBlocksWrittenFuture.wait_for(std::chrono::milliseconds(50));
+
+		// Sanity: handler is blocked by pending write
+		EXPECT_EQ(std::future_status::timeout, status);
+		EXPECT_EQ(0u, context.counters().NumPreBlocksWrittenCalls);
+
+		unblockPromise.set_value();
+		preBlocksWrittenFuture.get();
+
+		// Assert:
+		EXPECT_EQ(1u, context.counters().NumPreBlocksWrittenCalls);
+	}
+
+	namespace {
+		void AssertAddAsyncCommitResiliencyCommitStepIsForwardedImmediately(consumers::CommitOperationStep step) {
+			// Arrange:
+			AddAsyncCommitResiliencyTestContext context(true);
+			std::promise<void> unblockPromise;
+			context.blockWriter(unblockPromise.get_future().share());
+
+			// Act:
+			context.syncHandlers().CommitStep(step);
+
+			// Assert:
+			EXPECT_EQ(std::vector<consumers::CommitOperationStep>({ step }), context.counters().CommitSteps);
+
+			unblockPromise.set_value();
+		}
+	}
+
+	TEST(TEST_CLASS, AddAsyncCommitResiliency_CommitStepIsForwardedImmediatelyWhenOperationIsBlocksWritten) {
+		AssertAddAsyncCommitResiliencyCommitStepIsForwardedImmediately(consumers::CommitOperationStep::Blocks_Written);
+	}
+
+	TEST(TEST_CLASS, AddAsyncCommitResiliency_CommitStepIsForwardedImmediatelyWhenOperationIsStateWritten) {
+		AssertAddAsyncCommitResiliencyCommitStepIsForwardedImmediately(consumers::CommitOperationStep::State_Written);
+	}
+
+	TEST(TEST_CLASS, AddAsyncCommitResiliency_CommitStepIsDeferredUntilPendingWritesCompleteWhenOperationIsAllUpdated) {
+		// Arrange:
+		AddAsyncCommitResiliencyTestContext context(true);
+		std::promise<void> unblockPromise;
+		context.blockWriter(unblockPromise.get_future().share());
+
+		// Act:
+		context.syncHandlers().CommitStep(consumers::CommitOperationStep::All_Updated);
+
+		// Sanity:
+		EXPECT_TRUE(context.counters().CommitSteps.empty());
+
+		unblockPromise.set_value();
+		context.cache().waitForPendingWrites();
+
+		// Assert:
+		auto expectedSteps = std::vector<consumers::CommitOperationStep>({ consumers::CommitOperationStep::All_Updated });
+		EXPECT_EQ(expectedSteps, context.counters().CommitSteps);
+	}
+
+	TEST(TEST_CLASS, AddAsyncCommitResiliency_CommitStepIsForwardedImmediatelyWhenOperationIsAllUpdatedWithoutBackgroundWriter) {
+		// Arrange:
+		AddAsyncCommitResiliencyTestContext context(false);
+
+		// Act:
+		context.syncHandlers().CommitStep(consumers::CommitOperationStep::All_Updated);
+
+		// Assert:
+		auto expectedSteps = std::vector<consumers::CommitOperationStep>({ consumers::CommitOperationStep::All_Updated });
+		EXPECT_EQ(expectedSteps, context.counters().CommitSteps);
+	}
+
+	// endregion
 }}
@@ -60,7 +60,7 @@ namespace catapult { namespace plugins {
 			}
 
 			static std::vector<ionet::PacketType> GetNonDiagnosticPacketTypes() {
-				return { ionet::PacketType::Hash_Lock_State_Path };
+				return { ionet::PacketType::Hash_Lock_State_Path, ionet::PacketType::Hash_Lock_State_Paths };
 			}
 
 			static std::vector<ionet::PacketType> GetDiagnosticPacketTypes() {
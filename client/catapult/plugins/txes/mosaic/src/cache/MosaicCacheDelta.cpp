@@ -74,4 +74,14 @@ namespace catapult { namespace cache {
 
 		MosaicCacheDeltaMixins::BasicInsertRemove::remove(mosaicId);
 	}
+
+	void BasicMosaicCacheDelta::prefetch(const StatePrefetchKeys& keys) {
+		m_pEntryById->prefetch(keys.MosaicIds);
+	}
+
+	StatePrefetchLoader BasicMosaicCacheDelta::createPrefetchLoader() const {
+		return [loader = m_pEntryById->createOriginalElementsLoader()](const auto& keys) {
+			loader(keys.MosaicIds);
+		};
+	}
 }}
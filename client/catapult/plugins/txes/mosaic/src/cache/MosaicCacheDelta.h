@@ -25,6 +25,7 @@
 #include "catapult/cache/CacheMixinAliases.h"
 #include "catapult/cache/ReadOnlyArtifactCache.h"
 #include "catapult/cache/ReadOnlyViewSupplier.h"
+#include "catapult/cache/StatePrefetchKeys.h"
 #include "catapult/deltaset/BaseSetDelta.h"
 
 namespace catapult { namespace cache {
@@ -67,6 +68,12 @@ namespace catapult { namespace cache {
 		/// Removes the value identified by \a mosaicId from the cache.
 		void remove(MosaicId mosaicId);
 
+		/// Prefetches all mosaics identified by mosaic ids in \a keys.
+		void prefetch(const StatePrefetchKeys& keys);
+
+		/// Creates a loader of all mosaics identified by mosaic ids in its keys that does not modify this delta.
+		StatePrefetchLoader createPrefetchLoader() const;
+
 	private:
 		MosaicCacheTypes::PrimaryTypes::BaseSetDeltaPointerType m_pEntryById;
 		MosaicCacheTypes::HeightGroupingTypes::BaseSetDeltaPointerType m_pMosaicIdsByExpiryHeight;
@@ -60,7 +60,7 @@ namespace catapult { namespace plugins {
 			}
 
 			static std::vector<ionet::PacketType> GetNonDiagnosticPacketTypes() {
-				return { ionet::PacketType::Multisig_State_Path };
+				return { ionet::PacketType::Multisig_State_Path, ionet::PacketType::Multisig_State_Paths };
 			}
 
 			static std::vector<ionet::PacketType> GetDiagnosticPacketTypes() {
@@ -82,7 +82,7 @@ namespace catapult { namespace plugins {
 			}
 
 			static std::vector<ionet::PacketType> GetNonDiagnosticPacketTypes() {
-				return { ionet::PacketType::Namespace_State_Path };
+				return { ionet::PacketType::Namespace_State_Path, ionet::PacketType::Namespace_State_Paths };
 			}
 
 			static std::vector<ionet::PacketType> GetDiagnosticPacketTypes() {
@@ -0,0 +1,108 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "StateProofVerifier.h"
+#include "catapult/exceptions.h"
+#include <algorithm>
+
+namespace catapult { namespace extensions {
+
+	namespace {
+		StateProofVerificationResult CreateResult(VerifyStateProofResult result) {
+			return { result, Hash256() };
+		}
+
+		StateProofVerificationResult VerifyStatePath(
+				const std::vector<tree::TreeNode>& nodes,
+				const std::vector<uint32_t>& nodeIndexPath,
+				const tree::TreeNodePath& keyPath,
+				const Hash256& stateRoot) {
+			// an empty path can only prove that a key does not exist in an empty tree
+			if (nodeIndexPath.empty()) {
+				auto isEmptyTree = Hash256() == stateRoot;
+				return CreateResult(isEmptyTree ? VerifyStateProofResult::Does_Not_Exist : VerifyStateProofResult::Invalid_Root);
+			}
+
+			if (stateRoot != nodes[nodeIndexPath[0]].hash())
+				return CreateResult(VerifyStateProofResult::Invalid_Root);
+
+			auto remainingKeyPath = keyPath;
+			for (auto i = 0u; i < nodeIndexPath.size(); ++i) {
+				const auto& node = nodes[nodeIndexPath[i]];
+				auto isLastNode = nodeIndexPath.size() - 1 == i;
+
+				// a leaf must terminate the path and fully match the remaining key path for the key to exist
+				if (node.isLeaf()) {
+					if (!isLastNode)
+						return CreateResult(VerifyStateProofResult::Invalid_Path);
+
+					return node.path() == remainingKeyPath
+							? StateProofVerificationResult{ VerifyStateProofResult::Exists, node.asLeafNode().value() }
+							: CreateResult(VerifyStateProofResult::Does_Not_Exist);
+				}
+
+				// all keys below a branch share its path, so a partial match proves that the key does not exist
+				auto differenceIndex = tree::FindFirstDifferenceIndex(node.path(), remainingKeyPath);
+				if (differenceIndex < node.path().size())
+					return CreateResult(VerifyStateProofResult::Does_Not_Exist);
+
+				if (differenceIndex >= remainingKeyPath.size())
+					return CreateResult(VerifyStateProofResult::Invalid_Path);
+
+				// a branch without a link for the next nibble proves that the key does not exist
+				const auto& branchNode = node.asBranchNode();
+				auto linkIndex = remainingKeyPath.nibbleAt(differenceIndex);
+				if (!branchNode.hasLink(linkIndex))
+					return CreateResult(VerifyStateProofResult::Does_Not_Exist);
+
+				if (isLastNode || branchNode.link(linkIndex) != nodes[nodeIndexPath[i + 1]].hash())
+					return CreateResult(VerifyStateProofResult::Invalid_Path);
+
+				remainingKeyPath = remainingKeyPath.subpath(differenceIndex + 1);
+			}
+
+			return CreateResult(VerifyStateProofResult::Invalid_Path);
+		}
+	}
+
+	std::vector<StateProofVerificationResult> VerifyBatchStateProof(
+			const tree::PatriciaTreeBatchProof& proof,
+			const std::vector<tree::TreeNodePath>& keyPaths,
+			const Hash256& stateRoot) {
+		if (keyPaths.size() != proof.NodeIndexPaths.size())
+			CATAPULT_THROW_INVALID_ARGUMENT_2("proof path count does not match key count", proof.NodeIndexPaths.size(), keyPaths.size());
+
+		std::vector<StateProofVerificationResult> results;
+		results.reserve(keyPaths.size());
+		for (auto i = 0u; i < keyPaths.size(); ++i) {
+			const auto& nodeIndexPath = proof.NodeIndexPaths[i];
+			auto hasInvalidNodeIndex = std::any_of(nodeIndexPath.cbegin(), nodeIndexPath.cend(), [&proof](auto nodeIndex) {
+				return nodeIndex >= proof.Nodes.size();
+			});
+
+			results.push_back(hasInvalidNodeIndex
+					? CreateResult(VerifyStateProofResult::Invalid_Path)
+					: VerifyStatePath(proof.Nodes, nodeIndexPath, keyPaths[i], stateRoot));
+		}
+
+		return results;
+	}
+}}
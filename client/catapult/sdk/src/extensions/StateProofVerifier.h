@@ -0,0 +1,58 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/tree/PatriciaTreeBatchProof.h"
+#include <vector>
+
+namespace catapult { namespace extensions {
+
+	/// Possible results of verifying a state proof for a single key.
+	enum class VerifyStateProofResult {
+		/// Proof is valid and proves that the key exists in state.
+		Exists,
+
+		/// Proof is valid and proves that the key does not exist in state.
+		Does_Not_Exist,
+
+		/// Proof does not start at the expected state root.
+		Invalid_Root,
+
+		/// Proof is not a connected path to the key or is incomplete.
+		Invalid_Path
+	};
+
+	/// Result of verifying a state proof for a single key.
+	struct StateProofVerificationResult {
+		/// Verification result.
+		VerifyStateProofResult Result;
+
+		/// Value (hash) associated with the key when it exists.
+		Hash256 Value;
+	};
+
+	/// Verifies batch state \a proof for keys with encoded paths \a keyPaths against \a stateRoot.
+	/// \note Key paths must be created from keys encoded with the encoder used by the corresponding state tree.
+	std::vector<StateProofVerificationResult> VerifyBatchStateProof(
+			const tree::PatriciaTreeBatchProof& proof,
+			const std::vector<tree::TreeNodePath>& keyPaths,
+			const Hash256& stateRoot);
+}}
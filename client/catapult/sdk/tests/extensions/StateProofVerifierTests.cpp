@@ -0,0 +1,241 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "src/extensions/StateProofVerifier.h"
+#include "catapult/tree/MemoryDataSource.h"
+#include "catapult/tree/PatriciaTree.h"
+#include "tests/test/tree/PassThroughEncoder.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace extensions {
+
+#define TEST_CLASS StateProofVerifierTests
+
+	namespace {
+		using MemoryPatriciaTree = tree::PatriciaTree<test::PassThroughEncoder, tree::MemoryDataSource>;
+
+		class TestContext {
+		public:
+			TestContext() : m_tree(m_dataSource) {
+				m_tree.set(0x64'6F'00'00, "verb");
+				m_tree.set(0x64'6F'67'00, "puppy");
+				m_tree.set(0x64'6F'67'65, "coin");
+				m_tree.set(0x68'6F'72'73, "stallion");
+			}
+
+		public:
+			Hash256 root() const {
+				return m_tree.root();
+			}
+
+			tree::PatriciaTreeBatchProof createProof(const std::vector<uint32_t>& keys) const {
+				// roundtrip proof through serializer to mirror client usage
+				tree::PatriciaTreeBatchProof proof;
+				m_tree.lookup(keys, proof);
+
+				auto serializedProof = tree::PatriciaTreeBatchProofSerializer::Serialize(proof);
+				auto buffer = std::vector<uint8_t>(serializedProof.cbegin(), serializedProof.cend());
+				return tree::PatriciaTreeBatchProofSerializer::Deserialize(buffer);
+			}
+
+		private:
+			tree::MemoryDataSource m_dataSource;
+			MemoryPatriciaTree m_tree;
+		};
+
+		std::vector<tree::TreeNodePath> ToKeyPaths(const std::vector<uint32_t>& keys) {
+			std::vector<tree::TreeNodePath> keyPaths;
+			for (auto key : keys)
+				keyPaths.push_back(tree::TreeNodePath(key));
+
+			return keyPaths;
+		}
+
+		void AssertResults(
+				const std::vector<VerifyStateProofResult>& expectedResults,
+				const std::vector<StateProofVerificationResult>& results) {
+			ASSERT_EQ(expectedResults.size(), results.size());
+			for (auto i = 0u; i < expectedResults.size(); ++i)
+				EXPECT_EQ(expectedResults[i], results[i].Result) << "result at " << i;
+		}
+	}
+
+	// region valid proofs
+
+	TEST(TEST_CLASS, CanVerifyProofOfExistingKeys) {
+		// Arrange:
+		TestContext context;
+		std::vector<uint32_t> keys{ 0x64'6F'00'00, 0x64'6F'67'00, 0x64'6F'67'65, 0x68'6F'72'73 };
+		auto proof = context.createProof(keys);
+
+		// Act:
+		auto results = VerifyBatchStateProof(proof, ToKeyPaths(keys), context.root());
+
+		// Assert:
+		AssertResults(std::vector<VerifyStateProofResult>(4, VerifyStateProofResult::Exists), results);
+		EXPECT_EQ(test::PassThroughEncoder::EncodeValue("verb"), results[0].Value);
+		EXPECT_EQ(test::PassThroughEncoder::EncodeValue("puppy"), results[1].Value);
+		EXPECT_EQ(test::PassThroughEncoder::EncodeValue("coin"), results[2].Value);
+		EXPECT_EQ(test::PassThroughEncoder::EncodeValue("stallion"), results[3].Value);
+	}
+
+	TEST(TEST_CLASS, CanVerifyProofOfMissingKeys) {
+		// Arrange: diverging in root path, missing root link, missing branch link, diverging in leaf path
+		TestContext context;
+		std::vector<uint32_t> keys{ 0x54'6F'67'00, 0x65'6F'67'00, 0x64'6F'77'65, 0x64'6F'67'66 };
+		auto proof = context.createProof(keys);
+
+		// Act:
+		auto results = VerifyBatchStateProof(proof, ToKeyPaths(keys), context.root());
+
+		// Assert:
+		AssertResults(std::vector<VerifyStateProofResult>(4, VerifyStateProofResult::Does_Not_Exist), results);
+		for (const auto& result : results)
+			EXPECT_EQ(Hash256(), result.Value);
+	}
+
+	TEST(TEST_CLASS, CanVerifyProofOfMixedKeys) {
+		// Arrange:
+		TestContext context;
+		std::vector<uint32_t> keys{ 0x64'6F'67'65, 0x64'6F'67'44, 0x68'6F'72'73 };
+		auto proof = context.createProof(keys);
+
+		// Act:
+		auto results = VerifyBatchStateProof(proof, ToKeyPaths(keys), context.root());
+
+		// Assert:
+		AssertResults({ VerifyStateProofResult::Exists, VerifyStateProofResult::Does_Not_Exist, VerifyStateProofResult::Exists }, results);
+	}
+
+	TEST(TEST_CLASS, CanVerifyProofOfMissingKeyInEmptyTree) {
+		// Arrange:
+		tree::MemoryDataSource dataSource;
+		MemoryPatriciaTree tree(dataSource);
+
+		tree::PatriciaTreeBatchProof proof;
+		tree.lookup(std::vector<uint32_t>{ 0x64'6F'67'65 }, proof);
+
+		// Act:
+		auto results = VerifyBatchStateProof(proof, ToKeyPaths({ 0x64'6F'67'65 }), Hash256());
+
+		// Assert:
+		AssertResults({ VerifyStateProofResult::Does_Not_Exist }, results);
+	}
+
+	// endregion
+
+	// region invalid proofs
+
+	TEST(TEST_CLASS, CannotVerifyProofWithDifferentStateRoot) {
+		// Arrange:
+		TestContext context;
+		std::vector<uint32_t> keys{ 0x64'6F'67'65, 0x64'6F'67'44 };
+		auto proof = context.createProof(keys);
+
+		// Act:
+		auto results = VerifyBatchStateProof(proof, ToKeyPaths(keys), test::GenerateRandomByteArray<Hash256>());
+
+		// Assert:
+		AssertResults(std::vector<VerifyStateProofResult>(2, VerifyStateProofResult::Invalid_Root), results);
+	}
+
+	TEST(TEST_CLASS, CannotVerifyEmptyProofWithNonzeroStateRoot) {
+		// Arrange:
+		TestContext context;
+		tree::PatriciaTreeBatchProof proof;
+		proof.NodeIndexPaths.resize(1);
+
+		// Act:
+		auto results = VerifyBatchStateProof(proof, ToKeyPaths({ 0x64'6F'67'65 }), context.root());
+
+		// Assert:
+		AssertResults({ VerifyStateProofResult::Invalid_Root }, results);
+	}
+
+	TEST(TEST_CLASS, CannotVerifyProofWithTamperedLeaf) {
+		// Arrange: replace the leaf with one associated with a different value
+		TestContext context;
+		std::vector<uint32_t> keys{ 0x64'6F'67'65 };
+		auto proof = context.createProof(keys);
+
+		auto& leafNode = proof.Nodes[proof.NodeIndexPaths[0].back()];
+		leafNode = tree::TreeNode(tree::LeafTreeNode(leafNode.path(), test::GenerateRandomByteArray<Hash256>()));
+
+		// Act:
+		auto results = VerifyBatchStateProof(proof, ToKeyPaths(keys), context.root());
+
+		// Assert:
+		AssertResults({ VerifyStateProofResult::Invalid_Path }, results);
+	}
+
+	TEST(TEST_CLASS, CannotVerifyTruncatedProof) {
+		// Arrange: drop the leaf, so that the path ends at a branch with a link to the key
+		TestContext context;
+		std::vector<uint32_t> keys{ 0x64'6F'67'65 };
+		auto proof = context.createProof(keys);
+		proof.NodeIndexPaths[0].pop_back();
+
+		// Act:
+		auto results = VerifyBatchStateProof(proof, ToKeyPaths(keys), context.root());
+
+		// Assert:
+		AssertResults({ VerifyStateProofResult::Invalid_Path }, results);
+	}
+
+	TEST(TEST_CLASS, CannotVerifyProofWithLeafBeforeEndOfPath) {
+		// Arrange: append the root to a complete path
+		TestContext context;
+		std::vector<uint32_t> keys{ 0x64'6F'67'65 };
+		auto proof = context.createProof(keys);
+		proof.NodeIndexPaths[0].push_back(proof.NodeIndexPaths[0][0]);
+
+		// Act:
+		auto results = VerifyBatchStateProof(proof, ToKeyPaths(keys), context.root());
+
+		// Assert:
+		AssertResults({ VerifyStateProofResult::Invalid_Path }, results);
+	}
+
+	TEST(TEST_CLASS, CannotVerifyProofWithOutOfRangeNodeIndex) {
+		// Arrange:
+		TestContext context;
+		std::vector<uint32_t> keys{ 0x64'6F'67'65, 0x68'6F'72'73 };
+		auto proof = context.createProof(keys);
+		proof.NodeIndexPaths[0].back() = static_cast<uint32_t>(proof.Nodes.size());
+
+		// Act:
+		auto results = VerifyBatchStateProof(proof, ToKeyPaths(keys), context.root());
+
+		// Assert: only the proof with the bad index is rejected
+		AssertResults({ VerifyStateProofResult::Invalid_Path, VerifyStateProofResult::Exists }, results);
+	}
+
+	TEST(TEST_CLASS, CannotVerifyProofWithMismatchedKeyCount) {
+		// Arrange:
+		TestContext context;
+		auto proof = context.createProof({ 0x64'6F'67'65, 0x68'6F'72'73 });
+
+		// Act + Assert:
+		EXPECT_THROW(VerifyBatchStateProof(proof, ToKeyPaths({ 0x64'6F'67'65 }), context.root()), catapult_invalid_argument);
+	}
+
+	// endregion
+}}
@@ -22,8 +22,19 @@
 #pragma once
 #include "catapult/config/NodeConfiguration.h"
 #include "catapult/utils/FileSize.h"
+#include <memory>
 #include <string>
 
+namespace catapult {
+	namespace cache {
+		class PatriciaTreeNodeCache;
+		class RocksBackgroundWriter;
+		class RocksBlockCache;
+		class RocksSharedDatabase;
+	}
+	namespace thread { class IoThreadPool; }
+}
+
 namespace catapult { namespace cache {
 
 	/// Possible patricia tree storage modes.
@@ -42,6 +53,7 @@ namespace catapult { namespace cache {
 		CacheConfiguration()
 				: ShouldUseCacheDatabase(false)
 				, ShouldStorePatriciaTrees(false)
+				, pStateHashPool(nullptr)
 		{}
 
 		/// Creates a cache configuration around \a databaseDirectory and specified patricia tree storage \a mode.
@@ -58,6 +70,7 @@ namespace catapult { namespace cache {
 				, CacheDatabaseDirectory(databaseDirectory)
 				, CacheDatabaseConfig(databaseConfig)
 				, ShouldStorePatriciaTrees(PatriciaTreeStorageMode::Enabled == mode)
+				, pStateHashPool(nullptr)
 		{}
 
 	public:
@@ -72,5 +85,20 @@ namespace catapult { namespace cache {
 
 		/// \c true if patricia trees should be stored, \c false otherwise.
 		bool ShouldStorePatriciaTrees;
+
+		/// Block cache shared by all cache databases (optional).
+		std::shared_ptr<RocksBlockCache> pSharedBlockCache;
+
+		/// Database shared by all cache databases (optional).
+		std::shared_ptr<RocksSharedDatabase> pSharedDatabase;
+
+		/// Background writer used by all cache databases for writing committed changes (optional).
+		std::shared_ptr<RocksBackgroundWriter> pBackgroundWriter;
+
+		/// Node cache shared by all patricia trees (optional).
+		std::shared_ptr<PatriciaTreeNodeCache> pTreeNodeCache;
+
+		/// Thread pool used by all patricia trees for hashing independent changed subtrees in parallel (optional).
+		thread::IoThreadPool* pStateHashPool;
 	};
 }}
@@ -21,6 +21,7 @@
 
 #pragma once
 #include "CacheConfiguration.h"
+#include "ParallelPatriciaTreeHasher.h"
 #include "catapult/cache_db/CacheDatabase.h"
 #include "catapult/cache_db/UpdateSet.h"
 #include "catapult/deltaset/ConditionalContainer.h"
@@ -36,14 +37,14 @@ namespace catapult { namespace cache {
 				const std::vector<std::string>& columnFamilyNames,
 				FilterPruningMode pruningMode = FilterPruningMode::Disabled)
 				: m_pDatabase(config.ShouldUseCacheDatabase
-						? std::make_unique<CacheDatabase>(CacheDatabaseSettings(
-								config.CacheDatabaseDirectory,
-								config.CacheDatabaseConfig,
-								GetAdjustedColumnFamilyNames(config, columnFamilyNames),
-								pruningMode))
+						? std::make_unique<CacheDatabase>(CreateCacheDatabaseSettings(config, columnFamilyNames, pruningMode))
 						: std::make_unique<CacheDatabase>())
 				, m_containerMode(GetContainerMode(config))
 				, m_hasPatriciaTreeSupport(config.ShouldStorePatriciaTrees)
+				, m_patriciaTreeHasher(config.pStateHashPool
+						? CreateParallelPatriciaTreeHasher(*config.pStateHashPool)
+						: tree::TreeNodesHasher())
+				, m_pTreeNodeCache(config.pTreeNodeCache)
 		{}
 
 	protected:
@@ -52,6 +53,16 @@ namespace catapult { namespace cache {
 			return m_hasPatriciaTreeSupport;
 		}
 
+		/// Gets the hasher that should be used by patricia trees to hash independent changed subtrees.
+		const tree::TreeNodesHasher& patriciaTreeHasher() const {
+			return m_patriciaTreeHasher;
+		}
+
+		/// Gets the node cache that should be used by patricia trees (optional).
+		PatriciaTreeNodeCache* patriciaTreeNodeCache() const {
+			return m_pTreeNodeCache.get();
+		}
+
 		/// Gets the database.
 		CacheDatabase& database() {
 			return *m_pDatabase;
@@ -72,6 +83,28 @@ namespace catapult { namespace cache {
 		}
 
 	private:
+		static CacheDatabaseSettings CreateCacheDatabaseSettings(
+				const CacheConfiguration& config,
+				const std::vector<std::string>& columnFamilyNames,
+				FilterPruningMode pruningMode) {
+			auto adjustedColumnFamilyNames = GetAdjustedColumnFamilyNames(config, columnFamilyNames);
+			if (config.pSharedDatabase) {
+				return CacheDatabaseSettings(
+						config.CacheDatabaseDirectory,
+						adjustedColumnFamilyNames,
+						pruningMode,
+						config.pSharedDatabase);
+			}
+
+			return CacheDatabaseSettings(
+					config.CacheDatabaseDirectory,
+					config.CacheDatabaseConfig,
+					adjustedColumnFamilyNames,
+					pruningMode,
+					config.pSharedBlockCache,
+					config.pBackgroundWriter);
+		}
+
 		static std::vector<std::string> GetAdjustedColumnFamilyNames(
 				const CacheConfiguration& config,
 				const std::vector<std::string>& columnFamilyNames) {
@@ -86,5 +119,7 @@ namespace catapult { namespace cache {
 		std::unique_ptr<CacheDatabase> m_pDatabase;
 		const deltaset::ConditionalContainerMode m_containerMode;
 		const bool m_hasPatriciaTreeSupport;
+		const tree::TreeNodesHasher m_patriciaTreeHasher;
+		std::shared_ptr<PatriciaTreeNodeCache> m_pTreeNodeCache;
 	};
 }}
@@ -21,7 +21,9 @@
 
 #pragma once
 #include "catapult/cache_db/CacheDatabase.h"
+#include "catapult/cache_db/PatriciaTreeNodeCache.h"
 #include "catapult/cache_db/PatriciaTreeRdbDataSource.h"
+#include "catapult/tree/PatriciaTree.h"
 #include <memory>
 
 namespace catapult { namespace cache {
@@ -32,7 +34,24 @@ namespace catapult { namespace cache {
 	public:
 		/// Creates a tree around \a database and \a columnId if \a enable is \c true.
 		CachePatriciaTree(bool enable, CacheDatabase& database, size_t columnId)
-				: m_pImpl(enable ? std::make_unique<Impl>(database, columnId) : nullptr)
+				: CachePatriciaTree(enable, database, columnId, tree::TreeNodesHasher())
+		{}
+
+		/// Creates a tree around \a database and \a columnId if \a enable is \c true
+		/// that uses \a hasher to hash independent changed subtrees.
+		CachePatriciaTree(bool enable, CacheDatabase& database, size_t columnId, const tree::TreeNodesHasher& hasher)
+				: CachePatriciaTree(enable, database, columnId, hasher, nullptr)
+		{}
+
+		/// Creates a tree around \a database and \a columnId if \a enable is \c true
+		/// that uses \a hasher to hash independent changed subtrees and caches decoded nodes in \a pNodeCache (optional).
+		CachePatriciaTree(
+				bool enable,
+				CacheDatabase& database,
+				size_t columnId,
+				const tree::TreeNodesHasher& hasher,
+				PatriciaTreeNodeCache* pNodeCache)
+				: m_pImpl(enable ? std::make_unique<Impl>(database, columnId, hasher, pNodeCache) : nullptr)
 		{}
 
 	public:
@@ -62,10 +81,10 @@ namespace catapult { namespace cache {
 	private:
 		class Impl {
 		public:
-			Impl(CacheDatabase& database, size_t columnId)
+			Impl(CacheDatabase& database, size_t columnId, const tree::TreeNodesHasher& hasher, PatriciaTreeNodeCache* pNodeCache)
 					: m_container(database, columnId)
-					, m_dataSource(m_container)
-					, m_pTree(std::make_unique<TTree>(m_dataSource)) {
+					, m_dataSource(m_container, pNodeCache)
+					, m_pTree(std::make_unique<TTree>(m_dataSource, hasher)) {
 				Hash256 rootHash;
 				if (!m_container.prop("root", rootHash))
 					return;
@@ -73,7 +92,8 @@ namespace catapult { namespace cache {
 				if (Hash256() == rootHash)
 					return;
 
-				m_pTree = std::make_unique<TTree>(m_dataSource, rootHash);
+				m_pTree = std::make_unique<TTree>(m_dataSource, rootHash, hasher);
+				m_dataSource.pinTopLevels(rootHash);
 			}
 
 		public:
@@ -95,6 +115,7 @@ namespace catapult { namespace cache {
 					return;
 
 				m_container.setProp("root", m_pTree->root());
+				m_dataSource.pinTopLevels(m_pTree->root());
 			}
 
 		private:
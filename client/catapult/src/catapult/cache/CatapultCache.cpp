@@ -24,6 +24,8 @@
 #include "CatapultCacheDetachedDelta.h"
 #include "ReadOnlyCatapultCache.h"
 #include "SubCachePluginAdapter.h"
+#include "catapult/cache_db/RocksBackgroundWriter.h"
+#include "catapult/cache_db/RocksDatabase.h"
 #include "catapult/crypto/Hashes.h"
 #include "catapult/model/BlockchainConfiguration.h"
 #include "catapult/model/NetworkIdentifier.h"
@@ -197,6 +199,32 @@ namespace catapult { namespace cache {
 		}
 	}
 
+	void CatapultCacheDelta::prefetch(const StatePrefetchKeys& keys) {
+		for (const auto& pSubView : m_subViews) {
+			if (!pSubView)
+				continue;
+
+			pSubView->prefetch(keys);
+		}
+	}
+
+	StatePrefetchLoader CatapultCacheDelta::createPrefetchLoader() const {
+		std::vector<StatePrefetchLoader> subLoaders;
+		for (const auto& pSubView : m_subViews) {
+			if (!pSubView)
+				continue;
+
+			auto subLoader = pSubView->createPrefetchLoader();
+			if (subLoader)
+				subLoaders.push_back(std::move(subLoader));
+		}
+
+		return [subLoaders](const auto& keys) {
+			for (const auto& subLoader : subLoaders)
+				subLoader(keys);
+		};
+	}
+
 	ReadOnlyCatapultCache CatapultCacheDelta::toReadOnly() const {
 		return ReadOnlyCatapultCache(*m_pDependentState, ExtractReadOnlyViews(m_subViews));
 	}
@@ -282,10 +310,19 @@ namespace catapult { namespace cache {
 	}
 
 	CatapultCache::CatapultCache(std::vector<std::unique_ptr<SubCachePlugin>>&& subCaches)
+			: CatapultCache(std::move(subCaches), nullptr, nullptr)
+	{}
+
+	CatapultCache::CatapultCache(
+			std::vector<std::unique_ptr<SubCachePlugin>>&& subCaches,
+			const std::shared_ptr<RocksSharedDatabase>& pSharedDatabase,
+			const std::shared_ptr<RocksBackgroundWriter>& pBackgroundWriter)
 			: m_pCacheHeight(std::make_unique<CacheHeight>())
 			, m_pDependentState(std::make_unique<state::CatapultState>())
 			, m_pDependentStateDelta(std::make_unique<state::CatapultState>())
 			, m_subCaches(std::move(subCaches))
+			, m_pSharedDatabase(pSharedDatabase)
+			, m_pBackgroundWriter(pBackgroundWriter)
 	{}
 
 	CatapultCache::~CatapultCache() = default;
@@ -324,16 +361,36 @@ namespace catapult { namespace cache {
 		// use the height writer lock to lock the entire cache during commit
 		auto cacheHeightModifier = m_pCacheHeight->modifier();
 
+		// when sub caches share a database, defer all writes so that they are stored in a single atomic batch
+		RocksSharedDatabaseCommitGuard sharedDatabaseCommitGuard(m_pSharedDatabase.get());
+
 		for (const auto& pSubCache : m_subCaches) {
 			if (pSubCache)
 				pSubCache->commit();
 		}
 
+		sharedDatabaseCommitGuard.commit();
+
 		// finally, update the dependent state and cache height
 		m_pDependentState = std::make_unique<state::CatapultState>(*m_pDependentStateDelta);
 		cacheHeightModifier.set(height);
 	}
 
+	void CatapultCache::waitForPendingWrites() const {
+		if (m_pBackgroundWriter)
+			m_pBackgroundWriter->drain();
+	}
+
+	void CatapultCache::onPendingWritesComplete(const action& handler) const {
+		if (!m_pBackgroundWriter) {
+			handler();
+			return;
+		}
+
+		// background writer executes operations in order, so handler is executed after all previously queued writes
+		m_pBackgroundWriter->post(handler);
+	}
+
 	std::vector<std::unique_ptr<const CacheStorage>> CatapultCache::storages() const {
 		return MapSubCaches<const CacheStorage>(
 				m_subCaches,
@@ -24,12 +24,15 @@
 #include "CatapultCacheDetachableDelta.h"
 #include "CatapultCacheView.h"
 #include "SubCachePlugin.h"
+#include "catapult/functions.h"
 
 namespace catapult {
 	namespace cache {
 		class CacheChangesStorage;
 		class CacheHeight;
 		class CacheStorage;
+		class RocksBackgroundWriter;
+		class RocksSharedDatabase;
 		class SubCachePlugin;
 	}
 	namespace model { struct BlockchainConfiguration; }
@@ -43,6 +46,14 @@ namespace catapult { namespace cache {
 		/// Creates a catapult cache around \a subCaches.
 		explicit CatapultCache(std::vector<std::unique_ptr<SubCachePlugin>>&& subCaches);
 
+		/// Creates a catapult cache around \a subCaches with optional shared database (\a pSharedDatabase)
+		/// and optional background writer (\a pBackgroundWriter).
+		/// \note All sub cache changes are written to \a pSharedDatabase atomically during commit.
+		CatapultCache(
+				std::vector<std::unique_ptr<SubCachePlugin>>&& subCaches,
+				const std::shared_ptr<RocksSharedDatabase>& pSharedDatabase,
+				const std::shared_ptr<RocksBackgroundWriter>& pBackgroundWriter);
+
 		/// Destroys the cache.
 		~CatapultCache();
 
@@ -71,8 +82,16 @@ namespace catapult { namespace cache {
 		CatapultCacheDetachableDelta createDetachableDelta() const;
 
 		/// Commits all pending changes to the underlying storage and sets the cache height to \a height.
+		/// \note When a background writer is used, committed changes are visible immediately but written asynchronously.
 		void commit(Height height);
 
+		/// Waits until all committed changes have been written to the underlying storage.
+		void waitForPendingWrites() const;
+
+		/// Invokes \a handler after all changes committed so far have been written to the underlying storage.
+		/// \note When a background writer is used, \a handler is invoked on the background writer thread.
+		void onPendingWritesComplete(const action& handler) const;
+
 	public:
 		/// Gets the (const) cache storages for all sub caches.
 		std::vector<std::unique_ptr<const CacheStorage>> storages() const;
@@ -88,5 +107,7 @@ namespace catapult { namespace cache {
 		std::unique_ptr<state::CatapultState> m_pDependentState; // use a unique_ptr to allow fwd declare
 		std::unique_ptr<state::CatapultState> m_pDependentStateDelta; // backing for (single) outstanding delta
 		std::vector<std::unique_ptr<SubCachePlugin>> m_subCaches;
+		std::shared_ptr<RocksSharedDatabase> m_pSharedDatabase;
+		std::shared_ptr<RocksBackgroundWriter> m_pBackgroundWriter;
 	};
 }}
@@ -52,6 +52,17 @@ namespace catapult { namespace cache {
 			return CatapultCache(std::move(m_subCaches));
 		}
 
+		/// Builds a catapult cache with optional shared database (\a pSharedDatabase) and optional background writer
+		/// (\a pBackgroundWriter).
+		CatapultCache build(
+				const std::shared_ptr<RocksSharedDatabase>& pSharedDatabase,
+				const std::shared_ptr<RocksBackgroundWriter>& pBackgroundWriter) {
+			CATAPULT_LOG(debug)
+					<< "creating CatapultCache with " << m_subCaches.size() << " sub caches"
+					<< " (shared database " << !!pSharedDatabase << ", background writer " << !!pBackgroundWriter << ")";
+			return CatapultCache(std::move(m_subCaches), pSharedDatabase, pBackgroundWriter);
+		}
+
 	private:
 		std::vector<std::unique_ptr<SubCachePlugin>> m_subCaches;
 	};
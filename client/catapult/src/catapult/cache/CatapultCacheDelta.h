@@ -93,6 +93,14 @@ namespace catapult { namespace cache {
 		/// Prunes the cache at \a time.
 		void prune(Timestamp time);
 
+		/// Prefetches all state identified by \a keys into all sub caches that support prefetching.
+		void prefetch(const StatePrefetchKeys& keys);
+
+		/// Creates a loader of state from storage for all sub caches that support prefetching.
+		/// \note The loader does not modify this delta and can be called after it has been destroyed,
+		///       but it must not be called after the underlying cache has been destroyed.
+		StatePrefetchLoader createPrefetchLoader() const;
+
 	public:
 		/// Creates a read-only view of this delta.
 		ReadOnlyCatapultCache toReadOnly() const;
@@ -0,0 +1,45 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "ParallelPatriciaTreeHasher.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "catapult/thread/ParallelFor.h"
+
+namespace catapult { namespace cache {
+
+	tree::TreeNodesHasher CreateParallelPatriciaTreeHasher(thread::IoThreadPool& pool) {
+		return [&pool](auto& nodes) {
+			auto numPartitions = std::min<size_t>(pool.numWorkerThreads(), nodes.size());
+			if (numPartitions <= 1) {
+				for (const auto& node : nodes)
+					node.hash();
+
+				return;
+			}
+
+			// node hashes are cached, so they are not recalculated when the nodes are subsequently linked
+			thread::ParallelFor(pool.ioContext(), nodes, numPartitions, [](const auto& node, auto) {
+				node.hash();
+				return true;
+			}).get();
+		};
+	}
+}}
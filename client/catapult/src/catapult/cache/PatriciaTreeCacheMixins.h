@@ -54,6 +54,19 @@ namespace catapult { namespace cache {
 					: std::make_pair(Hash256(), false);
 		}
 
+		/// Tries to find the values associated with \a keys in the tree and stores deduplicated proofs of existence or not in \a proof.
+		std::vector<std::pair<Hash256, bool>> tryLookup(
+				const std::vector<typename TTree::KeyType>& keys,
+				tree::PatriciaTreeBatchProof& proof) const {
+			if (m_pTree)
+				return m_pTree->lookup(keys, proof);
+
+			proof.Nodes.clear();
+			proof.NodeIndexPaths.clear();
+			proof.NodeIndexPaths.resize(keys.size());
+			return std::vector<std::pair<Hash256, bool>>(keys.size(), std::make_pair(Hash256(), false));
+		}
+
 	private:
 		const TTree* m_pTree;
 	};
@@ -69,6 +69,7 @@ namespace catapult { namespace cache {
 
 	/// Applies all changes in \a set to \a tree for all generations starting at \a minGenerationId through the current generation
 	/// given the current chain \a height.
+	/// \note All modified values are set in a single batch so that every changed tree node is only built and hashed once.
 	template<typename TTree, typename TSet>
 	void ApplyDeltasToTree(TTree& tree, const TSet& set, uint32_t minGenerationId, Height height) {
 		auto needsApplication = [&set, minGenerationId, maxGenerationId = set.generationId()](const auto& key) {
@@ -76,23 +77,29 @@ namespace catapult { namespace cache {
 			return minGenerationId <= generationId && generationId <= maxGenerationId;
 		};
 
-		auto handleModification = [&tree, height](const auto& pair) {
+		auto deltas = set.deltas();
+		auto isRemoved = [&removed = deltas.Removed](const auto& key) {
+			return removed.cend() != removed.find(key);
+		};
+
+		// only the last change to each key (added < copied < removed) is applied, so removals and modifications can be reordered
+		std::vector<typename TTree::EncodedPair> encodedPairs;
+		auto handleModification = [&tree, height, &encodedPairs](const auto& pair) {
 			if (detail::IsActiveAdapter::IsActive(pair.second, height))
-				tree.set(pair.first, pair.second);
+				encodedPairs.push_back(TTree::Encode(pair.first, pair.second));
 			else
 				tree.unset(pair.first);
 		};
 
-		auto deltas = set.deltas();
 		for (const auto& pair : deltas.Added) {
-			if (needsApplication(pair.first)) {
+			if (needsApplication(pair.first) && deltas.Copied.cend() == deltas.Copied.find(pair.first) && !isRemoved(pair.first)) {
 				// a value can be added and deactivated during the processing of a single chain part
 				handleModification(pair);
 			}
 		}
 
 		for (const auto& pair : deltas.Copied) {
-			if (needsApplication(pair.first))
+			if (needsApplication(pair.first) && !isRemoved(pair.first))
 				handleModification(pair);
 		}
 
@@ -100,5 +107,7 @@ namespace catapult { namespace cache {
 			if (needsApplication(pair.first))
 				tree.unset(pair.first);
 		}
+
+		tree.setBatch(std::move(encodedPairs));
 	}
 }}
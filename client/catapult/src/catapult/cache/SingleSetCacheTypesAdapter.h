@@ -102,7 +102,7 @@ namespace catapult { namespace cache {
 			explicit BaseSets(const CacheConfiguration& config)
 					: CacheDatabaseMixin(config, { "default" })
 					, Primary(GetContainerMode(config), database(), 0)
-					, PatriciaTree(hasPatriciaTreeSupport(), database(), 1)
+					, PatriciaTree(hasPatriciaTreeSupport(), database(), 1, patriciaTreeHasher(), patriciaTreeNodeCache())
 			{}
 
 		public:
@@ -0,0 +1,41 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/functions.h"
+#include "catapult/types.h"
+#include <vector>
+
+namespace catapult { namespace cache {
+
+	/// Keys of state that is expected to be accessed, grouped by key type.
+	/// \note Keys are resolved and each sub cache picks the keys it is able to prefetch.
+	struct StatePrefetchKeys {
+		/// Account addresses.
+		std::vector<Address> Addresses;
+
+		/// Mosaic ids.
+		std::vector<MosaicId> MosaicIds;
+	};
+
+	/// Loads all state identified by keys from storage without modifying any cache.
+	using StatePrefetchLoader = consumer<const StatePrefetchKeys&>;
+}}
@@ -20,6 +20,7 @@
 **/
 
 #pragma once
+#include "StatePrefetchKeys.h"
 #include "catapult/plugins.h"
 #include "catapult/types.h"
 #include <memory>
@@ -99,6 +100,13 @@ namespace catapult { namespace cache {
 		/// Prunes the cache at \a time.
 		virtual void prune(Timestamp time) = 0;
 
+		/// Prefetches all state identified by \a keys if supported.
+		virtual void prefetch(const StatePrefetchKeys& keys) = 0;
+
+		/// Creates a loader of state from storage that does not depend on the lock of this view if supported.
+		/// \note Returns an empty loader if prefetching is not supported.
+		virtual StatePrefetchLoader createPrefetchLoader() const = 0;
+
 		/// Gets a read-only view of this view.
 		virtual const void* asReadOnly() const = 0;
 	};
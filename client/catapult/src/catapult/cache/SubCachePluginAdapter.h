@@ -138,6 +138,12 @@ namespace catapult { namespace cache {
 				return PruneMutator<TPruneValue, UnderlyingViewType>();
 			}
 
+			auto prefetchMutator() const {
+				// need to dereference to get underlying view type from LockedCacheView
+				using UnderlyingViewType = std::remove_reference_t<decltype(*m_view)>;
+				return PrefetchMutator<UnderlyingViewType>();
+			}
+
 		public:
 			const SubCacheViewIdentifier& id() const override {
 				return m_id;
@@ -175,6 +181,14 @@ namespace catapult { namespace cache {
 				Prune(m_view, time, pruneMutator<Timestamp>());
 			}
 
+			void prefetch(const StatePrefetchKeys& keys) override {
+				Prefetch(m_view, keys, prefetchMutator());
+			}
+
+			StatePrefetchLoader createPrefetchLoader() const override {
+				return CreatePrefetchLoader(m_view, prefetchMutator());
+			}
+
 			const void* asReadOnly() const override {
 				return &m_view->asReadOnly();
 			}
@@ -215,6 +229,16 @@ namespace catapult { namespace cache {
 					: public SupportedFeatureFlag
 			{};
 
+			template<typename T, typename = void>
+			struct PrefetchMutator : public UnsupportedFeatureFlag {};
+
+			template<typename T>
+			struct PrefetchMutator<
+					T,
+					utils::traits::is_type_expression_t<decltype(reinterpret_cast<T*>(1)->prefetch(StatePrefetchKeys()))>>
+					: public SupportedFeatureFlag
+			{};
+
 			static bool SupportsMerkleRoot(const TView&, UnsupportedFeatureFlag) {
 				return false;
 			}
@@ -261,6 +285,21 @@ namespace catapult { namespace cache {
 				view->prune(value);
 			}
 
+			static void Prefetch(TView&, const StatePrefetchKeys&, UnsupportedFeatureFlag)
+			{}
+
+			static void Prefetch(TView& view, const StatePrefetchKeys& keys, SupportedFeatureFlag) {
+				view->prefetch(keys);
+			}
+
+			static StatePrefetchLoader CreatePrefetchLoader(const TView&, UnsupportedFeatureFlag) {
+				return StatePrefetchLoader();
+			}
+
+			static StatePrefetchLoader CreatePrefetchLoader(const TView& view, SupportedFeatureFlag) {
+				return view->createPrefetchLoader();
+			}
+
 		private:
 			TView m_view;
 			SubCacheViewIdentifier m_id;
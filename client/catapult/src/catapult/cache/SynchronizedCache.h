@@ -21,7 +21,7 @@
 
 #pragma once
 #include "catapult/utils/NonCopyable.h"
-#include "catapult/utils/SpinReaderWriterLock.h"
+#include "catapult/utils/StripedReaderWriterLock.h"
 #include <boost/optional.hpp>
 
 namespace catapult { namespace cache {
@@ -35,7 +35,7 @@ namespace catapult { namespace cache {
 		struct CacheViewReadLockPair {
 		public:
 			/// Creates a pair around \a cacheView and \a readLock.
-			CacheViewReadLockPair(TCacheView&& cacheView, utils::SpinReaderWriterLock::ReaderLockGuard&& readLock)
+			CacheViewReadLockPair(TCacheView&& cacheView, utils::StripedReaderWriterLock::ReaderLockGuard&& readLock)
 					: CacheView(std::move(cacheView))
 					, ReadLock(std::move(readLock))
 			{}
@@ -45,7 +45,7 @@ namespace catapult { namespace cache {
 			TCacheView CacheView;
 
 			/// Read lock.
-			utils::SpinReaderWriterLock::ReaderLockGuard ReadLock;
+			utils::StripedReaderWriterLock::ReaderLockGuard ReadLock;
 		};
 
 		// endregion
@@ -102,7 +102,7 @@ namespace catapult { namespace cache {
 	class LockedCacheView : public detail::CacheViewAccessor<TCacheView> {
 	public:
 		/// Creates a view around \a cacheView and \a readLock.
-		LockedCacheView(TCacheView&& cacheView, utils::SpinReaderWriterLock::ReaderLockGuard&& readLock)
+		LockedCacheView(TCacheView&& cacheView, utils::StripedReaderWriterLock::ReaderLockGuard&& readLock)
 				: detail::CacheViewAccessor<TCacheView>(&m_cacheView)
 				, m_cacheView(std::move(cacheView))
 				, m_readLock(std::move(readLock))
@@ -118,7 +118,7 @@ namespace catapult { namespace cache {
 
 	private:
 		TCacheView m_cacheView;
-		utils::SpinReaderWriterLock::ReaderLockGuard m_readLock;
+		utils::StripedReaderWriterLock::ReaderLockGuard m_readLock;
 	};
 
 	// endregion
@@ -152,13 +152,13 @@ namespace catapult { namespace cache {
 		{}
 
 		/// Creates a view around \a cacheView and \a pReadLock.
-		OptionalLockedCacheDelta(TCacheView& cacheView, utils::SpinReaderWriterLock::ReaderLockGuard&& readLock)
+		OptionalLockedCacheDelta(TCacheView& cacheView, utils::StripedReaderWriterLock::ReaderLockGuard&& readLock)
 				: detail::CacheViewAccessor<TCacheView>(&cacheView)
 				, m_readLock(std::move(readLock))
 		{}
 
 	private:
-		boost::optional<utils::SpinReaderWriterLock::ReaderLockGuard> m_readLock;
+		boost::optional<utils::StripedReaderWriterLock::ReaderLockGuard> m_readLock;
 	};
 
 	// endregion
@@ -170,7 +170,7 @@ namespace catapult { namespace cache {
 	public:
 		/// Creates a lockable cache delta around \a cacheDelta using the specified \a lock
 		/// and commit counter (\a commitCounter).
-		LockableCacheDelta(TCacheDelta&& cacheDelta, const size_t& commitCounter, utils::SpinReaderWriterLock& lock)
+		LockableCacheDelta(TCacheDelta&& cacheDelta, const size_t& commitCounter, utils::StripedReaderWriterLock& lock)
 				: m_cacheDelta(std::move(cacheDelta))
 				, m_initialCommitCount(commitCounter)
 				, m_commitCounter(commitCounter)
@@ -191,7 +191,7 @@ namespace catapult { namespace cache {
 		TCacheDelta m_cacheDelta;
 		size_t m_initialCommitCount;
 		const size_t& m_commitCounter;
-		utils::SpinReaderWriterLock& m_lock;
+		utils::StripedReaderWriterLock& m_lock;
 	};
 
 	// endregion
@@ -266,7 +266,7 @@ namespace catapult { namespace cache {
 		TCache m_cache;
 		size_t m_commitCounter;
 		std::weak_ptr<detail::CacheViewReadLockPair<CacheDeltaType>> m_pWeakDeltaPair;
-		mutable utils::SpinReaderWriterLock m_lock;
+		mutable utils::StripedReaderWriterLock m_lock;
 	};
 
 	// endregion
@@ -204,6 +204,16 @@ namespace catapult { namespace cache {
 		m_highValueAccountsUpdater.prune(model::CalculateGroupedHeight<Height>(height, m_options.VotingSetGrouping));
 	}
 
+	void BasicAccountStateCacheDelta::prefetch(const StatePrefetchKeys& keys) {
+		m_pStateByAddress->prefetch(keys.Addresses);
+	}
+
+	StatePrefetchLoader BasicAccountStateCacheDelta::createPrefetchLoader() const {
+		return [loader = m_pStateByAddress->createOriginalElementsLoader()](const auto& keys) {
+			loader(keys.Addresses);
+		};
+	}
+
 	Address BasicAccountStateCacheDelta::getAddress(const Key& publicKey) {
 		auto keyToAddressIter = m_pKeyToAddress->find(publicKey);
 		const auto* pPair = keyToAddressIter.get();
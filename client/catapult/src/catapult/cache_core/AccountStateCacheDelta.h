@@ -26,6 +26,7 @@
 #include "ReadOnlyAccountStateCache.h"
 #include "catapult/cache/CacheMixinAliases.h"
 #include "catapult/cache/ReadOnlyViewSupplier.h"
+#include "catapult/cache/StatePrefetchKeys.h"
 #include "catapult/model/ContainerTypes.h"
 
 namespace catapult { namespace cache {
@@ -165,6 +166,12 @@ namespace catapult { namespace cache {
 		/// Prunes the cache at \a height.
 		void prune(Height height);
 
+		/// Prefetches all accounts identified by addresses in \a keys.
+		void prefetch(const StatePrefetchKeys& keys);
+
+		/// Creates a loader of all accounts identified by addresses in its keys that does not modify this delta.
+		StatePrefetchLoader createPrefetchLoader() const;
+
 	private:
 		Address getAddress(const Key& publicKey);
 
@@ -0,0 +1,230 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "PatriciaTreeNodeCache.h"
+#include "catapult/utils/Hashers.h"
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+
+namespace catapult { namespace cache {
+
+	namespace {
+		constexpr size_t Num_Shards = 16;
+	}
+
+	// region Shard
+
+	class PatriciaTreeNodeCache::Shard {
+	private:
+		struct Entry {
+			tree::TreeNode Node;
+			uint32_t PinCount = 0;
+			bool IsReferenced = true;
+		};
+
+	public:
+		explicit Shard(size_t capacity) : m_capacity(capacity), m_hand(0) {
+			m_entries.reserve(m_capacity);
+		}
+
+	public:
+		size_t size() const {
+			std::lock_guard<std::mutex> guard(m_mutex);
+			return m_entries.size();
+		}
+
+		size_t numPinned() const {
+			std::lock_guard<std::mutex> guard(m_mutex);
+			return static_cast<size_t>(std::count_if(m_entries.cbegin(), m_entries.cend(), [](const auto& entry) {
+				return 0 != entry.PinCount;
+			}));
+		}
+
+	public:
+		tree::TreeNode find(const Hash256& hash) {
+			std::lock_guard<std::mutex> guard(m_mutex);
+			auto iter = m_indexes.find(hash);
+			if (m_indexes.cend() == iter)
+				return tree::TreeNode();
+
+			auto& entry = m_entries[iter->second];
+			entry.IsReferenced = true;
+			return entry.Node.copy();
+		}
+
+		void insert(tree::TreeNode&& node) {
+			std::lock_guard<std::mutex> guard(m_mutex);
+			auto iter = m_indexes.find(node.hash());
+			if (m_indexes.cend() != iter) {
+				m_entries[iter->second].IsReferenced = true;
+				return;
+			}
+
+			if (m_entries.size() < m_capacity) {
+				m_indexes.emplace(node.hash(), m_entries.size());
+				m_entries.push_back(Entry{ std::move(node) });
+				return;
+			}
+
+			size_t index;
+			if (!tryFindVictim(index))
+				return;
+
+			auto& entry = m_entries[index];
+			m_indexes.erase(entry.Node.hash());
+			m_indexes.emplace(node.hash(), index);
+			entry = Entry{ std::move(node) };
+		}
+
+		void pin(const Hash256& hash) {
+			std::lock_guard<std::mutex> guard(m_mutex);
+			auto iter = m_indexes.find(hash);
+			if (m_indexes.cend() != iter)
+				++m_entries[iter->second].PinCount;
+		}
+
+		void unpin(const Hash256& hash) {
+			std::lock_guard<std::mutex> guard(m_mutex);
+			auto iter = m_indexes.find(hash);
+			if (m_indexes.cend() == iter)
+				return;
+
+			auto& entry = m_entries[iter->second];
+			if (0 != entry.PinCount)
+				--entry.PinCount;
+		}
+
+	private:
+		bool tryFindVictim(size_t& index) {
+			// two sweeps are sufficient because the first sweep clears all reference bits
+			for (auto i = 0u; i < 2 * m_capacity; ++i) {
+				auto& entry = m_entries[m_hand];
+				auto currentIndex = m_hand;
+				m_hand = (m_hand + 1) % m_capacity;
+
+				if (0 != entry.PinCount)
+					continue;
+
+				if (entry.IsReferenced) {
+					entry.IsReferenced = false;
+					continue;
+				}
+
+				index = currentIndex;
+				return true;
+			}
+
+			// all nodes are pinned
+			return false;
+		}
+
+	private:
+		size_t m_capacity;
+		size_t m_hand;
+		std::vector<Entry> m_entries;
+		std::unordered_map<Hash256, size_t, utils::ArrayHasher<Hash256>> m_indexes;
+		mutable std::mutex m_mutex;
+	};
+
+	// endregion
+
+	// region PatriciaTreeNodeCache
+
+	PatriciaTreeNodeCache::PatriciaTreeNodeCache(size_t maxSize, size_t numPinnedLevels)
+			: m_maxSize(maxSize)
+			, m_numPinnedLevels(numPinnedLevels)
+			, m_numHits(0)
+			, m_numMisses(0) {
+		// distribute capacity so that the total capacity of all shards is exactly maxSize
+		for (auto i = 0u; i < Num_Shards; ++i)
+			m_shards.push_back(std::make_unique<Shard>(maxSize / Num_Shards + (i < maxSize % Num_Shards ? 1 : 0)));
+	}
+
+	PatriciaTreeNodeCache::~PatriciaTreeNodeCache() = default;
+
+	size_t PatriciaTreeNodeCache::maxSize() const {
+		return m_maxSize;
+	}
+
+	size_t PatriciaTreeNodeCache::numPinnedLevels() const {
+		return m_numPinnedLevels;
+	}
+
+	size_t PatriciaTreeNodeCache::size() const {
+		size_t size = 0;
+		for (const auto& pShard : m_shards)
+			size += pShard->size();
+
+		return size;
+	}
+
+	size_t PatriciaTreeNodeCache::numPinned() const {
+		size_t numPinned = 0;
+		for (const auto& pShard : m_shards)
+			numPinned += pShard->numPinned();
+
+		return numPinned;
+	}
+
+	uint64_t PatriciaTreeNodeCache::numHits() const {
+		return m_numHits;
+	}
+
+	uint64_t PatriciaTreeNodeCache::numMisses() const {
+		return m_numMisses;
+	}
+
+	tree::TreeNode PatriciaTreeNodeCache::find(const Hash256& hash) {
+		auto node = shard(hash).find(hash);
+		if (node.empty())
+			++m_numMisses;
+		else
+			++m_numHits;
+
+		return node;
+	}
+
+	void PatriciaTreeNodeCache::insert(const tree::TreeNode& node) {
+		if (!node.isBranch())
+			return;
+
+		// replace linked nodes with hashes so that cached nodes do not keep (potentially large) subtrees alive
+		auto branchNode = node.asBranchNode();
+		branchNode.compactLinks();
+		shard(node.hash()).insert(tree::TreeNode(branchNode));
+	}
+
+	void PatriciaTreeNodeCache::pin(const Hash256& hash) {
+		shard(hash).pin(hash);
+	}
+
+	void PatriciaTreeNodeCache::unpin(const Hash256& hash) {
+		shard(hash).unpin(hash);
+	}
+
+	PatriciaTreeNodeCache::Shard& PatriciaTreeNodeCache::shard(const Hash256& hash) {
+		// hashes are uniformly distributed, so any byte can be used for sharding
+		return *m_shards[hash[Hash256::Size - 1] % Num_Shards];
+	}
+
+	// endregion
+}}
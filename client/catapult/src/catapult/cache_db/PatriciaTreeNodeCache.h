@@ -0,0 +1,87 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/tree/TreeNode.h"
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace catapult { namespace cache {
+
+	/// Bounded cache of decoded patricia tree branch nodes keyed by hash that can be shared by multiple tree data sources.
+	/// \note Nodes are partitioned into independently locked shards and are evicted using the CLOCK algorithm.
+	///       Pinned nodes are never evicted.
+	class PatriciaTreeNodeCache {
+	public:
+		/// Creates a cache that holds at most \a maxSize branch nodes and pins the top \a numPinnedLevels levels of each tree.
+		PatriciaTreeNodeCache(size_t maxSize, size_t numPinnedLevels);
+
+		/// Destroys the cache.
+		~PatriciaTreeNodeCache();
+
+	public:
+		/// Gets the maximum number of cached nodes.
+		size_t maxSize() const;
+
+		/// Gets the number of tree levels that should be pinned.
+		size_t numPinnedLevels() const;
+
+		/// Gets the number of cached nodes.
+		size_t size() const;
+
+		/// Gets the number of pinned nodes.
+		size_t numPinned() const;
+
+		/// Gets the number of successful lookups.
+		uint64_t numHits() const;
+
+		/// Gets the number of failed lookups.
+		uint64_t numMisses() const;
+
+	public:
+		/// Finds the node with \a hash or returns an empty node if it is not cached.
+		tree::TreeNode find(const Hash256& hash);
+
+		/// Adds \a node to the cache if it is a branch node.
+		/// \note Linked nodes are not cached.
+		void insert(const tree::TreeNode& node);
+
+		/// Pins the node with \a hash if it is cached.
+		/// \note Pins are counted, so a node pinned multiple times needs to be unpinned the same number of times.
+		void pin(const Hash256& hash);
+
+		/// Unpins the node with \a hash if it is pinned.
+		void unpin(const Hash256& hash);
+
+	private:
+		class Shard;
+
+		Shard& shard(const Hash256& hash);
+
+	private:
+		size_t m_maxSize;
+		size_t m_numPinnedLevels;
+		std::vector<std::unique_ptr<Shard>> m_shards;
+		std::atomic<uint64_t> m_numHits;
+		std::atomic<uint64_t> m_numMisses;
+	};
+}}
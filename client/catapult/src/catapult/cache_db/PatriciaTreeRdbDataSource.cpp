@@ -0,0 +1,100 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "PatriciaTreeRdbDataSource.h"
+#include "PatriciaTreeNodeCache.h"
+
+namespace catapult { namespace cache {
+
+	PatriciaTreeRdbDataSource::PatriciaTreeRdbDataSource(PatriciaTreeContainer& container)
+			: PatriciaTreeRdbDataSource(container, nullptr)
+	{}
+
+	PatriciaTreeRdbDataSource::PatriciaTreeRdbDataSource(PatriciaTreeContainer& container, PatriciaTreeNodeCache* pNodeCache)
+			: m_container(container)
+			, m_pNodeCache(pNodeCache)
+	{}
+
+	PatriciaTreeRdbDataSource::~PatriciaTreeRdbDataSource() {
+		pinTopLevels(Hash256());
+	}
+
+	tree::TreeNode PatriciaTreeRdbDataSource::get(const Hash256& hash) const {
+		if (m_pNodeCache) {
+			auto node = m_pNodeCache->find(hash);
+			if (!node.empty())
+				return node;
+		}
+
+		auto iter = m_container.find(hash);
+		if (m_container.cend() == iter)
+			return tree::TreeNode();
+
+		const auto& pair = *iter;
+		if (m_pNodeCache)
+			m_pNodeCache->insert(pair.second);
+
+		return pair.second.copy();
+	}
+
+	void PatriciaTreeRdbDataSource::pinTopLevels(const Hash256& rootHash) {
+		if (!m_pNodeCache)
+			return;
+
+		std::vector<Hash256> pinnedHashes;
+		if (Hash256() != rootHash) {
+			std::vector<Hash256> levelHashes{ rootHash };
+			for (auto level = 0u; level < m_pNodeCache->numPinnedLevels() && !levelHashes.empty(); ++level) {
+				std::vector<Hash256> nextLevelHashes;
+				for (const auto& hash : levelHashes) {
+					// loading a branch node adds it to the node cache
+					auto node = get(hash);
+					if (!node.isBranch())
+						continue;
+
+					pinnedHashes.push_back(hash);
+					const auto& branchNode = node.asBranchNode();
+					for (auto i = 0u; i < tree::BranchTreeNode::Max_Links; ++i) {
+						if (branchNode.hasLink(i))
+							nextLevelHashes.push_back(branchNode.link(i));
+					}
+				}
+
+				levelHashes = std::move(nextLevelHashes);
+			}
+		}
+
+		// pin new nodes before unpinning old nodes so that nodes shared by both sets are never evictable
+		for (const auto& hash : pinnedHashes)
+			m_pNodeCache->pin(hash);
+
+		for (const auto& hash : m_pinnedHashes)
+			m_pNodeCache->unpin(hash);
+
+		m_pinnedHashes = std::move(pinnedHashes);
+	}
+
+	void PatriciaTreeRdbDataSource::set(const tree::TreeNode& node) {
+		m_container.insert(std::make_pair(node.hash(), node.copy()));
+		if (m_pNodeCache)
+			m_pNodeCache->insert(node);
+	}
+}}
@@ -22,6 +22,9 @@
 #pragma once
 #include "PatriciaTreeContainer.h"
 #include "catapult/types.h"
+#include <vector>
+
+namespace catapult { namespace cache { class PatriciaTreeNodeCache; } }
 
 namespace catapult { namespace cache {
 
@@ -29,8 +32,13 @@ namespace catapult { namespace cache {
 	class PatriciaTreeRdbDataSource {
 	public:
 		/// Creates data source around \a container.
-		explicit PatriciaTreeRdbDataSource(PatriciaTreeContainer& container) : m_container(container)
-		{}
+		explicit PatriciaTreeRdbDataSource(PatriciaTreeContainer& container);
+
+		/// Creates data source around \a container that caches decoded branch nodes in \a pNodeCache (optional).
+		PatriciaTreeRdbDataSource(PatriciaTreeContainer& container, PatriciaTreeNodeCache* pNodeCache);
+
+		/// Destroys the data source and unpins all nodes pinned by it.
+		~PatriciaTreeRdbDataSource();
 
 	public:
 		/// Gets the number of saved nodes.
@@ -39,14 +47,7 @@ namespace catapult { namespace cache {
 		}
 
 		/// Gets the tree node associated with \a hash.
-		tree::TreeNode get(const Hash256& hash) const {
-			auto iter = m_container.find(hash);
-			if (m_container.cend() == iter)
-				return tree::TreeNode();
-
-			const auto& pair = *iter;
-			return pair.second.copy();
-		}
+		tree::TreeNode get(const Hash256& hash) const;
 
 	public:
 		/// Saves a leaf tree \a node.
@@ -59,12 +60,16 @@ namespace catapult { namespace cache {
 			set(tree::TreeNode(node));
 		}
 
+	public:
+		/// Pins the top levels of the tree with \a rootHash in the node cache and unpins all previously pinned nodes.
+		void pinTopLevels(const Hash256& rootHash);
+
 	private:
-		void set(const tree::TreeNode& node) {
-			m_container.insert(std::make_pair(node.hash(), node.copy()));
-		}
+		void set(const tree::TreeNode& node);
 
 	private:
 		PatriciaTreeContainer& m_container;
+		PatriciaTreeNodeCache* m_pNodeCache;
+		std::vector<Hash256> m_pinnedHashes;
 	};
 }}
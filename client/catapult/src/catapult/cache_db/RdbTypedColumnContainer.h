@@ -25,6 +25,7 @@
 #include "RocksDatabase.h"
 #include "catapult/exceptions.h"
 #include "catapult/types.h"
+#include <vector>
 
 namespace catapult { namespace cache {
 
@@ -127,6 +128,24 @@ namespace catapult { namespace cache {
 			return iter;
 		}
 
+		/// Finds all elements with \a keys in a single batched lookup.
+		/// \note Iterators are ordered like \a keys and each key that has not been found maps to cend().
+		std::vector<const_iterator> find(const std::vector<KeyType>& keys) const {
+			std::vector<RawBuffer> serializedKeys;
+			serializedKeys.reserve(keys.size());
+			for (const auto& key : keys)
+				serializedKeys.push_back(SerializeKey(key));
+
+			std::vector<RdbDataIterator> dbIterators;
+			TContainer::find(serializedKeys, dbIterators);
+
+			std::vector<const_iterator> iters(keys.size());
+			for (auto i = 0u; i < keys.size(); ++i)
+				iters[i].dbIterator() = std::move(dbIterators[i]);
+
+			return iters;
+		}
+
 		/// Prunes elements with keys smaller than \a key. Returns number of pruned elements.
 		size_t prune(const KeyType& key) {
 			return TContainer::prune(TDescriptor::Serializer::KeyToBoundary(key));
@@ -0,0 +1,120 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "RocksBackgroundWriter.h"
+#include "catapult/thread/ThreadInfo.h"
+#include "catapult/utils/ExceptionLogging.h"
+#include "catapult/utils/Logging.h"
+#include "catapult/exceptions.h"
+
+namespace catapult { namespace cache {
+
+	RocksBackgroundWriter::RocksBackgroundWriter(size_t maxPendingOperations)
+			: m_maxPendingOperations(maxPendingOperations)
+			, m_isExecuting(false)
+			, m_isStopped(false) {
+		if (0 == m_maxPendingOperations)
+			CATAPULT_THROW_INVALID_ARGUMENT("max pending operations must be nonzero");
+
+		m_thread = std::thread([this]() { run(); });
+	}
+
+	RocksBackgroundWriter::~RocksBackgroundWriter() {
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_isStopped = true;
+		}
+
+		m_condition.notify_all();
+		m_thread.join();
+	}
+
+	size_t RocksBackgroundWriter::maxPendingOperations() const {
+		return m_maxPendingOperations;
+	}
+
+	size_t RocksBackgroundWriter::numPendingOperations() const {
+		std::lock_guard<std::mutex> lock(m_mutex);
+		return m_operations.size() + (m_isExecuting ? 1 : 0);
+	}
+
+	bool RocksBackgroundWriter::hasFailed() const {
+		std::lock_guard<std::mutex> lock(m_mutex);
+		return !!m_pFailure;
+	}
+
+	void RocksBackgroundWriter::post(const action& operation) {
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_condition.wait(lock, [this]() {
+			return m_pFailure || m_operations.size() + (m_isExecuting ? 1 : 0) < m_maxPendingOperations;
+		});
+		checkFailure();
+
+		m_operations.push_back(operation);
+		lock.unlock();
+		m_condition.notify_all();
+	}
+
+	void RocksBackgroundWriter::drain() {
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_condition.wait(lock, [this]() { return m_operations.empty() && !m_isExecuting; });
+		checkFailure();
+	}
+
+	void RocksBackgroundWriter::run() {
+		thread::SetThreadName("rocks writer");
+
+		std::unique_lock<std::mutex> lock(m_mutex);
+		for (;;) {
+			m_condition.wait(lock, [this]() { return m_isStopped || !m_operations.empty(); });
+			if (m_operations.empty())
+				return;
+
+			auto operation = std::move(m_operations.front());
+			m_operations.pop_front();
+			m_isExecuting = true;
+			lock.unlock();
+
+			std::exception_ptr pFailure;
+			try {
+				operation();
+			} catch (...) {
+				CATAPULT_LOG(error) << UNHANDLED_EXCEPTION_MESSAGE("writing to database in background");
+				pFailure = std::current_exception();
+			}
+
+			lock.lock();
+			m_isExecuting = false;
+			if (pFailure) {
+				// subsequent operations depend on the failed one, so they must not be executed
+				m_pFailure = pFailure;
+				m_operations.clear();
+			}
+
+			m_condition.notify_all();
+		}
+	}
+
+	void RocksBackgroundWriter::checkFailure() {
+		if (m_pFailure)
+			std::rethrow_exception(m_pFailure);
+	}
+}}
@@ -0,0 +1,74 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/functions.h"
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+namespace catapult { namespace cache {
+
+	/// Background writer that executes database write operations on a dedicated thread in submission order.
+	/// \note After an operation fails, all remaining operations are discarded and the failure is rethrown to callers.
+	class RocksBackgroundWriter {
+	public:
+		/// Creates a writer that allows at most \a maxPendingOperations operations to be pending.
+		explicit RocksBackgroundWriter(size_t maxPendingOperations);
+
+		/// Destroys the writer after executing all pending operations.
+		~RocksBackgroundWriter();
+
+	public:
+		/// Gets the maximum number of pending operations.
+		size_t maxPendingOperations() const;
+
+		/// Gets the number of operations that have not completed.
+		size_t numPendingOperations() const;
+
+		/// Returns \c true if an operation has failed.
+		bool hasFailed() const;
+
+	public:
+		/// Queues \a operation for execution.
+		/// \note This call blocks while the maximum number of operations are pending.
+		void post(const action& operation);
+
+		/// Waits for all pending operations to complete.
+		void drain();
+
+	private:
+		void run();
+		void checkFailure();
+
+	private:
+		const size_t m_maxPendingOperations;
+		mutable std::mutex m_mutex;
+		std::condition_variable m_condition;
+		std::deque<action> m_operations;
+		bool m_isExecuting;
+		bool m_isStopped;
+		std::exception_ptr m_pFailure;
+		std::thread m_thread;
+	};
+}}
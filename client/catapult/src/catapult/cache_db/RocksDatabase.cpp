@@ -22,11 +22,14 @@
 #include "RocksDatabase.h"
 #include "RocksInclude.h"
 #include "RocksPruningFilter.h"
+#include "RocksWriteQueue.h"
 #include "catapult/config/CatapultDataDirectory.h"
+#include "catapult/utils/Casting.h"
 #include "catapult/utils/HexFormatter.h"
 #include "catapult/utils/PathUtils.h"
 #include "catapult/utils/StackLogger.h"
 #include "catapult/exceptions.h"
+#include <filesystem>
 
 namespace catapult { namespace cache {
 
@@ -76,6 +79,25 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region RocksBlockCache
+
+	RocksBlockCache::RocksBlockCache(utils::FileSize capacity)
+			: m_capacity(capacity)
+			, m_pCache(rocksdb::NewLRUCache(capacity.bytes()))
+	{}
+
+	RocksBlockCache::~RocksBlockCache() = default;
+
+	utils::FileSize RocksBlockCache::capacity() const {
+		return m_capacity;
+	}
+
+	const std::shared_ptr<rocksdb::Cache>& RocksBlockCache::cache() const {
+		return m_pCache;
+	}
+
+	// endregion
+
 	// region RocksDatabaseSettings
 
 	RocksDatabaseSettings::RocksDatabaseSettings()
@@ -98,15 +120,63 @@ namespace catapult { namespace cache {
 			const config::NodeConfiguration::CacheDatabaseSubConfiguration& databaseConfig,
 			const std::vector<std::string>& columnFamilyNames,
 			FilterPruningMode pruningMode)
+			: RocksDatabaseSettings(databaseDirectory, databaseConfig, columnFamilyNames, pruningMode, nullptr, nullptr, nullptr)
+	{}
+
+	RocksDatabaseSettings::RocksDatabaseSettings(
+			const std::string& databaseDirectory,
+			const config::NodeConfiguration::CacheDatabaseSubConfiguration& databaseConfig,
+			const std::vector<std::string>& columnFamilyNames,
+			FilterPruningMode pruningMode,
+			const std::shared_ptr<RocksBlockCache>& pBlockCache)
+			: RocksDatabaseSettings(databaseDirectory, databaseConfig, columnFamilyNames, pruningMode, pBlockCache, nullptr, nullptr)
+	{}
+
+	RocksDatabaseSettings::RocksDatabaseSettings(
+			const std::string& databaseDirectory,
+			const config::NodeConfiguration::CacheDatabaseSubConfiguration& databaseConfig,
+			const std::vector<std::string>& columnFamilyNames,
+			FilterPruningMode pruningMode,
+			const std::shared_ptr<RocksBlockCache>& pBlockCache,
+			const std::shared_ptr<RocksBackgroundWriter>& pWriter)
+			: RocksDatabaseSettings(databaseDirectory, databaseConfig, columnFamilyNames, pruningMode, pBlockCache, pWriter, nullptr)
+	{}
+
+	RocksDatabaseSettings::RocksDatabaseSettings(
+			const std::string& databaseDirectory,
+			const std::vector<std::string>& columnFamilyNames,
+			FilterPruningMode pruningMode,
+			const std::shared_ptr<RocksSharedDatabase>& pDatabase)
+			: RocksDatabaseSettings(
+					databaseDirectory,
+					pDatabase->databaseConfig(),
+					columnFamilyNames,
+					pruningMode,
+					nullptr,
+					nullptr,
+					pDatabase)
+	{}
+
+	RocksDatabaseSettings::RocksDatabaseSettings(
+			const std::string& databaseDirectory,
+			const config::NodeConfiguration::CacheDatabaseSubConfiguration& databaseConfig,
+			const std::vector<std::string>& columnFamilyNames,
+			FilterPruningMode pruningMode,
+			const std::shared_ptr<RocksBlockCache>& pBlockCache,
+			const std::shared_ptr<RocksBackgroundWriter>& pWriter,
+			const std::shared_ptr<RocksSharedDatabase>& pDatabase)
 			: DatabaseDirectory(databaseDirectory)
 			, DatabaseConfig(databaseConfig)
 			, ColumnFamilyNames(columnFamilyNames)
 			, PruningMode(pruningMode)
+			, pSharedBlockCache(pBlockCache)
+			, pBackgroundWriter(pWriter)
+			, pSharedDatabase(pDatabase)
 	{}
 
 	// endregion
 
-	// region RocksDatabase
+	// region utils
 
 	namespace {
 		rocksdb::Options CreateDatabaseOptions(const config::NodeConfiguration::CacheDatabaseSubConfiguration& config) {
@@ -135,37 +205,298 @@ namespace catapult { namespace cache {
 			return dbOptions;
 		}
 
+		rocksdb::CompressionType MapToCompressionType(config::CacheDatabaseCompression compression) {
+			switch (compression) {
+			case config::CacheDatabaseCompression::None:
+				return rocksdb::kNoCompression;
+			case config::CacheDatabaseCompression::Lz4:
+				return rocksdb::kLZ4Compression;
+			case config::CacheDatabaseCompression::Zstd:
+				return rocksdb::kZSTD;
+			default:
+				CATAPULT_THROW_INVALID_ARGUMENT_1("unsupported cache database compression", utils::to_underlying_type(compression));
+			}
+		}
+
+		bool RequiresCustomTableOptions(
+				const std::shared_ptr<RocksBlockCache>& pBlockCache,
+				const config::NodeConfiguration::CacheDatabaseColumnFamilySubConfiguration& config) {
+			return pBlockCache
+					|| 0 != config.BloomFilterBitsPerKey
+					|| 0 != config.BloomFilterPrefixSize
+					|| config.EnablePartitionedIndexFilters
+					|| config.PinL0FilterAndIndexBlocks;
+		}
+
+		void UpdateTableOptions(
+				rocksdb::BlockBasedTableOptions& tableOptions,
+				const std::shared_ptr<RocksBlockCache>& pBlockCache,
+				const config::NodeConfiguration::CacheDatabaseColumnFamilySubConfiguration& config) {
+			if (pBlockCache)
+				tableOptions.block_cache = pBlockCache->cache();
+
+			if (0 != config.BloomFilterBitsPerKey)
+				tableOptions.filter_policy.reset(rocksdb::NewBloomFilterPolicy(config.BloomFilterBitsPerKey));
+
+			// prefix filters are only consulted for lookups with keys at least as long as the prefix
+			if (0 != config.BloomFilterPrefixSize)
+				tableOptions.whole_key_filtering = false;
+
+			if (config.EnablePartitionedIndexFilters) {
+				tableOptions.index_type = rocksdb::BlockBasedTableOptions::IndexType::kTwoLevelIndexSearch;
+				tableOptions.partition_filters = !!tableOptions.filter_policy;
+				tableOptions.cache_index_and_filter_blocks = true;
+			}
+
+			if (config.PinL0FilterAndIndexBlocks) {
+				tableOptions.cache_index_and_filter_blocks = true;
+				tableOptions.pin_l0_filter_and_index_blocks_in_cache = true;
+			}
+		}
+
 		rocksdb::ColumnFamilyOptions CreateColumnFamilyOptions(
-				const config::NodeConfiguration::CacheDatabaseSubConfiguration& config,
+				const config::NodeConfiguration::CacheDatabaseSubConfiguration& databaseConfig,
+				const std::shared_ptr<RocksBlockCache>& pBlockCache,
+				const std::string& cacheName,
+				const std::string& columnFamilyName,
 				rocksdb::CompactionFilter* pCompactionFilter) {
+			const auto& config = config::GetCacheDatabaseColumnFamilyConfiguration(databaseConfig, cacheName, columnFamilyName);
+
 			rocksdb::ColumnFamilyOptions columnFamilyOptions;
 			columnFamilyOptions.compaction_filter = pCompactionFilter;
 
-			if (utils::FileSize() != config.BlockCacheSize)
-				columnFamilyOptions.OptimizeForPointLookup(config.BlockCacheSize.megabytes());
+			if (utils::FileSize() != databaseConfig.BlockCacheSize)
+				columnFamilyOptions.OptimizeForPointLookup(databaseConfig.BlockCacheSize.megabytes());
 
-			if (utils::FileSize() != config.MemtableMemoryBudget)
-				columnFamilyOptions.OptimizeLevelStyleCompaction(config.MemtableMemoryBudget.bytes());
+			if (utils::FileSize() != databaseConfig.MemtableMemoryBudget)
+				columnFamilyOptions.OptimizeLevelStyleCompaction(databaseConfig.MemtableMemoryBudget.bytes());
+
+			if (config::CacheDatabaseCompression::Default != config.Compression) {
+				// per level compression takes precedence, so it needs to be cleared for uniform compression to be applied
+				columnFamilyOptions.compression = MapToCompressionType(config.Compression);
+				columnFamilyOptions.compression_per_level.clear();
+			}
+
+			if (config::CacheDatabaseCompression::Default != config.BottommostCompression)
+				columnFamilyOptions.bottommost_compression = MapToCompressionType(config.BottommostCompression);
+
+			if (0 != config.BloomFilterPrefixSize)
+				columnFamilyOptions.prefix_extractor.reset(rocksdb::NewFixedPrefixTransform(config.BloomFilterPrefixSize));
+
+			if (RequiresCustomTableOptions(pBlockCache, config)) {
+				// start from current table options in order to preserve any point lookup optimizations
+				const auto* pCurrentTableOptions = columnFamilyOptions.table_factory->GetOptions<rocksdb::BlockBasedTableOptions>();
+				auto tableOptions = pCurrentTableOptions ? *pCurrentTableOptions : rocksdb::BlockBasedTableOptions();
+				UpdateTableOptions(tableOptions, pBlockCache, config);
+				columnFamilyOptions.table_factory.reset(rocksdb::NewBlockBasedTableFactory(tableOptions));
+			}
 
 			return columnFamilyOptions;
 		}
+
+		std::string GetCacheName(const RocksDatabaseSettings& settings) {
+			return std::filesystem::path(settings.DatabaseDirectory).filename().generic_string();
+		}
+
+		std::string GetSharedColumnFamilyName(const std::string& cacheName, const std::string& columnFamilyName) {
+			return cacheName + ":" + columnFamilyName;
+		}
+	}
+
+	// endregion
+
+	// region RocksSharedDatabase
+
+	RocksSharedDatabase::RocksSharedDatabase(
+			const std::string& databaseDirectory,
+			const config::NodeConfiguration::CacheDatabaseSubConfiguration& databaseConfig,
+			const std::shared_ptr<RocksBlockCache>& pBlockCache)
+			: RocksSharedDatabase(databaseDirectory, databaseConfig, pBlockCache, nullptr)
+	{}
+
+	RocksSharedDatabase::RocksSharedDatabase(
+			const std::string& databaseDirectory,
+			const config::NodeConfiguration::CacheDatabaseSubConfiguration& databaseConfig,
+			const std::shared_ptr<RocksBlockCache>& pBlockCache,
+			const std::shared_ptr<RocksBackgroundWriter>& pBackgroundWriter)
+			: m_databaseDirectory(databaseDirectory)
+			, m_databaseConfig(databaseConfig)
+			, m_pBlockCache(pBlockCache)
+			, m_pBackgroundWriter(pBackgroundWriter)
+			, m_isCommitting(false) {
+		config::CatapultDirectory(m_databaseDirectory).createAll();
+
+		// all existing column families must be opened, so use options derived from owning cache names
+		auto dbOptions = CreateDatabaseOptions(m_databaseConfig);
+		std::vector<std::string> columnFamilyNames;
+		if (!rocksdb::DB::ListColumnFamilies(dbOptions, m_databaseDirectory, &columnFamilyNames).ok())
+			columnFamilyNames = { rocksdb::kDefaultColumnFamilyName };
+
+		std::vector<rocksdb::ColumnFamilyDescriptor> columnFamilies;
+		for (const auto& columnFamilyName : columnFamilyNames) {
+			auto separatorIndex = columnFamilyName.find(':');
+			auto columnFamilyOptions = std::string::npos == separatorIndex
+					? rocksdb::ColumnFamilyOptions()
+					: CreateColumnFamilyOptions(
+							m_databaseConfig,
+							m_pBlockCache,
+							columnFamilyName.substr(0, separatorIndex),
+							columnFamilyName.substr(separatorIndex + 1),
+							pruningFilter(columnFamilyName.substr(0, separatorIndex)).compactionFilter());
+			columnFamilies.push_back(rocksdb::ColumnFamilyDescriptor(columnFamilyName, columnFamilyOptions));
+		}
+
+		rocksdb::DB* pDb;
+		std::vector<rocksdb::ColumnFamilyHandle*> handles;
+		auto status = rocksdb::DB::Open(dbOptions, m_databaseDirectory, columnFamilies, &handles, &pDb);
+		m_pDb.reset(pDb);
+		if (!status.ok())
+			CATAPULT_THROW_RUNTIME_ERROR_2("couldn't open database", m_databaseDirectory, status.ToString());
+
+		for (auto i = 0u; i < handles.size(); ++i)
+			m_handles.emplace(columnFamilyNames[i], handles[i]);
+
+		m_pWriteQueue = std::make_unique<RocksWriteQueue>(*m_pDb, m_databaseDirectory, m_pBackgroundWriter);
+	}
+
+	RocksSharedDatabase::~RocksSharedDatabase() {
+		// all pending changes must be written before column families are destroyed
+		m_pWriteQueue.reset();
+
+		for (const auto& pair : m_handles)
+			m_pDb->DestroyColumnFamilyHandle(pair.second);
+	}
+
+	const std::string& RocksSharedDatabase::databaseDirectory() const {
+		return m_databaseDirectory;
+	}
+
+	const config::NodeConfiguration::CacheDatabaseSubConfiguration& RocksSharedDatabase::databaseConfig() const {
+		return m_databaseConfig;
+	}
+
+	rocksdb::DB& RocksSharedDatabase::database() {
+		return *m_pDb;
+	}
+
+	RocksWriteQueue& RocksSharedDatabase::writeQueue() {
+		return *m_pWriteQueue;
+	}
+
+	RocksPruningFilter& RocksSharedDatabase::pruningFilter(const std::string& cacheName) {
+		// filter is always enabled because it is a noop until a pruning boundary is set
+		auto& pPruningFilter = m_pruningFilters[cacheName];
+		if (!pPruningFilter)
+			pPruningFilter = std::make_unique<RocksPruningFilter>(FilterPruningMode::Enabled);
+
+		return *pPruningFilter;
+	}
+
+	std::vector<rocksdb::ColumnFamilyHandle*> RocksSharedDatabase::columnFamilies(
+			const std::string& cacheName,
+			const std::vector<std::string>& columnFamilyNames) {
+		std::vector<rocksdb::ColumnFamilyHandle*> handles;
+		for (const auto& columnFamilyName : columnFamilyNames) {
+			auto sharedColumnFamilyName = GetSharedColumnFamilyName(cacheName, columnFamilyName);
+			auto iter = m_handles.find(sharedColumnFamilyName);
+			if (m_handles.cend() == iter) {
+				auto columnFamilyOptions = CreateColumnFamilyOptions(
+						m_databaseConfig,
+						m_pBlockCache,
+						cacheName,
+						columnFamilyName,
+						pruningFilter(cacheName).compactionFilter());
+
+				rocksdb::ColumnFamilyHandle* pHandle;
+				auto status = m_pDb->CreateColumnFamily(columnFamilyOptions, sharedColumnFamilyName, &pHandle);
+				if (!status.ok())
+					CATAPULT_THROW_RUNTIME_ERROR_2("couldn't create column family", sharedColumnFamilyName, status.ToString());
+
+				iter = m_handles.emplace(sharedColumnFamilyName, pHandle).first;
+			}
+
+			handles.push_back(iter->second);
+		}
+
+		return handles;
+	}
+
+	bool RocksSharedDatabase::isCommitting() const {
+		return m_isCommitting;
 	}
 
+	void RocksSharedDatabase::beginCommit() {
+		m_isCommitting = true;
+	}
+
+	void RocksSharedDatabase::commit() {
+		m_isCommitting = false;
+		write();
+	}
+
+	void RocksSharedDatabase::abandonCommit() {
+		// changes of sub caches that were committed before the failure must not be written as part of a later commit
+		m_isCommitting = false;
+		m_pWriteQueue->discard();
+	}
+
+	void RocksSharedDatabase::flush() {
+		if (m_isCommitting)
+			return;
+
+		write();
+	}
+
+	void RocksSharedDatabase::write() {
+		m_pWriteQueue->flush();
+	}
+
+	RocksSharedDatabaseCommitGuard::RocksSharedDatabaseCommitGuard(RocksSharedDatabase* pSharedDatabase)
+			: m_pSharedDatabase(pSharedDatabase) {
+		if (m_pSharedDatabase)
+			m_pSharedDatabase->beginCommit();
+	}
+
+	RocksSharedDatabaseCommitGuard::~RocksSharedDatabaseCommitGuard() {
+		// if a sub cache commit threw, the shared database must not be left in a committing state forever
+		if (m_pSharedDatabase && m_pSharedDatabase->isCommitting())
+			m_pSharedDatabase->abandonCommit();
+	}
+
+	void RocksSharedDatabaseCommitGuard::commit() {
+		if (m_pSharedDatabase)
+			m_pSharedDatabase->commit();
+	}
+
+	// endregion
+
+	// region RocksDatabase
+
 	RocksDatabase::RocksDatabase() = default;
 
 	RocksDatabase::RocksDatabase(const RocksDatabaseSettings& settings)
 			: m_settings(settings)
-			, m_pruningFilter(m_settings.PruningMode)
-			, m_pWriteBatch(std::make_unique<rocksdb::WriteBatch>()) {
+			, m_pruningFilter(m_settings.pSharedDatabase ? FilterPruningMode::Disabled : m_settings.PruningMode) {
 		if (m_settings.ColumnFamilyNames.empty())
 			CATAPULT_THROW_INVALID_ARGUMENT("missing column family names");
 
+		if (m_settings.pSharedDatabase) {
+			m_handles = m_settings.pSharedDatabase->columnFamilies(GetCacheName(m_settings), m_settings.ColumnFamilyNames);
+			return;
+		}
+
 		config::CatapultDirectory(m_settings.DatabaseDirectory).createAll();
 
-		auto columnFamilyOptions = CreateColumnFamilyOptions(m_settings.DatabaseConfig, m_pruningFilter.compactionFilter());
 		std::vector<rocksdb::ColumnFamilyDescriptor> columnFamilies;
-		for (const auto& columnFamilyName : m_settings.ColumnFamilyNames)
+		for (const auto& columnFamilyName : m_settings.ColumnFamilyNames) {
+			auto columnFamilyOptions = CreateColumnFamilyOptions(
+					m_settings.DatabaseConfig,
+					m_settings.pSharedBlockCache,
+					GetCacheName(m_settings),
+					columnFamilyName,
+					m_pruningFilter.compactionFilter());
 			columnFamilies.push_back(rocksdb::ColumnFamilyDescriptor(columnFamilyName, columnFamilyOptions));
+		}
 
 		rocksdb::DB* pDb;
 		auto dbOptions = CreateDatabaseOptions(m_settings.DatabaseConfig);
@@ -173,9 +504,18 @@ namespace catapult { namespace cache {
 		m_pDb.reset(pDb);
 		if (!status.ok())
 			CATAPULT_THROW_RUNTIME_ERROR_2("couldn't open database", m_settings.DatabaseDirectory, status.ToString());
+
+		m_pWriteQueue = std::make_unique<RocksWriteQueue>(*m_pDb, m_settings.DatabaseDirectory, m_settings.pBackgroundWriter);
 	}
 
 	RocksDatabase::~RocksDatabase() {
+		// handles of shared database are owned by it
+		if (!m_pDb)
+			return;
+
+		// all pending changes must be written before column families are destroyed
+		m_pWriteQueue.reset();
+
 		for (auto* pHandle : m_handles)
 			m_pDb->DestroyColumnFamilyHandle(pHandle);
 	}
@@ -188,6 +528,18 @@ namespace catapult { namespace cache {
 		return FilterPruningMode::Enabled == m_settings.PruningMode;
 	}
 
+	rocksdb::DB& RocksDatabase::database() {
+		return m_settings.pSharedDatabase ? m_settings.pSharedDatabase->database() : *m_pDb;
+	}
+
+	RocksWriteQueue& RocksDatabase::writeQueue() {
+		return m_settings.pSharedDatabase ? m_settings.pSharedDatabase->writeQueue() : *m_pWriteQueue;
+	}
+
+	RocksPruningFilter& RocksDatabase::pruningFilter() {
+		return m_settings.pSharedDatabase ? m_settings.pSharedDatabase->pruningFilter(GetCacheName(m_settings)) : m_pruningFilter;
+	}
+
 	namespace {
 		[[noreturn]]
 		void ThrowError(const std::string& message, const std::string& columnName, const rocksdb::Slice& key) {
@@ -199,10 +551,21 @@ namespace catapult { namespace cache {
 	ThrowError(std::string(message) + " " + status.ToString() + " (column, key)", m_settings.ColumnFamilyNames[columnId], key)
 
 	void RocksDatabase::get(size_t columnId, const rocksdb::Slice& key, RdbDataIterator& result) {
-		if (!m_pDb)
+		if (m_handles.empty())
 			CATAPULT_THROW_INVALID_ARGUMENT("RocksDatabase has not been initialized");
 
-		auto status = m_pDb->Get(rocksdb::ReadOptions(), m_handles[columnId], key, &result.storage());
+		// flushed changes that have not been written yet take precedence over database values
+		std::optional<std::string> pendingValue;
+		if (writeQueue().tryFindPending(m_handles[columnId], key, pendingValue)) {
+			result.storage().Reset();
+			if (pendingValue)
+				result.storage().PinSelf(*pendingValue);
+
+			result.setFound(!!pendingValue);
+			return;
+		}
+
+		auto status = database().Get(rocksdb::ReadOptions(), m_handles[columnId], key, &result.storage());
 		result.setFound(status.ok());
 
 		if (status.ok())
@@ -213,11 +576,48 @@ namespace catapult { namespace cache {
 			CATAPULT_THROW_DB_KEY_ERROR("could not retrieve value");
 	}
 
+	void RocksDatabase::multiGet(size_t columnId, const std::vector<rocksdb::Slice>& keys, std::vector<RdbDataIterator>& results) {
+		if (m_handles.empty())
+			CATAPULT_THROW_INVALID_ARGUMENT("RocksDatabase has not been initialized");
+
+		results.clear();
+		results.resize(keys.size());
+		if (keys.empty())
+			return;
+
+		if (writeQueue().hasPendingWrites()) {
+			for (auto i = 0u; i < keys.size(); ++i)
+				get(columnId, keys[i], results[i]);
+
+			return;
+		}
+
+		// batched api requires contiguous values, so pin into temporary slices and move them into results afterwards
+		std::vector<rocksdb::PinnableSlice> values(keys.size());
+		std::vector<rocksdb::Status> statuses(keys.size());
+		database().MultiGet(rocksdb::ReadOptions(), m_handles[columnId], keys.size(), keys.data(), values.data(), statuses.data());
+
+		for (auto i = 0u; i < keys.size(); ++i) {
+			const auto& key = keys[i];
+			const auto& status = statuses[i];
+			auto& result = results[i];
+			result.setFound(status.ok());
+
+			if (status.ok()) {
+				result.storage() = std::move(values[i]);
+				continue;
+			}
+
+			if (!status.IsNotFound())
+				CATAPULT_THROW_DB_KEY_ERROR("could not retrieve value");
+		}
+	}
+
 	void RocksDatabase::put(size_t columnId, const rocksdb::Slice& key, const std::string& value) {
-		if (!m_pDb)
+		if (m_handles.empty())
 			CATAPULT_THROW_INVALID_ARGUMENT("RocksDatabase has not been initialized");
 
-		auto status = m_pWriteBatch->Put(m_handles[columnId], key, value);
+		auto status = writeQueue().put(m_handles[columnId], key, value);
 		if (!status.ok())
 			CATAPULT_THROW_DB_KEY_ERROR("could not add put operation to batch");
 
@@ -225,12 +625,10 @@ namespace catapult { namespace cache {
 	}
 
 	void RocksDatabase::del(size_t columnId, const rocksdb::Slice& key) {
-		if (!m_pDb)
+		if (m_handles.empty())
 			CATAPULT_THROW_INVALID_ARGUMENT("RocksDatabase has not been initialized");
 
-		// note: using SingleDelete can result in undefined result if value has ever been overwritten
-		// that can't be guaranteed, so Delete is used instead
-		auto status = m_pWriteBatch->Delete(m_handles[columnId], key);
+		auto status = writeQueue().del(m_handles[columnId], key);
 		if (!status.ok())
 			CATAPULT_THROW_DB_KEY_ERROR("could not add delete operation to batch");
 
@@ -238,32 +636,30 @@ namespace catapult { namespace cache {
 	}
 
 	size_t RocksDatabase::prune(size_t columnId, uint64_t boundary) {
-		if (!m_pruningFilter.compactionFilter())
+		auto& filter = pruningFilter();
+		if (!canPrune() || !filter.compactionFilter())
 			return 0;
 
-		m_pruningFilter.setPruningBoundary(boundary);
-		m_pDb->CompactRange({}, m_handles[columnId], nullptr, nullptr);
-		return m_pruningFilter.numRemoved();
+		// compaction only applies to written changes
+		writeQueue().drain();
+
+		filter.setPruningBoundary(boundary);
+		database().CompactRange({}, m_handles[columnId], nullptr, nullptr);
+		return filter.numRemoved();
 	}
 
 	void RocksDatabase::flush() {
-		if (0 == m_pWriteBatch->GetDataSize())
+		// shared database defers writes until the current commit completes
+		if (m_settings.pSharedDatabase) {
+			m_settings.pSharedDatabase->flush();
 			return;
+		}
 
-		rocksdb::WriteOptions writeOptions;
-		writeOptions.sync = true;
-
-		auto directory = m_settings.DatabaseDirectory + "/";
-		utils::SlowOperationLogger logger(utils::ExtractDirectoryName(directory.c_str()).pData, utils::LogLevel::warning);
-		auto status = m_pDb->Write(writeOptions, m_pWriteBatch.get());
-		if (!status.ok())
-			CATAPULT_THROW_RUNTIME_ERROR_1("could not store batch in db", status.ToString());
-
-		m_pWriteBatch->Clear();
+		m_pWriteQueue->flush();
 	}
 
 	void RocksDatabase::saveIfBatchFull() {
-		if (m_pWriteBatch->GetDataSize() < m_settings.DatabaseConfig.MaxWriteBatchSize.bytes())
+		if (writeQueue().size() < m_settings.DatabaseConfig.MaxWriteBatchSize.bytes())
 			return;
 
 		flush();
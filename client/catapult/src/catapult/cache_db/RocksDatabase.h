@@ -24,16 +24,24 @@
 #include "catapult/config/NodeConfiguration.h"
 #include "catapult/utils/FileSize.h"
 #include "catapult/types.h"
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
 
+namespace catapult {
+	namespace cache {
+		class RocksBackgroundWriter;
+		class RocksWriteQueue;
+	}
+}
+
 namespace rocksdb {
+	class Cache;
 	class ColumnFamilyHandle;
 	class DB;
 	class PinnableSlice;
 	class Slice;
-	class WriteBatch;
 }
 
 namespace catapult { namespace cache {
@@ -90,6 +98,131 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region RocksBlockCache
+
+	/// RocksDb block cache that can be shared by multiple databases.
+	class RocksBlockCache {
+	public:
+		/// Creates a block cache with \a capacity.
+		explicit RocksBlockCache(utils::FileSize capacity);
+
+		/// Destroys the block cache.
+		~RocksBlockCache();
+
+	public:
+		/// Gets the capacity of the block cache.
+		utils::FileSize capacity() const;
+
+		/// Gets the underlying cache.
+		const std::shared_ptr<rocksdb::Cache>& cache() const;
+
+	private:
+		utils::FileSize m_capacity;
+		std::shared_ptr<rocksdb::Cache> m_pCache;
+	};
+
+	// endregion
+
+	// region RocksSharedDatabase
+
+	/// RocksDb database that is shared by multiple cache databases.
+	/// \note Each cache database owns a distinct set of column families that are prefixed with its cache name.
+	class RocksSharedDatabase {
+	public:
+		/// Creates a shared database around \a databaseDirectory, \a databaseConfig and optional shared block cache (\a pBlockCache).
+		RocksSharedDatabase(
+				const std::string& databaseDirectory,
+				const config::NodeConfiguration::CacheDatabaseSubConfiguration& databaseConfig,
+				const std::shared_ptr<RocksBlockCache>& pBlockCache);
+
+		/// Creates a shared database around \a databaseDirectory, \a databaseConfig, optional shared block cache (\a pBlockCache)
+		/// and optional background writer (\a pBackgroundWriter).
+		RocksSharedDatabase(
+				const std::string& databaseDirectory,
+				const config::NodeConfiguration::CacheDatabaseSubConfiguration& databaseConfig,
+				const std::shared_ptr<RocksBlockCache>& pBlockCache,
+				const std::shared_ptr<RocksBackgroundWriter>& pBackgroundWriter);
+
+		/// Destroys the shared database.
+		~RocksSharedDatabase();
+
+	public:
+		/// Gets the database directory.
+		const std::string& databaseDirectory() const;
+
+		/// Gets the database configuration.
+		const config::NodeConfiguration::CacheDatabaseSubConfiguration& databaseConfig() const;
+
+		/// Gets the underlying database.
+		rocksdb::DB& database();
+
+		/// Gets the write queue containing all pending changes.
+		RocksWriteQueue& writeQueue();
+
+		/// Gets the pruning filter of the cache named \a cacheName.
+		RocksPruningFilter& pruningFilter(const std::string& cacheName);
+
+		/// Gets the handles of column families (\a columnFamilyNames) owned by the cache named \a cacheName.
+		/// \note Column families that do not exist are created.
+		std::vector<rocksdb::ColumnFamilyHandle*> columnFamilies(
+				const std::string& cacheName,
+				const std::vector<std::string>& columnFamilyNames);
+
+	public:
+		/// Returns \c true if a commit is in progress.
+		bool isCommitting() const;
+
+		/// Begins a commit, deferring all writes until the commit is finished.
+		void beginCommit();
+
+		/// Finishes a commit by atomically writing all pending changes.
+		void commit();
+
+		/// Abandons a commit and discards all pending changes that have not been flushed.
+		void abandonCommit();
+
+		/// Writes all pending changes unless a commit is in progress.
+		void flush();
+
+	private:
+		void write();
+
+	private:
+		const std::string m_databaseDirectory;
+		const config::NodeConfiguration::CacheDatabaseSubConfiguration m_databaseConfig;
+		const std::shared_ptr<RocksBlockCache> m_pBlockCache;
+		std::map<std::string, std::unique_ptr<RocksPruningFilter>> m_pruningFilters;
+		const std::shared_ptr<RocksBackgroundWriter> m_pBackgroundWriter;
+		bool m_isCommitting;
+
+		std::unique_ptr<rocksdb::DB> m_pDb;
+		std::map<std::string, rocksdb::ColumnFamilyHandle*> m_handles;
+		std::unique_ptr<RocksWriteQueue> m_pWriteQueue;
+	};
+
+	/// RAII class that begins a shared database commit on construction and abandons it on destruction unless it was committed.
+	class RocksSharedDatabaseCommitGuard {
+	public:
+		/// Creates a guard around \a pSharedDatabase, which is optional.
+		explicit RocksSharedDatabaseCommitGuard(RocksSharedDatabase* pSharedDatabase);
+
+		/// Destroys the guard.
+		~RocksSharedDatabaseCommitGuard();
+
+	public:
+		/// Finishes the commit by atomically writing all pending changes.
+		void commit();
+
+	private:
+		RocksSharedDatabase* m_pSharedDatabase;
+
+	public:
+		RocksSharedDatabaseCommitGuard(const RocksSharedDatabaseCommitGuard&) = delete;
+		RocksSharedDatabaseCommitGuard& operator=(const RocksSharedDatabaseCommitGuard&) = delete;
+	};
+
+	// endregion
+
 	// region RocksDatabaseSettings
 
 	/// RocksDb settings.
@@ -112,6 +245,45 @@ namespace catapult { namespace cache {
 				const std::vector<std::string>& columnFamilyNames,
 				FilterPruningMode pruningMode);
 
+		/// Creates database settings around \a databaseDirectory, \a databaseConfig, column family names (\a columnFamilyNames),
+		/// \a pruningMode and shared block cache (\a pBlockCache).
+		RocksDatabaseSettings(
+				const std::string& databaseDirectory,
+				const config::NodeConfiguration::CacheDatabaseSubConfiguration& databaseConfig,
+				const std::vector<std::string>& columnFamilyNames,
+				FilterPruningMode pruningMode,
+				const std::shared_ptr<RocksBlockCache>& pBlockCache);
+
+		/// Creates database settings around \a databaseDirectory, \a databaseConfig, column family names (\a columnFamilyNames),
+		/// \a pruningMode, shared block cache (\a pBlockCache) and background writer (\a pWriter).
+		/// \note All flushed changes are written asynchronously by the background writer when it is set.
+		RocksDatabaseSettings(
+				const std::string& databaseDirectory,
+				const config::NodeConfiguration::CacheDatabaseSubConfiguration& databaseConfig,
+				const std::vector<std::string>& columnFamilyNames,
+				FilterPruningMode pruningMode,
+				const std::shared_ptr<RocksBlockCache>& pBlockCache,
+				const std::shared_ptr<RocksBackgroundWriter>& pWriter);
+
+		/// Creates database settings around \a databaseDirectory, column family names (\a columnFamilyNames), \a pruningMode
+		/// and shared database (\a pDatabase).
+		/// \note Cache database is composed of column families within the shared database instead of an independent database.
+		RocksDatabaseSettings(
+				const std::string& databaseDirectory,
+				const std::vector<std::string>& columnFamilyNames,
+				FilterPruningMode pruningMode,
+				const std::shared_ptr<RocksSharedDatabase>& pDatabase);
+
+	private:
+		RocksDatabaseSettings(
+				const std::string& databaseDirectory,
+				const config::NodeConfiguration::CacheDatabaseSubConfiguration& databaseConfig,
+				const std::vector<std::string>& columnFamilyNames,
+				FilterPruningMode pruningMode,
+				const std::shared_ptr<RocksBlockCache>& pBlockCache,
+				const std::shared_ptr<RocksBackgroundWriter>& pWriter,
+				const std::shared_ptr<RocksSharedDatabase>& pDatabase);
+
 	public:
 		/// Database directory.
 		const std::string DatabaseDirectory;
@@ -124,6 +296,15 @@ namespace catapult { namespace cache {
 
 		/// Database pruning mode.
 		const FilterPruningMode PruningMode;
+
+		/// Block cache shared with other databases (optional).
+		const std::shared_ptr<RocksBlockCache> pSharedBlockCache;
+
+		/// Background writer used for writing flushed changes (optional).
+		const std::shared_ptr<RocksBackgroundWriter> pBackgroundWriter;
+
+		/// Database shared with other cache databases (optional).
+		const std::shared_ptr<RocksSharedDatabase> pSharedDatabase;
 	};
 
 	// endregion
@@ -153,6 +334,11 @@ namespace catapult { namespace cache {
 		/// Gets the value associated with \a key from \a columnId and sets \a result.
 		void get(size_t columnId, const rocksdb::Slice& key, RdbDataIterator& result);
 
+		/// Gets the values associated with all \a keys from \a columnId in a single batched lookup and sets \a results.
+		/// \note \a results is resized to match \a keys and each result corresponds to the key with the same index.
+		/// \note This can be called concurrently with writes, in which case changes flushed during the call might not be observed.
+		void multiGet(size_t columnId, const std::vector<rocksdb::Slice>& keys, std::vector<RdbDataIterator>& results);
+
 		/// Puts the \a value associated with \a key in \a columnId.
 		void put(size_t columnId, const rocksdb::Slice& key, const std::string& value);
 
@@ -166,15 +352,18 @@ namespace catapult { namespace cache {
 		void flush();
 
 	private:
+		rocksdb::DB& database();
+		RocksWriteQueue& writeQueue();
+		RocksPruningFilter& pruningFilter();
 		void saveIfBatchFull();
 
 	private:
 		const RocksDatabaseSettings m_settings;
 		RocksPruningFilter m_pruningFilter;
-		std::unique_ptr<rocksdb::WriteBatch> m_pWriteBatch;
 
 		std::unique_ptr<rocksdb::DB> m_pDb;
 		std::vector<rocksdb::ColumnFamilyHandle*> m_handles;
+		std::unique_ptr<RocksWriteQueue> m_pWriteQueue;
 	};
 
 	// endregion
@@ -0,0 +1,179 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "RocksWriteQueue.h"
+#include "RocksBackgroundWriter.h"
+#include "RocksInclude.h"
+#include "catapult/utils/ExceptionLogging.h"
+#include "catapult/utils/PathUtils.h"
+#include "catapult/utils/StackLogger.h"
+#include "catapult/exceptions.h"
+
+namespace catapult { namespace cache {
+
+	RocksWriteQueue::RocksWriteQueue(
+			rocksdb::DB& database,
+			const std::string& databaseDirectory,
+			const std::shared_ptr<RocksBackgroundWriter>& pWriter)
+			: m_database(database)
+			, m_databaseDirectory(databaseDirectory)
+			, m_pWriter(pWriter)
+			, m_pWriteBatch(std::make_unique<rocksdb::WriteBatch>())
+			, m_pBatchChanges(m_pWriter ? std::make_unique<BatchChanges>() : nullptr)
+			, m_numPendingBatches(0)
+	{}
+
+	RocksWriteQueue::~RocksWriteQueue() {
+		// pending writes reference this queue, so they must complete before it is destroyed
+		try {
+			drain();
+		} catch (...) {
+			CATAPULT_LOG(error) << UNHANDLED_EXCEPTION_MESSAGE("draining write queue");
+		}
+	}
+
+	size_t RocksWriteQueue::size() const {
+		return m_pWriteBatch->GetDataSize();
+	}
+
+	bool RocksWriteQueue::hasPendingWrites() const {
+		// flushed batches are never written after a background write has failed, so they must not be readable
+		return 0 != m_numPendingBatches && !m_pWriter->hasFailed();
+	}
+
+	rocksdb::Status RocksWriteQueue::put(rocksdb::ColumnFamilyHandle* pHandle, const rocksdb::Slice& key, const std::string& value) {
+		auto status = m_pWriteBatch->Put(pHandle, key, value);
+		if (status.ok() && m_pBatchChanges)
+			(*m_pBatchChanges)[pHandle][key.ToString()] = value;
+
+		return status;
+	}
+
+	rocksdb::Status RocksWriteQueue::del(rocksdb::ColumnFamilyHandle* pHandle, const rocksdb::Slice& key) {
+		// note: using SingleDelete can result in undefined result if value has ever been overwritten
+		// that can't be guaranteed, so Delete is used instead
+		auto status = m_pWriteBatch->Delete(pHandle, key);
+		if (status.ok() && m_pBatchChanges)
+			(*m_pBatchChanges)[pHandle][key.ToString()] = std::nullopt;
+
+		return status;
+	}
+
+	bool RocksWriteQueue::tryFindPending(
+			const rocksdb::ColumnFamilyHandle* pHandle,
+			const rocksdb::Slice& key,
+			std::optional<std::string>& value) const {
+		if (!hasPendingWrites())
+			return false;
+
+		auto keyString = key.ToString();
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		// search from newest to oldest batch so that the most recent change wins
+		for (auto iter = m_pendingChanges.crbegin(); m_pendingChanges.crend() != iter; ++iter) {
+			auto columnIter = (*iter)->find(pHandle);
+			if ((*iter)->cend() == columnIter)
+				continue;
+
+			auto keyIter = columnIter->second.find(keyString);
+			if (columnIter->second.cend() == keyIter)
+				continue;
+
+			value = keyIter->second;
+			return true;
+		}
+
+		return false;
+	}
+
+	void RocksWriteQueue::flush() {
+		if (0 == m_pWriteBatch->GetDataSize())
+			return;
+
+		if (!m_pWriter) {
+			write(*m_pWriteBatch);
+			m_pWriteBatch->Clear();
+			return;
+		}
+
+		// make changes readable until they are written
+		std::shared_ptr<rocksdb::WriteBatch> pWriteBatch = std::move(m_pWriteBatch);
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_pendingChanges.push_back(std::move(m_pBatchChanges));
+			++m_numPendingBatches;
+		}
+
+		m_pWriteBatch = std::make_unique<rocksdb::WriteBatch>();
+		m_pBatchChanges = std::make_unique<BatchChanges>();
+
+		try {
+			m_pWriter->post([this, pWriteBatch]() {
+				try {
+					write(*pWriteBatch);
+				} catch (...) {
+					clearPending();
+					throw;
+				}
+
+				// background writer executes operations in order, so the oldest pending batch has been written
+				std::lock_guard<std::mutex> lock(m_mutex);
+				if (m_pendingChanges.empty())
+					return;
+
+				m_pendingChanges.pop_front();
+				--m_numPendingBatches;
+			});
+		} catch (...) {
+			clearPending();
+			throw;
+		}
+	}
+
+	void RocksWriteQueue::discard() {
+		m_pWriteBatch->Clear();
+		if (m_pBatchChanges)
+			m_pBatchChanges->clear();
+	}
+
+	void RocksWriteQueue::drain() {
+		if (m_pWriter)
+			m_pWriter->drain();
+	}
+
+	void RocksWriteQueue::clearPending() {
+		// background writer discards all operations after a failed one, so none of the pending batches will be written
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_pendingChanges.clear();
+		m_numPendingBatches = 0;
+	}
+
+	void RocksWriteQueue::write(rocksdb::WriteBatch& writeBatch) {
+		rocksdb::WriteOptions writeOptions;
+		writeOptions.sync = true;
+
+		auto directory = m_databaseDirectory + "/";
+		utils::SlowOperationLogger logger(utils::ExtractDirectoryName(directory.c_str()).pData, utils::LogLevel::warning);
+		auto status = m_database.Write(writeOptions, &writeBatch);
+		if (!status.ok())
+			CATAPULT_THROW_RUNTIME_ERROR_1("could not store batch in db", status.ToString());
+	}
+}}
@@ -0,0 +1,110 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+namespace catapult { namespace cache { class RocksBackgroundWriter; } }
+
+namespace rocksdb {
+	class ColumnFamilyHandle;
+	class DB;
+	class Slice;
+	class Status;
+	class WriteBatch;
+}
+
+namespace catapult { namespace cache {
+
+	/// Queue of database write batches that are written either synchronously or by a background writer.
+	/// \note Changes in batches that are flushed but not yet written by the background writer remain readable.
+	class RocksWriteQueue {
+	private:
+		using ColumnChanges = std::unordered_map<std::string, std::optional<std::string>>;
+		using BatchChanges = std::unordered_map<const rocksdb::ColumnFamilyHandle*, ColumnChanges>;
+
+	public:
+		/// Creates a queue around \a database in \a databaseDirectory with optional background writer (\a pWriter).
+		RocksWriteQueue(
+				rocksdb::DB& database,
+				const std::string& databaseDirectory,
+				const std::shared_ptr<RocksBackgroundWriter>& pWriter);
+
+		/// Destroys the queue after all flushed batches have been written.
+		~RocksWriteQueue();
+
+	public:
+		/// Gets the size of the current batch.
+		size_t size() const;
+
+		/// Returns \c true if any flushed batches have not been written.
+		/// \note Flushed batches are discarded when a background write fails.
+		bool hasPendingWrites() const;
+
+	public:
+		/// Adds a put of \a value associated with \a key in column family \a pHandle to the current batch.
+		rocksdb::Status put(rocksdb::ColumnFamilyHandle* pHandle, const rocksdb::Slice& key, const std::string& value);
+
+		/// Adds a delete of \a key in column family \a pHandle to the current batch.
+		rocksdb::Status del(rocksdb::ColumnFamilyHandle* pHandle, const rocksdb::Slice& key);
+
+		/// Tries to find a pending change of \a key in column family \a pHandle and sets \a value on success.
+		/// \note \a value is unset when the pending change is a delete.
+		bool tryFindPending(
+				const rocksdb::ColumnFamilyHandle* pHandle,
+				const rocksdb::Slice& key,
+				std::optional<std::string>& value) const;
+
+	public:
+		/// Writes the current batch, asynchronously when a background writer is available.
+		void flush();
+
+		/// Discards the current batch without writing it.
+		/// \note Flushed batches are not affected.
+		void discard();
+
+		/// Waits until all flushed batches have been written.
+		void drain();
+
+	private:
+		void clearPending();
+
+		void write(rocksdb::WriteBatch& writeBatch);
+
+	private:
+		rocksdb::DB& m_database;
+		std::string m_databaseDirectory;
+		std::shared_ptr<RocksBackgroundWriter> m_pWriter;
+
+		std::unique_ptr<rocksdb::WriteBatch> m_pWriteBatch;
+		std::unique_ptr<BatchChanges> m_pBatchChanges;
+
+		mutable std::mutex m_mutex;
+		std::deque<std::shared_ptr<const BatchChanges>> m_pendingChanges;
+		std::atomic<size_t> m_numPendingBatches;
+	};
+}}
@@ -101,7 +101,7 @@ namespace catapult { namespace cache {
 			utils::FileSize maxResponseSize,
 			utils::FileSize cacheSize,
 			const PtDataContainer& transactionDataContainer,
-			utils::SpinReaderWriterLock::ReaderLockGuard&& readLock)
+			utils::StripedReaderWriterLock::ReaderLockGuard&& readLock)
 			: m_maxResponseSize(maxResponseSize)
 			, m_cacheSize(cacheSize)
 			, m_transactionDataContainer(transactionDataContainer)
@@ -190,7 +190,7 @@ namespace catapult { namespace cache {
 					utils::FileSize& cacheSize,
 					PtDataContainer& transactionDataContainer,
 					std::set<state::TimestampedHash>& timestampedHashes,
-					utils::SpinReaderWriterLock::WriterLockGuard&& writeLock)
+					utils::StripedReaderWriterLock::WriterLockGuard&& writeLock)
 					: m_maxCacheSize(maxCacheSize)
 					, m_cacheSize(cacheSize)
 					, m_transactionDataContainer(transactionDataContainer)
@@ -288,7 +288,7 @@ namespace catapult { namespace cache {
 			utils::FileSize& m_cacheSize;
 			PtDataContainer& m_transactionDataContainer;
 			std::set<state::TimestampedHash>& m_timestampedHashes;
-			utils::SpinReaderWriterLock::WriterLockGuard m_writeLock;
+			utils::StripedReaderWriterLock::WriterLockGuard m_writeLock;
 		};
 	}
 
@@ -27,7 +27,7 @@
 #include "catapult/model/CosignedTransactionInfo.h"
 #include "catapult/model/WeakCosignedTransactionInfo.h"
 #include "catapult/utils/Hashers.h"
-#include "catapult/utils/SpinReaderWriterLock.h"
+#include "catapult/utils/StripedReaderWriterLock.h"
 #include <unordered_map>
 
 namespace catapult { namespace cache { class PtData; } }
@@ -48,7 +48,7 @@ namespace catapult { namespace cache {
 				utils::FileSize maxResponseSize,
 				utils::FileSize cacheSize,
 				const PtDataContainer& transactionDataContainer,
-				utils::SpinReaderWriterLock::ReaderLockGuard&& readLock);
+				utils::StripedReaderWriterLock::ReaderLockGuard&& readLock);
 
 	public:
 		/// Gets the number of partial transactions in the cache.
@@ -73,7 +73,7 @@ namespace catapult { namespace cache {
 		utils::FileSize m_maxResponseSize;
 		utils::FileSize m_cacheSize;
 		const PtDataContainer& m_transactionDataContainer;
-		utils::SpinReaderWriterLock::ReaderLockGuard m_readLock;
+		utils::StripedReaderWriterLock::ReaderLockGuard m_readLock;
 	};
 
 	/// Interface (read write) for caching partial transactions.
@@ -107,7 +107,7 @@ namespace catapult { namespace cache {
 	private:
 		MemoryCacheOptions m_options;
 		std::unique_ptr<Impl> m_pImpl;
-		mutable utils::SpinReaderWriterLock m_lock;
+		mutable utils::StripedReaderWriterLock m_lock;
 	};
 
 	/// Delegating proxy around a MemoryPtCache.
@@ -55,7 +55,7 @@ namespace catapult { namespace cache {
 			utils::FileSize cacheSize,
 			const TransactionDataContainer& transactionDataContainer,
 			const IdLookup& idLookup,
-			utils::SpinReaderWriterLock::ReaderLockGuard&& readLock)
+			utils::StripedReaderWriterLock::ReaderLockGuard&& readLock)
 			: m_maxResponseSize(maxResponseSize)
 			, m_cacheSize(cacheSize)
 			, m_transactionDataContainer(transactionDataContainer)
@@ -136,7 +136,7 @@ namespace catapult { namespace cache {
 					TransactionDataContainer& transactionDataContainer,
 					IdLookup& idLookup,
 					AccountWeights& weights,
-					utils::SpinReaderWriterLock::WriterLockGuard&& writeLock)
+					utils::StripedReaderWriterLock::WriterLockGuard&& writeLock)
 					: m_maxCacheSize(maxCacheSize)
 					, m_cacheSize(cacheSize)
 					, m_idSequence(idSequence)
@@ -220,7 +220,7 @@ namespace catapult { namespace cache {
 			TransactionDataContainer& m_transactionDataContainer;
 			IdLookup& m_idLookup;
 			AccountWeights& m_weights;
-			utils::SpinReaderWriterLock::WriterLockGuard m_writeLock;
+			utils::StripedReaderWriterLock::WriterLockGuard m_writeLock;
 		};
 	}
 
@@ -25,7 +25,7 @@
 #include "UtCache.h"
 #include "catapult/model/RangeTypes.h"
 #include "catapult/utils/Hashers.h"
-#include "catapult/utils/SpinReaderWriterLock.h"
+#include "catapult/utils/StripedReaderWriterLock.h"
 #include <set>
 #include <unordered_map>
 
@@ -52,7 +52,7 @@ namespace catapult { namespace cache {
 				utils::FileSize cacheSize,
 				const TransactionDataContainer& transactionDataContainer,
 				const IdLookup& idLookup,
-				utils::SpinReaderWriterLock::ReaderLockGuard&& readLock);
+				utils::StripedReaderWriterLock::ReaderLockGuard&& readLock);
 
 	public:
 		/// Gets the number of unconfirmed transactions in the cache.
@@ -83,7 +83,7 @@ namespace catapult { namespace cache {
 		utils::FileSize m_cacheSize;
 		const TransactionDataContainer& m_transactionDataContainer;
 		const IdLookup& m_idLookup;
-		utils::SpinReaderWriterLock::ReaderLockGuard m_readLock;
+		utils::StripedReaderWriterLock::ReaderLockGuard m_readLock;
 	};
 
 	/// Interface (read write) for caching unconfirmed transactions.
@@ -118,7 +118,7 @@ namespace catapult { namespace cache {
 		MemoryCacheOptions m_options;
 		size_t m_idSequence;
 		std::unique_ptr<Impl> m_pImpl;
-		mutable utils::SpinReaderWriterLock m_lock;
+		mutable utils::StripedReaderWriterLock m_lock;
 	};
 
 	/// Delegating proxy around a MemoryUtCache.
@@ -43,6 +43,10 @@ namespace catapult { namespace chain {
 				if (entityInfos.empty())
 					return ValidationResult::Neutral;
 
+				// warm the cache with all state touched by the batch so that observers do not need to load it one key at a time
+				if (m_config.Prefetcher)
+					m_config.Prefetcher(entityInfos, state.Cache);
+
 				ProcessContextsBuilder contextBuilder(height, timestamp, m_config);
 				contextBuilder.setObserverState(state); // this uses contents of ObserverState to initialize the builder
 				auto validatorContext = contextBuilder.buildValidatorContext();
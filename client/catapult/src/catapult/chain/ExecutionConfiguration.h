@@ -27,6 +27,9 @@
 
 namespace catapult { namespace chain {
 
+	/// Function signature for loading all state touched by a batch of entities into a cache delta.
+	using StatePrefetcher = consumer<const model::WeakEntityInfos&, cache::CatapultCacheDelta&>;
+
 	/// Configuration for creating contexts for executing entities.
 	struct ExecutionContextConfiguration {
 	private:
@@ -57,5 +60,8 @@ namespace catapult { namespace chain {
 
 		/// Notification publisher.
 		PublisherPointer pNotificationPublisher;
+
+		/// State prefetcher that is called before a batch of entities is executed (optional).
+		StatePrefetcher Prefetcher;
 	};
 }}
@@ -0,0 +1,154 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "StatePrefetcher.h"
+#include "catapult/cache/CatapultCache.h"
+#include "catapult/cache/ReadOnlyCatapultCache.h"
+#include "catapult/model/Address.h"
+#include "catapult/model/ContainerTypes.h"
+#include "catapult/model/NotificationSubscriber.h"
+#include "catapult/model/Notifications.h"
+#include "catapult/model/ResolverContext.h"
+#include <unordered_set>
+
+namespace catapult { namespace chain {
+
+	namespace {
+		class StateKeysCollector : public model::NotificationSubscriber {
+		public:
+			StateKeysCollector(model::NetworkIdentifier networkIdentifier, const model::ResolverContext& resolvers)
+					: m_networkIdentifier(networkIdentifier)
+					, m_resolvers(resolvers)
+			{}
+
+		public:
+			void setNetworkIdentifier(model::NetworkIdentifier networkIdentifier) {
+				m_networkIdentifier = networkIdentifier;
+			}
+
+			cache::StatePrefetchKeys keys() const {
+				cache::StatePrefetchKeys keys;
+				keys.Addresses.assign(m_addresses.cbegin(), m_addresses.cend());
+				keys.MosaicIds.assign(m_mosaicIds.cbegin(), m_mosaicIds.cend());
+				return keys;
+			}
+
+		public:
+			void notify(const model::Notification& notification) override {
+				switch (notification.Type) {
+				case model::Core_Register_Account_Address_Notification:
+					add(static_cast<const model::AccountAddressNotification&>(notification).Address);
+					break;
+
+				case model::Core_Register_Account_Public_Key_Notification: {
+					const auto& publicKey = static_cast<const model::AccountPublicKeyNotification&>(notification).PublicKey;
+					m_addresses.insert(model::PublicKeyToAddress(publicKey, m_networkIdentifier));
+					break;
+				}
+
+				case model::Core_Balance_Transfer_Notification: {
+					const auto& transferNotification = static_cast<const model::BalanceTransferNotification&>(notification);
+					add(transferNotification.Sender);
+					add(transferNotification.Recipient);
+					m_mosaicIds.insert(m_resolvers.resolve(transferNotification.MosaicId));
+					break;
+				}
+
+				case model::Core_Balance_Debit_Notification: {
+					const auto& debitNotification = static_cast<const model::BalanceDebitNotification&>(notification);
+					add(debitNotification.Sender);
+					m_mosaicIds.insert(m_resolvers.resolve(debitNotification.MosaicId));
+					break;
+				}
+
+				case model::Core_Mosaic_Required_Notification: {
+					const auto& mosaicRequiredNotification = static_cast<const model::MosaicRequiredNotification&>(notification);
+					add(mosaicRequiredNotification.Owner);
+					m_mosaicIds.insert(mosaicRequiredNotification.MosaicId.resolved(m_resolvers));
+					break;
+				}
+
+				default:
+					break;
+				}
+			}
+
+		private:
+			void add(const model::ResolvableAddress& address) {
+				m_addresses.insert(address.resolved(m_resolvers));
+			}
+
+		private:
+			model::NetworkIdentifier m_networkIdentifier;
+			const model::ResolverContext& m_resolvers;
+			model::AddressSet m_addresses;
+			std::unordered_set<MosaicId, utils::BaseValueHasher<MosaicId>> m_mosaicIds;
+		};
+	}
+
+	cache::StatePrefetchKeys CollectStatePrefetchKeys(
+			const model::WeakEntityInfos& entityInfos,
+			const model::NotificationPublisher& notificationPublisher,
+			const model::ResolverContext& resolvers) {
+		StateKeysCollector sub(model::NetworkIdentifier::Zero, resolvers);
+		for (const auto& entityInfo : entityInfos) {
+			sub.setNetworkIdentifier(entityInfo.entity().Network);
+			notificationPublisher.publish(entityInfo, sub);
+		}
+
+		return sub.keys();
+	}
+
+	StatePrefetcher CreateStatePrefetcher(
+			const ExecutionContextConfiguration& config,
+			const std::shared_ptr<const model::NotificationPublisher>& pNotificationPublisher) {
+		auto resolverContextFactory = config.ResolverContextFactory;
+		return [resolverContextFactory, pNotificationPublisher](const auto& entityInfos, auto& cacheDelta) {
+			if (entityInfos.empty())
+				return;
+
+			auto readOnlyCache = cacheDelta.toReadOnly();
+			auto resolvers = resolverContextFactory(readOnlyCache);
+			cacheDelta.prefetch(CollectStatePrefetchKeys(entityInfos, *pNotificationPublisher, resolvers));
+		};
+	}
+
+	StateLoader CreateDetachedStateLoader(const cache::CatapultCache& cache) {
+		return [&cache](const auto& keys) {
+			cache::StatePrefetchLoader loader;
+			{
+				// all cache locks (including the cache height lock) are released at the end of this scope
+				auto cacheDetachableDelta = cache.createDetachableDelta();
+				auto cacheDetachedDelta = cacheDetachableDelta.detach();
+
+				// locking fails when the cache has been committed since detaching, in which case nothing is loaded
+				auto pCacheDelta = cacheDetachedDelta.tryLock();
+				if (!pCacheDelta)
+					return;
+
+				loader = pCacheDelta->createPrefetchLoader();
+			}
+
+			// loaded state is discarded, so the batched lookups only warm storage and do not need to block commits
+			loader(keys);
+		};
+	}
+}}
@@ -0,0 +1,50 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "ExecutionConfiguration.h"
+#include "catapult/cache/StatePrefetchKeys.h"
+
+namespace catapult { namespace cache { class CatapultCache; } }
+
+namespace catapult { namespace chain {
+
+	/// Prototype for a function that loads the state identified by prefetch keys.
+	using StateLoader = consumer<const cache::StatePrefetchKeys&>;
+
+	/// Collects the resolved keys of all state touched by \a entityInfos.
+	/// \a notificationPublisher is used to raise all notifications and \a resolvers is used to resolve aliased keys.
+	cache::StatePrefetchKeys CollectStatePrefetchKeys(
+			const model::WeakEntityInfos& entityInfos,
+			const model::NotificationPublisher& notificationPublisher,
+			const model::ResolverContext& resolvers);
+
+	/// Creates a state prefetcher that collects keys with \a pNotificationPublisher, resolves them using resolvers created by
+	/// \a config and loads all of them into the cache delta with a single batched lookup per sub cache.
+	StatePrefetcher CreateStatePrefetcher(
+			const ExecutionContextConfiguration& config,
+			const std::shared_ptr<const model::NotificationPublisher>& pNotificationPublisher);
+
+	/// Creates a state loader that warms \a cache by loading keys into short-lived detached cache deltas.
+	/// \note Loaded state is discarded with the delta, but the cache database keeps it in memory for subsequent execution.
+	///       Storage is read after all cache locks are released, so the loader must not be called after \a cache is destroyed.
+	StateLoader CreateDetachedStateLoader(const cache::CatapultCache& cache);
+}}
@@ -22,11 +22,56 @@
 #include "NodeConfiguration.h"
 #include "catapult/utils/ConfigurationBag.h"
 #include "catapult/utils/ConfigurationUtils.h"
+#include "catapult/exceptions.h"
 
 namespace catapult { namespace config {
 
 #define LOAD_PROPERTY(SECTION, NAME) utils::LoadIniProperty(bag, SECTION, #NAME, config.NAME)
 
+	namespace {
+		constexpr auto Cache_Database_Section_Prefix = "cache_database:";
+		constexpr size_t Num_Column_Family_Properties = 6;
+
+		void LoadColumnFamilyConfiguration(
+				const utils::ConfigurationBag& bag,
+				const std::string& section,
+				NodeConfiguration::CacheDatabaseColumnFamilySubConfiguration& config) {
+#define LOAD_COLUMN_FAMILY_PROPERTY(NAME) LOAD_PROPERTY(section.c_str(), NAME)
+
+			LOAD_COLUMN_FAMILY_PROPERTY(BloomFilterBitsPerKey);
+			LOAD_COLUMN_FAMILY_PROPERTY(BloomFilterPrefixSize);
+			LOAD_COLUMN_FAMILY_PROPERTY(Compression);
+			LOAD_COLUMN_FAMILY_PROPERTY(BottommostCompression);
+			LOAD_COLUMN_FAMILY_PROPERTY(EnablePartitionedIndexFilters);
+			LOAD_COLUMN_FAMILY_PROPERTY(PinL0FilterAndIndexBlocks);
+
+#undef LOAD_COLUMN_FAMILY_PROPERTY
+		}
+
+		size_t ParseColumnFamilyOverrideSections(
+				const utils::ConfigurationBag& bag,
+				std::unordered_map<std::string, NodeConfiguration::CacheDatabaseColumnFamilySubConfiguration>& overrides) {
+			std::string prefix(Cache_Database_Section_Prefix);
+
+			size_t numOverrideProperties = 0;
+			for (const auto& section : bag.sections()) {
+				if (0 != section.find(prefix))
+					continue;
+
+				// override key must be composed of a cache name and a column family name
+				auto key = section.substr(prefix.size());
+				auto separatorIndex = key.find(':');
+				if (0 == separatorIndex || std::string::npos == separatorIndex || key.size() - 1 == separatorIndex)
+					CATAPULT_THROW_INVALID_ARGUMENT_1("cache database section has malformed name", section);
+
+				LoadColumnFamilyConfiguration(bag, section, overrides[key]);
+				numOverrideProperties += Num_Column_Family_Properties;
+			}
+
+			return numOverrideProperties;
+		}
+	}
+
 	NodeConfiguration NodeConfiguration::Uninitialized() {
 		return NodeConfiguration();
 	}
@@ -45,6 +90,9 @@ namespace catapult { namespace config {
 		LOAD_NODE_PROPERTY(EnableAutoSyncCleanup);
 
 		LOAD_NODE_PROPERTY(FileDatabaseBatchSize);
+		LOAD_NODE_PROPERTY(EnableMemoryMappedBlockReads);
+		LOAD_NODE_PROPERTY(BlockElementCacheSize);
+		LOAD_NODE_PROPERTY(BlockStorageCompressionLevel);
 
 		LOAD_NODE_PROPERTY(EnableTransactionSpamThrottling);
 		LOAD_NODE_PROPERTY(TransactionSpamThrottlingMaxBoostFee);
@@ -52,6 +100,7 @@ namespace catapult { namespace config {
 		LOAD_NODE_PROPERTY(MaxHashesPerSyncAttempt);
 		LOAD_NODE_PROPERTY(MaxBlocksPerSyncAttempt);
 		LOAD_NODE_PROPERTY(MaxChainBytesPerSyncAttempt);
+		LOAD_NODE_PROPERTY(StateHashCalculationInterval);
 
 		LOAD_NODE_PROPERTY(ShortLivedCacheTransactionDuration);
 		LOAD_NODE_PROPERTY(ShortLivedCacheBlockDuration);
@@ -63,6 +112,7 @@ namespace catapult { namespace config {
 		LOAD_NODE_PROPERTY(TransactionSelectionStrategy);
 		LOAD_NODE_PROPERTY(UnconfirmedTransactionsCacheMaxResponseSize);
 		LOAD_NODE_PROPERTY(UnconfirmedTransactionsCacheMaxSize);
+		LOAD_NODE_PROPERTY(MaxStatePathKeysPerRequest);
 
 		LOAD_NODE_PROPERTY(ConnectTimeout);
 		LOAD_NODE_PROPERTY(SyncTimeout);
@@ -78,9 +128,13 @@ namespace catapult { namespace config {
 		LOAD_NODE_PROPERTY(TransactionDisruptorSlotCount);
 		LOAD_NODE_PROPERTY(TransactionDisruptorMaxMemorySize);
 		LOAD_NODE_PROPERTY(TransactionElementTraceInterval);
+		LOAD_NODE_PROPERTY(TransactionDisruptorMaxCoalescedSize);
 
 		LOAD_NODE_PROPERTY(EnableDispatcherAbortWhenFull);
 		LOAD_NODE_PROPERTY(EnableDispatcherInputAuditing);
+		LOAD_NODE_PROPERTY(EnableWorkStealingValidation);
+		LOAD_NODE_PROPERTY(MinSignatureBatchSize);
+		LOAD_NODE_PROPERTY(StatePrefetchBlockCount);
 
 		LOAD_NODE_PROPERTY(MaxTrackedNodes);
 
@@ -106,8 +160,22 @@ namespace catapult { namespace config {
 
 		LOAD_CACHE_DATABASE_PROPERTY(MaxWriteBatchSize);
 
+		LOAD_CACHE_DATABASE_PROPERTY(EnableSharedBlockCache);
+		LOAD_CACHE_DATABASE_PROPERTY(EnableSharedDatabase);
+
+		LOAD_CACHE_DATABASE_PROPERTY(EnableAsyncCommit);
+		LOAD_CACHE_DATABASE_PROPERTY(MaxPendingWrites);
+
+		LOAD_CACHE_DATABASE_PROPERTY(StateHashThreadCount);
+
+		LOAD_CACHE_DATABASE_PROPERTY(TreeNodeCacheSize);
+		LOAD_CACHE_DATABASE_PROPERTY(TreeNodeCachePinnedLevels);
+
 #undef LOAD_CACHE_DATABASE_PROPERTY
 
+		LoadColumnFamilyConfiguration(bag, "cache_database", config.CacheDatabase.DefaultColumnFamily);
+		auto numOverrideProperties = ParseColumnFamilyOverrideSections(bag, config.CacheDatabase.ColumnFamilyOverrides);
+
 #define LOAD_LOCALNODE_PROPERTY(NAME) utils::LoadIniProperty(bag, "localnode", #NAME, config.Local.NAME)
 
 		LOAD_LOCALNODE_PROPERTY(Host);
@@ -152,7 +220,7 @@ namespace catapult { namespace config {
 
 #undef LOAD_BANNING_PROPERTY
 
-		utils::VerifyBagSizeExact(bag, 40 + 9 + 4 + 4 + 5 + 9);
+		utils::VerifyBagSizeExact(bag, 49 + 9 + 7 + 4 + 4 + 5 + 15 + numOverrideProperties);
 		return config;
 	}
 
@@ -160,6 +228,19 @@ namespace catapult { namespace config {
 
 	// region utils
 
+	const NodeConfiguration::CacheDatabaseColumnFamilySubConfiguration& GetCacheDatabaseColumnFamilyConfiguration(
+			const NodeConfiguration::CacheDatabaseSubConfiguration& config,
+			const std::string& cacheName,
+			const std::string& columnFamilyName) {
+		for (const auto& name : { cacheName, std::string("*") }) {
+			auto iter = config.ColumnFamilyOverrides.find(name + ":" + columnFamilyName);
+			if (config.ColumnFamilyOverrides.cend() != iter)
+				return iter->second;
+		}
+
+		return config.DefaultColumnFamily;
+	}
+
 	bool IsLocalHost(const std::string& host, const std::unordered_set<std::string>& localNetworks) {
 		return std::any_of(localNetworks.cbegin(), localNetworks.cend(), [&host](const auto& localNetwork) {
 			return host.size() >= localNetwork.size() && 0 == std::memcmp(&localNetwork[0], &host[0], localNetwork.size());
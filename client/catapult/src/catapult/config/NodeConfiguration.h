@@ -20,11 +20,13 @@
 **/
 
 #pragma once
+#include "CacheDatabaseCompression.h"
 #include "catapult/ionet/NodeRoles.h"
 #include "catapult/ionet/NodeVersion.h"
 #include "catapult/model/TransactionSelectionStrategy.h"
 #include "catapult/utils/FileSize.h"
 #include "catapult/utils/TimeSpan.h"
+#include <unordered_map>
 #include <unordered_set>
 
 namespace catapult { namespace utils { class ConfigurationBag; } }
@@ -57,6 +59,17 @@ namespace catapult { namespace config {
 		/// \note This is recommended to be a factor of 10000.
 		uint32_t FileDatabaseBatchSize;
 
+		/// \c true if blocks should be read from memory mapped file database files instead of being copied into new buffers.
+		bool EnableMemoryMappedBlockReads;
+
+		/// Maximum estimated size of recently used block elements cached in memory.
+		/// \note Zero disables caching of recently used block elements.
+		utils::FileSize BlockElementCacheSize;
+
+		/// Level used to compress blocks and statements stored in the data directory.
+		/// \note Zero disables compression. Memory mapped block reads are not used when compression is enabled.
+		uint32_t BlockStorageCompressionLevel;
+
 		/// \c true if transaction spam throttling should be enabled.
 		bool EnableTransactionSpamThrottling;
 
@@ -72,6 +85,11 @@ namespace catapult { namespace config {
 		/// Maximum chain bytes per sync attempt.
 		utils::FileSize MaxChainBytesPerSyncAttempt;
 
+		/// Multiple of heights at which state hashes of finalized blocks are calculated and checked.
+		/// \note State hashes of all other blocks and of the last block in every processed chain part are always checked.
+		/// \note State hashes of all blocks are checked when sub cache merkle roots are calculated (verifiable state is enabled).
+		uint32_t StateHashCalculationInterval;
+
 		/// Duration of a transaction in the short lived cache.
 		utils::TimeSpan ShortLivedCacheTransactionDuration;
 
@@ -100,6 +118,9 @@ namespace catapult { namespace config {
 		/// Maximum size of the unconfirmed transactions cache.
 		utils::FileSize UnconfirmedTransactionsCacheMaxSize;
 
+		/// Maximum number of keys in a single batch state path request.
+		uint32_t MaxStatePathKeysPerRequest;
+
 		/// Timeout for connecting to a peer.
 		utils::TimeSpan ConnectTimeout;
 
@@ -134,12 +155,26 @@ namespace catapult { namespace config {
 		/// Multiple of elements at which a transaction element should be traced through queue and completion.
 		uint32_t TransactionElementTraceInterval;
 
+		/// Maximum number of transactions from different sources that can be coalesced into a single transaction disruptor element.
+		/// \note Zero disables coalescing.
+		uint32_t TransactionDisruptorMaxCoalescedSize;
+
 		/// \c true if the process should terminate when any dispatcher is full.
 		bool EnableDispatcherAbortWhenFull;
 
 		/// \c true if all dispatcher inputs should be audited.
 		bool EnableDispatcherInputAuditing;
 
+		/// \c true if stateless and signature validation work should be balanced across validator threads by work stealing.
+		bool EnableWorkStealingValidation;
+
+		/// Minimum number of signatures to verify together in a single batch.
+		uint32_t MinSignatureBatchSize;
+
+		/// Number of consecutive blocks whose state is prefetched together ahead of execution when the cache database is enabled.
+		/// \note Prefetching is disabled when this is \c 0.
+		uint32_t StatePrefetchBlockCount;
+
 		/// Maximum number of nodes to track in memory.
 		uint32_t MaxTrackedNodes;
 
@@ -158,6 +193,29 @@ namespace catapult { namespace config {
 		/// Network interface on which to listen.
 		std::string ListenInterface;
 
+	public:
+		/// Cache database column family configuration.
+		struct CacheDatabaseColumnFamilySubConfiguration {
+			/// Number of bloom filter bits per key (\c 0 to use database default).
+			uint32_t BloomFilterBitsPerKey;
+
+			/// Size of key prefix used by bloom filters (\c 0 to filter on whole keys).
+			uint32_t BloomFilterPrefixSize;
+
+			/// Compression applied to all levels except the bottommost level.
+			/// \note This replaces any per level compression.
+			CacheDatabaseCompression Compression;
+
+			/// Compression applied to the bottommost level.
+			CacheDatabaseCompression BottommostCompression;
+
+			/// \c true if index and filter blocks should be partitioned.
+			bool EnablePartitionedIndexFilters;
+
+			/// \c true if level zero filter and index blocks should be pinned in the block cache.
+			bool PinL0FilterAndIndexBlocks;
+		};
+
 	public:
 		/// Cache database configuration.
 		struct CacheDatabaseSubConfiguration {
@@ -189,6 +247,38 @@ namespace catapult { namespace config {
 
 			/// Maximum write batch size.
 			utils::FileSize MaxWriteBatchSize;
+
+			/// \c true if a single block cache should be shared by all cache databases.
+			bool EnableSharedBlockCache;
+
+			/// \c true if all cache databases should be stored as column families of a single database.
+			/// \note All cache changes of a block are written atomically when enabled.
+			bool EnableSharedDatabase;
+
+			/// \c true if committed changes should be written to cache databases asynchronously.
+			/// \note Committed changes remain readable from memory until they are written.
+			bool EnableAsyncCommit;
+
+			/// Maximum number of pending asynchronous writes before commits are blocked.
+			uint32_t MaxPendingWrites;
+
+			/// Number of threads used to hash independent changed patricia tree subtrees in parallel.
+			/// \note Subtrees are hashed on the calling thread when zero.
+			uint32_t StateHashThreadCount;
+
+			/// Maximum number of decoded patricia tree branch nodes cached across all caches.
+			/// \note Nodes are not cached when zero.
+			uint32_t TreeNodeCacheSize;
+
+			/// Number of top levels of each patricia tree that are pinned in the tree node cache.
+			uint32_t TreeNodeCachePinnedLevels;
+
+			/// Column family configuration used when there is no matching override.
+			CacheDatabaseColumnFamilySubConfiguration DefaultColumnFamily;
+
+			/// Column family configuration overrides keyed by \c <cache name>:<column family name>.
+			/// \note Cache name \c * matches all caches.
+			std::unordered_map<std::string, CacheDatabaseColumnFamilySubConfiguration> ColumnFamilyOverrides;
 		};
 
 	public:
@@ -291,6 +381,12 @@ namespace catapult { namespace config {
 		static NodeConfiguration LoadFromBag(const utils::ConfigurationBag& bag);
 	};
 
+	/// Gets the configuration for the column family named \a columnFamilyName in the cache named \a cacheName given \a config.
+	const NodeConfiguration::CacheDatabaseColumnFamilySubConfiguration& GetCacheDatabaseColumnFamilyConfiguration(
+			const NodeConfiguration::CacheDatabaseSubConfiguration& config,
+			const std::string& cacheName,
+			const std::string& columnFamilyName);
+
 	/// Returns \c true when \a host is contained in \a localNetworks.
 	bool IsLocalHost(const std::string& host, const std::unordered_set<std::string>& localNetworks);
 }}
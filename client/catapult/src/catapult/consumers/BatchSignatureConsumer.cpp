@@ -26,16 +26,26 @@
 #include "catapult/model/NotificationSubscriber.h"
 #include "catapult/thread/IoThreadPool.h"
 #include "catapult/thread/ParallelFor.h"
+#include "catapult/thread/WorkStealingParallelFor.h"
+#include "catapult/utils/MemoryArena.h"
 #include "catapult/validators/AggregateValidationResult.h"
 
 namespace catapult { namespace consumers {
 
 	namespace {
+		using SignatureInputs = std::vector<crypto::SignatureInput, utils::ArenaAllocator<crypto::SignatureInput>>;
+
 		class SignatureCapturingNotificationSubscriber : public model::NotificationSubscriber {
 		public:
-			explicit SignatureCapturingNotificationSubscriber(const GenerationHashSeed& generationHashSeed)
+			SignatureCapturingNotificationSubscriber(
+					const GenerationHashSeed& generationHashSeed,
+					utils::MemoryArena& arena,
+					size_t startEntityIndex)
 					: m_generationHashSeed(generationHashSeed)
-					, m_entityIndex(0)
+					, m_arena(arena)
+					, m_entityIndex(startEntityIndex)
+					, m_notificationToEntityIndexMap(utils::ArenaAllocator<size_t>(arena))
+					, m_inputs(utils::ArenaAllocator<crypto::SignatureInput>(arena))
 			{}
 
 		public:
@@ -47,6 +57,10 @@ namespace catapult { namespace consumers {
 				return m_inputs;
 			}
 
+			auto& inputs() {
+				return m_inputs;
+			}
+
 		public:
 			void next() {
 				++m_entityIndex;
@@ -63,33 +77,117 @@ namespace catapult { namespace consumers {
 
 		private:
 			void add(const model::SignatureNotification& notification) {
-				std::vector<RawBuffer> buffers;
-				if (model::SignatureNotification::ReplayProtectionMode::Enabled == notification.DataReplayProtectionMode)
+				auto isReplayProtectionEnabled = model::SignatureNotification::ReplayProtectionMode::Enabled
+						== notification.DataReplayProtectionMode;
+
+				auto buffers = crypto::SignatureInputBuffers(utils::ArenaAllocator<RawBuffer>(m_arena));
+				buffers.reserve(isReplayProtectionEnabled ? 2 : 1);
+				if (isReplayProtectionEnabled)
 					buffers.push_back(m_generationHashSeed);
 
 				buffers.push_back(notification.Data);
 
-				m_inputs.push_back({ notification.SignerPublicKey, buffers, notification.Signature });
+				m_inputs.push_back({ notification.SignerPublicKey, std::move(buffers), notification.Signature });
 			}
 
 		private:
 			const GenerationHashSeed& m_generationHashSeed;
+			utils::MemoryArena& m_arena;
 			size_t m_entityIndex;
-			std::vector<size_t> m_notificationToEntityIndexMap;
-			std::vector<crypto::SignatureInput> m_inputs;
+			std::vector<size_t, utils::ArenaAllocator<size_t>> m_notificationToEntityIndexMap;
+			SignatureInputs m_inputs;
 		};
 
-		std::unique_ptr<SignatureCapturingNotificationSubscriber> ExtractAllSignatureNotifications(
+		// signatures captured from a contiguous range of entities, backed by an arena owned by the range
+		struct EntityRangeSignatures {
+		public:
+			EntityRangeSignatures(const GenerationHashSeed& generationHashSeed, size_t startEntityIndex)
+					: Subscriber(generationHashSeed, Arena, startEntityIndex)
+			{}
+
+		public:
+			utils::MemoryArena Arena;
+			SignatureCapturingNotificationSubscriber Subscriber;
+		};
+
+		// all signatures captured from a range of entities, ordered by entity
+		struct ExtractedSignatures {
+		public:
+			std::vector<std::unique_ptr<EntityRangeSignatures>> Ranges;
+			std::vector<crypto::SignatureInput> Inputs;
+			std::vector<size_t> NotificationToEntityIndexMap;
+		};
+
+		template<typename TEntityInfos>
+		std::unique_ptr<ExtractedSignatures> ExtractAllSignatureNotifications(
+				thread::IoThreadPool& pool,
 				const GenerationHashSeed& generationHashSeed,
 				const model::NotificationPublisher& publisher,
-				const model::WeakEntityInfos& entityInfos) {
-			auto pSub = std::make_unique<SignatureCapturingNotificationSubscriber>(generationHashSeed);
-			for (const auto& entityInfo : entityInfos) {
-				publisher.publish(entityInfo, *pSub);
-				pSub->next();
+				TEntityInfos& entityInfos) {
+			// publish disjoint entity ranges in parallel, each into its own arena
+			auto pExtracted = std::make_unique<ExtractedSignatures>();
+			auto& ranges = pExtracted->Ranges;
+			ranges.resize(pool.numWorkerThreads());
+			auto rangeCallback = [&generationHashSeed, &publisher, &ranges](auto itBegin, auto itEnd, auto startIndex, auto batchIndex) {
+				auto pRange = std::make_unique<EntityRangeSignatures>(generationHashSeed, startIndex);
+				for (auto iter = itBegin; itEnd != iter; ++iter) {
+					publisher.publish(*iter, pRange->Subscriber);
+					pRange->Subscriber.next();
+				}
+
+				ranges[batchIndex] = std::move(pRange);
+			};
+
+			thread::ParallelForPartition(pool.ioContext(), entityInfos, ranges.size(), rangeCallback).get();
+
+			// merge the ranges in entity order so that signatures can be repartitioned by verification cost
+			for (const auto& pRange : ranges) {
+				if (!pRange)
+					continue;
+
+				for (auto& input : pRange->Subscriber.inputs())
+					pExtracted->Inputs.push_back(std::move(input));
+
+				auto& notificationToEntityIndexMap = pExtracted->NotificationToEntityIndexMap;
+				const auto& rangeMap = pRange->Subscriber.notificationToEntityIndexMap();
+				notificationToEntityIndexMap.insert(notificationToEntityIndexMap.end(), rangeMap.cbegin(), rangeMap.cend());
+			}
+
+			return pExtracted;
+		}
+
+		// weight of the elliptic curve operations performed for each signature, expressed in (approximate) equivalent hashed bytes
+		constexpr uint64_t Signature_Verification_Weight = 8 * 1024;
+
+		uint64_t CalculateVerificationWeight(const crypto::SignatureInput& input) {
+			// R and A are hashed along with all data buffers (including the generation hash seed when replay protection is enabled)
+			uint64_t weight = Signature_Verification_Weight + Signature::Size / 2 + Key::Size;
+			for (const auto& buffer : input.Buffers)
+				weight += buffer.Size;
+
+			return weight;
+		}
+
+		template<typename TInputs, typename TPartitionCallback>
+		void VerifyPartitions(
+				thread::IoThreadPool& pool,
+				const BatchSignatureOptions& options,
+				TInputs& inputs,
+				TPartitionCallback partitionCallback) {
+			auto& ioContext = pool.ioContext();
+			auto numThreads = pool.numWorkerThreads();
+			if (thread::ParallelForStrategy::Work_Stealing == options.Strategy) {
+				thread::WorkStealingParallelForPartition(ioContext, inputs, numThreads, options.MinBatchSize, partitionCallback).get();
+				return;
 			}
 
-			return pSub;
+			thread::WeightedParallelForPartition(
+					ioContext,
+					inputs,
+					numThreads,
+					options.MinBatchSize,
+					CalculateVerificationWeight,
+					partitionCallback).get();
 		}
 
 		std::vector<validators::ValidationResult> MapNotificationResultsToEntityResults(
@@ -111,11 +209,12 @@ namespace catapult { namespace consumers {
 			const crypto::RandomFiller& randomFiller,
 			const std::shared_ptr<const model::NotificationPublisher>& pPublisher,
 			thread::IoThreadPool& pool,
+			const BatchSignatureOptions& options,
 			const RequiresValidationPredicate& requiresValidationPredicate) {
-		return MakeBlockValidationConsumer(requiresValidationPredicate, [&pool, generationHashSeed, randomFiller, pPublisher](
+		return MakeBlockValidationConsumer(requiresValidationPredicate, [&pool, options, generationHashSeed, randomFiller, pPublisher](
 				const auto& entityInfos) {
 			// find all signature notifications
-			auto inputs = ExtractAllSignatureNotifications(generationHashSeed, *pPublisher, entityInfos)->inputs();
+			auto pExtracted = ExtractAllSignatureNotifications(pool, generationHashSeed, *pPublisher, entityInfos);
 
 			// process signatures in batches
 			std::atomic<validators::ValidationResult> aggregateResult(validators::ValidationResult::Success);
@@ -125,7 +224,7 @@ namespace catapult { namespace consumers {
 					validators::AggregateValidationResult(aggregateResult, Failure_Consumer_Batch_Signature_Not_Verifiable);
 			};
 
-			thread::ParallelForPartition(pool.ioContext(), inputs, pool.numWorkerThreads(), partitionCallback).get();
+			VerifyPartitions(pool, options, pExtracted->Inputs, partitionCallback);
 			return aggregateResult.load();
 		});
 	}
@@ -135,16 +234,18 @@ namespace catapult { namespace consumers {
 			const crypto::RandomFiller& randomFiller,
 			const std::shared_ptr<const model::NotificationPublisher>& pPublisher,
 			thread::IoThreadPool& pool,
+			const BatchSignatureOptions& options,
 			const chain::FailedTransactionSink& failedTransactionSink) {
-		return MakeTransactionValidationConsumer(failedTransactionSink, [&pool, generationHashSeed, randomFiller, pPublisher](
+		return MakeTransactionValidationConsumer(failedTransactionSink, [&pool, options, generationHashSeed, randomFiller, pPublisher](
 				const auto& entityInfos) {
 			// find all signature notifications
-			auto pSub = ExtractAllSignatureNotifications(generationHashSeed, *pPublisher, entityInfos);
+			auto pExtracted = ExtractAllSignatureNotifications(pool, generationHashSeed, *pPublisher, entityInfos);
 
 			// process signatures in batches
 			// note: store notification (not entity) results because it's possible for an entity to be split across partitions,
 			//       which would lead to a write data race (of same data) from multiple threads
-			std::vector<validators::ValidationResult> notificationResults(pSub->inputs().size(), validators::ValidationResult::Success);
+			auto numNotifications = pExtracted->Inputs.size();
+			std::vector<validators::ValidationResult> notificationResults(numNotifications, validators::ValidationResult::Success);
 			auto partitionCallback = [&randomFiller, &notificationResults](auto itBegin, auto itEnd, auto startIndex, auto) {
 				auto count = static_cast<size_t>(std::distance(itBegin, itEnd));
 				auto partitionResultsPair = VerifyMulti(randomFiller, &*itBegin, count);
@@ -160,9 +261,10 @@ namespace catapult { namespace consumers {
 				}
 			};
 
-			thread::ParallelForPartition(pool.ioContext(), pSub->inputs(), pool.numWorkerThreads(), partitionCallback).get();
+			VerifyPartitions(pool, options, pExtracted->Inputs, partitionCallback);
 
-			return MapNotificationResultsToEntityResults(entityInfos.size(), pSub->notificationToEntityIndexMap(), notificationResults);
+			const auto& notificationToEntityIndexMap = pExtracted->NotificationToEntityIndexMap;
+			return MapNotificationResultsToEntityResults(entityInfos.size(), notificationToEntityIndexMap, notificationResults);
 		});
 	}
 }}
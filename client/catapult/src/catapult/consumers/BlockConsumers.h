@@ -20,11 +20,13 @@
 **/
 
 #pragma once
+#include "BatchSignatureOptions.h"
 #include "BlockchainProcessor.h"
 #include "BlockchainSyncHandlers.h"
 #include "HashCheckOptions.h"
 #include "InputUtils.h"
 #include "catapult/chain/ChainFunctions.h"
+#include "catapult/chain/StatePrefetcher.h"
 #include "catapult/crypto/Signer.h"
 #include "catapult/disruptor/DisruptorConsumer.h"
 #include "catapult/validators/ParallelValidationPolicy.h"
@@ -67,13 +69,28 @@ namespace catapult { namespace consumers {
 	/// generation hash seed (\a generationHashSeed).
 	/// Validation will only be performed for entities for which \a requiresValidationPredicate returns \c true.
 	/// \a randomFiller is used to generate random bytes.
+	/// \a options determine how signatures are batched and distributed across \a pool threads.
 	disruptor::ConstBlockConsumer CreateBlockBatchSignatureConsumer(
 			const GenerationHashSeed& generationHashSeed,
 			const crypto::RandomFiller& randomFiller,
 			const std::shared_ptr<const model::NotificationPublisher>& pPublisher,
 			thread::IoThreadPool& pool,
+			const BatchSignatureOptions& options,
 			const RequiresValidationPredicate& requiresValidationPredicate);
 
+	/// Creates a consumer that collects the keys of all state touched by blocks and loads them with \a stateLoader on \a pool
+	/// threads so that the state is loaded while preceding blocks are executed.
+	/// Keys are collected using \a pPublisher and resolved against \a cache using resolvers created by \a executionContextConfig.
+	/// Keys of up to \a maxBlocksPerPrefetch consecutive blocks are loaded together.
+	/// \note Destroying the consumer waits for all of its loads to complete or to be dropped by \a pool.
+	disruptor::ConstBlockConsumer CreateBlockStatePrefetchConsumer(
+			const cache::CatapultCache& cache,
+			const chain::ExecutionContextConfiguration& executionContextConfig,
+			const std::shared_ptr<const model::NotificationPublisher>& pPublisher,
+			thread::IoThreadPool& pool,
+			uint32_t maxBlocksPerPrefetch,
+			const chain::StateLoader& stateLoader);
+
 	/// Creates a consumer that attempts to synchronize a remote chain with the local chain, which is composed of
 	/// state (in \a cache) and blocks (in \a storage) with \a importanceGrouping.
 	/// \a handlers are used to customize the sync process.
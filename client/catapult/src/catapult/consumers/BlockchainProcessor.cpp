@@ -97,10 +97,14 @@ namespace catapult { namespace consumers {
 			DefaultBlockchainProcessor(
 					const BlockHitPredicateFactory& blockHitPredicateFactory,
 					const chain::BatchEntityProcessor& batchEntityProcessor,
-					ReceiptValidationMode receiptValidationMode)
+					ReceiptValidationMode receiptValidationMode,
+					uint32_t stateHashCalculationInterval,
+					const supplier<model::HeightHashPair>& finalizedHeightHashPairSupplier)
 					: m_blockHitPredicateFactory(blockHitPredicateFactory)
 					, m_batchEntityProcessor(batchEntityProcessor)
 					, m_receiptValidationMode(receiptValidationMode)
+					, m_stateHashCalculationInterval(std::max<uint32_t>(1, stateHashCalculationInterval))
+					, m_finalizedHeightHashPairSupplier(finalizedHeightHashPairSupplier)
 			{}
 
 		public:
@@ -121,8 +125,13 @@ namespace catapult { namespace consumers {
 				const auto* pParentGenerationHash = &parentBlockInfo.generationHash();
 
 				// initial cache state will be either last cache state or unwound cache state
+				auto initialStateHashInfo = state.Cache.calculateStateHash(pParent->Height);
 				std::vector<std::string> cacheStateLogs;
-				cacheStateLogs.push_back(FormatCacheStateLog(pParent->Height, state.Cache.calculateStateHash(pParent->Height)));
+				cacheStateLogs.push_back(FormatCacheStateLog(pParent->Height, initialStateHashInfo));
+
+				// state hash checks can only be skipped for blocks that are finalized
+				// sub cache merkle roots are stored with every block, so they must be calculated for every block when present
+				auto maxUncheckedHeight = initialStateHashInfo.SubCacheMerkleRoots.empty() ? findFinalizedHeight(elements) : Height(0);
 
 				for (auto& element : elements) {
 					// 1. check generation hash
@@ -141,8 +150,10 @@ namespace catapult { namespace consumers {
 						return result;
 					}
 
-					// 3. check state hash
-					if (!CheckStateHash(element, state.Cache, cacheStateLogs))
+					// 3. check state hash (all changes since the last check are accumulated and applied to patricia trees at once)
+					if (!shouldCheckStateHash(element, elements, maxUncheckedHeight))
+						element.SubCacheMerkleRoots.clear();
+					else if (!CheckStateHash(element, state.Cache, cacheStateLogs))
 						return chain::Failure_Chain_Block_Inconsistent_State_Hash;
 
 					// 4. check receipts hash
@@ -158,6 +169,29 @@ namespace catapult { namespace consumers {
 			}
 
 		private:
+			Height findFinalizedHeight(const BlockElements& elements) const {
+				if (1 == m_stateHashCalculationInterval)
+					return Height(0);
+
+				// elements are linked, so all blocks up to the finalized block are fixed by its hash
+				auto finalizedHeightHashPair = m_finalizedHeightHashPairSupplier();
+				auto elementIter = std::find_if(elements.cbegin(), elements.cend(), [&finalizedHeightHashPair](const auto& element) {
+					return finalizedHeightHashPair.Height == element.Block.Height;
+				});
+
+				return elements.cend() != elementIter && finalizedHeightHashPair.Hash == elementIter->EntityHash
+						? finalizedHeightHashPair.Height
+						: Height(0);
+			}
+
+			bool shouldCheckStateHash(const model::BlockElement& element, const BlockElements& elements, Height maxUncheckedHeight) const {
+				// always check last block so that the committed cache state is consistent with its patricia trees
+				if (&elements.back() == &element || element.Block.Height > maxUncheckedHeight)
+					return true;
+
+				return 0 == element.Block.Height.unwrap() % m_stateHashCalculationInterval;
+			}
+
 			observers::ObserverState createBlockDependentObserverState(
 					observers::ObserverState& state,
 					model::BlockStatementBuilder& blockStatementBuilder) const {
@@ -264,13 +298,22 @@ namespace catapult { namespace consumers {
 			BlockHitPredicateFactory m_blockHitPredicateFactory;
 			chain::BatchEntityProcessor m_batchEntityProcessor;
 			ReceiptValidationMode m_receiptValidationMode;
+			uint32_t m_stateHashCalculationInterval;
+			supplier<model::HeightHashPair> m_finalizedHeightHashPairSupplier;
 		};
 	}
 
 	BlockchainProcessor CreateBlockchainProcessor(
 			const BlockHitPredicateFactory& blockHitPredicateFactory,
 			const chain::BatchEntityProcessor& batchEntityProcessor,
-			ReceiptValidationMode receiptValidationMode) {
-		return DefaultBlockchainProcessor(blockHitPredicateFactory, batchEntityProcessor, receiptValidationMode);
+			ReceiptValidationMode receiptValidationMode,
+			uint32_t stateHashCalculationInterval,
+			const supplier<model::HeightHashPair>& finalizedHeightHashPairSupplier) {
+		return DefaultBlockchainProcessor(
+				blockHitPredicateFactory,
+				batchEntityProcessor,
+				receiptValidationMode,
+				stateHashCalculationInterval,
+				finalizedHeightHashPairSupplier);
 	}
 }}
@@ -22,6 +22,7 @@
 #pragma once
 #include "catapult/chain/BatchEntityProcessor.h"
 #include "catapult/disruptor/DisruptorElement.h"
+#include "catapult/model/HeightHashPair.h"
 #include "catapult/model/WeakEntityInfo.h"
 #include <functional>
 
@@ -79,8 +80,15 @@ namespace catapult { namespace consumers {
 
 	/// Creates a blockchain processor around the specified block hit predicate factory (\a blockHitPredicateFactory)
 	/// and batch entity processor (\a batchEntityProcessor) with \a receiptValidationMode.
+	/// State hashes of finalized blocks are only calculated and checked for blocks with heights that are multiples of
+	/// \a stateHashCalculationInterval and for the last block of each processed chain part.
+	/// Blocks are finalized when the chain part contains the block returned by \a finalizedHeightHashPairSupplier.
+	/// \note Patricia trees accumulate all changes between checked blocks, so each changed state entry is only hashed once.
+	/// \note Sub cache merkle roots are stored with every block, so no checks are skipped when the cache produces them.
 	BlockchainProcessor CreateBlockchainProcessor(
 			const BlockHitPredicateFactory& blockHitPredicateFactory,
 			const chain::BatchEntityProcessor& batchEntityProcessor,
-			ReceiptValidationMode receiptValidationMode);
+			ReceiptValidationMode receiptValidationMode,
+			uint32_t stateHashCalculationInterval,
+			const supplier<model::HeightHashPair>& finalizedHeightHashPairSupplier);
 }}
@@ -297,6 +297,7 @@ namespace catapult { namespace consumers {
 
 				// 1. save the peer chain into storage
 				logger.addSubOperation("save the peer chain into storage");
+				m_handlers.PreBlocksWritten();
 				auto storageModifier = m_storage.modifier();
 				storageModifier.dropBlocksAfter(syncState.commonBlockHeight());
 				storageModifier.saveBlocks(elements);
@@ -88,6 +88,9 @@ namespace catapult { namespace consumers {
 		/// Prototype for state change notification.
 		using StateChangeFunc = consumer<const subscribers::StateChangeInfo&>;
 
+		/// Prototype for pre blocks written notification.
+		using PreBlocksWrittenFunc = action;
+
 		/// Prototype for pre state written notification.
 		using PreStateWrittenFunc = consumer<const cache::CatapultCacheDelta&, Height>;
 
@@ -116,6 +119,9 @@ namespace catapult { namespace consumers {
 		/// Called with state change info to indicate a state change.
 		StateChangeFunc StateChange;
 
+		/// Called before any blocks are written to disk.
+		PreBlocksWrittenFunc PreBlocksWritten;
+
 		/// Called after state change but before state written checkpoint.
 		PreStateWrittenFunc PreStateWritten;
 
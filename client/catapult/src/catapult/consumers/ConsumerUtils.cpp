@@ -44,4 +44,29 @@ namespace catapult { namespace consumers {
 
 		return ionet::NodeInteractionResult(sourceIdentity, code);
 	}
+
+	void ForEachSourceCompletionResult(
+			const disruptor::ConsumerInput& input,
+			const disruptor::ConsumerCompletionResult& completionResult,
+			const consumer<const model::NodeIdentity&, const disruptor::ConsumerCompletionResult&>& action) {
+		const auto& partitions = input.partitions();
+		if (partitions.empty()) {
+			action(input.sourceIdentity(), completionResult);
+			return;
+		}
+
+		for (const auto& partition : partitions) {
+			// partitions without results were processed together, so the result of the entire input applies to them
+			if (disruptor::CompletionStatus::Normal == partition.Result.CompletionStatus) {
+				action(partition.SourceIdentity, completionResult);
+				continue;
+			}
+
+			auto partitionCompletionResult = completionResult;
+			partitionCompletionResult.CompletionStatus = partition.Result.CompletionStatus;
+			partitionCompletionResult.CompletionCode = partition.Result.CompletionCode;
+			partitionCompletionResult.ResultSeverity = partition.Result.ResultSeverity;
+			action(partition.SourceIdentity, partitionCompletionResult);
+		}
+	}
 }}
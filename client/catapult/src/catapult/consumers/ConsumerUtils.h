@@ -21,6 +21,7 @@
 
 #pragma once
 #include "catapult/ionet/NodeInteractionResult.h"
+#include "catapult/functions.h"
 
 namespace catapult {
 	namespace disruptor {
@@ -35,4 +36,11 @@ namespace catapult { namespace consumers {
 	ionet::NodeInteractionResult ToNodeInteractionResult(
 			const model::NodeIdentity& sourceIdentity,
 			const disruptor::ConsumerCompletionResult& result);
+
+	/// Calls \a action with the identity and completion result of each source contributing to \a input
+	/// given the completion result (\a completionResult) of the entire input.
+	void ForEachSourceCompletionResult(
+			const disruptor::ConsumerInput& input,
+			const disruptor::ConsumerCompletionResult& completionResult,
+			const consumer<const model::NodeIdentity&, const disruptor::ConsumerCompletionResult&>& action);
 }}
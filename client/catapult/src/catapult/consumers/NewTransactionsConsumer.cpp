@@ -46,37 +46,64 @@ namespace catapult { namespace consumers {
 				//      but doesn't invalidate the input elements
 				//    - the range is moved into ExtractEntitiesFromRange, which extends the lifetime of the range
 				//      to the lifetime of the returned transactions
+				//    - the input elements are still valid even though the backing range has been detached
 				auto transactions = model::TransactionRange::ExtractEntitiesFromRange(input.detachTransactionRange());
+				const auto& elements = input.transactions();
+				auto& partitions = input.partitions();
+				if (partitions.empty())
+					return process(transactions, elements, 0, transactions.size());
+
+				// 2. process the transactions from each source separately so that failures are only attributed to their sources
+				auto numAbortedPartitions = 0u;
+				auto numSuccessPartitions = 0u;
+				for (auto& partition : partitions) {
+					// transactions from sources aborted by preceding consumers have already been skipped
+					if (disruptor::CompletionStatus::Aborted != partition.Result.CompletionStatus)
+						partition.Result = process(transactions, elements, partition.StartIndex, partition.Size);
+
+					if (disruptor::CompletionStatus::Aborted == partition.Result.CompletionStatus)
+						++numAbortedPartitions;
+					else if (disruptor::ConsumerResultSeverity::Success == partition.Result.ResultSeverity)
+						++numSuccessPartitions;
+				}
+
+				if (0 != numAbortedPartitions)
+					return Abort(validators::ValidationResult::Failure);
 
-				// 2. prepare the output
+				return numSuccessPartitions > 0 ? CompleteSuccess() : CompleteNeutral();
+			}
+
+		private:
+			ConsumerResult process(
+					const std::vector<std::shared_ptr<model::Transaction>>& transactions,
+					const disruptor::TransactionElements& elements,
+					size_t startIndex,
+					size_t count) const {
+				// 1. prepare the output
 				TransactionInfos transactionInfos;
-				transactionInfos.reserve(transactions.size());
+				transactionInfos.reserve(count);
 
-				// 3. filter transactions
-				//    - the input elements are still valid even though the backing range has been detached
-				size_t i = 0;
+				// 2. filter transactions
 				size_t numFailures = 0;
-				for (const auto& element : input.transactions()) {
-					if (disruptor::ConsumerResultSeverity::Success == element.ResultSeverity) {
+				for (auto i = startIndex; i < startIndex + count; ++i) {
+					const auto& element = elements[i];
+					if (disruptor::ConsumerResultSeverity::Success == element.ResultSeverity)
 						transactionInfos.emplace_back(model::MakeTransactionInfo(transactions[i], element));
-					} else if (disruptor::ConsumerResultSeverity::Failure == element.ResultSeverity) {
+					else if (disruptor::ConsumerResultSeverity::Failure == element.ResultSeverity)
 						++numFailures;
-					}
-
-					++i;
 				}
 
-				// 4. call the sink
+				// 3. call the sink
 				auto aggregateResult = m_newTransactionsProcessor(std::move(transactionInfos));
 				aggregateResult.FailureCount += numFailures;
 
-				// 5. indicate input was consumed and processing is complete
+				// 4. indicate input was consumed and processing is complete
 				if (0 == aggregateResult.FailureCount)
 					return aggregateResult.SuccessCount > 0 ? CompleteSuccess() : CompleteNeutral();
 
 				auto shouldBan =
 						aggregateResult.FailureCount >= m_minTransactionFailuresCountForBan
-						&& aggregateResult.FailureCount * 100 / transactions.size() >= m_minTransactionFailuresPercentForBan;
+						&& aggregateResult.FailureCount * 100 / count >= m_minTransactionFailuresPercentForBan;
 				return shouldBan
 						? Abort(validators::ValidationResult::Failure, disruptor::ConsumerResultSeverity::Fatal)
 						: Abort(validators::ValidationResult::Failure);
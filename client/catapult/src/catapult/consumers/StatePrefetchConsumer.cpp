@@ -0,0 +1,139 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "BlockConsumers.h"
+#include "ConsumerResultFactory.h"
+#include "catapult/cache/CatapultCache.h"
+#include "catapult/cache/ReadOnlyCatapultCache.h"
+#include "catapult/model/ResolverContext.h"
+#include "catapult/thread/IoThreadPool.h"
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/post.hpp>
+#include <condition_variable>
+#include <mutex>
+
+namespace catapult { namespace consumers {
+
+	namespace {
+		// tracks posted loads so that they never outlive the consumer, which does not outlive the cache
+		class PendingLoads {
+		public:
+			PendingLoads() : m_numPendingLoads(0)
+			{}
+
+			~PendingLoads() {
+				std::unique_lock<std::mutex> lock(m_mutex);
+				m_condition.wait(lock, [this]() { return 0 == m_numPendingLoads; });
+			}
+
+		public:
+			// the returned token completes the load when it is destroyed, which also happens when the pool drops the load
+			std::shared_ptr<PendingLoads> begin() {
+				{
+					std::lock_guard<std::mutex> lock(m_mutex);
+					++m_numPendingLoads;
+				}
+
+				return std::shared_ptr<PendingLoads>(this, [](auto* pPendingLoads) {
+					std::lock_guard<std::mutex> lock(pPendingLoads->m_mutex);
+					--pPendingLoads->m_numPendingLoads;
+					pPendingLoads->m_condition.notify_all();
+				});
+			}
+
+		private:
+			size_t m_numPendingLoads;
+			std::mutex m_mutex;
+			std::condition_variable m_condition;
+		};
+
+		class BlockStatePrefetchConsumer {
+		public:
+			BlockStatePrefetchConsumer(
+					const cache::CatapultCache& cache,
+					const chain::ExecutionContextConfiguration& executionContextConfig,
+					const std::shared_ptr<const model::NotificationPublisher>& pPublisher,
+					thread::IoThreadPool& pool,
+					uint32_t maxBlocksPerPrefetch,
+					const chain::StateLoader& stateLoader)
+					: m_cache(cache)
+					, m_executionContextConfig(executionContextConfig)
+					, m_pPublisher(pPublisher)
+					, m_pool(pool)
+					, m_maxBlocksPerPrefetch(std::max<uint32_t>(1, maxBlocksPerPrefetch))
+					, m_stateLoader(stateLoader)
+					, m_pPendingLoads(std::make_shared<PendingLoads>())
+			{}
+
+		public:
+			ConsumerResult operator()(const BlockElements& elements) const {
+				if (elements.empty())
+					return Abort(Failure_Consumer_Empty_Input);
+
+				for (auto i = 0u; i < elements.size(); i += m_maxBlocksPerPrefetch) {
+					model::WeakEntityInfos entityInfos;
+					auto endIndex = std::min<size_t>(elements.size(), i + m_maxBlocksPerPrefetch);
+					for (auto j = i; j < endIndex; ++j)
+						model::ExtractEntityInfos(elements[j], entityInfos);
+
+					// load asynchronously so that execution of the blocks can start before all of their state has been loaded
+					auto keys = collectKeys(entityInfos);
+					auto pLoadToken = m_pPendingLoads->begin();
+					boost::asio::post(m_pool.ioContext(), [stateLoader = m_stateLoader, keys = std::move(keys), pLoadToken]() {
+						stateLoader(keys);
+					});
+				}
+
+				return Continue();
+			}
+
+		private:
+			cache::StatePrefetchKeys collectKeys(const model::WeakEntityInfos& entityInfos) const {
+				// keys are resolved against the committed state, so keys depending on preceding (unexecuted) blocks might be
+				// stale, which is acceptable because they are only used to warm the cache
+				// the view is only held while the keys of a single chunk are collected so that commits are not blocked for long
+				auto view = m_cache.createView();
+				auto readOnlyCache = view.toReadOnly();
+				auto resolvers = m_executionContextConfig.ResolverContextFactory(readOnlyCache);
+				return chain::CollectStatePrefetchKeys(entityInfos, *m_pPublisher, resolvers);
+			}
+
+		private:
+			const cache::CatapultCache& m_cache;
+			chain::ExecutionContextConfiguration m_executionContextConfig;
+			std::shared_ptr<const model::NotificationPublisher> m_pPublisher;
+			thread::IoThreadPool& m_pool;
+			uint32_t m_maxBlocksPerPrefetch;
+			chain::StateLoader m_stateLoader;
+			std::shared_ptr<PendingLoads> m_pPendingLoads;
+		};
+	}
+
+	disruptor::ConstBlockConsumer CreateBlockStatePrefetchConsumer(
+			const cache::CatapultCache& cache,
+			const chain::ExecutionContextConfiguration& executionContextConfig,
+			const std::shared_ptr<const model::NotificationPublisher>& pPublisher,
+			thread::IoThreadPool& pool,
+			uint32_t maxBlocksPerPrefetch,
+			const chain::StateLoader& stateLoader) {
+		return BlockStatePrefetchConsumer(cache, executionContextConfig, pPublisher, pool, maxBlocksPerPrefetch, stateLoader);
+	}
+}}
@@ -20,6 +20,7 @@
 **/
 
 #pragma once
+#include "BatchSignatureOptions.h"
 #include "HashCheckOptions.h"
 #include "InputUtils.h"
 #include "catapult/chain/BatchUpdateResult.h"
@@ -55,11 +56,13 @@ namespace catapult { namespace consumers {
 	/// Creates a consumer that runs batch signature validation using \a pPublisher and \a pool for the network with the specified
 	/// generation hash seed (\a generationHashSeed) and calls \a failedTransactionSink for each failure.
 	/// \a randomFiller is used to generate random bytes.
+	/// \a options determine how signatures are batched and distributed across \a pool threads.
 	disruptor::TransactionConsumer CreateTransactionBatchSignatureConsumer(
 			const GenerationHashSeed& generationHashSeed,
 			const crypto::RandomFiller& randomFiller,
 			const std::shared_ptr<const model::NotificationPublisher>& pPublisher,
 			thread::IoThreadPool& pool,
+			const BatchSignatureOptions& options,
 			const chain::FailedTransactionSink& failedTransactionSink);
 
 	/// Prototype for a function that is called with new transactions.
@@ -22,6 +22,8 @@
 #include "Hashes.h"
 #include "catapult/utils/Casting.h"
 #include "catapult/utils/MemoryUtils.h"
+#include <algorithm>
+#include <cstring>
 
 #ifdef __clang__
 #pragma clang diagnostic push
@@ -36,6 +38,12 @@
 #pragma clang diagnostic pop
 #endif
 
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define CATAPULT_SHA3_MULTI_X86 1
+#else
+#define CATAPULT_SHA3_MULTI_X86 0
+#endif
+
 namespace catapult { namespace crypto {
 
 	// region free functions
@@ -104,6 +112,259 @@ namespace catapult { namespace crypto {
 
 	// endregion
 
+	// region Sha3_256Multi
+
+	namespace {
+		void Sha3_256MultiScalar(const RawBuffer* pDataBuffers, size_t numBuffersPerMessage, size_t count, Hash256* pHashes) {
+			for (auto i = 0u; i < count; ++i) {
+				Sha3_256_Builder builder;
+				for (auto j = 0u; j < numBuffersPerMessage; ++j)
+					builder.update(*pDataBuffers++);
+
+				builder.final(pHashes[i]);
+			}
+		}
+
+#if CATAPULT_SHA3_MULTI_X86
+		constexpr size_t Sha3_256_Rate = 136;
+		constexpr size_t Num_Rate_Words = Sha3_256_Rate / sizeof(uint64_t);
+		constexpr size_t Num_State_Words = 25;
+
+		constexpr uint64_t Round_Constants[] = {
+			0x0000000000000001, 0x0000000000008082, 0x800000000000808A, 0x8000000080008000,
+			0x000000000000808B, 0x0000000080000001, 0x8000000080008081, 0x8000000000008009,
+			0x000000000000008A, 0x0000000000000088, 0x0000000080008009, 0x000000008000000A,
+			0x000000008000808B, 0x800000000000008B, 0x8000000000008089, 0x8000000000008003,
+			0x8000000000008002, 0x8000000000000080, 0x000000000000800A, 0x800000008000000A,
+			0x8000000080008081, 0x8000000000008080, 0x0000000080000001, 0x8000000080008008
+		};
+
+		// rotation offsets indexed by x + 5 * y
+		constexpr int Rotation_Offsets[] = {
+			0, 1, 62, 28, 27,
+			36, 44, 6, 55, 20,
+			3, 10, 43, 25, 39,
+			41, 45, 15, 21, 8,
+			18, 2, 61, 56, 14
+		};
+
+		// each lane holds one word of multiple independent keccak states
+		using Lane4 = uint64_t __attribute__((vector_size(32)));
+		using Lane8 = uint64_t __attribute__((vector_size(64)));
+
+		// kernel functions are always inlined so that they are compiled with the instruction set of the dispatch target
+#define KECCAK_INLINE inline __attribute__((always_inline))
+
+		// note: loops are fully unrolled so that all indexes and rotation offsets are compile time constants
+		template<typename TLane>
+		KECCAK_INLINE void KeccakF1600(TLane* state) {
+			for (auto round = 0u; round < 24; ++round) {
+				// theta
+				TLane columns[5];
+#pragma GCC unroll 5
+				for (auto x = 0u; x < 5; ++x)
+					columns[x] = state[x] ^ state[x + 5] ^ state[x + 10] ^ state[x + 15] ^ state[x + 20];
+
+#pragma GCC unroll 5
+				for (auto x = 0u; x < 5; ++x) {
+					const auto& rotated = columns[(x + 1) % 5];
+					auto d = columns[(x + 4) % 5] ^ ((rotated << 1) | (rotated >> 63));
+#pragma GCC unroll 5
+					for (auto y = 0u; y < 25; y += 5)
+						state[y + x] ^= d;
+				}
+
+				// rho and pi
+				TLane permuted[Num_State_Words];
+#pragma GCC unroll 25
+				for (auto index = 0u; index < Num_State_Words; ++index) {
+					auto x = index % 5;
+					auto y = index / 5;
+					auto offset = Rotation_Offsets[index];
+					const auto& word = state[index];
+					permuted[y + 5 * ((2 * x + 3 * y) % 5)] = (word << offset) | (word >> ((64 - offset) & 63));
+				}
+
+				// chi
+#pragma GCC unroll 25
+				for (auto index = 0u; index < Num_State_Words; ++index) {
+					auto y = index - index % 5;
+					auto x = index % 5;
+					state[index] = permuted[index] ^ (~permuted[y + (x + 1) % 5] & permuted[y + (x + 2) % 5]);
+				}
+
+				// iota
+				state[0] ^= Round_Constants[round];
+			}
+		}
+
+		class MessageCursor {
+		public:
+			MessageCursor() : MessageCursor(nullptr, 0)
+			{}
+
+			MessageCursor(const RawBuffer* pBuffers, size_t numBuffers)
+					: m_pBuffers(pBuffers)
+					, m_numRemainingBuffers(numBuffers)
+					, m_bufferOffset(0)
+			{}
+
+		public:
+			// copies the next padded block into pBlock and returns true when it is the final block
+			bool nextBlock(uint8_t* pBlock) {
+				size_t blockSize = 0;
+				while (m_numRemainingBuffers > 0 && blockSize < Sha3_256_Rate) {
+					const auto& buffer = *m_pBuffers;
+					auto chunkSize = std::min(buffer.Size - m_bufferOffset, Sha3_256_Rate - blockSize);
+					if (0 != chunkSize)
+						std::memcpy(pBlock + blockSize, buffer.pData + m_bufferOffset, chunkSize);
+
+					blockSize += chunkSize;
+					m_bufferOffset += chunkSize;
+					if (buffer.Size == m_bufferOffset) {
+						++m_pBuffers;
+						--m_numRemainingBuffers;
+						m_bufferOffset = 0;
+					}
+				}
+
+				if (Sha3_256_Rate == blockSize)
+					return false;
+
+				// sha3 padding (a message that fills complete blocks is followed by a block containing only padding)
+				std::memset(pBlock + blockSize, 0, Sha3_256_Rate - blockSize);
+				pBlock[blockSize] ^= 0x06;
+				pBlock[Sha3_256_Rate - 1] ^= 0x80;
+				return true;
+			}
+
+		private:
+			const RawBuffer* m_pBuffers;
+			size_t m_numRemainingBuffers;
+			size_t m_bufferOffset;
+		};
+
+		template<typename TLane, size_t Num_Lanes>
+		KECCAK_INLINE void Sha3_256MultiLanes(const RawBuffer* pDataBuffers, size_t numBuffersPerMessage, size_t count, Hash256* pHashes) {
+			TLane state[Num_State_Words] = {};
+			MessageCursor cursors[Num_Lanes];
+			size_t messageIndexes[Num_Lanes];
+			bool isLaneActive[Num_Lanes] = {};
+
+			// messages are assigned to lanes as they become free, so messages of different sizes do not stall each other
+			size_t nextMessageIndex = 0;
+			auto assignNextMessage = [&](auto lane) {
+				isLaneActive[lane] = nextMessageIndex < count;
+				if (!isLaneActive[lane])
+					return;
+
+				messageIndexes[lane] = nextMessageIndex;
+				cursors[lane] = MessageCursor(pDataBuffers + nextMessageIndex * numBuffersPerMessage, numBuffersPerMessage);
+				++nextMessageIndex;
+			};
+
+			for (auto lane = 0u; lane < Num_Lanes; ++lane)
+				assignNextMessage(lane);
+
+			uint8_t block[Sha3_256_Rate];
+			uint64_t blockWords[Num_Rate_Words][Num_Lanes];
+			bool isFinalBlock[Num_Lanes] = {};
+			while (std::any_of(isLaneActive, isLaneActive + Num_Lanes, [](auto isActive) { return isActive; })) {
+				// transpose the next block of every active message so that it can be absorbed by all lanes at once
+				for (auto lane = 0u; lane < Num_Lanes; ++lane) {
+					if (!isLaneActive[lane]) {
+						for (auto& words : blockWords)
+							words[lane] = 0;
+
+						continue;
+					}
+
+					isFinalBlock[lane] = cursors[lane].nextBlock(block);
+					for (auto i = 0u; i < Num_Rate_Words; ++i)
+						std::memcpy(&blockWords[i][lane], block + i * sizeof(uint64_t), sizeof(uint64_t));
+				}
+
+				for (auto i = 0u; i < Num_Rate_Words; ++i) {
+					TLane words;
+					std::memcpy(&words, blockWords[i], sizeof(TLane));
+					state[i] ^= words;
+				}
+
+				KeccakF1600(state);
+
+				// squeeze completed messages and reuse their lanes
+				for (auto lane = 0u; lane < Num_Lanes; ++lane) {
+					if (!isLaneActive[lane] || !isFinalBlock[lane])
+						continue;
+
+					auto* pHash = pHashes[messageIndexes[lane]].data();
+					for (auto i = 0u; i < Hash256::Size / sizeof(uint64_t); ++i) {
+						uint64_t word = state[i][lane];
+						std::memcpy(pHash + i * sizeof(uint64_t), &word, sizeof(uint64_t));
+					}
+
+					for (auto& word : state)
+						word[lane] = 0;
+
+					assignNextMessage(lane);
+				}
+			}
+		}
+
+#undef KECCAK_INLINE
+
+		__attribute__((target("avx2")))
+		void Sha3_256MultiAvx2(const RawBuffer* pDataBuffers, size_t numBuffersPerMessage, size_t count, Hash256* pHashes) {
+			Sha3_256MultiLanes<Lane4, 4>(pDataBuffers, numBuffersPerMessage, count, pHashes);
+		}
+
+		__attribute__((target("avx512f")))
+		void Sha3_256MultiAvx512(const RawBuffer* pDataBuffers, size_t numBuffersPerMessage, size_t count, Hash256* pHashes) {
+			Sha3_256MultiLanes<Lane8, 8>(pDataBuffers, numBuffersPerMessage, count, pHashes);
+		}
+
+		size_t DetectMaxLanes() {
+			__builtin_cpu_init();
+			if (__builtin_cpu_supports("avx512f"))
+				return 8;
+
+			return __builtin_cpu_supports("avx2") ? 4 : 1;
+		}
+
+#else
+		size_t DetectMaxLanes() {
+			return 1;
+		}
+#endif
+	}
+
+	void Sha3_256Multi(const RawBuffer* pDataBuffers, size_t numBuffersPerMessage, size_t count, Hash256* pHashes) {
+		Sha3_256Multi(Sha3_256MultiMaxLanes(), pDataBuffers, numBuffersPerMessage, count, pHashes);
+	}
+
+	void Sha3_256Multi(size_t maxLanes, const RawBuffer* pDataBuffers, size_t numBuffersPerMessage, size_t count, Hash256* pHashes) {
+		// a single message cannot benefit from multiple lanes, so use the (faster) openssl implementation
+		auto numLanes = 1 == count ? 1 : std::min(maxLanes, Sha3_256MultiMaxLanes());
+
+#if CATAPULT_SHA3_MULTI_X86
+		if (numLanes >= 8)
+			return Sha3_256MultiAvx512(pDataBuffers, numBuffersPerMessage, count, pHashes);
+
+		if (numLanes >= 4)
+			return Sha3_256MultiAvx2(pDataBuffers, numBuffersPerMessage, count, pHashes);
+#endif
+
+		Sha3_256MultiScalar(pDataBuffers, numBuffersPerMessage, count, pHashes);
+	}
+
+	size_t Sha3_256MultiMaxLanes() {
+		// cpu features cannot change while the process is running, so only detect them once
+		static auto maxLanes = DetectMaxLanes();
+		return maxLanes;
+	}
+
+	// endregion
+
 	// region hash builders
 
 	namespace {
@@ -45,6 +45,18 @@ namespace catapult { namespace crypto {
 	/// Calculates the 256-bit SHA3 hash of \a dataBuffer into \a hash.
 	void Sha3_256(const RawBuffer& dataBuffer, Hash256& hash);
 
+	/// Calculates the 256-bit SHA3 hashes of \a count messages into \a pHashes.
+	/// Each message is the concatenation of \a numBuffersPerMessage consecutive buffers in \a pDataBuffers.
+	/// \note Independent messages are hashed concurrently in simd lanes when supported by the cpu.
+	void Sha3_256Multi(const RawBuffer* pDataBuffers, size_t numBuffersPerMessage, size_t count, Hash256* pHashes);
+
+	/// Calculates the 256-bit SHA3 hashes of \a count messages into \a pHashes using at most \a maxLanes simd lanes.
+	/// Each message is the concatenation of \a numBuffersPerMessage consecutive buffers in \a pDataBuffers.
+	void Sha3_256Multi(size_t maxLanes, const RawBuffer* pDataBuffers, size_t numBuffersPerMessage, size_t count, Hash256* pHashes);
+
+	/// Gets the maximum number of simd lanes used by Sha3_256Multi on the current cpu.
+	size_t Sha3_256MultiMaxLanes();
+
 	/// Calculates the sha256 HMAC of \a input with \a key, producing \a output.
 	void Hmac_Sha256(const RawBuffer& key, const RawBuffer& input, Hash256& output);
 
@@ -0,0 +1,142 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "IncrementalMerkleHashBuilder.h"
+#include "Hashes.h"
+#include "catapult/exceptions.h"
+#include <algorithm>
+
+namespace catapult { namespace crypto {
+
+	MerkleParentHasher CreateMerkleParentHasher() {
+		return [](const auto* pBuffers, auto count, auto* pHashes) {
+			Sha3_256Multi(pBuffers, 2, count, pHashes);
+		};
+	}
+
+	namespace {
+		void SortUnique(std::vector<size_t>& indexes) {
+			std::sort(indexes.begin(), indexes.end());
+			indexes.erase(std::unique(indexes.begin(), indexes.end()), indexes.end());
+		}
+	}
+
+	IncrementalMerkleHashBuilder::IncrementalMerkleHashBuilder(const MerkleParentHasher& parentHasher)
+			: m_parentHasher(parentHasher)
+			, m_levels(1)
+	{}
+
+	size_t IncrementalMerkleHashBuilder::size() const {
+		return m_levels[0].size();
+	}
+
+	void IncrementalMerkleHashBuilder::update(const Hash256& hash) {
+		m_dirtyLeafIndexes.push_back(m_levels[0].size());
+		m_levels[0].push_back(hash);
+	}
+
+	void IncrementalMerkleHashBuilder::replace(size_t index, const Hash256& hash) {
+		if (index >= size())
+			CATAPULT_THROW_OUT_OF_RANGE("cannot replace leaf with out of range index");
+
+		m_levels[0][index] = hash;
+		m_dirtyLeafIndexes.push_back(index);
+	}
+
+	void IncrementalMerkleHashBuilder::removeLast() {
+		if (0 == size())
+			CATAPULT_THROW_OUT_OF_RANGE("cannot remove leaf from empty merkle tree");
+
+		m_levels[0].pop_back();
+
+		// ignore pending changes to removed leaves
+		auto numLeaves = size();
+		m_dirtyLeafIndexes.erase(
+				std::remove_if(m_dirtyLeafIndexes.begin(), m_dirtyLeafIndexes.end(), [numLeaves](auto index) {
+					return index >= numLeaves;
+				}),
+				m_dirtyLeafIndexes.end());
+
+		// the new last leaf might have lost its sibling and the last node of every level is on its path to the root
+		if (0 != numLeaves)
+			m_dirtyLeafIndexes.push_back(numLeaves - 1);
+	}
+
+	void IncrementalMerkleHashBuilder::final(Hash256& hash) {
+		rehash();
+		hash = 0 == size() ? Hash256() : m_levels.back()[0];
+	}
+
+	void IncrementalMerkleHashBuilder::final(std::vector<Hash256>& tree) {
+		rehash();
+		if (0 == size()) {
+			tree.push_back(Hash256());
+			return;
+		}
+
+		// odd levels are padded by duplicating the last node
+		for (const auto& level : m_levels) {
+			tree.insert(tree.end(), level.cbegin(), level.cend());
+			if (level.size() > 1 && 1 == level.size() % 2)
+				tree.push_back(level.back());
+		}
+	}
+
+	void IncrementalMerkleHashBuilder::rehash() {
+		auto dirtyIndexes = std::move(m_dirtyLeafIndexes);
+		m_dirtyLeafIndexes.clear();
+		SortUnique(dirtyIndexes);
+
+		std::vector<RawBuffer> buffers;
+		std::vector<Hash256> parentHashes;
+		auto levelIndex = 0u;
+		for (; m_levels[levelIndex].size() > 1; ++levelIndex) {
+			if (m_levels.size() == levelIndex + 1)
+				m_levels.emplace_back();
+
+			const auto& children = m_levels[levelIndex];
+			auto& parents = m_levels[levelIndex + 1];
+			parents.resize((children.size() + 1) / 2);
+
+			for (auto& index : dirtyIndexes)
+				index /= 2;
+
+			dirtyIndexes.erase(std::unique(dirtyIndexes.begin(), dirtyIndexes.end()), dirtyIndexes.end());
+
+			// if there is an odd number of children, duplicate the last one
+			buffers.clear();
+			for (auto index : dirtyIndexes) {
+				auto childIndex = 2 * index;
+				buffers.push_back(children[childIndex]);
+				buffers.push_back(children[std::min(childIndex + 1, children.size() - 1)]);
+			}
+
+			parentHashes.resize(dirtyIndexes.size());
+			m_parentHasher(buffers.data(), parentHashes.size(), parentHashes.data());
+
+			for (auto i = 0u; i < dirtyIndexes.size(); ++i)
+				parents[dirtyIndexes[i]] = parentHashes[i];
+		}
+
+		// discard levels above the root, which are left over when leaves are removed
+		m_levels.resize(levelIndex + 1);
+	}
+}}
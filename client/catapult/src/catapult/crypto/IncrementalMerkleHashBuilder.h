@@ -0,0 +1,73 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/functions.h"
+#include "catapult/types.h"
+#include <vector>
+
+namespace catapult { namespace crypto {
+
+	/// Calculates \a count merkle parent hashes into \a pHashes, where the i-th parent hash is calculated from the
+	/// (2 * i) and (2 * i + 1) child hash buffers in \a pBuffers.
+	using MerkleParentHasher = consumer<const RawBuffer*, size_t, Hash256*>;
+
+	/// Creates a merkle parent hasher that calculates all parent hashes on the calling thread.
+	MerkleParentHasher CreateMerkleParentHasher();
+
+	/// Builder for creating a merkle hash that retains all intermediate tree levels.
+	/// \note When leaves are added, replaced or removed, only the paths from the changed leaves to the root are rehashed.
+	class IncrementalMerkleHashBuilder {
+	public:
+		/// Creates a new builder that uses \a parentHasher to calculate parent hashes.
+		explicit IncrementalMerkleHashBuilder(const MerkleParentHasher& parentHasher = CreateMerkleParentHasher());
+
+	public:
+		/// Gets the number of leaves.
+		size_t size() const;
+
+	public:
+		/// Adds \a hash as the last leaf of the merkle tree.
+		void update(const Hash256& hash);
+
+		/// Replaces the leaf at \a index with \a hash.
+		void replace(size_t index, const Hash256& hash);
+
+		/// Removes the last leaf of the merkle tree.
+		void removeLast();
+
+	public:
+		/// Calculates the merkle hash into \a hash.
+		void final(Hash256& hash);
+
+		/// Calculates the complete merkle tree into \a tree.
+		/// \note Layout of \a tree is the same as the one produced by MerkleHashBuilder.
+		void final(std::vector<Hash256>& tree);
+
+	private:
+		void rehash();
+
+	private:
+		MerkleParentHasher m_parentHasher;
+		std::vector<std::vector<Hash256>> m_levels;
+		std::vector<size_t> m_dirtyLeafIndexes;
+	};
+}}
@@ -22,6 +22,7 @@
 #include "MerkleHashBuilder.h"
 #include "Hashes.h"
 #include "catapult/functions.h"
+#include <algorithm>
 
 namespace catapult { namespace crypto {
 
@@ -36,30 +37,32 @@ namespace catapult { namespace crypto {
 			// build the merkle tree
 			auto numRemainingHashes = hashes.size();
 			hashConsumer(hashes.data(), hashes.size());
+
+			std::vector<RawBuffer> buffers;
+			std::vector<Hash256> levelHashes;
+			buffers.reserve(numRemainingHashes + 1);
+			levelHashes.reserve(numRemainingHashes / 2 + 1);
 			while (numRemainingHashes > 1) {
 				// merkle tree needs padding in case of an odd number of hashes, need to do before the next round of hashes is
 				// pushed into the vector because nodes with same depth should be consecutive entries in the vector
 				if (1 == numRemainingHashes % 2)
 					hashConsumer(&hashes[numRemainingHashes - 1], 1);
 
-				auto i = 0u;
-				for (; i < numRemainingHashes; i += 2) {
-					if (i + 1 < numRemainingHashes) {
-						Sha3_256({ hashes[i].data(), 2 * Hash256::Size }, hashes[i / 2]);
-						hashConsumer(&hashes[i / 2], 1);
-						continue;
-					}
-
-					// if there is an odd number of hashes, duplicate the last one
-					Sha3_256_Builder builder;
-					builder.update(hashes[i]);
-					builder.update(hashes[i]);
-					builder.final(hashes[i / 2]);
-					hashConsumer(&hashes[i / 2], 1);
-					++numRemainingHashes;
+				// if there is an odd number of hashes, duplicate the last one
+				buffers.clear();
+				for (auto i = 0u; i < numRemainingHashes; i += 2) {
+					buffers.push_back(hashes[i]);
+					buffers.push_back(hashes[i + 1 < numRemainingHashes ? i + 1 : i]);
 				}
 
-				numRemainingHashes /= 2;
+				// all nodes of a level are independent, so hash them together
+				auto numLevelHashes = buffers.size() / 2;
+				levelHashes.resize(numLevelHashes);
+				Sha3_256Multi(buffers.data(), 2, numLevelHashes, levelHashes.data());
+
+				std::copy(levelHashes.cbegin(), levelHashes.cend(), hashes.begin());
+				hashConsumer(hashes.data(), numLevelHashes);
+				numRemainingHashes = numLevelHashes;
 			}
 
 			return hashes[0];
@@ -21,17 +21,22 @@
 
 #pragma once
 #include "KeyPair.h"
+#include "catapult/utils/MemoryArena.h"
 #include <vector>
 
 namespace catapult { namespace crypto {
 
+	/// Signature input buffers.
+	/// \note Buffers can optionally be allocated from a memory arena.
+	using SignatureInputBuffers = std::vector<RawBuffer, utils::ArenaAllocator<RawBuffer>>;
+
 	/// Signature input.
 	struct SignatureInput {
 		/// Public key.
 		const Key& PublicKey;
 
 		/// Buffers.
-		std::vector<RawBuffer> Buffers;
+		SignatureInputBuffers Buffers;
 
 		/// Signature.
 		const catapult::Signature& Signature;
@@ -22,12 +22,14 @@
 #pragma once
 #include "BaseSetDefaultTraits.h"
 #include "BaseSetFindIterator.h"
+#include "BaseSetUtils.h"
 #include "DeltaElements.h"
 #include "catapult/utils/NonCopyable.h"
 #include "catapult/exceptions.h"
 #include <memory>
 #include <type_traits>
 #include <unordered_map>
+#include <vector>
 
 namespace catapult { namespace deltaset {
 
@@ -163,6 +165,12 @@ namespace catapult { namespace deltaset {
 		}
 
 		FindConstIterator find(const KeyType& key, ImmutableTypeTag) const {
+			if (!m_prefetchedKeys.empty()) {
+				auto prefetchedKeyIter = m_prefetchedKeys.find(key);
+				if (m_prefetchedKeys.cend() != prefetchedKeyIter)
+					return prefetchedKeyIter->second ? FindConstIterator(m_prefetchedElements.find(key)) : FindConstIterator();
+			}
+
 			auto originalIter = m_originalElements.find(key);
 			return m_originalElements.cend() != originalIter ? FindConstIterator(std::move(originalIter)) : FindConstIterator();
 		}
@@ -179,7 +187,7 @@ namespace catapult { namespace deltaset {
 		/// Searches for \a key in this set.
 		/// Returns \c true if it is found or \c false if it is not found.
 		bool contains(const KeyType& key) const {
-			return !Contains(m_removedElements, key) && (Contains(m_addedElements, key) || Contains(m_originalElements, key));
+			return !Contains(m_removedElements, key) && (Contains(m_addedElements, key) || containsOriginal(key));
 		}
 
 	private:
@@ -188,6 +196,56 @@ namespace catapult { namespace deltaset {
 			return set.cend() != set.find(key);
 		}
 
+		bool containsOriginal(const KeyType& key) const {
+			if (!m_prefetchedKeys.empty()) {
+				auto prefetchedKeyIter = m_prefetchedKeys.find(key);
+				if (m_prefetchedKeys.cend() != prefetchedKeyIter)
+					return prefetchedKeyIter->second;
+			}
+
+			return Contains(m_originalElements, key);
+		}
+
+	public:
+		/// Loads all original elements identified by \a keys into memory using a single batched lookup.
+		/// \note This is a no-op when the original set does not support batched lookups (e.g. it is memory-based).
+		void prefetch(const std::vector<KeyType>& keys) {
+			std::vector<KeyType> pendingKeys;
+			pendingKeys.reserve(keys.size());
+			for (const auto& key : keys) {
+				if (m_prefetchedKeys.cend() == m_prefetchedKeys.find(key))
+					pendingKeys.push_back(key);
+			}
+
+			if (pendingKeys.empty())
+				return;
+
+			// use argument dependent lookup to resolve TryFindAll
+			auto isPrefetched = TryFindAll(m_originalElements, pendingKeys, [this](const auto& key, const auto& storage) {
+				m_prefetchedKeys[key] = true;
+				m_prefetchedElements.insert(storage);
+			});
+
+			if (!isPrefetched)
+				return;
+
+			// remember missing keys too so that subsequent lookups of new elements do not hit the original set
+			for (const auto& key : pendingKeys)
+				m_prefetchedKeys.emplace(key, false);
+		}
+
+		/// Creates a loader that reads all original elements identified by its keys using a single batched lookup
+		/// and discards them.
+		/// \note The loader only accesses the original set, so it can be called without holding the lock of this delta,
+		///       but it must not be called after the original set has been destroyed.
+		auto createOriginalElementsLoader() const {
+			const auto* pOriginalElements = &m_originalElements;
+			return [pOriginalElements](const std::vector<KeyType>& keys) {
+				// use argument dependent lookup to resolve TryFindAll
+				TryFindAll(*pOriginalElements, keys, [](const auto&, const auto&) {});
+			};
+		}
+
 	public:
 		/// Inserts \a element into this set.
 		/// \note The algorithm relies on the data used for comparing elements being immutable.
@@ -215,7 +273,7 @@ namespace catapult { namespace deltaset {
 				m_removedElements.erase(removedIter);
 				pTargetElements = Contains(m_addedElements, key) ? &m_addedElements : &m_copiedElements;
 				insertResult = InsertResult::Unremoved;
-			} else if (Contains(m_originalElements, key)) {
+			} else if (containsOriginal(key)) {
 				pTargetElements = &m_copiedElements; // original element, possibly modified
 				insertResult = InsertResult::Updated;
 			} else {
@@ -243,7 +301,7 @@ namespace catapult { namespace deltaset {
 				return InsertResult::Unremoved;
 			}
 
-			if (Contains(m_originalElements, key) || Contains(m_addedElements, key))
+			if (containsOriginal(key) || Contains(m_addedElements, key))
 				return InsertResult::Redundant;
 
 			markKey(key);
@@ -311,6 +369,8 @@ namespace catapult { namespace deltaset {
 			m_addedElements.clear();
 			m_removedElements.clear();
 			m_copiedElements.clear();
+			m_prefetchedElements.clear();
+			m_prefetchedKeys.clear();
 
 			m_generationId = 1;
 			m_keyGenerationIdMap.clear();
@@ -345,15 +405,15 @@ namespace catapult { namespace deltaset {
 
 	private:
 		// for sorted containers, use map because no hasher is specified
-		template<typename T, typename = void>
-		struct KeyGenerationIdMap {
-			using Type = std::map<KeyType, uint32_t, typename T::key_compare>;
+		template<typename T, typename TValue, typename = void>
+		struct KeyMap {
+			using Type = std::map<KeyType, TValue, typename T::key_compare>;
 		};
 
 		// for hashed containers, use unordered_map because hasher is specified
-		template<typename T>
-		struct KeyGenerationIdMap<T, utils::traits::is_type_expression_t<typename T::hasher>> {
-			using Type = std::unordered_map<KeyType, uint32_t, typename T::hasher, typename T::key_equal>;
+		template<typename T, typename TValue>
+		struct KeyMap<T, TValue, utils::traits::is_type_expression_t<typename T::hasher>> {
+			using Type = std::unordered_map<KeyType, TValue, typename T::hasher, typename T::key_equal>;
 		};
 
 	private:
@@ -362,8 +422,12 @@ namespace catapult { namespace deltaset {
 		MemorySetType m_removedElements;
 		MemorySetType m_copiedElements;
 
+		// original elements loaded by prefetch and a flag per prefetched key indicating whether or not it was found
+		MemorySetType m_prefetchedElements;
+		typename KeyMap<SetType, bool>::Type m_prefetchedKeys;
+
 		uint32_t m_generationId;
-		typename KeyGenerationIdMap<SetType>::Type m_keyGenerationIdMap;
+		typename KeyMap<SetType, uint32_t>::Type m_keyGenerationIdMap;
 
 	private:
 		template<typename TElementTraits2, typename TSetTraits2>
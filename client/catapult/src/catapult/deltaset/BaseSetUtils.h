@@ -41,6 +41,13 @@ namespace catapult { namespace deltaset {
 			container.insert(pElement);
 	}
 
+	/// Searches for all \a keys in \a set using a single batched lookup and passes each found key and element to \a consumer.
+	/// Returns \c false if \a set does not support batched lookups, which is the default.
+	template<typename TSet, typename TKeys, typename TConsumer>
+	bool TryFindAll(const TSet&, const TKeys&, TConsumer) {
+		return false;
+	}
+
 	/// Removes all \a elements from the container (\a pContainer).
 	template<typename TContainer, typename TElements>
 	void RemoveAll(TContainer& container, const TElements& elements) {
@@ -23,6 +23,7 @@
 #include "BaseSetCommitPolicy.h"
 #include "DeltaElements.h"
 #include <memory>
+#include <vector>
 
 namespace catapult { namespace deltaset {
 
@@ -155,6 +156,23 @@ namespace catapult { namespace deltaset {
 					: ConditionalIterator(m_pContainer2->find(key), MemoryFlag());
 		}
 
+		/// Searches for all \a keys in this set using a single batched lookup and passes each found key and element to \a consumer.
+		/// Returns \c false if this set is memory-based and does not support batched lookups.
+		template<typename TConsumer>
+		bool tryFindAll(const std::vector<typename TKeyTraits::KeyType>& keys, TConsumer consumer) const {
+			if (!m_pContainer1)
+				return false;
+
+			auto iters = m_pContainer1->find(keys);
+			auto endIter = m_pContainer1->cend();
+			for (auto i = 0u; i < keys.size(); ++i) {
+				if (endIter != iters[i])
+					consumer(keys[i], *iters[i]);
+			}
+
+			return true;
+		}
+
 	public:
 		/// Applies all changes in \a deltas to the underlying container.
 		void update(const DeltaElements<MemorySetType>& deltas) {
@@ -203,6 +221,13 @@ namespace catapult { namespace deltaset {
 		return *set.m_pContainer2;
 	}
 
+	/// Searches for all \a keys in \a container using a single batched lookup and passes each found key and element to \a consumer.
+	/// \note Specialization for ConditionalContainer.
+	template<typename TKeyTraits, typename TStorageSet, typename TMemorySet, typename TKeys, typename TConsumer>
+	bool TryFindAll(const ConditionalContainer<TKeyTraits, TStorageSet, TMemorySet>& container, const TKeys& keys, TConsumer consumer) {
+		return container.tryFindAll(keys, consumer);
+	}
+
 	/// Applies all changes in \a deltas to \a container.
 	/// \note Specialization for ConditionalContainer.
 	template<typename TKeyTraits, typename TStorageSet, typename TMemorySet>
@@ -24,6 +24,7 @@
 #include "catapult/utils/Casting.h"
 #include "catapult/utils/Hashers.h"
 #include "catapult/utils/SpinLock.h"
+#include <map>
 #include <unordered_map>
 #include <vector>
 
@@ -74,11 +75,24 @@ namespace catapult { namespace disruptor {
 
 		using GroupedRangesMap = std::unordered_map<RangeGroupKey, std::vector<EntityRange>, RangeGroupKeyHasher, RangeGroupKeyEquality>;
 
+		struct CoalescedRanges {
+			std::vector<TAnnotatedEntityRange> Ranges;
+			size_t Size = 0;
+		};
+
 	public:
 		/// Creates a batch range dispatcher around \a dispatcher with specified \a equalityStrategy.
 		BatchRangeDispatcher(ConsumerDispatcher& dispatcher, model::NodeIdentityEqualityStrategy equalityStrategy)
+				: BatchRangeDispatcher(dispatcher, equalityStrategy, 0)
+		{}
+
+		/// Creates a batch range dispatcher around \a dispatcher with specified \a equalityStrategy that coalesces ranges from
+		/// different sources into single elements containing at most \a maxCoalescedSize entities.
+		/// \note Coalescing is disabled when \a maxCoalescedSize is zero.
+		BatchRangeDispatcher(ConsumerDispatcher& dispatcher, model::NodeIdentityEqualityStrategy equalityStrategy, size_t maxCoalescedSize)
 				: m_dispatcher(dispatcher)
 				, m_equalityStrategy(equalityStrategy)
+				, m_maxCoalescedSize(maxCoalescedSize)
 				, m_rangesMap(CreateGroupedRangesMap(m_equalityStrategy))
 		{}
 
@@ -105,10 +119,40 @@ namespace catapult { namespace disruptor {
 				rangesMap = std::move(m_rangesMap);
 			}
 
+			if (0 == m_maxCoalescedSize) {
+				for (auto& pair : rangesMap) {
+					auto mergedRange = EntityRange::MergeRanges(std::move(pair.second));
+					m_dispatcher.processElement(ConsumerInput({ std::move(mergedRange), pair.first.SourceIdentity }, pair.first.Source));
+				}
+
+				return;
+			}
+
+			// ranges from different identities are coalesced, but ranges from different input sources are always kept separate
+			std::map<InputSource, CoalescedRanges> coalescedRangesMap;
 			for (auto& pair : rangesMap) {
 				auto mergedRange = EntityRange::MergeRanges(std::move(pair.second));
-				m_dispatcher.processElement(ConsumerInput({ std::move(mergedRange), pair.first.SourceIdentity }, pair.first.Source));
+				auto& coalescedRanges = coalescedRangesMap[pair.first.Source];
+				if (!coalescedRanges.Ranges.empty() && coalescedRanges.Size + mergedRange.size() > m_maxCoalescedSize)
+					dispatch(std::move(coalescedRanges), pair.first.Source);
+
+				coalescedRanges.Size += mergedRange.size();
+				coalescedRanges.Ranges.push_back({ std::move(mergedRange), pair.first.SourceIdentity });
 			}
+
+			for (auto& pair : coalescedRangesMap)
+				dispatch(std::move(pair.second), pair.first);
+		}
+
+	private:
+		void dispatch(CoalescedRanges&& coalescedRanges, InputSource source) {
+			// ranges from a single identity don't need to be partitioned
+			if (1 == coalescedRanges.Ranges.size())
+				m_dispatcher.processElement(ConsumerInput(std::move(coalescedRanges.Ranges[0]), source));
+			else
+				m_dispatcher.processElement(ConsumerInput(std::move(coalescedRanges.Ranges), source));
+
+			coalescedRanges = CoalescedRanges();
 		}
 
 	private:
@@ -119,6 +163,7 @@ namespace catapult { namespace disruptor {
 	private:
 		ConsumerDispatcher& m_dispatcher;
 		model::NodeIdentityEqualityStrategy m_equalityStrategy;
+		size_t m_maxCoalescedSize;
 		GroupedRangesMap m_rangesMap;
 		mutable utils::SpinLock m_lock;
 	};
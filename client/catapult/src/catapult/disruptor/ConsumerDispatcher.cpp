@@ -23,11 +23,14 @@
 #include "ConsumerEntry.h"
 #include "catapult/thread/ThreadInfo.h"
 #include "catapult/utils/Functional.h"
+#include <algorithm>
 #include <thread>
 
 namespace catapult { namespace disruptor {
 
 	namespace {
+		constexpr auto Num_Spin_Iterations = 1000u;
+
 		const ConsumerDispatcherOptions& CheckOptions(const ConsumerDispatcherOptions& options) {
 			if (!options.DispatcherName || 0 == options.DisruptorSlotCount || utils::FileSize() == options.DisruptorMaxMemorySize)
 				CATAPULT_THROW_INVALID_ARGUMENT("consumer dispatcher options are invalid");
@@ -35,6 +38,39 @@ namespace catapult { namespace disruptor {
 			return options;
 		}
 
+		const std::vector<DisruptorConsumerStage>& CheckStages(const std::vector<DisruptorConsumerStage>& consumerStages) {
+			for (const auto& consumerStage : consumerStages) {
+				if (consumerStage.empty())
+					CATAPULT_THROW_INVALID_ARGUMENT("consumer stages must not be empty");
+			}
+
+			// inspector is run by the last consumer, so there must be exactly one
+			if (!consumerStages.empty() && 1 != consumerStages.back().size())
+				CATAPULT_THROW_INVALID_ARGUMENT("last consumer stage must contain a single consumer");
+
+			return consumerStages;
+		}
+
+		std::vector<DisruptorConsumerStage> ToSingleConsumerStages(const std::vector<DisruptorConsumer>& consumers) {
+			std::vector<DisruptorConsumerStage> consumerStages;
+			for (const auto& consumer : consumers)
+				consumerStages.push_back({ consumer });
+
+			return consumerStages;
+		}
+
+		std::vector<size_t> CalculateStageStartIndexes(const std::vector<DisruptorConsumerStage>& consumerStages) {
+			std::vector<size_t> stageStartIndexes{ 0 };
+			for (const auto& consumerStage : consumerStages)
+				stageStartIndexes.push_back(stageStartIndexes.back() + consumerStage.size());
+
+			return stageStartIndexes;
+		}
+
+		uint64_t GetElapsedMicroseconds(DisruptorElement::Clock::time_point start, DisruptorElement::Clock::time_point end) {
+			return end <= start ? 0 : static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+		}
+
 		void LogCompletion(const DisruptorElement& element, const DisruptorBarriers& barriers, size_t elementTraceInterval) {
 			if (!IsIntervalElementId(element.id(), elementTraceInterval))
 				return;
@@ -55,33 +91,48 @@ namespace catapult { namespace disruptor {
 			const ConsumerDispatcherOptions& options,
 			const std::vector<DisruptorConsumer>& consumers,
 			const DisruptorInspector& inspector)
+			: ConsumerDispatcher(options, ToSingleConsumerStages(consumers), inspector)
+	{}
+
+	ConsumerDispatcher::ConsumerDispatcher(
+			const ConsumerDispatcherOptions& options,
+			const std::vector<DisruptorConsumerStage>& consumerStages,
+			const DisruptorInspector& inspector)
 			: NamedObjectMixin(CheckOptions(options).DispatcherName)
 			, m_options(options)
 			, m_keepRunning(true)
-			, m_barriers(consumers.size() + 1)
+			, m_barriers(CheckStages(consumerStages).size() + 1)
+			, m_stageStartIndexes(CalculateStageStartIndexes(consumerStages))
+			, m_consumerBarriers(m_stageStartIndexes.back())
 			, m_disruptor(m_options.DisruptorSlotCount, m_options.ElementTraceInterval)
 			, m_inspector(inspector)
 			, m_numActiveElements(0)
 			, m_memorySize(0) {
+		for (auto i = 0u; i < m_consumerBarriers.size(); ++i)
+			m_consumerStatistics.push_back(std::make_unique<ConsumerStatistics>());
+
 		auto currentLevel = 0u;
-		for (const auto& consumer : consumers) {
-			ConsumerEntry consumerEntry(currentLevel++);
-			m_threads.spawn([pThis = this, consumerEntry, consumer]() mutable {
-				thread::SetThreadName(std::to_string(consumerEntry.level()) + " " + pThis->name());
-				while (pThis->m_keepRunning) {
-					auto* pDisruptorElement = pThis->tryNext(consumerEntry);
-					if (!pDisruptorElement) {
-						std::this_thread::sleep_for(std::chrono::milliseconds(10));
-						continue;
+		auto currentIndex = 0u;
+		for (const auto& consumerStage : consumerStages) {
+			for (const auto& consumer : consumerStage) {
+				ConsumerEntry consumerEntry(currentLevel, currentIndex++);
+				m_threads.spawn([pThis = this, consumerEntry, consumer]() mutable {
+					thread::SetThreadName(std::to_string(consumerEntry.index()) + " " + pThis->name());
+					while (pThis->m_keepRunning) {
+						auto* pDisruptorElement = pThis->next(consumerEntry);
+						if (!pDisruptorElement)
+							break;
+
+						auto result = pThis->process(consumer, consumerEntry, *pDisruptorElement);
+						if (CompletionStatus::Aborted == result.CompletionStatus)
+							pThis->m_disruptor.markSkipped(consumerEntry.position(), result);
+
+						pThis->advance(consumerEntry);
 					}
+				});
+			}
 
-					auto result = consumer(pDisruptorElement->input());
-					if (CompletionStatus::Aborted == result.CompletionStatus)
-						pThis->m_disruptor.markSkipped(consumerEntry.position(), result);
-
-					pThis->advance(consumerEntry);
-				}
-			});
+			++currentLevel;
 		}
 
 		CATAPULT_LOG(info) << m_options.DispatcherName << " ConsumerDispatcher spawned " << m_threads.size() << " workers";
@@ -93,6 +144,9 @@ namespace catapult { namespace disruptor {
 
 	void ConsumerDispatcher::shutdown() {
 		m_keepRunning = false;
+		for (auto level = 0u; level < m_barriers.size(); ++level)
+			m_barriers[level].notifyAll();
+
 		m_threads.join();
 	}
 
@@ -116,6 +170,26 @@ namespace catapult { namespace disruptor {
 		return utils::FileSize::FromBytes(m_memorySize.load());
 	}
 
+	const ConsumerStatistics& ConsumerDispatcher::consumerStatistics(size_t index) const {
+		if (index >= m_consumerStatistics.size())
+			CATAPULT_THROW_INVALID_ARGUMENT_1("consumer index is out of range", index);
+
+		return *m_consumerStatistics[index];
+	}
+
+	size_t ConsumerDispatcher::consumerLag(size_t index) const {
+		if (index >= m_consumerStatistics.size())
+			CATAPULT_THROW_INVALID_ARGUMENT_1("consumer index is out of range", index);
+
+		auto stageStartIter = std::upper_bound(m_stageStartIndexes.cbegin(), m_stageStartIndexes.cend(), index);
+		auto level = static_cast<size_t>(std::distance(m_stageStartIndexes.cbegin(), stageStartIter)) - 1;
+
+		// read the consumer position first because it can never be ahead of the barrier of its stage
+		auto consumerPosition = m_consumerBarriers[index].position();
+		auto readyPosition = m_barriers[level].position();
+		return static_cast<size_t>(readyPosition - consumerPosition);
+	}
+
 	DisruptorElement* ConsumerDispatcher::tryNext(ConsumerEntry& consumerEntry) {
 		while (true) {
 			auto consumerBarrierPosition = m_barriers[consumerEntry.level()].position();
@@ -130,13 +204,75 @@ namespace catapult { namespace disruptor {
 		}
 	}
 
+	DisruptorElement* ConsumerDispatcher::next(ConsumerEntry& consumerEntry) {
+		auto numSpinIterations = 0u;
+		while (m_keepRunning) {
+			auto* pDisruptorElement = tryNext(consumerEntry);
+			if (pDisruptorElement)
+				return pDisruptorElement;
+
+			auto shouldSpin = ConsumerWaitStrategy::Busy_Spin == m_options.WaitStrategy
+					|| (ConsumerWaitStrategy::Spin_Then_Block == m_options.WaitStrategy && numSpinIterations++ < Num_Spin_Iterations);
+			if (shouldSpin) {
+				std::this_thread::yield();
+				continue;
+			}
+
+			// block until the barrier of the preceding stage moves past the current position (or the dispatcher is shutdown)
+			m_barriers[consumerEntry.level()].wait(consumerEntry.position(), m_keepRunning);
+			numSpinIterations = 0;
+		}
+
+		return nullptr;
+	}
+
+	size_t ConsumerDispatcher::stageSize(size_t level) const {
+		return m_stageStartIndexes[level + 1] - m_stageStartIndexes[level];
+	}
+
+	PositionType ConsumerDispatcher::stagePosition(size_t level) const {
+		auto position = m_consumerBarriers[m_stageStartIndexes[level]].position();
+		for (auto i = m_stageStartIndexes[level] + 1; i < m_stageStartIndexes[level + 1]; ++i)
+			position = std::min(position, m_consumerBarriers[i].position());
+
+		return position;
+	}
+
+	ConsumerResult ConsumerDispatcher::process(
+			const DisruptorConsumer& consumer,
+			const ConsumerEntry& consumerEntry,
+			DisruptorElement& element) {
+		auto& statistics = *m_consumerStatistics[consumerEntry.index()];
+		auto startTime = DisruptorElement::Clock::now();
+		statistics.WaitTimes.record(GetElapsedMicroseconds(element.readyTime(), startTime));
+
+		auto result = consumer(element.input());
+
+		auto endTime = DisruptorElement::Clock::now();
+		statistics.ProcessingTimes.record(GetElapsedMicroseconds(startTime, endTime));
+
+		// ready time is only updated by single consumer stages in order to avoid concurrent writes,
+		// so waits measured after a parallel stage include the processing time of that stage
+		if (1 == stageSize(consumerEntry.level()))
+			element.setReadyTime(endTime);
+
+		return result;
+	}
+
 	void ConsumerDispatcher::advance(ConsumerEntry& consumerEntry) {
 		auto consumerPosition = consumerEntry.position();
 		consumerEntry.advance();
-		m_barriers[consumerEntry.level() + 1].advance();
+		m_consumerBarriers[consumerEntry.index()].advance();
+
+		// the next stage can only process an element after all consumers in the current stage have processed it
+		auto level = consumerEntry.level();
+		if (1 == stageSize(level))
+			m_barriers[level + 1].advance();
+		else
+			m_barriers[level + 1].advanceTo(stagePosition(level));
 
 		// if advance was called by the last consumer, then run the inspector on the (current) thread of the last consumer
-		if (consumerEntry.level() + 1 != m_barriers.size() - 1)
+		if (level + 1 != m_barriers.size() - 1)
 			return;
 
 		auto& element = m_disruptor.elementAt(consumerPosition);
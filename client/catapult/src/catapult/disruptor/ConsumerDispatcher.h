@@ -21,6 +21,7 @@
 
 #pragma once
 #include "ConsumerDispatcherOptions.h"
+#include "ConsumerStatistics.h"
 #include "Disruptor.h"
 #include "DisruptorConsumer.h"
 #include "DisruptorInspector.h"
@@ -46,6 +47,15 @@ namespace catapult { namespace disruptor {
 		/// Creates a dispatcher of \a consumers configured with \a options.
 		ConsumerDispatcher(const ConsumerDispatcherOptions& options, const std::vector<DisruptorConsumer>& consumers);
 
+		/// Creates a dispatcher of \a consumerStages configured with \a options.
+		/// All consumers within a stage process each element concurrently and the next stage only starts processing an element
+		/// after all consumers in the preceding stage have finished processing it.
+		/// Inspector (\a inspector) runs within a thread of the last consumer, so the last stage must contain a single consumer.
+		ConsumerDispatcher(
+				const ConsumerDispatcherOptions& options,
+				const std::vector<DisruptorConsumerStage>& consumerStages,
+				const DisruptorInspector& inspector);
+
 		~ConsumerDispatcher();
 
 	public:
@@ -74,11 +84,27 @@ namespace catapult { namespace disruptor {
 		/// Gets the cumulative size of all elements currently in the disruptor.
 		utils::FileSize memorySize() const;
 
+		/// Gets the processing statistics of the consumer at \a index.
+		/// \note Consumers are indexed in stage order.
+		const ConsumerStatistics& consumerStatistics(size_t index) const;
+
+		/// Gets the number of elements ready for or being processed by the consumer at \a index.
+		/// \note Consumers are indexed in stage order.
+		size_t consumerLag(size_t index) const;
+
 	private:
 		DisruptorElement* tryNext(ConsumerEntry& consumerEntry);
 
+		DisruptorElement* next(ConsumerEntry& consumerEntry);
+
 		void advance(ConsumerEntry& consumerEntry);
 
+		size_t stageSize(size_t level) const;
+
+		PositionType stagePosition(size_t level) const;
+
+		ConsumerResult process(const DisruptorConsumer& consumer, const ConsumerEntry& consumerEntry, DisruptorElement& element);
+
 		bool canProcessNextElement() const;
 
 		ProcessingCompleteFunc wrap(const ProcessingCompleteFunc& processingComplete, utils::FileSize inputMemorySize);
@@ -86,9 +112,12 @@ namespace catapult { namespace disruptor {
 	private:
 		ConsumerDispatcherOptions m_options;
 		std::atomic_bool m_keepRunning;
-		DisruptorBarriers m_barriers;
+		DisruptorBarriers m_barriers; // one barrier per stage (and one for the end of the pipeline)
+		std::vector<size_t> m_stageStartIndexes; // index of the first consumer in each stage (and the total number of consumers)
+		DisruptorBarriers m_consumerBarriers; // one barrier per consumer (tracks consumer positions)
 		Disruptor m_disruptor;
 		DisruptorInspector m_inspector;
+		std::vector<std::unique_ptr<ConsumerStatistics>> m_consumerStatistics;
 		thread::ThreadGroup m_threads;
 		std::atomic<size_t> m_numActiveElements;
 		std::atomic<uint64_t> m_memorySize;
@@ -24,6 +24,18 @@
 
 namespace catapult { namespace disruptor {
 
+	/// Strategies for waiting for new elements when a consumer has no work.
+	enum class ConsumerWaitStrategy {
+		/// Consumer repeatedly yields until an element is available.
+		Busy_Spin,
+
+		/// Consumer yields for a bounded number of iterations and then blocks until its barrier is advanced.
+		Spin_Then_Block,
+
+		/// Consumer blocks until its barrier is advanced.
+		Block
+	};
+
 	/// Consumer dispatcher options.
 	struct ConsumerDispatcherOptions {
 	public:
@@ -34,6 +46,7 @@ namespace catapult { namespace disruptor {
 				, DisruptorMaxMemorySize(utils::FileSize::FromMegabytes(1024))
 				, ElementTraceInterval(1)
 				, ShouldThrowWhenFull(true)
+				, WaitStrategy(ConsumerWaitStrategy::Spin_Then_Block)
 		{}
 
 	public:
@@ -51,5 +64,8 @@ namespace catapult { namespace disruptor {
 
 		/// \c true if the dispatcher should throw when full, \c false if it should return an error.
 		bool ShouldThrowWhenFull;
+
+		/// Strategy used by consumers waiting for new elements.
+		ConsumerWaitStrategy WaitStrategy;
 	};
 }}
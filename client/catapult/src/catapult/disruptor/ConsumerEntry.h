@@ -27,9 +27,11 @@ namespace catapult { namespace disruptor {
 	/// Holds information about a consumer.
 	class ConsumerEntry {
 	public:
-		/// Creates an entry with \a level and \a position.
-		explicit ConsumerEntry(size_t level)
+		/// Creates an entry for the consumer with \a index at \a level.
+		/// \note Multiple consumers can share the same level.
+		ConsumerEntry(size_t level, size_t index)
 				: m_level(level)
+				, m_index(index)
 				, m_position(0)
 		{}
 
@@ -49,8 +51,14 @@ namespace catapult { namespace disruptor {
 			return m_level;
 		}
 
+		/// Gets the consumer index.
+		size_t index() const {
+			return m_index;
+		}
+
 	private:
 		const size_t m_level;
+		const size_t m_index;
 		PositionType m_position;
 	};
 }}
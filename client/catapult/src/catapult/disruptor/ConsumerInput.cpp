@@ -27,13 +27,53 @@ namespace catapult { namespace disruptor {
 
 	// region constructors
 
+	namespace {
+		template<typename TAnnotatedRange>
+		auto MergeAnnotatedRanges(std::vector<TAnnotatedRange>&& annotatedRanges, ConsumerInputPartitions& partitions) {
+			using EntityRange = decltype(TAnnotatedRange::Range);
+
+			std::vector<EntityRange> ranges;
+			size_t startIndex = 0;
+			for (auto& annotatedRange : annotatedRanges) {
+				if (annotatedRange.Range.empty())
+					continue;
+
+				auto size = annotatedRange.Range.size();
+				partitions.push_back({ annotatedRange.SourceIdentity, startIndex, size, ConsumerResult::Continue() });
+				ranges.push_back(std::move(annotatedRange.Range));
+				startIndex += size;
+			}
+
+			return EntityRange::MergeRanges(std::move(ranges));
+		}
+	}
+
 	ConsumerInput::ConsumerInput() : m_source(InputSource::Unknown)
 	{}
 
 	ConsumerInput::ConsumerInput(model::AnnotatedBlockRange&& range, InputSource source)
-			: m_blockRange(std::move(range.Range))
-			, m_source(source)
+			: m_source(source)
+			, m_sourceIdentity(range.SourceIdentity) {
+		setBlockRange(std::move(range.Range));
+	}
+
+	ConsumerInput::ConsumerInput(model::AnnotatedTransactionRange&& range, InputSource source)
+			: m_source(source)
 			, m_sourceIdentity(range.SourceIdentity) {
+		setTransactionRange(std::move(range.Range));
+	}
+
+	ConsumerInput::ConsumerInput(std::vector<model::AnnotatedBlockRange>&& ranges, InputSource source) : m_source(source) {
+		setBlockRange(MergeAnnotatedRanges(std::move(ranges), m_partitions));
+	}
+
+	ConsumerInput::ConsumerInput(std::vector<model::AnnotatedTransactionRange>&& ranges, InputSource source) : m_source(source) {
+		setTransactionRange(MergeAnnotatedRanges(std::move(ranges), m_partitions));
+	}
+
+	void ConsumerInput::setBlockRange(model::BlockRange&& range) {
+		m_blockRange = std::move(range);
+
 		uint64_t memorySize = 0;
 		m_blockElements.reserve(m_blockRange.size());
 		for (const auto& block : m_blockRange) {
@@ -49,10 +89,9 @@ namespace catapult { namespace disruptor {
 		}
 	}
 
-	ConsumerInput::ConsumerInput(model::AnnotatedTransactionRange&& range, InputSource source)
-			: m_transactionRange(std::move(range.Range))
-			, m_source(source)
-			, m_sourceIdentity(range.SourceIdentity) {
+	void ConsumerInput::setTransactionRange(model::TransactionRange&& range) {
+		m_transactionRange = std::move(range);
+
 		uint64_t memorySize = 0;
 		m_transactionElements.reserve(m_transactionRange.size());
 		for (const auto& transaction : m_transactionRange) {
@@ -113,6 +152,14 @@ namespace catapult { namespace disruptor {
 		return m_sourceIdentity;
 	}
 
+	ConsumerInputPartitions& ConsumerInput::partitions() {
+		return m_partitions;
+	}
+
+	const ConsumerInputPartitions& ConsumerInput::partitions() const {
+		return m_partitions;
+	}
+
 	utils::FileSize ConsumerInput::memorySize() const {
 		return m_memorySize;
 	}
@@ -169,7 +216,11 @@ namespace catapult { namespace disruptor {
 		if (input.empty())
 			out << "empty ";
 
-		out << "from " << input.source() << " with size " << input.memorySize();
+		out << "from " << input.source();
+		if (!input.partitions().empty())
+			out << " (" << input.partitions().size() << " identities)";
+
+		out << " with size " << input.memorySize();
 		return out;
 	}
 
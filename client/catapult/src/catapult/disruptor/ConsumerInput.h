@@ -25,9 +25,29 @@
 #include "catapult/model/AnnotatedEntityRange.h"
 #include "catapult/model/RangeTypes.h"
 #include "catapult/utils/FileSize.h"
+#include <vector>
 
 namespace catapult { namespace disruptor {
 
+	/// Consecutive entities within a consumer input that originate from the same source.
+	struct ConsumerInputPartition {
+		/// Identity of the source.
+		model::NodeIdentity SourceIdentity;
+
+		/// Index of the first entity.
+		size_t StartIndex;
+
+		/// Number of entities.
+		size_t Size;
+
+		/// Result of processing the entities.
+		/// \note This is only set by consumers that abort or complete processing of entities from one source independently of others.
+		ConsumerResult Result;
+	};
+
+	/// Container of ConsumerInputPartition.
+	using ConsumerInputPartitions = std::vector<ConsumerInputPartition>;
+
 	/// Consumer input composed of a range of entities augmented with metadata.
 	class ConsumerInput {
 	public:
@@ -40,6 +60,12 @@ namespace catapult { namespace disruptor {
 		/// Creates a consumer input around a transaction \a range with an optional input source (\a inputSource).
 		explicit ConsumerInput(model::AnnotatedTransactionRange&& range, InputSource source = InputSource::Unknown);
 
+		/// Creates a consumer input around block \a ranges from multiple sources with an optional input source (\a inputSource).
+		explicit ConsumerInput(std::vector<model::AnnotatedBlockRange>&& ranges, InputSource source = InputSource::Unknown);
+
+		/// Creates a consumer input around transaction \a ranges from multiple sources with an optional input source (\a inputSource).
+		explicit ConsumerInput(std::vector<model::AnnotatedTransactionRange>&& ranges, InputSource source = InputSource::Unknown);
+
 	public:
 		/// Returns \c true if this input is empty and has no elements.
 		bool empty() const;
@@ -67,8 +93,17 @@ namespace catapult { namespace disruptor {
 		InputSource source() const;
 
 		/// Gets the (optional) source identity.
+		/// \note This is not set when this input is composed of ranges from multiple sources.
 		const model::NodeIdentity& sourceIdentity() const;
 
+		/// Gets the partitions of the entities by source.
+		/// \note This is only set when this input is composed of ranges from multiple sources.
+		ConsumerInputPartitions& partitions();
+
+		/// Gets the const partitions of the entities by source.
+		/// \note This is only set when this input is composed of ranges from multiple sources.
+		const ConsumerInputPartitions& partitions() const;
+
 		/// Gets the memory size of all elements associated with this input.
 		utils::FileSize memorySize() const;
 
@@ -83,6 +118,11 @@ namespace catapult { namespace disruptor {
 		/// Insertion operator for outputting \a input to \a out.
 		friend std::ostream& operator<<(std::ostream& out, const ConsumerInput& input);
 
+	private:
+		void setBlockRange(model::BlockRange&& range);
+
+		void setTransactionRange(model::TransactionRange&& range);
+
 	private:
 		// backing memory
 		model::BlockRange m_blockRange;
@@ -94,6 +134,7 @@ namespace catapult { namespace disruptor {
 
 		InputSource m_source;
 		model::NodeIdentity m_sourceIdentity;
+		ConsumerInputPartitions m_partitions;
 		utils::FileSize m_memorySize;
 
 		// used by formatting
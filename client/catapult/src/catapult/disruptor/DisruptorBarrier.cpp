@@ -0,0 +1,58 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "DisruptorBarrier.h"
+
+namespace catapult { namespace disruptor {
+
+	void DisruptorBarrier::advanceTo(PositionType position) {
+		auto currentPosition = m_position.load();
+		while (currentPosition < position) {
+			if (m_position.compare_exchange_weak(currentPosition, position)) {
+				if (0 != m_numWaiters)
+					notifyAll();
+
+				return;
+			}
+		}
+	}
+
+	void DisruptorBarrier::wait(PositionType position, const std::atomic_bool& keepWaiting) {
+		// waiter count is incremented before position is checked so that any concurrent advance will either be observed here
+		// or will observe the waiter and notify under the mutex
+		++m_numWaiters;
+
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_condition.wait(lock, [this, position, &keepWaiting]() {
+			return position != m_position || !keepWaiting;
+		});
+
+		--m_numWaiters;
+	}
+
+	void DisruptorBarrier::notifyAll() {
+		{
+			std::lock_guard<std::mutex> guard(m_mutex);
+		}
+
+		m_condition.notify_all();
+	}
+}}
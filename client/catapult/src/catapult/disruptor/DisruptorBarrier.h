@@ -23,6 +23,8 @@
 #include "DisruptorTypes.h"
 #include "catapult/utils/Logging.h"
 #include <atomic>
+#include <condition_variable>
+#include <mutex>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -36,13 +38,20 @@ namespace catapult { namespace disruptor {
 		DisruptorBarrier(size_t level, PositionType position)
 				: m_level(level)
 				, m_position(position)
+				, m_numWaiters(0)
 		{}
 
-		/// Advances the barrier.
+		/// Advances the barrier and wakes all waiters.
 		inline void advance() {
 			++m_position;
+			if (0 != m_numWaiters)
+				notifyAll();
 		}
 
+		/// Advances the barrier to \a position if it is behind \a position and wakes all waiters.
+		/// \note This can be called concurrently by multiple threads.
+		void advanceTo(PositionType position);
+
 		/// Gets the level of the barrier.
 		inline size_t level() const {
 			return m_level;
@@ -53,8 +62,20 @@ namespace catapult { namespace disruptor {
 			return m_position;
 		}
 
+	public:
+		/// Blocks until the barrier position is different from \a position or \a keepWaiting is \c false.
+		void wait(PositionType position, const std::atomic_bool& keepWaiting);
+
+		/// Wakes all waiters.
+		/// \note This needs to be called after changing a flag passed to wait.
+		void notifyAll();
+
 	private:
 		const size_t m_level;
 		std::atomic<PositionType> m_position;
+
+		std::atomic<size_t> m_numWaiters;
+		std::mutex m_mutex;
+		std::condition_variable m_condition;
 	};
 }}
@@ -20,6 +20,7 @@
 **/
 
 #include "DisruptorConsumer.h"
+#include <algorithm>
 
 namespace catapult { namespace disruptor {
 
@@ -40,6 +41,56 @@ namespace catapult { namespace disruptor {
 
 			return consumers;
 		}
+
+		bool IsAborted(const ConsumerResult& result) {
+			return CompletionStatus::Aborted == result.CompletionStatus;
+		}
+
+		ConsumerResult InvokeTransactionConsumer(const TransactionConsumer& transactionConsumer, ConsumerInput& input) {
+			auto& partitions = input.partitions();
+			if (partitions.empty())
+				return transactionConsumer(input.transactions());
+
+			auto& elements = input.transactions();
+			std::vector<ConsumerResultSeverity> initialSeverities;
+			initialSeverities.reserve(elements.size());
+			for (const auto& element : elements)
+				initialSeverities.push_back(element.ResultSeverity);
+
+			auto result = transactionConsumer(elements);
+			if (!IsAborted(result))
+				return result;
+
+			// attribute the abort only to the sources of the transactions rejected by the consumer
+			auto numAttributedPartitions = 0u;
+			for (auto& partition : partitions) {
+				if (IsAborted(partition.Result))
+					continue;
+
+				auto begin = partition.StartIndex;
+				auto end = partition.StartIndex + partition.Size;
+				auto isRejected = false;
+				for (auto i = begin; i < end; ++i)
+					isRejected = isRejected || initialSeverities[i] != elements[i].ResultSeverity;
+
+				if (!isRejected)
+					continue;
+
+				// skip all remaining transactions from the same source, as if they had been pushed in a separate input
+				partition.Result = result;
+				for (auto i = begin; i < end; ++i) {
+					if (ConsumerResultSeverity::Success == elements[i].ResultSeverity)
+						elements[i].ResultSeverity = ConsumerResultSeverity::Neutral;
+				}
+
+				++numAttributedPartitions;
+			}
+
+			auto areAllPartitionsAborted = std::all_of(partitions.cbegin(), partitions.cend(), [](const auto& partition) {
+				return IsAborted(partition.Result);
+			});
+			return 0 == numAttributedPartitions || areAllPartitionsAborted ? result : ConsumerResult::Continue();
+		}
 	}
 
 	std::vector<DisruptorConsumer> DisruptorConsumersFromBlockConsumers(const std::vector<BlockConsumer>& blockConsumers) {
@@ -50,8 +101,6 @@ namespace catapult { namespace disruptor {
 
 	std::vector<DisruptorConsumer> DisruptorConsumersFromTransactionConsumers(
 			const std::vector<TransactionConsumer>& transactionConsumers) {
-		return DisruptorConsumersFromTypedConsumers(transactionConsumers, [](const auto& transactionConsumer, auto& input) {
-			return transactionConsumer(input.transactions());
-		});
+		return DisruptorConsumersFromTypedConsumers(transactionConsumers, InvokeTransactionConsumer);
 	}
 }}
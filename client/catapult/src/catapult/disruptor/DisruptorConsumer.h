@@ -32,6 +32,10 @@ namespace catapult { namespace disruptor {
 	/// Disruptor consumer function.
 	using DisruptorConsumer = DisruptorConsumerT<ConsumerInput>;
 
+	/// Disruptor consumers that process each element concurrently.
+	/// \note Consumers in a stage with more than one consumer must not modify their input.
+	using DisruptorConsumerStage = std::vector<DisruptorConsumer>;
+
 	/// Const disruptor consumer function.
 	using ConstDisruptorConsumer = DisruptorConsumerT<const ConsumerInput>;
 
@@ -51,6 +55,8 @@ namespace catapult { namespace disruptor {
 	std::vector<DisruptorConsumer> DisruptorConsumersFromBlockConsumers(const std::vector<BlockConsumer>& blockConsumers);
 
 	/// Maps \a transactionConsumers to disruptor consumers so that they can be used to create a ConsumerDispatcher.
+	/// \note When an input composed of transactions from multiple sources is aborted, the abort is only attributed to the sources
+	///       of the transactions rejected by the aborting consumer and processing of all other transactions continues.
 	std::vector<DisruptorConsumer> DisruptorConsumersFromTransactionConsumers(
 			const std::vector<TransactionConsumer>& transactionConsumers);
 }}
@@ -22,16 +22,22 @@
 #pragma once
 #include "ConsumerInput.h"
 #include "catapult/utils/SpinLock.h"
+#include <chrono>
 
 namespace catapult { namespace disruptor {
 
 	/// Augments consumer input with disruptor metadata.
 	class DisruptorElement {
+	public:
+		/// Clock used for timing element processing.
+		using Clock = std::chrono::steady_clock;
+
 	public:
 		/// Creates a default disruptor element.
 		DisruptorElement()
 				: m_id(static_cast<uint64_t>(-1))
 				, m_processingComplete([](auto, auto) {})
+				, m_readyTime(Clock::now())
 				, m_pSpinLock(std::make_unique<utils::SpinLock>())
 		{}
 
@@ -40,6 +46,7 @@ namespace catapult { namespace disruptor {
 				: m_input(std::move(input))
 				, m_id(id)
 				, m_processingComplete(processingComplete)
+				, m_readyTime(Clock::now())
 				, m_pSpinLock(std::make_unique<utils::SpinLock>())
 		{}
 
@@ -71,16 +78,31 @@ namespace catapult { namespace disruptor {
 			return m_result;
 		}
 
+		/// Gets the time at which the element became ready for processing by its current consumer.
+		Clock::time_point readyTime() const {
+			return m_readyTime;
+		}
+
 	public:
 		/// Marks the element as skipped at \a position with \a result.
+		/// \note When the element is already skipped, \a result is only used when it is more severe than the existing result.
 		void markSkipped(PositionType position, const ConsumerResult& result) {
 			utils::SpinLockGuard guard(*m_pSpinLock);
+			if (CompletionStatus::Aborted == m_result.CompletionStatus && result.ResultSeverity <= m_result.ResultSeverity)
+				return;
+
 			m_result.CompletionStatus = CompletionStatus::Aborted;
 			m_result.CompletionCode = result.CompletionCode;
 			m_result.ResultSeverity = result.ResultSeverity;
 			m_result.FinalConsumerPosition = position;
 		}
 
+		/// Sets the time at which the element became ready for processing by its next consumer to \a readyTime.
+		/// \note Consumer barriers ensure that the element is never accessed by two consumers concurrently.
+		void setReadyTime(Clock::time_point readyTime) {
+			m_readyTime = readyTime;
+		}
+
 		/// Calls the completion handler for the element.
 		void markProcessingComplete() {
 			m_processingComplete(m_id, m_result);
@@ -91,6 +113,7 @@ namespace catapult { namespace disruptor {
 		DisruptorElementId m_id;
 		ProcessingCompleteFunc m_processingComplete;
 		ConsumerCompletionResult m_result;
+		Clock::time_point m_readyTime;
 		std::unique_ptr<utils::SpinLock> m_pSpinLock; // unique_ptr to allow moving of element
 	};
 
@@ -55,6 +55,42 @@ namespace catapult { namespace extensions {
 		});
 	}
 
+	namespace {
+		constexpr auto Consumer_Counter_Percentile = 99u;
+
+		template<typename TSupplier>
+		void AddDispatcherConsumerCounter(
+				ServiceLocator& locator,
+				const std::string& dispatcherName,
+				const std::string& counterName,
+				size_t index,
+				TSupplier supplier) {
+			locator.registerServiceCounter<disruptor::ConsumerDispatcher>(dispatcherName, counterName, [index, supplier](
+					const auto& dispatcher) {
+				return static_cast<uint64_t>(supplier(dispatcher, index));
+			});
+		}
+	}
+
+	void AddDispatcherConsumerCounters(
+			ServiceLocator& locator,
+			const std::string& dispatcherName,
+			const std::string& counterPrefix,
+			const std::vector<std::string>& consumerNames) {
+		for (auto i = 0u; i < consumerNames.size(); ++i) {
+			auto namePrefix = counterPrefix + " " + consumerNames[i] + " ";
+			AddDispatcherConsumerCounter(locator, dispatcherName, namePrefix + "WAIT", i, [](const auto& dispatcher, auto index) {
+				return dispatcher.consumerStatistics(index).WaitTimes.percentile(Consumer_Counter_Percentile);
+			});
+			AddDispatcherConsumerCounter(locator, dispatcherName, namePrefix + "PROC", i, [](const auto& dispatcher, auto index) {
+				return dispatcher.consumerStatistics(index).ProcessingTimes.percentile(Consumer_Counter_Percentile);
+			});
+			AddDispatcherConsumerCounter(locator, dispatcherName, namePrefix + "LAG", i, [](const auto& dispatcher, auto index) {
+				return dispatcher.consumerLag(index);
+			});
+		}
+	}
+
 	thread::Task CreateBatchTransactionTask(TransactionBatchRangeDispatcher& dispatcher, const std::string& name) {
 		return thread::CreateNamedTask("batch " + name + " task", [&dispatcher]() {
 			dispatcher.dispatch();
@@ -42,6 +42,16 @@ namespace catapult { namespace extensions {
 	/// Adds dispatcher counters with prefix \a counterPrefix to \a locator for a dispatcher named \a dispatcherName.
 	void AddDispatcherCounters(ServiceLocator& locator, const std::string& dispatcherName, const std::string& counterPrefix);
 
+	/// Adds per consumer counters with prefix \a counterPrefix to \a locator for all consumers of a dispatcher named \a dispatcherName.
+	/// Consumers are identified by \a consumerNames, which must be in stage order.
+	/// \note For each consumer, the 99th percentile wait and processing times (in microseconds) and the current lag (in elements)
+	///       are exposed.
+	void AddDispatcherConsumerCounters(
+			ServiceLocator& locator,
+			const std::string& dispatcherName,
+			const std::string& counterPrefix,
+			const std::vector<std::string>& consumerNames);
+
 	/// Transaction batch range dispatcher.
 	using TransactionBatchRangeDispatcher = disruptor::BatchRangeDispatcher<model::AnnotatedTransactionRange>;
 
@@ -20,6 +20,7 @@
 **/
 
 #include "ExecutionConfigurationFactory.h"
+#include "catapult/chain/StatePrefetcher.h"
 #include "catapult/model/NotificationPublisher.h"
 #include "catapult/plugins/PluginManager.h"
 
@@ -34,6 +35,11 @@ namespace catapult { namespace extensions {
 		executionConfig.ResolverContextFactory = [&pluginManager](const auto& cache) {
 			return pluginManager.createResolverContext(cache);
 		};
+
+		// prefetching only pays off when state is loaded from disk
+		if (pluginManager.storageConfig().PreferCacheDatabase)
+			executionConfig.Prefetcher = chain::CreateStatePrefetcher(executionConfig, executionConfig.pNotificationPublisher);
+
 		return executionConfig;
 	}
 }}
@@ -211,6 +211,9 @@ namespace catapult { namespace extensions {
 			const config::NodeConfiguration& nodeConfig,
 			const cache::CatapultCache& cache,
 			const model::ChainScore& score) {
+		// state must not be saved while committed changes are still being written
+		cache.waitForPendingWrites();
+
 		SetCommitStep(dataDirectory, consumers::CommitOperationStep::Blocks_Written);
 
 		LocalNodeStateSerializer serializer(dataDirectory.dir("state.tmp"));
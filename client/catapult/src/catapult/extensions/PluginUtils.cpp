@@ -33,6 +33,7 @@ namespace catapult { namespace extensions {
 		storageConfig.PreferCacheDatabase = config.Node.EnableCacheDatabaseStorage;
 		storageConfig.CacheDatabaseDirectory = (std::filesystem::path(config.User.DataDirectory) / "statedb").generic_string();
 		storageConfig.CacheDatabaseConfig = config.Node.CacheDatabase;
+		storageConfig.MaxStatePathKeysPerRequest = config.Node.MaxStatePathKeysPerRequest;
 		return storageConfig;
 	}
 
@@ -21,7 +21,9 @@
 
 #pragma once
 #include "catapult/ionet/Packet.h"
+#include "catapult/ionet/PacketEntityUtils.h"
 #include "catapult/ionet/PacketHandlers.h"
+#include "catapult/tree/PatriciaTreeBatchProof.h"
 #include "catapult/tree/PatriciaTreeSerializer.h"
 #include "catapult/utils/Casting.h"
 
@@ -54,4 +56,41 @@ namespace catapult { namespace handlers {
 			context.response(ionet::PacketPayload(pResponsePacket));
 		});
 	}
+
+	/// Registers a handler in \a handlers that responds with serialized deduplicated state paths for multiple keys
+	/// produced by querying \a cache.
+	/// \note Requests with more than \a maxKeys keys are rejected.
+	template<typename TRequestTraits, typename TCache>
+	void RegisterBatchStatePathHandler(ionet::ServerPacketHandlers& handlers, const TCache& cache, uint32_t maxKeys) {
+		handlers.registerHandler(TRequestTraits::Packet_Type, [&cache, maxKeys](const auto& packet, auto& context) {
+			using KeyType = typename TRequestTraits::KeyType;
+			if (TRequestTraits::Packet_Type != packet.Type)
+				return;
+
+			auto keysRange = ionet::ExtractFixedSizeStructuresFromPacket<KeyType>(packet);
+			if (keysRange.empty())
+				return;
+
+			if (keysRange.size() > maxKeys) {
+				CATAPULT_LOG(warning) << "rejecting batch state path request with " << keysRange.size() << " keys (max " << maxKeys << ")";
+				return;
+			}
+
+			std::vector<KeyType> keys(keysRange.cbegin(), keysRange.cend());
+			tree::PatriciaTreeBatchProof proof;
+			{
+				auto view = cache.createView();
+				view->tryLookup(keys, proof);
+			}
+
+			// serialize paths even if lookups failed (to provide proofs that keys do not exist in state)
+			auto serializedProof = tree::PatriciaTreeBatchProofSerializer::Serialize(proof);
+
+			auto payloadSize = utils::checked_cast<size_t, uint32_t>(serializedProof.size());
+			auto pResponsePacket = ionet::CreateSharedPacket<ionet::Packet>(payloadSize);
+			pResponsePacket->Type = TRequestTraits::Packet_Type;
+			utils::memcpy_cond(pResponsePacket->Data(), serializedProof.data(), serializedProof.size());
+			context.response(ionet::PacketPayload(pResponsePacket));
+		});
+	}
 }}
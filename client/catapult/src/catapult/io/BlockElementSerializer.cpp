@@ -20,9 +20,11 @@
 **/
 
 #include "BlockElementSerializer.h"
+#include "BufferInputStreamAdapter.h"
 #include "PodIoUtils.h"
 #include "Stream.h"
 #include "catapult/utils/MemoryUtils.h"
+#include <cstring>
 
 namespace catapult { namespace io {
 
@@ -116,4 +118,50 @@ namespace catapult { namespace io {
 	}
 
 	// endregion
+
+	// region ReadBlockElementView
+
+	namespace {
+		struct BlockElementViewHolder {
+		public:
+			BlockElementViewHolder(const model::Block& block, const std::shared_ptr<const void>& pBufferOwner)
+					: pOwner(pBufferOwner)
+					, Element(block)
+			{}
+
+		public:
+			std::shared_ptr<const void> pOwner;
+			model::BlockElement Element;
+		};
+	}
+
+	std::shared_ptr<model::BlockElement> ReadBlockElementView(const RawBuffer& buffer, const std::shared_ptr<const void>& pBufferOwner) {
+		uint32_t size = 0;
+		if (buffer.Size >= sizeof(uint32_t))
+			std::memcpy(&size, buffer.pData, sizeof(uint32_t));
+
+		if (size < sizeof(model::BlockHeader) || size > buffer.Size)
+			CATAPULT_THROW_FILE_IO_ERROR("buffer does not contain a valid block");
+
+		// reference the block data in place
+		const auto& block = reinterpret_cast<const model::Block&>(*buffer.pData);
+		auto pHolder = std::make_shared<BlockElementViewHolder>(block, pBufferOwner);
+		auto pBlockElement = std::shared_ptr<model::BlockElement>(pHolder, &pHolder->Element);
+
+		// read metadata following the block data
+		RawBuffer metadataBuffer{ buffer.pData + size, buffer.Size - size };
+		BufferInputStreamAdapter<RawBuffer> inputStream(metadataBuffer);
+		inputStream.read(pBlockElement->EntityHash);
+		inputStream.read(pBlockElement->GenerationHash);
+
+		ReadTransactionHashes(inputStream, *pBlockElement);
+		ReadSubCacheMerkleRoots(inputStream, pBlockElement->SubCacheMerkleRoots);
+
+		if (!inputStream.eof())
+			CATAPULT_THROW_FILE_IO_ERROR("additional data after block element view");
+
+		return pBlockElement;
+	}
+
+	// endregion
 }}
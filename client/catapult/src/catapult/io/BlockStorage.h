@@ -25,6 +25,7 @@
 #include "catapult/model/RangeTypes.h"
 #include "catapult/utils/NonCopyable.h"
 #include <memory>
+#include <vector>
 
 namespace catapult { namespace io {
 
@@ -43,6 +44,12 @@ namespace catapult { namespace io {
 		/// Saves \a blockElement.
 		virtual void saveBlock(const model::BlockElement& blockElement) = 0;
 
+		/// Saves \a blockElements, which are expected to have consecutive heights.
+		virtual void saveBlocks(const std::vector<model::BlockElement>& blockElements) {
+			for (const auto& blockElement : blockElements)
+				saveBlock(blockElement);
+		}
+
 		/// Drops all blocks after \a height.
 		virtual void dropBlocksAfter(Height height) = 0;
 	};
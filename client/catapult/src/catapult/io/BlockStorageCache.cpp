@@ -21,6 +21,7 @@
 
 #include "BlockStorageCache.h"
 #include "MoveBlockFiles.h"
+#include "RecentBlockElementCache.h"
 #include "catapult/model/Elements.h"
 #include "catapult/utils/MemoryUtils.h"
 
@@ -35,6 +36,10 @@ namespace catapult { namespace io {
 	// region CachedData
 
 	struct CachedData {
+	public:
+		explicit CachedData(utils::FileSize maxBlockElementCacheSize) : m_recentBlockElements(maxBlockElementCacheSize)
+		{}
+
 	public:
 		Height height() const {
 			return m_pBlockElement ? m_pBlockElement->Block.Height : Height(0);
@@ -62,8 +67,19 @@ namespace catapult { namespace io {
 			m_pBlockElement.reset();
 		}
 
+	public:
+		RecentBlockElementCache& recentBlockElements() const {
+			// cache is logically const because it only caches data from the underlying storage
+			return m_recentBlockElements;
+		}
+
+		bool isRecentBlockElementCacheEnabled() const {
+			return 0 != m_recentBlockElements.maxMemorySize().bytes();
+		}
+
 	private:
 		std::shared_ptr<const model::BlockElement> m_pBlockElement;
+		mutable RecentBlockElementCache m_recentBlockElements;
 	};
 
 	// endregion
@@ -72,7 +88,7 @@ namespace catapult { namespace io {
 
 	BlockStorageView::BlockStorageView(
 			const BlockStorage& storage,
-			utils::SpinReaderWriterLock::ReaderLockGuard&& readLock,
+			utils::StripedReaderWriterLock::ReaderLockGuard&& readLock,
 			const CachedData& cachedData)
 			: m_storage(storage)
 			, m_readLock(std::move(readLock))
@@ -92,6 +108,9 @@ namespace catapult { namespace io {
 		if (m_cachedData.contains(height))
 			return m_cachedData.block(height);
 
+		if (m_cachedData.isRecentBlockElementCacheEnabled())
+			return BlockElementAsSharedBlock(loadRecentBlockElement(height));
+
 		return m_storage.loadBlock(height);
 	}
 
@@ -100,6 +119,9 @@ namespace catapult { namespace io {
 		if (m_cachedData.contains(height))
 			return m_cachedData.blockElement(height);
 
+		if (m_cachedData.isRecentBlockElementCacheEnabled())
+			return loadRecentBlockElement(height);
+
 		return m_storage.loadBlockElement(height);
 	}
 
@@ -108,6 +130,17 @@ namespace catapult { namespace io {
 		return m_storage.loadBlockStatementData(height);
 	}
 
+	std::shared_ptr<const model::BlockElement> BlockStorageView::loadRecentBlockElement(Height height) const {
+		auto& recentBlockElements = m_cachedData.recentBlockElements();
+		auto pBlockElement = recentBlockElements.find(height);
+		if (pBlockElement)
+			return pBlockElement;
+
+		pBlockElement = m_storage.loadBlockElement(height);
+		recentBlockElements.insert(pBlockElement);
+		return pBlockElement;
+	}
+
 	void BlockStorageView::requireHeight(Height height, const char* description) const {
 		auto chainHeight = this->chainHeight();
 		if (height <= chainHeight)
@@ -125,7 +158,7 @@ namespace catapult { namespace io {
 	BlockStorageModifier::BlockStorageModifier(
 			BlockStorage& storage,
 			PrunableBlockStorage& stagingStorage,
-			utils::SpinReaderWriterLock::WriterLockGuard&& writeLock,
+			utils::StripedReaderWriterLock::WriterLockGuard&& writeLock,
 			CachedData& cachedData)
 			: m_storage(storage)
 			, m_stagingStorage(stagingStorage)
@@ -139,8 +172,7 @@ namespace catapult { namespace io {
 	}
 
 	void BlockStorageModifier::saveBlocks(const std::vector<model::BlockElement>& blockElements) {
-		for (const auto& blockElement : blockElements)
-			m_stagingStorage.saveBlock(blockElement);
+		m_stagingStorage.saveBlocks(blockElements);
 	}
 
 	void BlockStorageModifier::dropBlocksAfter(Height height) {
@@ -152,7 +184,9 @@ namespace catapult { namespace io {
 		// 1. apply staging changes to permananent storage
 		MoveBlockFiles(m_stagingStorage, m_storage, m_saveStartHeight + Height(1));
 
-		// 2. update cache
+		// 2. update cache (all blocks after save start height might have been replaced)
+		m_cachedData.recentBlockElements().removeAfter(m_saveStartHeight);
+
 		auto newChainHeight = m_storage.chainHeight();
 		if (newChainHeight > Height(0))
 			m_cachedData.update(m_storage.loadBlockElement(newChainHeight));
@@ -164,10 +198,13 @@ namespace catapult { namespace io {
 
 	// region BlockStorageCache
 
-	BlockStorageCache::BlockStorageCache(std::unique_ptr<BlockStorage>&& pStorage, std::unique_ptr<PrunableBlockStorage>&& pStagingStorage)
+	BlockStorageCache::BlockStorageCache(
+			std::unique_ptr<BlockStorage>&& pStorage,
+			std::unique_ptr<PrunableBlockStorage>&& pStagingStorage,
+			utils::FileSize maxBlockElementCacheSize)
 			: m_pStorage(std::move(pStorage))
 			, m_pStagingStorage(std::move(pStagingStorage))
-			, m_pCachedData(std::make_unique<CachedData>()) {
+			, m_pCachedData(std::make_unique<CachedData>(maxBlockElementCacheSize)) {
 		m_pCachedData->update(m_pStorage->loadBlockElement(m_pStorage->chainHeight()));
 	}
 
@@ -183,5 +220,9 @@ namespace catapult { namespace io {
 		return BlockStorageModifier(*m_pStorage, *m_pStagingStorage, std::move(writeLock), *m_pCachedData);
 	}
 
+	const RecentBlockElementCache& BlockStorageCache::recentBlockElementCache() const {
+		return m_pCachedData->recentBlockElements();
+	}
+
 	// endregion
 }}
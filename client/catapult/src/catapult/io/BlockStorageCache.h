@@ -21,9 +21,15 @@
 
 #pragma once
 #include "BlockStorage.h"
-#include "catapult/utils/SpinReaderWriterLock.h"
+#include "catapult/utils/FileSize.h"
+#include "catapult/utils/StripedReaderWriterLock.h"
 
-namespace catapult { namespace io { struct CachedData; } }
+namespace catapult {
+	namespace io {
+		struct CachedData;
+		class RecentBlockElementCache;
+	}
+}
 
 namespace catapult { namespace io {
 
@@ -33,7 +39,7 @@ namespace catapult { namespace io {
 		/// Creates a view around \a storage and cache data (\a cachedData) with lock context \a readLock.
 		BlockStorageView(
 				const BlockStorage& storage,
-				utils::SpinReaderWriterLock::ReaderLockGuard&& readLock,
+				utils::StripedReaderWriterLock::ReaderLockGuard&& readLock,
 				const CachedData& cachedData);
 
 	public:
@@ -53,11 +59,12 @@ namespace catapult { namespace io {
 		std::pair<std::vector<uint8_t>, bool> loadBlockStatementData(Height height) const;
 
 	private:
+		std::shared_ptr<const model::BlockElement> loadRecentBlockElement(Height height) const;
 		void requireHeight(Height height, const char* description) const;
 
 	private:
 		const BlockStorage& m_storage;
-		utils::SpinReaderWriterLock::ReaderLockGuard m_readLock;
+		utils::StripedReaderWriterLock::ReaderLockGuard m_readLock;
 		const CachedData& m_cachedData;
 	};
 
@@ -68,7 +75,7 @@ namespace catapult { namespace io {
 		BlockStorageModifier(
 				BlockStorage& storage,
 				PrunableBlockStorage& stagingStorage,
-				utils::SpinReaderWriterLock::WriterLockGuard&& writeLock,
+				utils::StripedReaderWriterLock::WriterLockGuard&& writeLock,
 				CachedData& cachedData);
 
 	public:
@@ -87,17 +94,21 @@ namespace catapult { namespace io {
 	private:
 		BlockStorage& m_storage;
 		PrunableBlockStorage& m_stagingStorage;
-		utils::SpinReaderWriterLock::WriterLockGuard m_writeLock;
+		utils::StripedReaderWriterLock::WriterLockGuard m_writeLock;
 		CachedData& m_cachedData;
 		Height m_saveStartHeight;
 	};
 
 	/// Cache around a BlockStorage.
-	/// \note Currently this "cache" provides synchronization and support for two-phase commit.
+	/// \note This cache provides synchronization, support for two-phase commit and caching of recently used block elements.
 	class BlockStorageCache {
 	public:
 		/// Creates a new cache around \a pStorage that uses \a pStagingStorage for staging blocks in order to enable two-phase commit.
-		BlockStorageCache(std::unique_ptr<BlockStorage>&& pStorage, std::unique_ptr<PrunableBlockStorage>&& pStagingStorage);
+		/// Recently used block elements with a total estimated size of at most \a maxBlockElementCacheSize are cached in memory.
+		BlockStorageCache(
+				std::unique_ptr<BlockStorage>&& pStorage,
+				std::unique_ptr<PrunableBlockStorage>&& pStagingStorage,
+				utils::FileSize maxBlockElementCacheSize = utils::FileSize());
 
 		/// Destroys the cache.
 		~BlockStorageCache();
@@ -109,10 +120,13 @@ namespace catapult { namespace io {
 		/// Gets a write only view of the storage.
 		BlockStorageModifier modifier();
 
+		/// Gets the cache of recently used block elements.
+		const RecentBlockElementCache& recentBlockElementCache() const;
+
 	private:
 		std::unique_ptr<BlockStorage> m_pStorage;
 		std::unique_ptr<PrunableBlockStorage> m_pStagingStorage;
 		std::unique_ptr<CachedData> m_pCachedData;
-		mutable utils::SpinReaderWriterLock m_lock;
+		mutable utils::StripedReaderWriterLock m_lock;
 	};
 }}
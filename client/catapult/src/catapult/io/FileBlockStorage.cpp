@@ -25,6 +25,7 @@
 #include "BufferedFileStream.h"
 #include "FilesystemUtils.h"
 #include "PodIoUtils.h"
+#include "StringOutputStream.h"
 #include "catapult/config/CatapultDataDirectory.h"
 #include "catapult/utils/MemoryUtils.h"
 #include "catapult/preprocessor.h"
@@ -33,14 +34,24 @@ namespace catapult { namespace io {
 
 	// region ctor
 
-	FileBlockStorage::FileBlockStorage(const std::string& dataDirectory, uint32_t fileDatabaseBatchSize, FileBlockStorageMode mode)
+	FileBlockStorage::FileBlockStorage(
+			const std::string& dataDirectory,
+			uint32_t fileDatabaseBatchSize,
+			FileBlockStorageMode mode,
+			FileBlockStorageReadMode readMode,
+			uint32_t compressionLevel)
 			: m_dataDirectory(dataDirectory)
 			, m_mode(mode)
-			, m_blockDatabase(config::CatapultDirectory(dataDirectory), { fileDatabaseBatchSize, ".dat" })
-			, m_statementDatabase(config::CatapultDirectory(dataDirectory), { fileDatabaseBatchSize, ".stmt" })
+			, m_readMode(readMode)
+			, m_blockDatabase(
+					config::CatapultDirectory(dataDirectory),
+					{ fileDatabaseBatchSize, ".dat", FileBlockStorageReadMode::Memory_Mapped == readMode, compressionLevel })
+			, m_statementDatabase(config::CatapultDirectory(dataDirectory), { fileDatabaseBatchSize, ".stmt", false, compressionLevel })
 			, m_hashFile(dataDirectory, "hashes")
-			, m_indexFile((std::filesystem::path(dataDirectory) / "index.dat").generic_string())
-	{}
+			, m_indexFile((std::filesystem::path(dataDirectory) / "index.dat").generic_string()) {
+		if (FileBlockStorageReadMode::Memory_Mapped == readMode && 0 != compressionLevel)
+			CATAPULT_THROW_INVALID_ARGUMENT("memory mapped reads are not supported when compression is enabled");
+	}
 
 	// endregion
 
@@ -66,22 +77,19 @@ namespace catapult { namespace io {
 	void FileBlockStorage::saveBlock(const model::BlockElement& blockElement) {
 		auto currentHeight = chainHeight();
 		auto height = blockElement.Block.Height;
-
-		if (height != currentHeight + Height(1)) {
-			std::ostringstream out;
-			out << "cannot save block with height " << height << " when storage height is " << currentHeight;
-			CATAPULT_THROW_INVALID_ARGUMENT(out.str().c_str());
-		}
+		requireNextHeight(height, currentHeight);
 
 		{
 			// write element
 			auto pBlockStream = m_blockDatabase.outputStream(height.unwrap());
 			WriteBlockElement(blockElement, *pBlockStream);
+			pBlockStream->flush();
 
 			// write statements
 			if (blockElement.OptionalStatement) {
 				auto pBlockStatementStream = m_statementDatabase.outputStream(height.unwrap());
 				WriteBlockStatement(*blockElement.OptionalStatement, *pBlockStatementStream);
+				pBlockStatementStream->flush();
 			}
 		}
 
@@ -92,6 +100,74 @@ namespace catapult { namespace io {
 			m_indexFile.set(height.unwrap());
 	}
 
+	void FileBlockStorage::saveBlocks(const std::vector<model::BlockElement>& blockElements) {
+		if (blockElements.empty())
+			return;
+
+		auto currentHeight = chainHeight();
+		for (auto i = 0u; i < blockElements.size(); ++i)
+			requireNextHeight(blockElements[i].Block.Height, currentHeight + Height(i));
+
+		// serialize all elements into contiguous buffers
+		size_t blocksSize = 0;
+		for (const auto& blockElement : blockElements)
+			blocksSize += blockElement.Block.Size;
+
+		StringOutputStream blocksStream(blocksSize + blockElements.size() * (2 * Hash256::Size + sizeof(uint32_t)));
+		StringOutputStream statementsStream(0);
+		std::vector<std::pair<size_t, size_t>> blockRanges;
+		std::vector<std::pair<size_t, size_t>> statementRanges;
+		for (const auto& blockElement : blockElements) {
+			auto blockStartOffset = blocksStream.str().size();
+			WriteBlockElement(blockElement, blocksStream);
+			blockRanges.emplace_back(blockStartOffset, blocksStream.str().size() - blockStartOffset);
+
+			if (blockElement.OptionalStatement) {
+				auto statementStartOffset = statementsStream.str().size();
+				WriteBlockStatement(*blockElement.OptionalStatement, statementsStream);
+				statementRanges.emplace_back(statementStartOffset, statementsStream.str().size() - statementStartOffset);
+			} else {
+				statementRanges.emplace_back(0, 0);
+			}
+		}
+
+		// write elements (buffers can only be created after serialization completes because strings can be reallocated)
+		const auto* pBlocksData = reinterpret_cast<const uint8_t*>(blocksStream.str().data());
+		std::vector<RawBuffer> blockPayloads;
+		for (const auto& blockRange : blockRanges)
+			blockPayloads.emplace_back(pBlocksData + blockRange.first, blockRange.second);
+
+		m_blockDatabase.writePayloads(blockElements.front().Block.Height.unwrap(), blockPayloads);
+
+		// write statements in runs of consecutive heights
+		const auto* pStatementsData = reinterpret_cast<const uint8_t*>(statementsStream.str().data());
+		auto statementRunStartHeight = blockElements.front().Block.Height;
+		std::vector<RawBuffer> statementRunPayloads;
+		for (auto i = 0u; i <= blockElements.size(); ++i) {
+			if (i < blockElements.size() && blockElements[i].OptionalStatement) {
+				statementRunPayloads.emplace_back(pStatementsData + statementRanges[i].first, statementRanges[i].second);
+				continue;
+			}
+
+			if (!statementRunPayloads.empty())
+				m_statementDatabase.writePayloads(statementRunStartHeight.unwrap(), statementRunPayloads);
+
+			statementRunPayloads.clear();
+			statementRunStartHeight = blockElements.front().Block.Height + Height(i + 1);
+		}
+
+		// update hashes and index once per batch after all data has been written
+		if (FileBlockStorageMode::Hash_Index == m_mode) {
+			std::vector<Hash256> hashes;
+			for (const auto& blockElement : blockElements)
+				hashes.push_back(blockElement.EntityHash);
+
+			m_hashFile.saveAll(blockElements.front().Block.Height, hashes);
+		}
+
+		m_indexFile.set(blockElements.back().Block.Height.unwrap());
+	}
+
 	void FileBlockStorage::dropBlocksAfter(Height height) {
 		m_indexFile.set(height.unwrap());
 	}
@@ -112,12 +188,30 @@ namespace catapult { namespace io {
 
 	std::shared_ptr<const model::Block> FileBlockStorage::loadBlock(Height height) const {
 		requireHeight(height, "block");
+		if (FileBlockStorageReadMode::Memory_Mapped == m_readMode) {
+			auto mappedPayload = m_blockDatabase.mappedPayload(height.unwrap());
+			if (mappedPayload.Data.Size < sizeof(model::BlockHeader))
+				CATAPULT_THROW_RUNTIME_ERROR_1("insufficient data for block at height", height);
+
+			// block is referenced in place, so its declared size must not extend past the mapped payload
+			const auto* pBlock = reinterpret_cast<const model::Block*>(mappedPayload.Data.pData);
+			if (pBlock->Size < sizeof(model::BlockHeader) || pBlock->Size > mappedPayload.Data.Size)
+				CATAPULT_THROW_RUNTIME_ERROR_1("invalid size for block at height", height);
+
+			return std::shared_ptr<const model::Block>(mappedPayload.pOwner, pBlock);
+		}
+
 		auto pBlockStream = m_blockDatabase.inputStream(height.unwrap());
 		return ReadBlock(*pBlockStream);
 	}
 
 	std::shared_ptr<const model::BlockElement> FileBlockStorage::loadBlockElement(Height height) const {
 		requireHeight(height, "block element");
+		if (FileBlockStorageReadMode::Memory_Mapped == m_readMode) {
+			auto mappedPayload = m_blockDatabase.mappedPayload(height.unwrap());
+			return ReadBlockElementView(mappedPayload.Data, mappedPayload.pOwner);
+		}
+
 		auto pBlockStream = m_blockDatabase.inputStream(height.unwrap());
 		auto pBlockElement = ReadBlockElement(*pBlockStream);
 
@@ -157,6 +251,15 @@ namespace catapult { namespace io {
 
 	// region requireHeight
 
+	void FileBlockStorage::requireNextHeight(Height height, Height currentHeight) const {
+		if (height == currentHeight + Height(1))
+			return;
+
+		std::ostringstream out;
+		out << "cannot save block with height " << height << " when storage height is " << currentHeight;
+		CATAPULT_THROW_INVALID_ARGUMENT(out.str().c_str());
+	}
+
 	void FileBlockStorage::requireHeight(Height height, const char* description) const {
 		auto chainHeight = this->chainHeight();
 		if (height <= chainHeight)
@@ -38,21 +38,35 @@ namespace catapult { namespace io {
 		None
 	};
 
+	/// File block storage read modes.
+	enum class FileBlockStorageReadMode {
+		/// Copy blocks into newly allocated buffers.
+		Copy,
+
+		/// Reference blocks directly in memory mapped files.
+		Memory_Mapped
+	};
+
 	/// File-based block storage.
 	class FileBlockStorage final : public PrunableBlockStorage {
 	public:
 		/// Creates a file-based block storage, where blocks will be stored inside \a dataDirectory
-		/// with a file database batch size of \a fileDatabaseBatchSize and specified storage \a mode.
+		/// with a file database batch size of \a fileDatabaseBatchSize, specified storage \a mode and specified \a readMode.
+		/// Blocks and statements are compressed with \a compressionLevel unless it is zero.
+		/// \note Memory mapped reads are not supported when compression is enabled.
 		FileBlockStorage(
 				const std::string& dataDirectory,
 				uint32_t fileDatabaseBatchSize,
-				FileBlockStorageMode mode = FileBlockStorageMode::Hash_Index);
+				FileBlockStorageMode mode = FileBlockStorageMode::Hash_Index,
+				FileBlockStorageReadMode readMode = FileBlockStorageReadMode::Copy,
+				uint32_t compressionLevel = 0);
 
 	public:
 		// LightBlockStorage
 		Height chainHeight() const override;
 		model::HashRange loadHashesFrom(Height height, size_t maxHashes) const override;
 		void saveBlock(const model::BlockElement& blockElement) override;
+		void saveBlocks(const std::vector<model::BlockElement>& blockElements) override;
 		void dropBlocksAfter(Height height) override;
 
 		// BlockStorage
@@ -64,11 +78,13 @@ namespace catapult { namespace io {
 		void purge() override;
 
 	private:
+		void requireNextHeight(Height height, Height currentHeight) const;
 		void requireHeight(Height height, const char* description) const;
 
 	private:
 		std::string m_dataDirectory;
 		FileBlockStorageMode m_mode;
+		FileBlockStorageReadMode m_readMode;
 		FileDatabase m_blockDatabase;
 		FileDatabase m_statementDatabase;
 
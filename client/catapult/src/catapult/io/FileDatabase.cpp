@@ -21,9 +21,17 @@
 
 #include "FileDatabase.h"
 #include "FileStream.h"
+#include "MemoryMappedFile.h"
+#include "PayloadCompression.h"
 #include "PodIoUtils.h"
+#include "catapult/utils/ExceptionLogging.h"
+#include "catapult/utils/Logging.h"
 #include "catapult/exceptions.h"
 #include "catapult/preprocessor.h"
+#include <array>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
 
 namespace catapult { namespace io {
 
@@ -61,17 +69,177 @@ namespace catapult { namespace io {
 		};
 
 		// endregion
+
+		// region BufferInputStream
+
+		class BufferInputStream : public InputStream {
+		public:
+			explicit BufferInputStream(std::vector<uint8_t>&& buffer)
+					: m_buffer(std::move(buffer))
+					, m_position(0)
+			{}
+
+		public:
+			bool eof() const override {
+				return m_buffer.size() == m_position;
+			}
+
+			void read(const MutableRawBuffer& buffer) override {
+				if (buffer.Size + m_position > m_buffer.size()) {
+					std::ostringstream out;
+					out
+							<< "BufferInputStream invalid read (read-size = " << buffer.Size
+							<< ", stream-position = " << m_position
+							<< ", stream-size = " << m_buffer.size() << ")";
+					CATAPULT_THROW_FILE_IO_ERROR(out.str().c_str());
+				}
+
+				std::memcpy(buffer.pData, m_buffer.data() + m_position, buffer.Size);
+				m_position += buffer.Size;
+			}
+
+		private:
+			std::vector<uint8_t> m_buffer;
+			size_t m_position;
+		};
+
+		// endregion
+
+		// region CompressingOutputStream
+
+		class CompressingOutputStream : public OutputStream {
+		public:
+			CompressingOutputStream(FileDatabase& database, uint64_t id)
+					: m_database(database)
+					, m_id(id)
+					, m_hasUnflushedData(false)
+			{}
+
+			~CompressingOutputStream() override {
+				// payload is only written by flush, so write any remaining data like an uncompressed stream would
+				if (!m_hasUnflushedData)
+					return;
+
+				try {
+					flush();
+				} catch (...) {
+					CATAPULT_LOG(error) << UNHANDLED_EXCEPTION_MESSAGE("writing compressed payload " << m_id);
+				}
+			}
+
+		public:
+			void write(const RawBuffer& buffer) override {
+				m_buffer.insert(m_buffer.end(), buffer.pData, buffer.pData + buffer.Size);
+				m_hasUnflushedData = true;
+			}
+
+			void flush() override {
+				if (!m_hasUnflushedData)
+					return;
+
+				m_database.writePayloads(m_id, { m_buffer });
+				m_hasUnflushedData = false;
+			}
+
+		private:
+			FileDatabase& m_database;
+			uint64_t m_id;
+			std::vector<uint8_t> m_buffer;
+			bool m_hasUnflushedData;
+		};
+
+		// endregion
+
+		constexpr size_t Max_Cached_Mappings = 16;
+
+		bool IsCompressedPayloadAt(RawFile& rawFile, uint64_t bodyStartOffset, uint64_t bodyEndOffset) {
+			std::array<uint8_t, sizeof(uint32_t)> magic;
+			if (bodyEndOffset < bodyStartOffset + magic.size())
+				return false;
+
+			rawFile.seek(bodyStartOffset);
+			rawFile.read(magic);
+			return IsCompressedPayload(magic);
+		}
+
+		FileDatabase::MappedPayload DecompressMappedPayload(const RawBuffer& compressedPayload) {
+			auto pPayload = std::make_shared<const std::vector<uint8_t>>(DecompressPayload(compressedPayload));
+			return { pPayload, { pPayload->data(), pPayload->size() } };
+		}
+
+		std::unique_ptr<InputStream> DecompressPayloadAt(
+				RawFile& rawFile,
+				uint64_t bodyStartOffset,
+				uint64_t bodyEndOffset,
+				size_t* pSize) {
+			std::vector<uint8_t> compressedPayload(static_cast<size_t>(bodyEndOffset - bodyStartOffset));
+			rawFile.seek(bodyStartOffset);
+			rawFile.read(compressedPayload);
+
+			auto payload = DecompressPayload(compressedPayload);
+			if (pSize)
+				*pSize = payload.size();
+
+			return std::make_unique<BufferInputStream>(std::move(payload));
+		}
+
+		uint64_t ReadMapped64(const MemoryMappedFile& mapping, uint64_t offset) {
+			if (offset + sizeof(uint64_t) > mapping.size())
+				CATAPULT_THROW_FILE_IO_ERROR("mapped file is too small to contain header");
+
+			uint64_t value;
+			std::memcpy(&value, mapping.data() + offset, sizeof(uint64_t));
+			return value;
+		}
 	}
 
+	// region FileDatabase::MappingCache
+
+	class FileDatabase::MappingCache {
+	public:
+		std::shared_ptr<const MemoryMappedFile> get(const std::string& filePath, uint64_t minSize) {
+			std::lock_guard<std::mutex> lock(m_mutex);
+			auto iter = m_mappings.find(filePath);
+			if (m_mappings.cend() != iter && iter->second->size() >= minSize)
+				return iter->second;
+
+			// file has grown since it was last mapped (or was never mapped)
+			if (m_mappings.cend() == iter && m_mappings.size() >= Max_Cached_Mappings)
+				m_mappings.erase(m_mappings.begin());
+
+			auto pMapping = std::make_shared<const MemoryMappedFile>(filePath);
+			pMapping->advise(0, pMapping->size(), MemoryAccessPattern::Sequential);
+			m_mappings[filePath] = pMapping;
+			return pMapping;
+		}
+
+		void remove(const std::string& filePath) {
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_mappings.erase(filePath);
+		}
+
+	private:
+		std::unordered_map<std::string, std::shared_ptr<const MemoryMappedFile>> m_mappings;
+		std::mutex m_mutex;
+	};
+
+	// endregion
+
 	// region FileDatabase
 
 	FileDatabase::FileDatabase(const config::CatapultDirectory& directory, const Options& options)
 			: m_directory(directory)
-			, m_options(options) {
+			, m_options(options)
+			, m_pMappingCache(std::make_unique<MappingCache>()) {
 		if (0 == m_options.BatchSize)
 			CATAPULT_THROW_INVALID_ARGUMENT("batch size must be nonzero");
+
+		if (m_options.CompressionLevel > MaxPayloadCompressionLevel())
+			CATAPULT_THROW_INVALID_ARGUMENT_1("compression level is unsupported", m_options.CompressionLevel);
 	}
 
+	FileDatabase::~FileDatabase() = default;
+
 	bool FileDatabase::contains(uint64_t id) const {
 		auto filePath = getFilePath(id, false);
 		if (!std::filesystem::exists(filePath))
@@ -94,6 +262,11 @@ namespace catapult { namespace io {
 		auto rawFileSize = rawFile.size();
 
 		if (bypassHeader()) {
+			// compressed payloads are detected independently of the current compression level, which might have changed
+			if (IsCompressedPayloadAt(rawFile, 0, rawFileSize))
+				return DecompressPayloadAt(rawFile, 0, rawFileSize, pSize);
+
+			rawFile.seek(0);
 			if (pSize)
 				*pSize = rawFileSize;
 
@@ -114,11 +287,15 @@ namespace catapult { namespace io {
 		if (m_options.BatchSize - 1 != id % m_options.BatchSize)
 			bodyEndOffset = Read64(rawFile);
 
-		auto pBodyStream = std::make_unique<FileStream>(std::move(rawFile));
-		pBodyStream->seek(bodyStartOffset);
 		if (0 == bodyEndOffset) // payload extends to end of file
 			bodyEndOffset = rawFileSize;
 
+		if (IsCompressedPayloadAt(rawFile, bodyStartOffset, bodyEndOffset))
+			return DecompressPayloadAt(rawFile, bodyStartOffset, bodyEndOffset, pSize);
+
+		auto pBodyStream = std::make_unique<FileStream>(std::move(rawFile));
+		pBodyStream->seek(bodyStartOffset);
+
 		if (pSize)
 			*pSize = bodyEndOffset - pBodyStream->position();
 
@@ -126,13 +303,128 @@ namespace catapult { namespace io {
 	}
 
 	std::unique_ptr<OutputStream> FileDatabase::outputStream(uint64_t id) {
+		if (0 != m_options.CompressionLevel)
+			return std::make_unique<CompressingOutputStream>(*this, id);
+
+		auto rawFile = openForWrite(id);
+		if (bypassHeader())
+			return std::make_unique<FileStream>(std::move(rawFile));
+
+		// update the header
+		rawFile.seek(getHeaderOffset(id));
+		Write64(rawFile, rawFile.size());
+
+		// seek to the body and return
+		rawFile.seek(rawFile.size());
+		return std::make_unique<FileStream>(std::move(rawFile));
+	}
+
+	void FileDatabase::writePayloads(uint64_t startId, const std::vector<RawBuffer>& payloads) {
+		size_t i = 0;
+		while (i < payloads.size()) {
+			auto id = startId + i;
+			auto numPayloadsInFile = bypassHeader()
+					? 1
+					: std::min<size_t>(payloads.size() - i, m_options.BatchSize - id % m_options.BatchSize);
+
+			// compress each payload independently so that it can be read without reading any other payload
+			std::vector<std::vector<uint8_t>> compressedPayloads;
+			if (0 != m_options.CompressionLevel) {
+				for (auto j = 0u; j < numPayloadsInFile; ++j)
+					compressedPayloads.push_back(CompressPayload(payloads[i + j], m_options.CompressionLevel));
+			}
+
+			auto rawFile = openForWrite(id);
+			auto bodyStartOffset = rawFile.size();
+
+			std::vector<uint64_t> headerOffsets;
+			std::vector<RawBuffer> bodies;
+			for (auto j = 0u; j < numPayloadsInFile; ++j) {
+				RawBuffer body = compressedPayloads.empty() ? payloads[i + j] : RawBuffer(compressedPayloads[j]);
+				headerOffsets.push_back(bodyStartOffset);
+				bodies.push_back(body);
+				bodyStartOffset += body.Size;
+			}
+
+			// write all bodies before updating the header so that the header never references unwritten data
+			rawFile.seek(rawFile.size());
+			rawFile.writeBuffers(bodies);
+
+			if (!bypassHeader()) {
+				rawFile.seek(getHeaderOffset(id));
+				rawFile.write({ reinterpret_cast<const uint8_t*>(headerOffsets.data()), headerOffsets.size() * sizeof(uint64_t) });
+			}
+
+			i += numPayloadsInFile;
+		}
+	}
+
+	FileDatabase::MappedPayload FileDatabase::mappedPayload(uint64_t id) const {
+		if (!m_options.EnableMemoryMappedReads)
+			CATAPULT_THROW_INVALID_ARGUMENT("mappedPayload is not supported when memory mapped reads are disabled");
+
+		auto filePath = getFilePath(id, false);
+		if (bypassHeader()) {
+			auto pMapping = m_pMappingCache->get(filePath, std::filesystem::file_size(filePath));
+			RawBuffer payload(pMapping->data(), pMapping->size());
+			if (IsCompressedPayload(payload))
+				return DecompressMappedPayload(payload);
+
+			return { pMapping, payload };
+		}
+
+		auto headerOffset = getHeaderOffset(id);
+		auto pMapping = m_pMappingCache->get(filePath, m_options.BatchSize * sizeof(uint64_t));
+		auto bodyStartOffset = ReadMapped64(*pMapping, headerOffset);
+		if (0 == bodyStartOffset) {
+			std::ostringstream out;
+			out << "cannot read payload at " << id << " that has not been written";
+			CATAPULT_THROW_FILE_IO_ERROR(out.str().c_str());
+		}
+
+		uint64_t bodyEndOffset = 0;
+		if (m_options.BatchSize - 1 != id % m_options.BatchSize)
+			bodyEndOffset = ReadMapped64(*pMapping, headerOffset + sizeof(uint64_t));
+
+		if (0 == bodyEndOffset) // payload extends to end of file
+			bodyEndOffset = std::filesystem::file_size(filePath);
+
+		if (bodyEndOffset > pMapping->size())
+			pMapping = m_pMappingCache->get(filePath, bodyEndOffset);
+
+		if (bodyEndOffset > pMapping->size() || bodyStartOffset > bodyEndOffset)
+			CATAPULT_THROW_FILE_IO_ERROR("mapped payload extends past end of file");
+
+		auto payloadSize = static_cast<size_t>(bodyEndOffset - bodyStartOffset);
+		RawBuffer payload(pMapping->data() + bodyStartOffset, payloadSize);
+		if (IsCompressedPayload(payload))
+			return DecompressMappedPayload(payload);
+
+		pMapping->advise(static_cast<size_t>(bodyStartOffset), payloadSize, MemoryAccessPattern::Will_Need);
+		return { pMapping, payload };
+	}
+
+	RawFile FileDatabase::openForWrite(uint64_t id) {
 		auto filePath = getFilePath(id, true);
 
 		auto isNewFile = !std::filesystem::exists(filePath) || bypassHeader();
-		auto rawFile = RawFile(filePath, isNewFile ? OpenMode::Read_Write : OpenMode::Read_Append);
+
+		// truncating a file invalidates all of its mappings, so rewrite a copy of it and replace the original instead
+		auto writeFilePath = filePath;
+		if (m_options.EnableMemoryMappedReads && contains(id)) {
+			writeFilePath = filePath + ".tmp";
+			if (!bypassHeader())
+				std::filesystem::copy_file(filePath, writeFilePath, std::filesystem::copy_options::overwrite_existing);
+		}
+
+		auto rawFile = RawFile(writeFilePath, isNewFile ? OpenMode::Read_Write : OpenMode::Read_Append);
+		if (writeFilePath != filePath) {
+			std::filesystem::rename(writeFilePath, filePath);
+			m_pMappingCache->remove(filePath);
+		}
 
 		if (bypassHeader())
-			return std::make_unique<FileStream>(std::move(rawFile));
+			return rawFile;
 
 		auto headerOffset = getHeaderOffset(id);
 		auto headerSize = m_options.BatchSize * sizeof(uint64_t);
@@ -155,13 +447,7 @@ namespace catapult { namespace io {
 			}
 		}
 
-		// update the header
-		rawFile.seek(headerOffset);
-		Write64(rawFile, rawFile.size());
-
-		// seek to the body and return
-		rawFile.seek(rawFile.size());
-		return std::make_unique<FileStream>(std::move(rawFile));
+		return rawFile;
 	}
 
 	bool FileDatabase::bypassHeader() const {
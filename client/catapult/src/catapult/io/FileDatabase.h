@@ -20,8 +20,10 @@
 **/
 
 #pragma once
+#include "RawFile.h"
 #include "Stream.h"
 #include "catapult/config/CatapultDataDirectory.h"
+#include <memory>
 
 namespace catapult { namespace io {
 
@@ -35,12 +37,32 @@ namespace catapult { namespace io {
 
 			/// Extension of created files.
 			std::string FileExtension;
+
+			/// \c true if payloads can be read from memory mapped files.
+			/// \note When set, rewritten files are replaced instead of being truncated so that existing mappings remain valid.
+			bool EnableMemoryMappedReads = false;
+
+			/// Level used to compress written payloads.
+			/// \note Zero disables compression. Compressed and uncompressed payloads can be read independently of this level.
+			uint32_t CompressionLevel = 0;
+		};
+
+		/// Payload backed by a memory mapped file or by a decompressed copy.
+		struct MappedPayload {
+			/// Owner of the payload data (either the mapped file containing the payload or a decompressed copy).
+			std::shared_ptr<const void> pOwner;
+
+			/// Payload data.
+			RawBuffer Data;
 		};
 
 	public:
 		/// Creates a database in \a directory with \a options.
 		FileDatabase(const config::CatapultDirectory& directory, const Options& options);
 
+		/// Destroys the database.
+		~FileDatabase();
+
 	public:
 		/// Returns \c true if a payload for \a id is contained.
 		bool contains(uint64_t id) const;
@@ -49,9 +71,20 @@ namespace catapult { namespace io {
 		std::unique_ptr<InputStream> inputStream(uint64_t id, size_t* pSize = nullptr) const;
 
 		/// Gets an output stream for \a id.
+		/// \note When compression is enabled, the payload is only written when the stream is flushed or destroyed.
 		std::unique_ptr<OutputStream> outputStream(uint64_t id);
 
+		/// Writes \a payloads with consecutive ids starting at \a startId.
+		/// \note All payloads stored in the same file are written with a single gathered write.
+		void writePayloads(uint64_t startId, const std::vector<RawBuffer>& payloads);
+
+		/// Gets a memory mapped view of the payload for \a id.
+		/// \note Payload data is valid as long as the returned owner is alive.
+		/// \note Compressed payloads cannot be mapped directly, so they are decompressed into a copy.
+		MappedPayload mappedPayload(uint64_t id) const;
+
 	private:
+		RawFile openForWrite(uint64_t id);
 		bool bypassHeader() const;
 		uint64_t getHeaderOffset(uint64_t id) const;
 		std::string getFilePath(uint64_t id, bool createDirectories) const;
@@ -59,5 +92,8 @@ namespace catapult { namespace io {
 	private:
 		config::CatapultDirectory m_directory;
 		Options m_options;
+
+		class MappingCache;
+		std::unique_ptr<MappingCache> m_pMappingCache;
 	};
 }}
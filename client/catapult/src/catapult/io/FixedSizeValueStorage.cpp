@@ -59,14 +59,29 @@ namespace catapult { namespace io {
 
 	template<typename TKey, typename TValue>
 	void FixedSizeValueStorage<TKey, TValue>::save(TKey key, const TValue& value) {
-		auto currentId = key.unwrap() / Files_Per_Storage_Directory;
-		if (m_cachedDirectoryId != currentId) {
-			m_pCachedStorageFile = openStorageFile(key, OpenMode::Read_Append);
-			m_cachedDirectoryId = currentId;
-		}
+		auto& storageFile = cachedStorageFile(key);
+		seekStorageFile(storageFile, key);
+		storageFile.write({ reinterpret_cast<const uint8_t*>(&value), sizeof(TValue) });
+	}
+
+	template<typename TKey, typename TValue>
+	void FixedSizeValueStorage<TKey, TValue>::saveAll(TKey key, const std::vector<TValue>& values) {
+		const auto* pData = reinterpret_cast<const uint8_t*>(values.data());
+		auto numValues = values.size();
+		while (numValues) {
+			// write all values belonging to the same storage file at once
+			auto& storageFile = cachedStorageFile(key);
+			seekStorageFile(storageFile, key);
+
+			auto count = Files_Per_Storage_Directory - (key.unwrap() % Files_Per_Storage_Directory);
+			count = std::min<size_t>(numValues, count);
+
+			storageFile.write({ pData, count * sizeof(TValue) });
 
-		seekStorageFile(*m_pCachedStorageFile, key);
-		m_pCachedStorageFile->write({ reinterpret_cast<const uint8_t*>(&value), sizeof(TValue) });
+			pData += count * sizeof(TValue);
+			numValues -= count;
+			key = key + TKey(count);
+		}
 	}
 
 	template<typename TKey, typename TValue>
@@ -75,6 +90,17 @@ namespace catapult { namespace io {
 		m_pCachedStorageFile.reset();
 	}
 
+	template<typename TKey, typename TValue>
+	RawFile& FixedSizeValueStorage<TKey, TValue>::cachedStorageFile(TKey key) {
+		auto currentId = key.unwrap() / Files_Per_Storage_Directory;
+		if (m_cachedDirectoryId != currentId) {
+			m_pCachedStorageFile = openStorageFile(key, OpenMode::Read_Append);
+			m_cachedDirectoryId = currentId;
+		}
+
+		return *m_pCachedStorageFile;
+	}
+
 	template<typename TKey, typename TValue>
 	std::unique_ptr<RawFile> FixedSizeValueStorage<TKey, TValue>::openStorageFile(TKey key, OpenMode openMode) const {
 		auto storageDir = config::CatapultStorageDirectoryPreparer::Prepare(m_dataDirectory, key);
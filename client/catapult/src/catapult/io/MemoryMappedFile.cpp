@@ -0,0 +1,148 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "MemoryMappedFile.h"
+#include "catapult/exceptions.h"
+
+#ifdef _MSC_VER
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+namespace catapult { namespace io {
+
+#ifdef _MSC_VER
+	namespace {
+		class HandleGuard {
+		public:
+			explicit HandleGuard(HANDLE handle) : m_handle(handle)
+			{}
+
+			~HandleGuard() {
+				if (m_handle && INVALID_HANDLE_VALUE != m_handle)
+					CloseHandle(m_handle);
+			}
+
+		public:
+			HANDLE get() const {
+				return m_handle;
+			}
+
+		private:
+			HANDLE m_handle;
+		};
+	}
+
+	MemoryMappedFile::MemoryMappedFile(const std::string& pathname) : m_pData(nullptr), m_size(0) {
+		HandleGuard file(CreateFileA(
+				pathname.c_str(),
+				GENERIC_READ,
+				FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+				nullptr,
+				OPEN_EXISTING,
+				FILE_ATTRIBUTE_NORMAL,
+				nullptr));
+		if (INVALID_HANDLE_VALUE == file.get())
+			CATAPULT_THROW_FILE_IO_ERROR("couldn't open the file for mapping");
+
+		LARGE_INTEGER fileSize;
+		if (!GetFileSizeEx(file.get(), &fileSize))
+			CATAPULT_THROW_FILE_IO_ERROR("couldn't determine file size");
+
+		m_size = static_cast<size_t>(fileSize.QuadPart);
+		if (0 == m_size)
+			return;
+
+		HandleGuard mapping(CreateFileMappingA(file.get(), nullptr, PAGE_READONLY, 0, 0, nullptr));
+		if (!mapping.get())
+			CATAPULT_THROW_FILE_IO_ERROR("couldn't create file mapping");
+
+		m_pData = static_cast<const uint8_t*>(MapViewOfFile(mapping.get(), FILE_MAP_READ, 0, 0, 0));
+		if (!m_pData)
+			CATAPULT_THROW_FILE_IO_ERROR("couldn't map the file");
+	}
+
+	MemoryMappedFile::~MemoryMappedFile() {
+		if (m_pData)
+			UnmapViewOfFile(m_pData);
+	}
+
+	void MemoryMappedFile::advise(size_t, size_t, MemoryAccessPattern) const {
+		// access pattern hints are not supported on windows
+	}
+#else
+	MemoryMappedFile::MemoryMappedFile(const std::string& pathname) : m_pData(nullptr), m_size(0) {
+		auto fd = ::open(pathname.c_str(), O_RDONLY | O_CLOEXEC);
+		if (-1 == fd)
+			CATAPULT_THROW_FILE_IO_ERROR("couldn't open the file for mapping");
+
+		struct stat st;
+		if (0 != ::fstat(fd, &st)) {
+			::close(fd);
+			CATAPULT_THROW_FILE_IO_ERROR("couldn't determine file size");
+		}
+
+		m_size = static_cast<size_t>(st.st_size);
+		if (0 == m_size) {
+			::close(fd);
+			return;
+		}
+
+		// mapping remains valid after the descriptor is closed
+		auto* pData = ::mmap(nullptr, m_size, PROT_READ, MAP_SHARED, fd, 0);
+		::close(fd);
+		if (MAP_FAILED == pData)
+			CATAPULT_THROW_FILE_IO_ERROR("couldn't map the file");
+
+		m_pData = static_cast<const uint8_t*>(pData);
+	}
+
+	MemoryMappedFile::~MemoryMappedFile() {
+		if (m_pData)
+			::munmap(const_cast<uint8_t*>(m_pData), m_size);
+	}
+
+	void MemoryMappedFile::advise(size_t offset, size_t size, MemoryAccessPattern pattern) const {
+		if (!m_pData || offset >= m_size)
+			return;
+
+		// madvise requires a page aligned address
+		auto pageSize = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+		auto alignedOffset = offset - offset % pageSize;
+		auto alignedSize = std::min(size + offset - alignedOffset, m_size - alignedOffset);
+
+		auto advice = MemoryAccessPattern::Sequential == pattern ? MADV_SEQUENTIAL : MADV_WILLNEED;
+		::madvise(const_cast<uint8_t*>(m_pData + alignedOffset), alignedSize, advice);
+	}
+#endif
+
+	size_t MemoryMappedFile::size() const {
+		return m_size;
+	}
+
+	const uint8_t* MemoryMappedFile::data() const {
+		return m_pData;
+	}
+}}
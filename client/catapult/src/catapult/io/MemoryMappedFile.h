@@ -0,0 +1,64 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/utils/NonCopyable.h"
+#include "catapult/types.h"
+#include <string>
+
+namespace catapult { namespace io {
+
+	/// Access pattern hints for memory mapped data.
+	enum class MemoryAccessPattern {
+		/// Data will be accessed sequentially.
+		Sequential,
+
+		/// Data will be accessed soon.
+		Will_Need
+	};
+
+	/// Read-only memory mapping of a complete file.
+	/// \note Mapped data remains valid when the file is subsequently replaced or removed but not when it is truncated.
+	class MemoryMappedFile final : public utils::NonCopyable {
+	public:
+		/// Maps the file pointed to by \a pathname.
+		explicit MemoryMappedFile(const std::string& pathname);
+
+		/// Unmaps the file.
+		~MemoryMappedFile();
+
+	public:
+		/// Gets the size of the mapped data.
+		size_t size() const;
+
+		/// Gets a const pointer to the mapped data.
+		const uint8_t* data() const;
+
+	public:
+		/// Advises the operating system that mapped data in the range [\a offset, \a offset + \a size) will be accessed
+		/// with access \a pattern.
+		void advise(size_t offset, size_t size, MemoryAccessPattern pattern) const;
+
+	private:
+		const uint8_t* m_pData;
+		size_t m_size;
+	};
+}}
@@ -26,13 +26,23 @@
 
 namespace catapult { namespace io {
 
-	void MoveBlockFiles(PrunableBlockStorage& sourceStorage, BlockStorage& destinationStorage, Height startHeight) {
+	void CopyBlockFiles(const BlockStorage& sourceStorage, BlockStorage& destinationStorage, Height startHeight) {
 		if (startHeight < Height(1))
 			CATAPULT_THROW_INVALID_ARGUMENT_1("invalid height passed", startHeight);
 
 		if (startHeight <= destinationStorage.chainHeight())
 			destinationStorage.dropBlocksAfter(startHeight - Height(1));
 
+		// move blocks in batches so that destination storage can append them together
+		constexpr size_t Batch_Size = 100;
+		std::vector<model::BlockElement> blockElements;
+		std::vector<std::shared_ptr<const model::BlockElement>> blockElementOwners;
+		auto flush = [&destinationStorage, &blockElements, &blockElementOwners]() {
+			destinationStorage.saveBlocks(blockElements);
+			blockElements.clear();
+			blockElementOwners.clear();
+		};
+
 		auto sourceHeight = sourceStorage.chainHeight();
 		for (auto height = startHeight; height <= sourceHeight; height = height + Height(1)) {
 			auto pBlockElement = sourceStorage.loadBlockElement(height);
@@ -45,9 +55,17 @@ namespace catapult { namespace io {
 				const_cast<model::BlockElement&>(*pBlockElement).OptionalStatement = std::move(pBlockStatement);
 			}
 
-			destinationStorage.saveBlock(*pBlockElement);
+			blockElements.push_back(*pBlockElement);
+			blockElementOwners.push_back(std::move(pBlockElement));
+			if (Batch_Size == blockElements.size())
+				flush();
 		}
 
+		flush();
+	}
+
+	void MoveBlockFiles(PrunableBlockStorage& sourceStorage, BlockStorage& destinationStorage, Height startHeight) {
+		CopyBlockFiles(sourceStorage, destinationStorage, startHeight);
 		sourceStorage.purge();
 	}
 }}
@@ -0,0 +1,87 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "PayloadCompression.h"
+#include "catapult/exceptions.h"
+#include <cstring>
+#include <zstd.h>
+
+namespace catapult { namespace io {
+
+	namespace {
+		[[noreturn]]
+		void ThrowCompressionError(const char* message, size_t result) {
+			std::ostringstream out;
+			out << message << " (" << ZSTD_getErrorName(result) << ")";
+			CATAPULT_THROW_RUNTIME_ERROR(out.str().c_str());
+		}
+	}
+
+	uint32_t MaxPayloadCompressionLevel() {
+		return static_cast<uint32_t>(ZSTD_maxCLevel());
+	}
+
+	bool IsCompressedPayload(const RawBuffer& buffer) {
+		if (buffer.Size < sizeof(uint32_t))
+			return false;
+
+		uint32_t magic;
+		std::memcpy(&magic, buffer.pData, sizeof(uint32_t));
+		return ZSTD_MAGICNUMBER == magic;
+	}
+
+	std::vector<uint8_t> CompressPayload(const RawBuffer& buffer, uint32_t compressionLevel) {
+		if (0 == compressionLevel || compressionLevel > MaxPayloadCompressionLevel())
+			CATAPULT_THROW_INVALID_ARGUMENT_1("invalid compression level", compressionLevel);
+
+		std::vector<uint8_t> compressed(ZSTD_compressBound(buffer.Size));
+		auto result = ZSTD_compress(compressed.data(), compressed.size(), buffer.pData, buffer.Size, static_cast<int>(compressionLevel));
+		if (ZSTD_isError(result))
+			ThrowCompressionError("unable to compress payload", result);
+
+		compressed.resize(result);
+		return compressed;
+	}
+
+	std::vector<uint8_t> DecompressPayload(const RawBuffer& buffer) {
+		if (!IsCompressedPayload(buffer))
+			CATAPULT_THROW_RUNTIME_ERROR("buffer does not contain compressed payload");
+
+		// only decompress the first frame because a buffer extending to the end of a file can contain subsequent payloads
+		auto frameSize = ZSTD_findFrameCompressedSize(buffer.pData, buffer.Size);
+		if (ZSTD_isError(frameSize))
+			ThrowCompressionError("compressed payload has invalid frame", frameSize);
+
+		auto contentSize = ZSTD_getFrameContentSize(buffer.pData, frameSize);
+		if (ZSTD_CONTENTSIZE_ERROR == contentSize || ZSTD_CONTENTSIZE_UNKNOWN == contentSize)
+			CATAPULT_THROW_RUNTIME_ERROR("compressed payload has invalid content size");
+
+		std::vector<uint8_t> decompressed(static_cast<size_t>(contentSize));
+		auto result = ZSTD_decompress(decompressed.data(), decompressed.size(), buffer.pData, frameSize);
+		if (ZSTD_isError(result))
+			ThrowCompressionError("unable to decompress payload", result);
+
+		if (result != decompressed.size())
+			CATAPULT_THROW_RUNTIME_ERROR("decompressed payload size does not match frame content size");
+
+		return decompressed;
+	}
+}}
@@ -33,6 +33,7 @@
 #else
 #include <unistd.h>
 #include <sys/file.h>
+#include <sys/uio.h>
 #endif
 
 namespace catapult { namespace io {
@@ -212,6 +213,58 @@ namespace catapult { namespace io {
 			return ProcessInBlocks(write, Write_Error, fd, data);
 		}
 
+#ifdef _MSC_VER
+		FileOperationResult<size_t> nemWriteGathered(int fd, const std::vector<RawBuffer>& buffers) {
+			size_t numBytesWritten = 0;
+			for (const auto& buffer : buffers) {
+				auto writeResult = nemWrite(fd, buffer);
+				if (!writeResult.IsSuccess)
+					return writeResult;
+
+				numBytesWritten += writeResult.Value;
+			}
+
+			return MakeSuccessResult(numBytesWritten);
+		}
+#else
+		FileOperationResult<size_t> nemWriteGathered(int fd, const std::vector<RawBuffer>& buffers) {
+			std::vector<iovec> ioVectors;
+			ioVectors.reserve(buffers.size());
+			for (const auto& buffer : buffers) {
+				if (0 != buffer.Size)
+					ioVectors.push_back({ const_cast<uint8_t*>(buffer.pData), buffer.Size });
+			}
+
+			auto maxIoVectors = static_cast<size_t>(std::max<long>(1, ::sysconf(_SC_IOV_MAX)));
+
+			size_t numBytesWritten = 0;
+			size_t index = 0;
+			while (index < ioVectors.size()) {
+				auto numIoVectors = std::min<size_t>(maxIoVectors, ioVectors.size() - index);
+				auto ioResult = ::writev(fd, &ioVectors[index], static_cast<int>(numIoVectors));
+				if (Write_Error == ioResult || 0 == ioResult)
+					return MakeFailureResult(numBytesWritten);
+
+				// skip all completely written buffers and adjust partially written buffer
+				auto ioProcessed = static_cast<size_t>(ioResult);
+				numBytesWritten += ioProcessed;
+				while (0 != ioProcessed) {
+					auto& ioVector = ioVectors[index];
+					if (ioProcessed < ioVector.iov_len) {
+						ioVector.iov_base = static_cast<uint8_t*>(ioVector.iov_base) + ioProcessed;
+						ioVector.iov_len -= ioProcessed;
+						break;
+					}
+
+					ioProcessed -= ioVector.iov_len;
+					++index;
+				}
+			}
+
+			return MakeSuccessResult(numBytesWritten);
+		}
+#endif
+
 		FileOperationResult<size_t> nemRead(int fd, const MutableRawBuffer& data) {
 			return ProcessInBlocks(read, Read_Error, fd, data);
 		}
@@ -338,6 +391,14 @@ namespace catapult { namespace io {
 		m_fileSize = std::max(m_fileSize, m_position);
 	}
 
+	void RawFile::writeBuffers(const std::vector<RawBuffer>& dataBuffers) {
+		auto writeResult = nemWriteGathered(m_fd.raw(), dataBuffers);
+		CATAPULT_CHECK_FILE_OPERATION_RESULT(Error_Write, writeResult);
+
+		m_position += writeResult.Value;
+		m_fileSize = std::max(m_fileSize, m_position);
+	}
+
 	void RawFile::seek(uint64_t position) {
 		// constrain seek to inside the file even though low-level api allows seek outside the file
 		// if needed, such behavior is better suited for resize and/or truncate methods
@@ -22,6 +22,7 @@
 #pragma once
 #include "catapult/types.h"
 #include <string>
+#include <vector>
 
 namespace catapult { namespace io {
 
@@ -75,6 +76,10 @@ namespace catapult { namespace io {
 		/// If proper amount of data could not be written catapult_file_io_error exception will be thrown.
 		void write(const RawBuffer& dataBuffer);
 
+		/// Writes data pointed to by all \a dataBuffers to the file using a single gathered write when supported.
+		/// If proper amount of data could not be written catapult_file_io_error exception will be thrown.
+		void writeBuffers(const std::vector<RawBuffer>& dataBuffers);
+
 		/// Seeks to given absolute position.
 		/// Throws catapult_file_io_error exception if seek has failed.
 		void seek(uint64_t position);
@@ -0,0 +1,111 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "RecentBlockElementCache.h"
+
+namespace catapult { namespace io {
+
+	namespace {
+		uint64_t EstimateMemorySize(const model::BlockElement& blockElement) {
+			return sizeof(model::BlockElement)
+					+ blockElement.Block.Size
+					+ blockElement.Transactions.size() * sizeof(model::TransactionElement)
+					+ blockElement.SubCacheMerkleRoots.size() * Hash256::Size;
+		}
+	}
+
+	RecentBlockElementCache::RecentBlockElementCache(utils::FileSize maxMemorySize)
+			: m_maxMemorySize(maxMemorySize.bytes())
+			, m_memorySize(0)
+			, m_numHits(0)
+			, m_numMisses(0)
+	{}
+
+	utils::FileSize RecentBlockElementCache::maxMemorySize() const {
+		return utils::FileSize::FromBytes(m_maxMemorySize);
+	}
+
+	utils::FileSize RecentBlockElementCache::memorySize() const {
+		std::lock_guard<std::mutex> guard(m_mutex);
+		return utils::FileSize::FromBytes(m_memorySize);
+	}
+
+	size_t RecentBlockElementCache::size() const {
+		std::lock_guard<std::mutex> guard(m_mutex);
+		return m_entries.size();
+	}
+
+	uint64_t RecentBlockElementCache::numHits() const {
+		return m_numHits;
+	}
+
+	uint64_t RecentBlockElementCache::numMisses() const {
+		return m_numMisses;
+	}
+
+	std::shared_ptr<const model::BlockElement> RecentBlockElementCache::find(Height height) {
+		std::lock_guard<std::mutex> guard(m_mutex);
+		auto iter = m_entryIterators.find(height);
+		if (m_entryIterators.cend() == iter) {
+			++m_numMisses;
+			return nullptr;
+		}
+
+		// move the entry to the front of the list
+		++m_numHits;
+		m_entries.splice(m_entries.begin(), m_entries, iter->second);
+		return iter->second->pBlockElement;
+	}
+
+	void RecentBlockElementCache::insert(const std::shared_ptr<const model::BlockElement>& pBlockElement) {
+		auto memorySize = EstimateMemorySize(*pBlockElement);
+		if (memorySize > m_maxMemorySize)
+			return;
+
+		std::lock_guard<std::mutex> guard(m_mutex);
+		auto height = pBlockElement->Block.Height;
+		auto iter = m_entryIterators.find(height);
+		if (m_entryIterators.cend() != iter)
+			remove(iter->second);
+
+		while (m_memorySize + memorySize > m_maxMemorySize)
+			remove(std::prev(m_entries.end()));
+
+		m_entries.push_front(Entry{ pBlockElement, memorySize });
+		m_entryIterators.emplace(height, m_entries.begin());
+		m_memorySize += memorySize;
+	}
+
+	void RecentBlockElementCache::removeAfter(Height height) {
+		std::lock_guard<std::mutex> guard(m_mutex);
+		for (auto iter = m_entries.begin(); m_entries.end() != iter;) {
+			auto currentIter = iter++;
+			if (currentIter->pBlockElement->Block.Height > height)
+				remove(currentIter);
+		}
+	}
+
+	void RecentBlockElementCache::remove(EntryList::iterator iter) {
+		m_memorySize -= iter->MemorySize;
+		m_entryIterators.erase(iter->pBlockElement->Block.Height);
+		m_entries.erase(iter);
+	}
+}}
@@ -0,0 +1,88 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/model/Elements.h"
+#include "catapult/utils/FileSize.h"
+#include "catapult/utils/Hashers.h"
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace catapult { namespace io {
+
+	/// Memory bounded cache of recently used block elements keyed by height.
+	/// \note Least recently used block elements are evicted first.
+	class RecentBlockElementCache {
+	public:
+		/// Creates a cache that holds block elements with a total estimated size of at most \a maxMemorySize.
+		explicit RecentBlockElementCache(utils::FileSize maxMemorySize);
+
+	public:
+		/// Gets the maximum estimated size of all cached block elements.
+		utils::FileSize maxMemorySize() const;
+
+		/// Gets the estimated size of all cached block elements.
+		utils::FileSize memorySize() const;
+
+		/// Gets the number of cached block elements.
+		size_t size() const;
+
+		/// Gets the number of successful lookups.
+		uint64_t numHits() const;
+
+		/// Gets the number of failed lookups.
+		uint64_t numMisses() const;
+
+	public:
+		/// Finds the block element at \a height or returns \c nullptr if it is not cached.
+		std::shared_ptr<const model::BlockElement> find(Height height);
+
+		/// Adds \a pBlockElement to the cache.
+		/// \note Block elements that are larger than the maximum memory size are not cached.
+		void insert(const std::shared_ptr<const model::BlockElement>& pBlockElement);
+
+		/// Removes all block elements with heights greater than \a height.
+		void removeAfter(Height height);
+
+	private:
+		struct Entry {
+			std::shared_ptr<const model::BlockElement> pBlockElement;
+			uint64_t MemorySize;
+		};
+
+		using EntryList = std::list<Entry>;
+
+		void remove(EntryList::iterator iter);
+
+	private:
+		uint64_t m_maxMemorySize;
+		uint64_t m_memorySize;
+		EntryList m_entries; // ordered from most recently used to least recently used
+		std::unordered_map<Height, EntryList::iterator, utils::BaseValueHasher<Height>> m_entryIterators;
+		mutable std::mutex m_mutex;
+
+		std::atomic<uint64_t> m_numHits;
+		std::atomic<uint64_t> m_numMisses;
+	};
+}}
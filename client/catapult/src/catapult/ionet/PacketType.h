@@ -190,7 +190,36 @@ namespace catapult { namespace ionet {
 	ENUM_VALUE(Account_Restrictions_Infos, FACILITY_BASED_CODE(0x400, RestrictionAccount)) \
 	\
 	/* Mosaic restrictions infos have been requested by a client. */ \
-	ENUM_VALUE(Mosaic_Restrictions_Infos, FACILITY_BASED_CODE(0x400, RestrictionMosaic))
+	ENUM_VALUE(Mosaic_Restrictions_Infos, FACILITY_BASED_CODE(0x400, RestrictionMosaic)) \
+	\
+	/* batch state path packets have types [0x500, 0x600) - ordered by facility code name */ \
+	\
+	/* Account state paths for multiple keys have been requested by a client. */ \
+	ENUM_VALUE(Account_State_Paths, FACILITY_BASED_CODE(0x500, Core)) \
+	\
+	/* Hash lock state paths for multiple keys have been requested by a client. */ \
+	ENUM_VALUE(Hash_Lock_State_Paths, FACILITY_BASED_CODE(0x500, LockHash)) \
+	\
+	/* Secret lock state paths for multiple keys have been requested by a client. */ \
+	ENUM_VALUE(Secret_Lock_State_Paths, FACILITY_BASED_CODE(0x500, LockSecret)) \
+	\
+	/* Metadata state paths for multiple keys have been requested by a client. */ \
+	ENUM_VALUE(Metadata_State_Paths, FACILITY_BASED_CODE(0x500, Metadata)) \
+	\
+	/* Mosaic state paths for multiple keys have been requested by a client. */ \
+	ENUM_VALUE(Mosaic_State_Paths, FACILITY_BASED_CODE(0x500, Mosaic)) \
+	\
+	/* Multisig state paths for multiple keys have been requested by a client. */ \
+	ENUM_VALUE(Multisig_State_Paths, FACILITY_BASED_CODE(0x500, Multisig)) \
+	\
+	/* Namespace state paths for multiple keys have been requested by a client. */ \
+	ENUM_VALUE(Namespace_State_Paths, FACILITY_BASED_CODE(0x500, Namespace)) \
+	\
+	/* Account restrictions state paths for multiple keys have been requested by a client. */ \
+	ENUM_VALUE(Account_Restrictions_State_Paths, FACILITY_BASED_CODE(0x500, RestrictionAccount)) \
+	\
+	/* Mosaic restrictions state paths for multiple keys have been requested by a client. */ \
+	ENUM_VALUE(Mosaic_Restrictions_State_Paths, FACILITY_BASED_CODE(0x500, RestrictionMosaic))
 
 #define ENUM_VALUE(LABEL, VALUE) LABEL = VALUE,
 	/// Enumeration of known packet types.
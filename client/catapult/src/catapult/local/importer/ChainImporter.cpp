@@ -145,7 +145,18 @@ namespace catapult { namespace local {
 				// disable load optimizations (loading from the saved state is optimization enough) in order to prevent
 				// discontinuities in block analysis (e.g. statistic cache expects consecutive blocks)
 				auto observerFactory = [&pluginManager = m_pluginManager](const auto&) { return pluginManager.createObserver(); };
-				auto partialScore = LoadBlockchain(observerFactory, m_pluginManager, stateRef(), Height(2), statusConsumer);
+
+				// imported blocks are not trusted, so verify them on the pool while earlier blocks are being executed
+				auto* pPool = m_pBootstrapper->pool().pushIsolatedPool("block loader");
+				BlockLoadPipeline pipeline{
+					*pPool,
+					Max_Prefetched_Blocks_Per_Thread * pPool->numWorkerThreads(),
+					CreateBlockElementVerifier(
+							m_pluginManager.transactionRegistry(),
+							m_config.Blockchain.Network.GenerationHashSeed,
+							m_pluginManager.createNotificationPublisher())
+				};
+				auto partialScore = LoadBlockchain(observerFactory, m_pluginManager, stateRef(), Height(2), pipeline, statusConsumer);
 				m_score += partialScore;
 			}
 
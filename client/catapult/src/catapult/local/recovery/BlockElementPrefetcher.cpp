@@ -0,0 +1,210 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "BlockElementPrefetcher.h"
+#include "catapult/crypto/MerkleHashBuilder.h"
+#include "catapult/crypto/SecureRandomGenerator.h"
+#include "catapult/crypto/Signer.h"
+#include "catapult/model/BlockUtils.h"
+#include "catapult/model/Elements.h"
+#include "catapult/model/EntityHasher.h"
+#include "catapult/model/NotificationPublisher.h"
+#include "catapult/model/NotificationSubscriber.h"
+#include "catapult/exceptions.h"
+#include <boost/asio.hpp>
+
+namespace catapult { namespace local {
+
+	// region CreateBlockElementVerifier
+
+	namespace {
+		[[noreturn]]
+		void ThrowVerificationError(const char* message, Height height) {
+			CATAPULT_THROW_RUNTIME_ERROR_1(message, height);
+		}
+
+		class SignatureCapturingNotificationSubscriber : public model::NotificationSubscriber {
+		public:
+			explicit SignatureCapturingNotificationSubscriber(const GenerationHashSeed& generationHashSeed)
+					: m_generationHashSeed(generationHashSeed)
+			{}
+
+		public:
+			const auto& inputs() const {
+				return m_inputs;
+			}
+
+		public:
+			void notify(const model::Notification& notification) override {
+				if (model::SignatureNotification::Notification_Type != notification.Type)
+					return;
+
+				const auto& signatureNotification = static_cast<const model::SignatureNotification&>(notification);
+				crypto::SignatureInputBuffers buffers;
+				if (model::SignatureNotification::ReplayProtectionMode::Enabled == signatureNotification.DataReplayProtectionMode)
+					buffers.push_back(m_generationHashSeed);
+
+				buffers.push_back(signatureNotification.Data);
+				m_inputs.push_back({ signatureNotification.SignerPublicKey, std::move(buffers), signatureNotification.Signature });
+			}
+
+		private:
+			const GenerationHashSeed& m_generationHashSeed;
+			std::vector<crypto::SignatureInput> m_inputs;
+		};
+
+		void VerifyTransactionSignatures(
+				const model::NotificationPublisher& publisher,
+				const GenerationHashSeed& generationHashSeed,
+				const model::BlockElement& blockElement) {
+			SignatureCapturingNotificationSubscriber sub(generationHashSeed);
+			for (const auto& transactionElement : blockElement.Transactions) {
+				const auto& transaction = transactionElement.Transaction;
+				publisher.publish(model::WeakEntityInfo(transaction, transactionElement.EntityHash, blockElement.Block), sub);
+			}
+
+			auto randomFiller = [](auto* pOut, auto count) {
+				crypto::SecureRandomGenerator().fill(pOut, count);
+			};
+
+			const auto& inputs = sub.inputs();
+			if (!crypto::VerifyMultiShortCircuit(randomFiller, inputs.data(), inputs.size()))
+				ThrowVerificationError("block element has invalid transaction signature", blockElement.Block.Height);
+		}
+	}
+
+	BlockElementVerifier CreateBlockElementVerifier(
+			const model::TransactionRegistry& transactionRegistry,
+			const GenerationHashSeed& generationHashSeed,
+			const std::shared_ptr<const model::NotificationPublisher>& pPublisher) {
+		return [&transactionRegistry, generationHashSeed, pPublisher](const auto& blockElement) {
+			const auto& block = blockElement.Block;
+			if (model::CalculateHash(block) != blockElement.EntityHash)
+				ThrowVerificationError("block element has invalid block hash", block.Height);
+
+			if (!model::VerifyBlockHeaderSignature(block))
+				ThrowVerificationError("block element has invalid block signature", block.Height);
+
+			// recalculate all transaction hashes together because that is faster than calculating them individually
+			std::vector<model::TransactionElement> transactionElements;
+			std::vector<model::TransactionElement*> transactionElementPointers;
+			transactionElements.reserve(blockElement.Transactions.size());
+			for (const auto& transactionElement : blockElement.Transactions) {
+				transactionElements.emplace_back(transactionElement.Transaction);
+				transactionElementPointers.push_back(&transactionElements.back());
+			}
+
+			model::UpdateHashes(transactionRegistry, generationHashSeed, transactionElementPointers);
+
+			crypto::MerkleHashBuilder builder(transactionElements.size());
+			for (auto i = 0u; i < transactionElements.size(); ++i) {
+				const auto& expectedTransactionElement = transactionElements[i];
+				const auto& transactionElement = blockElement.Transactions[i];
+				if (expectedTransactionElement.EntityHash != transactionElement.EntityHash)
+					ThrowVerificationError("block element has invalid transaction hash", block.Height);
+
+				if (expectedTransactionElement.MerkleComponentHash != transactionElement.MerkleComponentHash)
+					ThrowVerificationError("block element has invalid transaction merkle component hash", block.Height);
+
+				builder.update(transactionElement.MerkleComponentHash);
+			}
+
+			// block signature covers transactions hash, so transaction data cannot be changed without invalidating it
+			Hash256 transactionsHash;
+			builder.final(transactionsHash);
+			if (block.TransactionsHash != transactionsHash)
+				ThrowVerificationError("block element has invalid block transactions hash", block.Height);
+
+			// transaction hashes do not prove that transaction signatures are valid, so they need to be checked too
+			VerifyTransactionSignatures(*pPublisher, generationHashSeed, blockElement);
+		};
+	}
+
+	// endregion
+
+	// region BlockElementPrefetcher
+
+	BlockElementPrefetcher::BlockElementPrefetcher(
+			boost::asio::io_context& ioContext,
+			Height startHeight,
+			Height endHeight,
+			size_t maxPrefetchedBlocks,
+			const BlockElementLoader& loader,
+			const BlockElementVerifier& verifier)
+			: m_ioContext(ioContext)
+			, m_nextHeight(startHeight)
+			, m_endHeight(endHeight)
+			, m_loader(loader)
+			, m_verifier(verifier) {
+		if (0 == maxPrefetchedBlocks)
+			CATAPULT_THROW_INVALID_ARGUMENT("max prefetched blocks must be nonzero");
+
+		for (auto i = 0u; i < maxPrefetchedBlocks; ++i)
+			prefetchNext();
+	}
+
+	BlockElementPrefetcher::~BlockElementPrefetcher() {
+		// outstanding loads reference this object, so they need to complete before it is destroyed
+		for (auto& blockElementFuture : m_blockElementFutures) {
+			try {
+				blockElementFuture.get();
+			} catch (...) {
+				// ignore failures of loads that will never be consumed
+			}
+		}
+	}
+
+	std::shared_ptr<const model::BlockElement> BlockElementPrefetcher::next() {
+		if (m_blockElementFutures.empty())
+			CATAPULT_THROW_OUT_OF_RANGE("no more block elements can be prefetched");
+
+		auto blockElementFuture = std::move(m_blockElementFutures.front());
+		m_blockElementFutures.pop_front();
+
+		// replace the consumed block element before waiting for it so that the pool always has maximum work
+		prefetchNext();
+		return blockElementFuture.get();
+	}
+
+	void BlockElementPrefetcher::prefetchNext() {
+		if (m_nextHeight > m_endHeight)
+			return;
+
+		auto pPromise = std::make_shared<thread::promise<std::shared_ptr<const model::BlockElement>>>();
+		m_blockElementFutures.push_back(pPromise->get_future());
+
+		boost::asio::post(m_ioContext, [this, height = m_nextHeight, pPromise]() {
+			try {
+				auto pBlockElement = m_loader(height);
+				if (m_verifier)
+					m_verifier(*pBlockElement);
+
+				pPromise->set_value(std::move(pBlockElement));
+			} catch (...) {
+				pPromise->set_exception(std::current_exception());
+			}
+		});
+
+		m_nextHeight = m_nextHeight + Height(1);
+	}
+
+	// endregion
+}}
@@ -0,0 +1,91 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/thread/Future.h"
+#include "catapult/functions.h"
+#include "catapult/types.h"
+#include <deque>
+#include <memory>
+
+namespace boost { namespace asio { class io_context; } }
+
+namespace catapult {
+	namespace model {
+		struct BlockElement;
+		class NotificationPublisher;
+		class TransactionRegistry;
+	}
+}
+
+namespace catapult { namespace local {
+
+	/// Maximum number of block elements that are prefetched for each worker thread.
+	constexpr size_t Max_Prefetched_Blocks_Per_Thread = 4;
+
+	/// Loads the block element at a height.
+	using BlockElementLoader = std::function<std::shared_ptr<const model::BlockElement> (Height)>;
+
+	/// Verifies a block element and throws if it is invalid.
+	using BlockElementVerifier = consumer<const model::BlockElement&>;
+
+	/// Creates a block element verifier that recalculates all block and transaction hashes using \a transactionRegistry and
+	/// \a generationHashSeed, compares them against the stored hashes and verifies the block signature.
+	/// All transaction signatures (including cosignatures) published by \a pPublisher are verified together in a single batch.
+	BlockElementVerifier CreateBlockElementVerifier(
+			const model::TransactionRegistry& transactionRegistry,
+			const GenerationHashSeed& generationHashSeed,
+			const std::shared_ptr<const model::NotificationPublisher>& pPublisher);
+
+	/// Loads and verifies block elements on a thread pool ahead of their in order consumption.
+	class BlockElementPrefetcher {
+	public:
+		/// Creates a prefetcher that uses \a ioContext to load all block elements with heights in [\a startHeight, \a endHeight]
+		/// using \a loader and to verify them using \a verifier.
+		/// At most \a maxPrefetchedBlocks block elements are loaded ahead of consumption.
+		BlockElementPrefetcher(
+				boost::asio::io_context& ioContext,
+				Height startHeight,
+				Height endHeight,
+				size_t maxPrefetchedBlocks,
+				const BlockElementLoader& loader,
+				const BlockElementVerifier& verifier);
+
+		/// Destroys the prefetcher after waiting for all outstanding loads to complete.
+		~BlockElementPrefetcher();
+
+	public:
+		/// Gets the next block element and blocks until it is available.
+		/// \note Any exception raised while loading or verifying the block element is rethrown.
+		std::shared_ptr<const model::BlockElement> next();
+
+	private:
+		void prefetchNext();
+
+	private:
+		boost::asio::io_context& m_ioContext;
+		Height m_nextHeight;
+		Height m_endHeight;
+		BlockElementLoader m_loader;
+		BlockElementVerifier m_verifier;
+		std::deque<thread::future<std::shared_ptr<const model::BlockElement>>> m_blockElementFutures;
+	};
+}}
@@ -32,6 +32,7 @@
 #include "catapult/observers/NotificationObserverAdapter.h"
 #include "catapult/plugins/PluginManager.h"
 #include "catapult/subscribers/StateChangeInfo.h"
+#include "catapult/thread/IoThreadPool.h"
 #include "catapult/utils/StackLogger.h"
 
 namespace catapult { namespace local {
@@ -115,11 +116,13 @@ namespace catapult { namespace local {
 				const plugins::PluginManager& pluginManager,
 				const extensions::LocalNodeStateRef& stateRef,
 				Height startHeight,
+				const BlockLoadPipeline* pPipeline,
 				const consumer<LoadedBlockStatus&&>& statusConsumer)
 				: m_observerFactory(observerFactory)
 				, m_pluginManager(pluginManager)
 				, m_stateRef(stateRef)
 				, m_startHeight(startHeight)
+				, m_pPipeline(pPipeline)
 				, m_statusConsumer(statusConsumer)
 		{}
 
@@ -134,8 +137,21 @@ namespace catapult { namespace local {
 			model::ChainScore score;
 			Hash256 stateHash;
 			auto chainHeight = storage.chainHeight();
+
+			// prefetcher is destroyed before storage view because it loads blocks from it
+			std::unique_ptr<BlockElementPrefetcher> pPrefetcher;
+			if (m_pPipeline) {
+				pPrefetcher = std::make_unique<BlockElementPrefetcher>(
+						m_pPipeline->Pool.ioContext(),
+						height,
+						chainHeight,
+						m_pPipeline->MaxPrefetchedBlocks,
+						[&storage](auto prefetchHeight) { return storage.loadBlockElement(prefetchHeight); },
+						m_pPipeline->Verifier);
+			}
+
 			while (chainHeight >= height) {
-				auto pBlockElement = storage.loadBlockElement(height);
+				auto pBlockElement = pPrefetcher ? pPrefetcher->next() : storage.loadBlockElement(height);
 				score += model::ChainScore(chain::CalculateScore(pParentBlockElement->Block, pBlockElement->Block));
 
 				const auto& blockElement = *pBlockElement;
@@ -190,20 +206,43 @@ namespace catapult { namespace local {
 		const plugins::PluginManager& m_pluginManager;
 		const extensions::LocalNodeStateRef& m_stateRef;
 		Height m_startHeight;
+		const BlockLoadPipeline* m_pPipeline;
 		consumer<LoadedBlockStatus&&> m_statusConsumer;
 	};
 
+	namespace {
+		model::ChainScore LoadBlockchainWithOptionalPipeline(
+				const BlockDependentNotificationObserverFactory& observerFactory,
+				const plugins::PluginManager& pluginManager,
+				const extensions::LocalNodeStateRef& stateRef,
+				Height startHeight,
+				const BlockLoadPipeline* pPipeline,
+				const consumer<LoadedBlockStatus&&>& statusConsumer) {
+			BlockchainLoader loader(observerFactory, pluginManager, stateRef, startHeight, pPipeline, statusConsumer);
+
+			utils::StackLogger logger("load blockchain", utils::LogLevel::important);
+			utils::StackTimer stopwatch;
+			return loader.loadAll(AnalyzeProgressLogger(stopwatch));
+		}
+	}
+
 	model::ChainScore LoadBlockchain(
 			const BlockDependentNotificationObserverFactory& observerFactory,
 			const plugins::PluginManager& pluginManager,
 			const extensions::LocalNodeStateRef& stateRef,
 			Height startHeight,
 			const consumer<LoadedBlockStatus&&>& statusConsumer) {
-		BlockchainLoader loader(observerFactory, pluginManager, stateRef, startHeight, statusConsumer);
+		return LoadBlockchainWithOptionalPipeline(observerFactory, pluginManager, stateRef, startHeight, nullptr, statusConsumer);
+	}
 
-		utils::StackLogger logger("load blockchain", utils::LogLevel::important);
-		utils::StackTimer stopwatch;
-		return loader.loadAll(AnalyzeProgressLogger(stopwatch));
+	model::ChainScore LoadBlockchain(
+			const BlockDependentNotificationObserverFactory& observerFactory,
+			const plugins::PluginManager& pluginManager,
+			const extensions::LocalNodeStateRef& stateRef,
+			Height startHeight,
+			const BlockLoadPipeline& pipeline,
+			const consumer<LoadedBlockStatus&&>& statusConsumer) {
+		return LoadBlockchainWithOptionalPipeline(observerFactory, pluginManager, stateRef, startHeight, &pipeline, statusConsumer);
 	}
 
 	// endregion
@@ -20,6 +20,7 @@
 **/
 
 #pragma once
+#include "BlockElementPrefetcher.h"
 #include "catapult/model/ChainScore.h"
 #include "catapult/observers/ObserverTypes.h"
 #include <functional>
@@ -33,6 +34,7 @@ namespace catapult {
 	}
 	namespace plugins { class PluginManager; }
 	namespace subscribers { struct StateChangeInfo; }
+	namespace thread { class IoThreadPool; }
 }
 
 namespace catapult { namespace local {
@@ -65,13 +67,37 @@ namespace catapult { namespace local {
 		const subscribers::StateChangeInfo& StateChangeInfo;
 	};
 
+	/// Pipeline used to load and verify blocks ahead of their execution.
+	struct BlockLoadPipeline {
+		/// Pool used to load and verify blocks.
+		thread::IoThreadPool& Pool;
+
+		/// Maximum number of blocks loaded ahead of execution.
+		size_t MaxPrefetchedBlocks;
+
+		/// Optional verifier called for each loaded block.
+		BlockElementVerifier Verifier;
+	};
+
+	/// Loads a blockchain from storage using the supplied observer factory (\a observerFactory) and plugin manager (\a pluginManager)
+	/// and updating \a stateRef starting with the block at \a startHeight.
+	/// Each loaded block and supporting information is passed to \a statusConsumer.
+	model::ChainScore LoadBlockchain(
+			const BlockDependentNotificationObserverFactory& observerFactory,
+			const plugins::PluginManager& pluginManager,
+			const extensions::LocalNodeStateRef& stateRef,
+			Height startHeight,
+			const consumer<LoadedBlockStatus&&>& statusConsumer = consumer<LoadedBlockStatus>());
+
 	/// Loads a blockchain from storage using the supplied observer factory (\a observerFactory) and plugin manager (\a pluginManager)
 	/// and updating \a stateRef starting with the block at \a startHeight.
+	/// Blocks are loaded and verified by \a pipeline ahead of execution, but they are always executed in order on the calling thread.
 	/// Each loaded block and supporting information is passed to \a statusConsumer.
 	model::ChainScore LoadBlockchain(
 			const BlockDependentNotificationObserverFactory& observerFactory,
 			const plugins::PluginManager& pluginManager,
 			const extensions::LocalNodeStateRef& stateRef,
 			Height startHeight,
+			const BlockLoadPipeline& pipeline,
 			const consumer<LoadedBlockStatus&&>& statusConsumer = consumer<LoadedBlockStatus>());
 }}
@@ -169,6 +169,7 @@ namespace catapult { namespace local {
 				repairState(systemState.commitStep());
 
 				CATAPULT_LOG(info) << "finalizing";
+				stateRef().Cache.waitForPendingWrites();
 				systemState.reset();
 			}
 
@@ -194,7 +195,11 @@ namespace catapult { namespace local {
 				// discontinuities in block analysis (e.g. statistic cache expects consecutive blocks)
 				CATAPULT_LOG(info) << "loading state - block loading required";
 				auto observerFactory = [&pluginManager = m_pluginManager](const auto&) { return pluginManager.createObserver(); };
-				auto partialScore = LoadBlockchain(observerFactory, m_pluginManager, stateRef(), heights.Cache + Height(1));
+
+				// blocks in local storage have already been verified, so they only need to be loaded ahead of execution
+				auto* pPool = m_pBootstrapper->pool().pushIsolatedPool("block loader");
+				BlockLoadPipeline pipeline{ *pPool, Max_Prefetched_Blocks_Per_Thread * pPool->numWorkerThreads(), BlockElementVerifier() };
+				auto partialScore = LoadBlockchain(observerFactory, m_pluginManager, stateRef(), heights.Cache + Height(1), pipeline);
 				m_score += partialScore;
 			}
 
@@ -297,6 +302,7 @@ namespace catapult { namespace local {
 			void saveStateToDisk() {
 				if (!m_stateSavingRequired) {
 					// just write the commit step file that was deleted during recover
+					m_catapultCache.waitForPendingWrites();
 					io::IndexFile commitStepFile(m_dataDirectory.rootDir().file("commit_step.dat"));
 					commitStepFile.set(utils::to_underlying_type(consumers::CommitOperationStep::All_Updated));
 					return;
@@ -38,6 +38,7 @@
 #include "catapult/io/BlockStorageCache.h"
 #include "catapult/io/FileQueue.h"
 #include "catapult/io/FilesystemUtils.h"
+#include "catapult/io/RecentBlockElementCache.h"
 #include "catapult/ionet/NodeContainer.h"
 #include "catapult/local/HostUtils.h"
 #include "catapult/utils/StackLogger.h"
@@ -187,6 +188,22 @@ namespace catapult { namespace local {
 			});
 		}
 
+		void AddBlockStorageCounters(std::vector<utils::DiagnosticCounter>& counters, const io::BlockStorageCache& storage) {
+			const auto& recentBlockElements = storage.recentBlockElementCache();
+			counters.emplace_back(utils::DiagnosticCounterId("BLK C HIT"), [&recentBlockElements]() {
+				return recentBlockElements.numHits();
+			});
+			counters.emplace_back(utils::DiagnosticCounterId("BLK C MISS"), [&recentBlockElements]() {
+				return recentBlockElements.numMisses();
+			});
+			counters.emplace_back(utils::DiagnosticCounterId("BLK C SIZE"), [&recentBlockElements]() {
+				return recentBlockElements.size();
+			});
+			counters.emplace_back(utils::DiagnosticCounterId("BLK C MEM"), [&recentBlockElements]() {
+				return recentBlockElements.memorySize().megabytes();
+			});
+		}
+
 		// endregion
 
 		class DefaultLocalNode final : public LocalNode {
@@ -207,7 +224,8 @@ namespace catapult { namespace local {
 					, m_catapultCache({}) // note that sub caches are added in boot
 					, m_storage(
 							m_pBootstrapper->subscriptionManager().createBlockStorage(m_pBlockChangeSubscriber),
-							CreateStagingBlockStorage(m_dataDirectory, m_config.Node.FileDatabaseBatchSize))
+							CreateStagingBlockStorage(m_dataDirectory, m_config.Node.FileDatabaseBatchSize),
+							m_config.Node.BlockElementCacheSize)
 					, m_pUtCache(m_pBootstrapper->subscriptionManager().createUtCache(extensions::GetUtCacheOptions(m_config.Node)))
 					, m_pFinalizationSubscriber(m_pBootstrapper->subscriptionManager().createFinalizationSubscriber())
 					, m_pNodeSubscriber(CreateNodeSubscriber(
@@ -295,6 +313,7 @@ namespace catapult { namespace local {
 				});
 
 				AddNodeCounters(m_counters, m_nodes);
+				AddBlockStorageCounters(m_counters, m_storage);
 			}
 
 			bool executeAndNotifyNemesis() {
@@ -105,4 +105,36 @@ namespace catapult { namespace model {
 				transactionElement.EntityHash,
 				transactionRegistry);
 	}
+
+	void UpdateHashes(
+			const TransactionRegistry& transactionRegistry,
+			const GenerationHashSeed& generationHashSeed,
+			const std::vector<TransactionElement*>& transactionElements) {
+		// use same buffers as CalculateHash (full signature, public key, generation hash seed, data buffer)
+		constexpr size_t Num_Buffers_Per_Transaction = 4;
+
+		std::vector<RawBuffer> buffers;
+		buffers.reserve(Num_Buffers_Per_Transaction * transactionElements.size());
+		for (const auto* pTransactionElement : transactionElements) {
+			const auto& transaction = pTransactionElement->Transaction;
+			const auto& plugin = *transactionRegistry.findPlugin(transaction.Type);
+
+			buffers.push_back(transaction.Signature);
+			buffers.push_back(transaction.SignerPublicKey);
+			buffers.push_back(generationHashSeed);
+			buffers.push_back(plugin.dataBuffer(transaction));
+		}
+
+		std::vector<Hash256> entityHashes(transactionElements.size());
+		crypto::Sha3_256Multi(buffers.data(), Num_Buffers_Per_Transaction, entityHashes.size(), entityHashes.data());
+
+		for (auto i = 0u; i < transactionElements.size(); ++i) {
+			auto& transactionElement = *transactionElements[i];
+			transactionElement.EntityHash = entityHashes[i];
+			transactionElement.MerkleComponentHash = CalculateMerkleComponentHash(
+					transactionElement.Transaction,
+					transactionElement.EntityHash,
+					transactionRegistry);
+		}
+	}
 }}
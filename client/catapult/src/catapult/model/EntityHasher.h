@@ -21,6 +21,7 @@
 
 #pragma once
 #include "Block.h"
+#include <vector>
 
 namespace catapult {
 	namespace model {
@@ -57,4 +58,12 @@ namespace catapult { namespace model {
 				const TransactionRegistry& transactionRegistry,
 				const GenerationHashSeed& generationHashSeed,
 				TransactionElement& transactionElement);
+
+	/// Calculates the hashes for all \a transactionElements in place for the network with the specified
+	/// generation hash seed (\a generationHashSeed) using transaction information from \a transactionRegistry.
+	/// \note Entity hashes of all transaction elements are calculated together, which is faster than calculating them individually.
+	void UpdateHashes(
+			const TransactionRegistry& transactionRegistry,
+			const GenerationHashSeed& generationHashSeed,
+			const std::vector<TransactionElement*>& transactionElements);
 }}
@@ -43,6 +43,12 @@ namespace catapult { namespace plugins {
 				handlers::RegisterStatePathHandler<PacketType>(handlers, cache.sub<CacheType>());
 			});
 
+			auto maxStatePathKeys = pluginManager.storageConfig().MaxStatePathKeysPerRequest;
+			pluginManager.addHandlerHook([maxStatePathKeys](auto& handlers, const cache::CatapultCache& cache) {
+				using RequestTraits = BatchStatePathRequestTraits<CachePacketTypes::State_Paths, KeyType>;
+				handlers::RegisterBatchStatePathHandler<RequestTraits>(handlers, cache.sub<CacheType>(), maxStatePathKeys);
+			});
+
 			pluginManager.addDiagnosticHandlerHook([](auto& handlers, const cache::CatapultCache& cache) {
 				using RequestTraits = BatchHandlerFactoryTraits<CachePacketTypes::Diagnostic_Infos, KeyType>;
 				handlers::BatchHandlerFactory<RequestTraits>::RegisterOne(
@@ -56,6 +62,7 @@ namespace catapult { namespace plugins {
 		struct CachePacketTypesT {
 			static constexpr auto State_Path = static_cast<ionet::PacketType>(0x200 + utils::to_underlying_type(FacilityCode));
 			static constexpr auto Diagnostic_Infos = static_cast<ionet::PacketType>(0x400 + utils::to_underlying_type(FacilityCode));
+			static constexpr auto State_Paths = static_cast<ionet::PacketType>(0x500 + utils::to_underlying_type(FacilityCode));
 		};
 
 		template<ionet::PacketType PacketType, typename TCacheKey>
@@ -65,6 +72,13 @@ namespace catapult { namespace plugins {
 			TCacheKey Key;
 		};
 
+		template<ionet::PacketType PacketType, typename TCacheKey>
+		struct BatchStatePathRequestTraits {
+			static constexpr ionet::PacketType Packet_Type = PacketType;
+
+			using KeyType = TCacheKey;
+		};
+
 		template<ionet::PacketType PacketType, typename TCacheKey>
 		struct BatchHandlerFactoryTraits {
 			static constexpr ionet::PacketType Packet_Type = PacketType;
@@ -20,10 +20,77 @@
 **/
 
 #include "PluginManager.h"
+#include "catapult/cache_db/PatriciaTreeNodeCache.h"
+#include "catapult/cache_db/RocksBackgroundWriter.h"
+#include "catapult/cache_db/RocksDatabase.h"
+#include "catapult/thread/IoThreadPool.h"
 #include <filesystem>
 
 namespace catapult { namespace plugins {
 
+	namespace {
+		std::shared_ptr<cache::RocksBlockCache> CreateSharedBlockCache(const StorageConfiguration& storageConfig) {
+			const auto& databaseConfig = storageConfig.CacheDatabaseConfig;
+			// shared database always uses a single block cache
+			if (!storageConfig.PreferCacheDatabase || !(databaseConfig.EnableSharedBlockCache || databaseConfig.EnableSharedDatabase))
+				return nullptr;
+
+			if (utils::FileSize() == databaseConfig.BlockCacheSize)
+				return nullptr;
+
+			return std::make_shared<cache::RocksBlockCache>(databaseConfig.BlockCacheSize);
+		}
+
+		std::shared_ptr<cache::RocksBackgroundWriter> CreateBackgroundWriter(const StorageConfiguration& storageConfig) {
+			const auto& databaseConfig = storageConfig.CacheDatabaseConfig;
+			if (!storageConfig.PreferCacheDatabase || !databaseConfig.EnableAsyncCommit)
+				return nullptr;
+
+			return std::make_shared<cache::RocksBackgroundWriter>(databaseConfig.MaxPendingWrites);
+		}
+
+		std::shared_ptr<cache::PatriciaTreeNodeCache> CreateTreeNodeCache(
+				const model::BlockchainConfiguration& config,
+				const StorageConfiguration& storageConfig) {
+			// patricia trees are only stored when cache database is used
+			const auto& databaseConfig = storageConfig.CacheDatabaseConfig;
+			if (!storageConfig.PreferCacheDatabase || !config.EnableVerifiableState || 0 == databaseConfig.TreeNodeCacheSize)
+				return nullptr;
+
+			return std::make_shared<cache::PatriciaTreeNodeCache>(
+					databaseConfig.TreeNodeCacheSize,
+					databaseConfig.TreeNodeCachePinnedLevels);
+		}
+
+		std::unique_ptr<thread::IoThreadPool> CreateStateHashPool(
+				const model::BlockchainConfiguration& config,
+				const StorageConfiguration& storageConfig) {
+			// patricia trees are only stored when cache database is used
+			auto numThreads = storageConfig.CacheDatabaseConfig.StateHashThreadCount;
+			if (!storageConfig.PreferCacheDatabase || !config.EnableVerifiableState || 0 == numThreads)
+				return nullptr;
+
+			auto pPool = thread::CreateIoThreadPool(numThreads, "state hash");
+			pPool->start();
+			return pPool;
+		}
+
+		std::shared_ptr<cache::RocksSharedDatabase> CreateSharedDatabase(
+				const StorageConfiguration& storageConfig,
+				const std::shared_ptr<cache::RocksBlockCache>& pBlockCache,
+				const std::shared_ptr<cache::RocksBackgroundWriter>& pBackgroundWriter) {
+			const auto& databaseConfig = storageConfig.CacheDatabaseConfig;
+			if (!storageConfig.PreferCacheDatabase || !databaseConfig.EnableSharedDatabase)
+				return nullptr;
+
+			return std::make_shared<cache::RocksSharedDatabase>(
+					storageConfig.CacheDatabaseDirectory,
+					databaseConfig,
+					pBlockCache,
+					pBackgroundWriter);
+		}
+	}
+
 	PluginManager::PluginManager(
 			const model::BlockchainConfiguration& config,
 			const StorageConfiguration& storageConfig,
@@ -33,8 +100,15 @@ namespace catapult { namespace plugins {
 			, m_storageConfig(storageConfig)
 			, m_userConfig(userConfig)
 			, m_inflationConfig(inflationConfig)
+			, m_pSharedBlockCache(CreateSharedBlockCache(m_storageConfig))
+			, m_pBackgroundWriter(CreateBackgroundWriter(m_storageConfig))
+			, m_pSharedDatabase(CreateSharedDatabase(m_storageConfig, m_pSharedBlockCache, m_pBackgroundWriter))
+			, m_pTreeNodeCache(CreateTreeNodeCache(m_config, m_storageConfig))
+			, m_pStateHashPool(CreateStateHashPool(m_config, m_storageConfig))
 	{}
 
+	PluginManager::~PluginManager() = default;
+
 	// region config
 
 	const model::BlockchainConfiguration& PluginManager::config() const {
@@ -57,10 +131,16 @@ namespace catapult { namespace plugins {
 		if (!m_storageConfig.PreferCacheDatabase)
 			return cache::CacheConfiguration();
 
-		return cache::CacheConfiguration(
+		auto cacheConfig = cache::CacheConfiguration(
 				(std::filesystem::path(m_storageConfig.CacheDatabaseDirectory) / name).generic_string(),
 				m_storageConfig.CacheDatabaseConfig,
 				m_config.EnableVerifiableState ? cache::PatriciaTreeStorageMode::Enabled : cache::PatriciaTreeStorageMode::Disabled);
+		cacheConfig.pSharedBlockCache = m_pSharedBlockCache;
+		cacheConfig.pSharedDatabase = m_pSharedDatabase;
+		cacheConfig.pBackgroundWriter = m_pBackgroundWriter;
+		cacheConfig.pTreeNodeCache = m_pTreeNodeCache;
+		cacheConfig.pStateHashPool = m_pStateHashPool.get();
+		return cacheConfig;
 	}
 
 	// endregion
@@ -84,7 +164,9 @@ namespace catapult { namespace plugins {
 	}
 
 	cache::CatapultCache PluginManager::createCache() {
-		return m_cacheBuilder.build();
+		return m_pSharedDatabase || m_pBackgroundWriter
+				? m_cacheBuilder.build(m_pSharedDatabase, m_pBackgroundWriter)
+				: m_cacheBuilder.build();
 	}
 
 	// endregion
@@ -131,6 +213,19 @@ namespace catapult { namespace plugins {
 	}
 
 	void PluginManager::addDiagnosticCounters(std::vector<utils::DiagnosticCounter>& counters, const cache::CatapultCache& cache) const {
+		if (m_pTreeNodeCache) {
+			auto pTreeNodeCache = m_pTreeNodeCache;
+			counters.emplace_back(utils::DiagnosticCounterId("TREE C HIT"), [pTreeNodeCache]() {
+				return pTreeNodeCache->numHits();
+			});
+			counters.emplace_back(utils::DiagnosticCounterId("TREE C MISS"), [pTreeNodeCache]() {
+				return pTreeNodeCache->numMisses();
+			});
+			counters.emplace_back(utils::DiagnosticCounterId("TREE C SIZE"), [pTreeNodeCache]() {
+				return pTreeNodeCache->size();
+			});
+		}
+
 		ApplyAll(counters, m_diagnosticCounterHooks, cache);
 	}
 
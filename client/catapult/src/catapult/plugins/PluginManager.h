@@ -44,6 +44,7 @@ namespace catapult { namespace plugins {
 		StorageConfiguration()
 				: PreferCacheDatabase(false)
 				, CacheDatabaseConfig() // default initialize
+				, MaxStatePathKeysPerRequest(0)
 		{}
 
 	public:
@@ -55,6 +56,9 @@ namespace catapult { namespace plugins {
 
 		/// Cache database configuration.
 		config::NodeConfiguration::CacheDatabaseSubConfiguration CacheDatabaseConfig;
+
+		/// Maximum number of keys in a single batch state path request.
+		uint32_t MaxStatePathKeysPerRequest;
 	};
 
 	/// Manager for registering plugins.
@@ -90,6 +94,9 @@ namespace catapult { namespace plugins {
 				const config::UserConfiguration& userConfig,
 				const config::InflationConfiguration& inflationConfig);
 
+		/// Destroys the plugin manager.
+		~PluginManager();
+
 	public:
 		// region config
 
@@ -227,6 +234,11 @@ namespace catapult { namespace plugins {
 		config::InflationConfiguration m_inflationConfig;
 		model::TransactionRegistry m_transactionRegistry;
 		cache::CatapultCacheBuilder m_cacheBuilder;
+		std::shared_ptr<cache::RocksBlockCache> m_pSharedBlockCache;
+		std::shared_ptr<cache::RocksBackgroundWriter> m_pBackgroundWriter;
+		std::shared_ptr<cache::RocksSharedDatabase> m_pSharedDatabase;
+		std::shared_ptr<cache::PatriciaTreeNodeCache> m_pTreeNodeCache;
+		std::unique_ptr<thread::IoThreadPool> m_pStateHashPool;
 
 		std::vector<HandlerHook> m_nonDiagnosticHandlerHooks;
 		std::vector<HandlerHook> m_diagnosticHandlerHooks;
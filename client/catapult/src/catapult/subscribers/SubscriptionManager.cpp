@@ -36,7 +36,14 @@ namespace catapult { namespace subscribers {
 
 	SubscriptionManager::SubscriptionManager(const config::CatapultConfiguration& config)
 			: m_config(config)
-			, m_pStorage(std::make_unique<io::FileBlockStorage>(m_config.User.DataDirectory, m_config.Node.FileDatabaseBatchSize)) {
+			, m_pStorage(std::make_unique<io::FileBlockStorage>(
+					m_config.User.DataDirectory,
+					m_config.Node.FileDatabaseBatchSize,
+					io::FileBlockStorageMode::Hash_Index,
+					m_config.Node.EnableMemoryMappedBlockReads && 0 == m_config.Node.BlockStorageCompressionLevel
+							? io::FileBlockStorageReadMode::Memory_Mapped
+							: io::FileBlockStorageReadMode::Copy,
+					m_config.Node.BlockStorageCompressionLevel)) {
 		m_subscriberUsedFlags.fill(false);
 	}
 
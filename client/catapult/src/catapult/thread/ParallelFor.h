@@ -22,9 +22,22 @@
 #pragma once
 #include "Future.h"
 #include <boost/asio.hpp>
+#include <algorithm>
+#include <memory>
+#include <vector>
 
 namespace catapult { namespace thread {
 
+	/// Strategy for distributing items across threads.
+	enum class ParallelForStrategy {
+		/// Split items into a fixed number of equally sized partitions.
+		Static,
+
+		/// Split items into per-worker ranges and let idle workers steal items from busy workers.
+		/// \note This strategy is preferred when item processing costs are skewed.
+		Work_Stealing
+	};
+
 	/// Uses \a ioContext to process \a items in \a numPartitions batches and calls \a callback for each partition.
 	/// Future is returned that is resolved when all items have been processed.
 	template<typename TItems, typename TWorkCallback>
@@ -114,6 +127,92 @@ namespace catapult { namespace thread {
 		return pParallelContext->future();
 	}
 
+	namespace detail {
+		/// Partition of items.
+		struct WeightedPartition {
+			/// Index of first item in partition.
+			size_t StartIndex;
+
+			/// Number of items in partition.
+			size_t Size;
+		};
+
+		/// Splits \a items into at most \a numPartitions contiguous partitions of roughly equal total weight, as determined by
+		/// \a weightAccessor, such that each partition contains at least \a minPartitionSize items.
+		template<typename TItems, typename TWeightAccessor>
+		std::vector<WeightedPartition> CalculateWeightedPartitions(
+				const TItems& items,
+				size_t numPartitions,
+				size_t minPartitionSize,
+				TWeightAccessor weightAccessor) {
+			std::vector<WeightedPartition> partitions;
+			auto numItems = items.size();
+			if (0 == numItems)
+				return partitions;
+
+			std::vector<uint64_t> weights;
+			weights.reserve(numItems);
+			uint64_t remainingWeight = 0;
+			for (const auto& item : items) {
+				weights.push_back(weightAccessor(item));
+				remainingWeight += weights.back();
+			}
+
+			// never create a partition with fewer than minPartitionSize items unless there are fewer items in total
+			minPartitionSize = std::max<size_t>(1, minPartitionSize);
+			numPartitions = std::max<size_t>(1, std::min(numPartitions, numItems / minPartitionSize));
+
+			size_t startIndex = 0;
+			for (auto numRemainingPartitions = numPartitions; numRemainingPartitions > 1; --numRemainingPartitions) {
+				// leave enough items for all remaining partitions to be at least minPartitionSize
+				auto maxEndIndex = numItems - (numRemainingPartitions - 1) * minPartitionSize;
+				auto targetWeight = remainingWeight / numRemainingPartitions;
+
+				auto endIndex = startIndex;
+				uint64_t partitionWeight = 0;
+				while (maxEndIndex > endIndex && (endIndex - startIndex < minPartitionSize || partitionWeight < targetWeight))
+					partitionWeight += weights[endIndex++];
+
+				partitions.push_back({ startIndex, endIndex - startIndex });
+				remainingWeight -= partitionWeight;
+				startIndex = endIndex;
+			}
+
+			partitions.push_back({ startIndex, numItems - startIndex });
+			return partitions;
+		}
+	}
+
+	/// Uses \a ioContext to process \a items in at most \a numPartitions batches of roughly equal weight and calls \a callback
+	/// for each partition. Weight of each item is determined by \a weightAccessor and each partition contains at least
+	/// \a minPartitionSize items (unless there are fewer items in total).
+	/// Future is returned that is resolved when all items have been processed.
+	template<typename TItems, typename TWeightAccessor, typename TWorkCallback>
+	thread::future<bool> WeightedParallelForPartition(
+			boost::asio::io_context& ioContext,
+			TItems& items,
+			size_t numPartitions,
+			size_t minPartitionSize,
+			TWeightAccessor weightAccessor,
+			TWorkCallback callback) {
+		using DifferenceType = typename decltype(items.begin())::difference_type;
+
+		// partitions need to outlive this function because they are processed asynchronously
+		auto pPartitions = std::make_shared<std::vector<detail::WeightedPartition>>(
+				detail::CalculateWeightedPartitions(items, numPartitions, minPartitionSize, weightAccessor));
+		auto itItemsBegin = items.begin();
+		auto partitionCallback = [pPartitions, itItemsBegin, callback](auto itPartition, auto, auto, auto batchIndex) {
+			auto itBegin = itItemsBegin;
+			std::advance(itBegin, static_cast<DifferenceType>(itPartition->StartIndex));
+
+			auto itEnd = itBegin;
+			std::advance(itEnd, static_cast<DifferenceType>(itPartition->Size));
+			callback(itBegin, itEnd, itPartition->StartIndex, batchIndex);
+		};
+
+		return ParallelForPartition(ioContext, *pPartitions, pPartitions->size(), partitionCallback);
+	}
+
 	/// Uses \a ioContext to process \a items in \a numPartitions batches and calls \a callback for each item.
 	/// Future is returned that is resolved when all items have been processed.
 	template<typename TItems, typename TWorkCallback>
@@ -0,0 +1,287 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "Future.h"
+#include "catapult/exceptions.h"
+#include <boost/asio.hpp>
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <limits>
+#include <vector>
+
+namespace catapult { namespace thread {
+
+	namespace detail {
+		/// Per-worker ranges of item indexes.
+		/// Each worker claims chunks from the front of its own range and steals half of the largest remaining range
+		/// (from the back) when its own range is exhausted.
+		class WorkStealingRanges {
+		private:
+			static constexpr size_t Max_Num_Items = std::numeric_limits<uint32_t>::max();
+
+			// pad each range to its own cache line so that owner updates do not contend with each other
+			struct alignas(64) PackedRange {
+				std::atomic<uint64_t> Value;
+			};
+
+		public:
+			/// Creates ranges for \a numItems items split across \a numWorkers workers.
+			/// Chunks will contain at least \a minGrainSize items unless fewer items remain.
+			WorkStealingRanges(size_t numItems, size_t numWorkers, size_t minGrainSize)
+					: m_minGrainSize(std::max<size_t>(1, minGrainSize))
+					, m_ranges(std::max<size_t>(1, numWorkers)) {
+				if (numItems > Max_Num_Items)
+					CATAPULT_THROW_INVALID_ARGUMENT_1("too many items for work stealing", numItems);
+
+				// split items into contiguous initial ranges using same distribution as ParallelForPartition
+				size_t begin = 0;
+				for (auto i = 0u; i < m_ranges.size(); ++i) {
+					auto end = begin + (numItems - begin) / (m_ranges.size() - i);
+					if (0 != (numItems - begin) % (m_ranges.size() - i))
+						++end;
+
+					m_ranges[i].Value = Pack(begin, end);
+					begin = end;
+				}
+			}
+
+		public:
+			/// Gets the number of workers.
+			size_t numWorkers() const {
+				return m_ranges.size();
+			}
+
+			/// Claims the next chunk of items for worker \a workerId and stores its index bounds in \a begin and \a end.
+			/// Returns \c false when there are no unclaimed items left.
+			bool next(size_t workerId, size_t& begin, size_t& end) {
+				while (true) {
+					if (popFront(workerId, begin, end))
+						return true;
+
+					if (!steal(workerId))
+						return false;
+				}
+			}
+
+		private:
+			bool popFront(size_t workerId, size_t& begin, size_t& end) {
+				auto& range = m_ranges[workerId].Value;
+				auto packed = range.load();
+				while (true) {
+					auto currentBegin = Begin(packed);
+					auto currentEnd = End(packed);
+					if (currentBegin >= currentEnd)
+						return false;
+
+					// adaptive grain: claim a quarter of the remaining range so that chunks shrink as the range drains
+					// and a large tail is left available for stealing
+					auto remaining = currentEnd - currentBegin;
+					auto size = std::min(remaining, std::max(m_minGrainSize, remaining / 4));
+					if (range.compare_exchange_weak(packed, Pack(currentBegin + size, currentEnd))) {
+						begin = currentBegin;
+						end = currentBegin + size;
+						return true;
+					}
+				}
+			}
+
+			bool steal(size_t workerId) {
+				while (true) {
+					// pick the victim with the most remaining items
+					size_t victimId = 0;
+					uint64_t victimPacked = 0;
+					size_t victimRemaining = 0;
+					for (auto i = 0u; i < m_ranges.size(); ++i) {
+						if (workerId == i)
+							continue;
+
+						auto packed = m_ranges[i].Value.load();
+						auto remaining = Remaining(packed);
+						if (remaining > victimRemaining) {
+							victimId = i;
+							victimPacked = packed;
+							victimRemaining = remaining;
+						}
+					}
+
+					if (0 == victimRemaining)
+						return false;
+
+					// take the back half of the victim range (or all of it when it is not worth splitting)
+					auto victimBegin = Begin(victimPacked);
+					auto victimEnd = End(victimPacked);
+					auto size = victimRemaining < 2 * m_minGrainSize ? victimRemaining : (victimRemaining + 1) / 2;
+					auto stolenBegin = victimEnd - size;
+					if (!m_ranges[victimId].Value.compare_exchange_strong(victimPacked, Pack(victimBegin, stolenBegin)))
+						continue;
+
+					// only the owner refills its own (empty) range, so a plain store is sufficient
+					m_ranges[workerId].Value = Pack(stolenBegin, victimEnd);
+					return true;
+				}
+			}
+
+		private:
+			static uint64_t Pack(size_t begin, size_t end) {
+				return static_cast<uint64_t>(begin) << 32 | static_cast<uint64_t>(end);
+			}
+
+			static size_t Begin(uint64_t packed) {
+				return static_cast<size_t>(packed >> 32);
+			}
+
+			static size_t End(uint64_t packed) {
+				return static_cast<size_t>(packed & 0xFFFF'FFFF);
+			}
+
+			static size_t Remaining(uint64_t packed) {
+				auto begin = Begin(packed);
+				auto end = End(packed);
+				return begin < end ? end - begin : 0;
+			}
+
+		private:
+			size_t m_minGrainSize;
+			std::vector<PackedRange> m_ranges;
+		};
+	}
+
+	/// Uses \a ioContext to process \a items with \a numWorkers workers that dynamically balance work by stealing from each other
+	/// and calls \a callback for each claimed chunk of at least \a minGrainSize items.
+	/// Future is returned that is resolved when all items have been processed.
+	/// \note Unlike ParallelForPartition, \a callback can be called multiple times per worker and is passed the worker index
+	///       instead of the batch index.
+	template<typename TItems, typename TWorkCallback>
+	thread::future<bool> WorkStealingParallelForPartition(
+			boost::asio::io_context& ioContext,
+			TItems& items,
+			size_t numWorkers,
+			size_t minGrainSize,
+			TWorkCallback callback) {
+		using IteratorType = decltype(items.begin());
+		static_assert(
+				std::is_base_of_v<std::random_access_iterator_tag, typename std::iterator_traits<IteratorType>::iterator_category>,
+				"work stealing requires random access iterators");
+
+		// region WorkStealingContext
+
+		class WorkStealingContext {
+		public:
+			WorkStealingContext(size_t numItems, size_t numWorkersParam, size_t minGrainSizeParam)
+					: m_ranges(numItems, numWorkersParam, minGrainSizeParam)
+					, m_numOutstandingWorkers(m_ranges.numWorkers())
+			{}
+
+		public:
+			auto& ranges() {
+				return m_ranges;
+			}
+
+			auto future() {
+				return m_promise.get_future();
+			}
+
+		public:
+			void decrementOutstandingWorkers() {
+				if (0 != --m_numOutstandingWorkers)
+					return;
+
+				m_promise.set_value(true);
+			}
+
+		private:
+			detail::WorkStealingRanges m_ranges;
+			std::atomic<size_t> m_numOutstandingWorkers;
+			thread::promise<bool> m_promise;
+		};
+
+		// endregion
+
+		// region DecrementGuard
+
+		class DecrementGuard {
+		public:
+			explicit DecrementGuard(WorkStealingContext& context) : m_context(context)
+			{}
+
+			~DecrementGuard() {
+				m_context.decrementOutstandingWorkers();
+			}
+
+		private:
+			WorkStealingContext& m_context;
+		};
+
+		// endregion
+
+		auto numItems = items.size();
+		if (0 == numItems)
+			return thread::make_ready_future(true);
+
+		// there is no benefit to starting more workers than there are items
+		auto pContext = std::make_shared<WorkStealingContext>(numItems, std::min(numWorkers, numItems), minGrainSize);
+		auto itBegin = items.begin();
+		for (auto workerId = 0u; workerId < pContext->ranges().numWorkers(); ++workerId) {
+			// each worker captures pContext by value, which keeps that object alive
+			boost::asio::post(ioContext, [callback, pContext, itBegin, workerId]() {
+				DecrementGuard workerGuard(*pContext);
+
+				size_t begin;
+				size_t end;
+				while (pContext->ranges().next(workerId, begin, end)) {
+					using DifferenceType = typename std::iterator_traits<IteratorType>::difference_type;
+					auto itChunkBegin = itBegin + static_cast<DifferenceType>(begin);
+					auto itChunkEnd = itBegin + static_cast<DifferenceType>(end);
+					callback(itChunkBegin, itChunkEnd, begin, static_cast<size_t>(workerId));
+				}
+			});
+		}
+
+		return pContext->future();
+	}
+
+	/// Uses \a ioContext to process \a items with \a numWorkers workers that dynamically balance work by stealing from each other
+	/// and calls \a callback for each item.
+	/// Future is returned that is resolved when all items have been processed.
+	/// \note Processing of all remaining items is skipped after \a callback returns \c false.
+	template<typename TItems, typename TWorkCallback>
+	thread::future<bool> WorkStealingParallelFor(
+			boost::asio::io_context& ioContext,
+			TItems& items,
+			size_t numWorkers,
+			TWorkCallback callback) {
+		// since chunks are claimed dynamically, a short circuit needs to be visible to all workers
+		auto pIsAborted = std::make_shared<std::atomic_bool>(false);
+		return WorkStealingParallelForPartition(ioContext, items, numWorkers, 1, [callback, pIsAborted](
+				auto itBegin,
+				auto itEnd,
+				auto startIndex,
+				auto) {
+			auto i = 0u;
+			for (auto iter = itBegin; itEnd != iter && !*pIsAborted; ++iter, ++i) {
+				if (!callback(*iter, startIndex + i))
+					*pIsAborted = true;
+			}
+		});
+	}
+}}
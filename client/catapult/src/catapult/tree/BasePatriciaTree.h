@@ -36,13 +36,24 @@ namespace catapult { namespace tree {
 
 	public:
 		/// Creates a tree around \a dataSource.
-		explicit BasePatriciaTree(TDataSource& dataSource)
+		explicit BasePatriciaTree(TDataSource& dataSource) : BasePatriciaTree(dataSource, TreeNodesHasher())
+		{}
+
+		/// Creates a tree around \a dataSource whose deltas use \a hasher to hash independent changed subtrees.
+		BasePatriciaTree(TDataSource& dataSource, const TreeNodesHasher& hasher)
 				: m_dataSource(dataSource)
+				, m_hasher(hasher)
 				, m_tree(m_dataSource)
 		{}
 
 		/// Creates a tree around \a dataSource with specified root hash (\a rootHash).
-		BasePatriciaTree(TDataSource& dataSource, const Hash256& rootHash) : BasePatriciaTree(dataSource) {
+		BasePatriciaTree(TDataSource& dataSource, const Hash256& rootHash) : BasePatriciaTree(dataSource, rootHash, TreeNodesHasher())
+		{}
+
+		/// Creates a tree around \a dataSource with specified root hash (\a rootHash)
+		/// whose deltas use \a hasher to hash independent changed subtrees.
+		BasePatriciaTree(TDataSource& dataSource, const Hash256& rootHash, const TreeNodesHasher& hasher)
+				: BasePatriciaTree(dataSource, hasher) {
 			if (!m_tree.tryLoad(rootHash))
 				CATAPULT_THROW_RUNTIME_ERROR_1("unable to load tree with root hash", rootHash);
 		}
@@ -58,13 +69,18 @@ namespace catapult { namespace tree {
 			return m_tree.lookup(key, nodePath);
 		}
 
+		/// Tries to find the values associated with \a keys in the tree and stores deduplicated proofs of existence or not in \a proof.
+		std::vector<std::pair<Hash256, bool>> lookup(const std::vector<KeyType>& keys, PatriciaTreeBatchProof& proof) const {
+			return m_tree.lookup(keys, proof);
+		}
+
 	public:
 		/// Gets a delta based on the same data source as this tree.
 		std::shared_ptr<DeltaType> rebase() {
 			if (m_pWeakDelta.lock())
 				CATAPULT_THROW_RUNTIME_ERROR("only a single attached delta is allowed at a time");
 
-			auto pDelta = std::make_shared<DeltaType>(m_dataSource, root());
+			auto pDelta = std::make_shared<DeltaType>(m_dataSource, root(), m_hasher);
 			m_pWeakDelta = pDelta;
 			return pDelta;
 		}
@@ -72,7 +88,7 @@ namespace catapult { namespace tree {
 		/// Gets a delta based on the same data source as this tree
 		/// but without the ability to commit any changes to the original tree.
 		std::shared_ptr<DeltaType> rebaseDetached() const {
-			return std::make_shared<DeltaType>(m_dataSource, root());
+			return std::make_shared<DeltaType>(m_dataSource, root(), m_hasher);
 		}
 
 	public:
@@ -91,6 +107,7 @@ namespace catapult { namespace tree {
 
 	private:
 		TDataSource& m_dataSource;
+		TreeNodesHasher m_hasher;
 		PatriciaTree<TEncoder, TDataSource> m_tree;
 		std::weak_ptr<DeltaType> m_pWeakDelta;
 	};
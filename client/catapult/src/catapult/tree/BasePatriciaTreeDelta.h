@@ -22,6 +22,7 @@
 #pragma once
 #include "PatriciaTree.h"
 #include "ReadThroughMemoryDataSource.h"
+#include "TreeNodeArena.h"
 #include "catapult/utils/HexFormatter.h"
 #include "catapult/exceptions.h"
 #include <unordered_map>
@@ -35,13 +36,24 @@ namespace catapult { namespace tree {
 	private:
 		using KeyType = typename TEncoder::KeyType;
 		using ValueType = typename TEncoder::ValueType;
+		using TreeType = PatriciaTree<TEncoder, ReadThroughMemoryDataSource<TDataSource>>;
+
+	public:
+		using EncodedPair = typename TreeType::EncodedPair;
 
 	public:
 		/// Creates a tree around \a dataSource with root \a rootHash.
 		BasePatriciaTreeDelta(const TDataSource& dataSource, const Hash256& rootHash)
+				: BasePatriciaTreeDelta(dataSource, rootHash, TreeNodesHasher())
+		{}
+
+		/// Creates a tree around \a dataSource with root \a rootHash that uses \a hasher to hash independent changed subtrees.
+		BasePatriciaTreeDelta(const TDataSource& dataSource, const Hash256& rootHash, const TreeNodesHasher& hasher)
 				: m_dataSource(dataSource)
 				, m_baseRootHash(rootHash)
-				, m_tree(m_dataSource) {
+				, m_hasher(hasher)
+				, m_pArena(std::make_shared<TreeNodeArena>())
+				, m_tree(m_dataSource, m_pArena) {
 			m_tree.tryLoad(rootHash);
 		}
 
@@ -72,6 +84,16 @@ namespace catapult { namespace tree {
 			return m_tree.set(key, value);
 		}
 
+		/// Encodes \a key and \a value into a pair that can be passed to setBatch.
+		static EncodedPair Encode(const KeyType& key, const ValueType& value) {
+			return TreeType::Encode(key, value);
+		}
+
+		/// Sets all encoded key value \a pairs in the tree.
+		void setBatch(std::vector<EncodedPair>&& pairs) {
+			m_tree.setBatch(std::move(pairs), m_hasher);
+		}
+
 		/// Removes the value associated with \a key from the tree.
 		bool unset(const KeyType& key) {
 			return m_tree.unset(key);
@@ -108,6 +130,8 @@ namespace catapult { namespace tree {
 	private:
 		ReadThroughMemoryDataSource<TDataSource> m_dataSource;
 		Hash256 m_baseRootHash;
-		PatriciaTree<TEncoder, ReadThroughMemoryDataSource<TDataSource>> m_tree;
+		TreeNodesHasher m_hasher;
+		std::shared_ptr<TreeNodeArena> m_pArena; // in-memory nodes are recycled across all changes to this delta
+		TreeType m_tree;
 	};
 }}
@@ -20,10 +20,19 @@
 **/
 
 #pragma once
+#include "PatriciaTreeBatchProof.h"
 #include "TreeNode.h"
+#include "catapult/utils/Hashers.h"
+#include "catapult/functions.h"
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
 
 namespace catapult { namespace tree {
 
+	/// Calculates the hashes of independent tree \a nodes, which allows them to be hashed in parallel.
+	using TreeNodesHasher = consumer<std::vector<TreeNode>&>;
+
 	/// Represents a compact patricia tree.
 	template<typename TEncoder, typename TDataSource>
 	class PatriciaTree {
@@ -33,7 +42,13 @@ namespace catapult { namespace tree {
 
 	public:
 		/// Creates a tree around \a dataSource.
-		explicit PatriciaTree(TDataSource& dataSource) : m_dataSource(dataSource)
+		explicit PatriciaTree(TDataSource& dataSource) : PatriciaTree(dataSource, nullptr)
+		{}
+
+		/// Creates a tree around \a dataSource that allocates in-memory nodes from \a pArena (if specified).
+		PatriciaTree(TDataSource& dataSource, const std::shared_ptr<TreeNodeArena>& pArena)
+				: m_dataSource(dataSource)
+				, m_pArena(pArena)
 		{}
 
 	public:
@@ -150,6 +165,157 @@ namespace catapult { namespace tree {
 
 		// endregion
 
+		// region setBatch
+
+	public:
+		/// Key value pair that is encoded for insertion into the tree.
+		struct EncodedPair {
+			/// Encoded key.
+			TreeNodePath Path;
+
+			/// Encoded value.
+			Hash256 Value;
+		};
+
+		/// Encodes \a key and \a value into a pair that can be passed to setBatch.
+		static EncodedPair Encode(const KeyType& key, const ValueType& value) {
+			return { TreeNodePath(TEncoder::EncodeKey(key)), TEncoder::EncodeValue(value) };
+		}
+
+		/// Sets all encoded key value \a pairs in the tree and uses \a hasher (if specified) to hash independent changed subtrees.
+		/// \note This is equivalent to setting all pairs in order, but every changed node is only built once.
+		void setBatch(std::vector<EncodedPair>&& pairs, const TreeNodesHasher& hasher = TreeNodesHasher()) {
+			if (pairs.empty())
+				return;
+
+			// sort pairs so that all pairs sharing a prefix are adjacent and only keep the last value set for each key
+			std::stable_sort(pairs.begin(), pairs.end(), [](const auto& lhs, const auto& rhs) {
+				return IsPathLess(lhs.Path, rhs.Path);
+			});
+			auto itUniqueReverse = std::unique(pairs.rbegin(), pairs.rend(), [](const auto& lhs, const auto& rhs) {
+				return lhs.Path == rhs.Path;
+			});
+			pairs.erase(pairs.begin(), itUniqueReverse.base());
+
+			// subtrees can only be built from sorted pairs when all keys have the same size
+			auto pathSize = pairs.front().Path.size();
+			auto hasFixedSizePaths = std::all_of(pairs.cbegin(), pairs.cend(), [pathSize](const auto& pair) {
+				return pathSize == pair.Path.size();
+			});
+			if (!hasFixedSizePaths) {
+				for (const auto& pair : pairs)
+					m_rootNode = set(m_rootNode, { pair.Path, pair.Value });
+
+				return;
+			}
+
+			m_rootNode = setBatch(m_rootNode, pairs.cbegin(), pairs.cend(), 0, hasher);
+		}
+
+	private:
+		using EncodedPairsIterator = typename std::vector<EncodedPair>::const_iterator;
+
+	private:
+		// sets all pairs in [itBegin, itEnd), which share the first `offset` nibbles, in the subtree rooted at `node`
+		TreeNode setBatch(
+				const TreeNode& node,
+				EncodedPairsIterator itBegin,
+				EncodedPairsIterator itEnd,
+				size_t offset,
+				const TreeNodesHasher& hasher) {
+			if (1 == std::distance(itBegin, itEnd))
+				return set(node, { itBegin->Path.subpath(offset), itBegin->Value });
+
+			if (node.isLeaf())
+				return setBatchWithLeaf(node.asLeafNode(), itBegin, itEnd, offset, hasher);
+
+			// pairs are sorted, so the path shared by all pairs is the path shared by the first and last pairs
+			auto firstPath = itBegin->Path.subpath(offset);
+			auto sharedPathSize = FindFirstDifferenceIndex(firstPath, std::prev(itEnd)->Path.subpath(offset));
+			if (node.empty()) {
+				auto branchNode = BranchTreeNode(firstPath.subpath(0, sharedPathSize));
+				return TreeNode(updateBranchLinks(std::move(branchNode), itBegin, itEnd, offset + sharedPathSize, hasher));
+			}
+
+			// if the path of the existing branch node is not shared by all pairs, the branch needs to be split
+			const auto& branchPath = node.path();
+			auto differenceIndex = std::min(sharedPathSize, FindFirstDifferenceIndex(branchPath, firstPath));
+			auto branchNode = BranchTreeNode(node.asBranchNode());
+			if (differenceIndex != branchPath.size()) {
+				auto newBranchNode = BranchTreeNode(branchPath.subpath(0, differenceIndex));
+				branchNode.setPath(branchPath.subpath(differenceIndex + 1));
+				setLink(newBranchNode, branchNode, branchPath.nibbleAt(differenceIndex));
+				branchNode = std::move(newBranchNode);
+			}
+
+			return TreeNode(updateBranchLinks(std::move(branchNode), itBegin, itEnd, offset + differenceIndex, hasher));
+		}
+
+		TreeNode setBatchWithLeaf(
+				const LeafTreeNode& leafNode,
+				EncodedPairsIterator itBegin,
+				EncodedPairsIterator itEnd,
+				size_t offset,
+				const TreeNodesHasher& hasher) {
+			// rebase all pairs onto the leaf and merge the leaf into them unless it is being replaced
+			std::vector<EncodedPair> pairs;
+			pairs.reserve(static_cast<size_t>(std::distance(itBegin, itEnd)) + 1);
+			for (auto iter = itBegin; itEnd != iter; ++iter)
+				pairs.push_back({ iter->Path.subpath(offset), iter->Value });
+
+			auto leafIter = std::lower_bound(pairs.cbegin(), pairs.cend(), leafNode.path(), [](const auto& pair, const auto& path) {
+				return IsPathLess(pair.Path, path);
+			});
+			if (pairs.cend() == leafIter || leafNode.path() != leafIter->Path)
+				pairs.insert(leafIter, { leafNode.path(), leafNode.value() });
+
+			return setBatch(TreeNode(), pairs.cbegin(), pairs.cend(), 0, hasher);
+		}
+
+		BranchTreeNode updateBranchLinks(
+				BranchTreeNode&& branchNode,
+				EncodedPairsIterator itBegin,
+				EncodedPairsIterator itEnd,
+				size_t linkOffset,
+				const TreeNodesHasher& hasher) {
+			// pairs are grouped by the link nibble, so each linked subtree is only updated once
+			std::vector<TreeNode> linkedNodes;
+			std::vector<uint8_t> linkIndexes;
+			TreeNodesHasher emptyHasher;
+			for (auto itGroupBegin = itBegin; itEnd != itGroupBegin;) {
+				auto linkIndex = itGroupBegin->Path.nibbleAt(linkOffset);
+				auto itGroupEnd = std::find_if(itGroupBegin, itEnd, [linkIndex, linkOffset](const auto& pair) {
+					return linkIndex != pair.Path.nibbleAt(linkOffset);
+				});
+
+				// when all pairs are in a single subtree, defer hashing to the next level where there might be multiple subtrees
+				auto isSingleGroup = itBegin == itGroupBegin && itEnd == itGroupEnd;
+				const auto& groupHasher = isSingleGroup ? hasher : emptyHasher;
+				auto nextNode = branchNode.hasLink(linkIndex) ? getLinkedNode(branchNode, linkIndex) : TreeNode();
+				linkedNodes.push_back(setBatch(nextNode, itGroupBegin, itGroupEnd, linkOffset + 1, groupHasher));
+				linkIndexes.push_back(linkIndex);
+				itGroupBegin = itGroupEnd;
+			}
+
+			// changed subtrees are independent, so they can be hashed before they are linked
+			if (hasher && linkedNodes.size() > 1)
+				hasher(linkedNodes);
+
+			for (auto i = 0u; i < linkedNodes.size(); ++i)
+				setLink(branchNode, linkedNodes[i], linkIndexes[i]);
+
+			return std::move(branchNode);
+		}
+
+		static bool IsPathLess(const TreeNodePath& lhs, const TreeNodePath& rhs) {
+			auto differenceIndex = FindFirstDifferenceIndex(lhs, rhs);
+			return differenceIndex == lhs.size() || differenceIndex == rhs.size()
+					? lhs.size() < rhs.size()
+					: lhs.nibbleAt(differenceIndex) < rhs.nibbleAt(differenceIndex);
+		}
+
+		// endregion
+
 		// region unset
 
 	public:
@@ -252,6 +418,84 @@ namespace catapult { namespace tree {
 			return std::make_pair(Hash256(), false);
 		}
 
+	public:
+		/// Tries to find the values associated with \a keys in the tree and stores deduplicated proofs of existence or not in \a proof.
+		/// \note The tree is walked once, so nodes shared by multiple key paths are loaded and added to \a proof only once.
+		std::vector<std::pair<Hash256, bool>> lookup(const std::vector<KeyType>& keys, PatriciaTreeBatchProof& proof) const {
+			BatchLookupContext context(keys.size(), proof);
+
+			std::vector<BatchLookupKey> lookupKeys;
+			lookupKeys.reserve(keys.size());
+			for (auto i = 0u; i < keys.size(); ++i)
+				lookupKeys.push_back({ i, TreeNodePath(TEncoder::EncodeKey(keys[i])) });
+
+			lookupBatch(m_rootNode, lookupKeys, context);
+			return std::move(context.Results);
+		}
+
+	private:
+		struct BatchLookupKey {
+			size_t Index;
+			TreeNodePath Path;
+		};
+
+		struct BatchLookupContext {
+		public:
+			BatchLookupContext(size_t numKeys, PatriciaTreeBatchProof& proof)
+					: Results(numKeys, LookupNotFoundResult())
+					, Proof(proof) {
+				Proof.Nodes.clear();
+				Proof.NodeIndexPaths.clear();
+				Proof.NodeIndexPaths.resize(numKeys);
+			}
+
+		public:
+			std::vector<std::pair<Hash256, bool>> Results;
+			PatriciaTreeBatchProof& Proof;
+			std::unordered_map<Hash256, uint32_t, utils::ArrayHasher<Hash256>> NodeIndexes;
+		};
+
+		void lookupBatch(const TreeNode& node, const std::vector<BatchLookupKey>& lookupKeys, BatchLookupContext& context) const {
+			// if the node is empty, there is nothing to do
+			if (node.empty())
+				return;
+
+			// identical nodes can appear at different positions in the tree, so deduplicate them by hash
+			auto nodeIndexIter = context.NodeIndexes.find(node.hash());
+			if (context.NodeIndexes.cend() == nodeIndexIter) {
+				auto nodeIndex = static_cast<uint32_t>(context.Proof.Nodes.size());
+				nodeIndexIter = context.NodeIndexes.emplace(node.hash(), nodeIndex).first;
+				context.Proof.Nodes.push_back(node.copy());
+			}
+
+			for (const auto& lookupKey : lookupKeys)
+				context.Proof.NodeIndexPaths[lookupKey.Index].push_back(nodeIndexIter->second);
+
+			// if the node is a leaf, it must fully match a key path for that key to be in the tree
+			if (!node.isBranch()) {
+				for (const auto& lookupKey : lookupKeys) {
+					if (FindFirstDifferenceIndex(node.path(), lookupKey.Path) == lookupKey.Path.size())
+						context.Results[lookupKey.Index] = std::make_pair(node.asLeafNode().value(), true);
+				}
+
+				return;
+			}
+
+			// group keys by the branch connecting with them, so that each linked node is visited at most once
+			const auto& branchNode = node.asBranchNode();
+			std::array<std::vector<BatchLookupKey>, BranchTreeNode::Max_Links> linkedLookupKeys;
+			for (const auto& lookupKey : lookupKeys) {
+				auto differenceIndex = FindFirstDifferenceIndex(node.path(), lookupKey.Path);
+				auto nodeLinkIndex = lookupKey.Path.nibbleAt(differenceIndex);
+				linkedLookupKeys[nodeLinkIndex].push_back({ lookupKey.Index, lookupKey.Path.subpath(differenceIndex + 1) });
+			}
+
+			for (auto i = 0u; i < BranchTreeNode::Max_Links; ++i) {
+				if (!linkedLookupKeys[i].empty() && branchNode.hasLink(i))
+					lookupBatch(getLinkedNode(branchNode, i), linkedLookupKeys[i], context);
+			}
+		}
+
 		// endregion
 
 		// region tryLoad + setRoot + clear
@@ -327,18 +571,19 @@ namespace catapult { namespace tree {
 		}
 
 		void setLink(BranchTreeNode& branchNode, const TreeNode& node, size_t index) {
-			branchNode.setLink(node, index);
+			branchNode.setLink(node, index, m_pArena);
 		}
 
 		template<typename TNode>
 		void setLink(BranchTreeNode& branchNode, const TNode& node, size_t index) {
-			branchNode.setLink(TreeNode(node), index);
+			branchNode.setLink(TreeNode(node), index, m_pArena);
 		}
 
 		// endregion
 
 	private:
 		TDataSource& m_dataSource;
+		std::shared_ptr<TreeNodeArena> m_pArena;
 		TreeNode m_rootNode;
 	};
 }}
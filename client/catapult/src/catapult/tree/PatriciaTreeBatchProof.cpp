@@ -0,0 +1,95 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "PatriciaTreeBatchProof.h"
+#include "PatriciaTreeSerializer.h"
+#include "catapult/io/BufferInputStreamAdapter.h"
+#include "catapult/io/PodIoUtils.h"
+#include "catapult/io/StringOutputStream.h"
+#include "catapult/utils/Casting.h"
+
+namespace catapult { namespace tree {
+
+	std::string PatriciaTreeBatchProofSerializer::Serialize(const PatriciaTreeBatchProof& proof) {
+		std::vector<std::string> serializedNodes;
+		serializedNodes.reserve(proof.Nodes.size());
+
+		auto size = 2 * sizeof(uint32_t);
+		for (const auto& node : proof.Nodes) {
+			serializedNodes.push_back(PatriciaTreeSerializer::SerializeValue(node));
+			size += sizeof(uint16_t) + serializedNodes.back().size();
+		}
+
+		for (const auto& nodeIndexPath : proof.NodeIndexPaths)
+			size += sizeof(uint8_t) + nodeIndexPath.size() * sizeof(uint32_t);
+
+		io::StringOutputStream out(size);
+		io::Write32(out, utils::checked_cast<size_t, uint32_t>(serializedNodes.size()));
+		io::Write32(out, utils::checked_cast<size_t, uint32_t>(proof.NodeIndexPaths.size()));
+
+		for (const auto& serializedNode : serializedNodes) {
+			io::Write16(out, utils::checked_cast<size_t, uint16_t>(serializedNode.size()));
+			out.write({ reinterpret_cast<const uint8_t*>(serializedNode.data()), serializedNode.size() });
+		}
+
+		for (const auto& nodeIndexPath : proof.NodeIndexPaths) {
+			io::Write8(out, utils::checked_cast<size_t, uint8_t>(nodeIndexPath.size()));
+			for (auto nodeIndex : nodeIndexPath)
+				io::Write32(out, nodeIndex);
+		}
+
+		return out.str();
+	}
+
+	PatriciaTreeBatchProof PatriciaTreeBatchProofSerializer::Deserialize(const RawBuffer& buffer) {
+		io::BufferInputStreamAdapter<RawBuffer> input(buffer);
+		auto numNodes = io::Read32(input);
+		auto numPaths = io::Read32(input);
+
+		PatriciaTreeBatchProof proof;
+		for (auto i = 0u; i < numNodes; ++i) {
+			auto nodeSize = io::Read16(input);
+			std::vector<uint8_t> serializedNode(nodeSize);
+			input.read(serializedNode);
+
+			proof.Nodes.push_back(PatriciaTreeSerializer::DeserializeValue(serializedNode));
+		}
+
+		for (auto i = 0u; i < numPaths; ++i) {
+			auto numPathNodes = io::Read8(input);
+			std::vector<uint32_t> nodeIndexPath;
+			for (auto j = 0u; j < numPathNodes; ++j) {
+				auto nodeIndex = io::Read32(input);
+				if (nodeIndex >= numNodes)
+					CATAPULT_THROW_INVALID_ARGUMENT_1("node index is out of range", nodeIndex);
+
+				nodeIndexPath.push_back(nodeIndex);
+			}
+
+			proof.NodeIndexPaths.push_back(std::move(nodeIndexPath));
+		}
+
+		if (!input.eof())
+			CATAPULT_THROW_INVALID_ARGUMENT_1("serialized proof has trailing data", buffer.Size - input.position());
+
+		return proof;
+	}
+}}
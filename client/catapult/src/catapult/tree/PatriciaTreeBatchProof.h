@@ -0,0 +1,49 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "TreeNode.h"
+#include <vector>
+
+namespace catapult { namespace tree {
+
+	/// Deduplicated proof of existence or non-existence of multiple keys in a patricia tree.
+	struct PatriciaTreeBatchProof {
+		/// Unique nodes referenced by at least one key path.
+		std::vector<TreeNode> Nodes;
+
+		/// Path (as indexes into Nodes) from the root node for each key.
+		std::vector<std::vector<uint32_t>> NodeIndexPaths;
+	};
+
+	/// Serializer for patricia tree batch proofs.
+	/// \note Serialized proofs are composed of a node count (uint32), a path count (uint32),
+	///       size prefixed (uint16) serialized nodes and count prefixed (uint8) node index (uint32) paths.
+	struct PatriciaTreeBatchProofSerializer {
+	public:
+		/// Serializes \a proof to string.
+		static std::string Serialize(const PatriciaTreeBatchProof& proof);
+
+		/// Deserializes a proof from \a buffer.
+		/// \note Throws if \a buffer is malformed or contains out of range node indexes.
+		static PatriciaTreeBatchProof Deserialize(const RawBuffer& buffer);
+	};
+}}
@@ -20,6 +20,7 @@
 **/
 
 #include "TreeNode.h"
+#include "TreeNodeArena.h"
 #include "catapult/crypto/Hashes.h"
 #include "catapult/utils/IntegerMath.h"
 #include "catapult/exceptions.h"
@@ -157,8 +158,14 @@ namespace catapult { namespace tree {
 	}
 
 	void BranchTreeNode::setLink(const TreeNode& node, size_t index) {
+		setLink(node, index, nullptr);
+	}
+
+	void BranchTreeNode::setLink(const TreeNode& node, size_t index, const std::shared_ptr<TreeNodeArena>& pArena) {
 		// m_links does not need to be explicitly cleared because m_linkedNodes takes precedence
-		m_linkedNodes[index] = std::make_shared<const TreeNode>(node.copy());
+		m_linkedNodes[index] = pArena
+				? std::allocate_shared<const TreeNode>(TreeNodeArenaAllocator<TreeNode>(pArena), node.copy())
+				: std::make_shared<const TreeNode>(node.copy());
 		setLink(index);
 	}
 
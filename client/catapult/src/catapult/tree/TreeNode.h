@@ -25,7 +25,12 @@
 #include <bitset>
 #include <memory>
 
-namespace catapult { namespace tree { class TreeNode; } }
+namespace catapult {
+	namespace tree {
+		class TreeNode;
+		class TreeNodeArena;
+	}
+}
 
 namespace catapult { namespace tree {
 
@@ -112,6 +117,9 @@ namespace catapult { namespace tree {
 		/// Sets the branch link at \a index to \a node.
 		void setLink(const TreeNode& node, size_t index);
 
+		/// Sets the branch link at \a index to \a node that is allocated from \a pArena (if specified).
+		void setLink(const TreeNode& node, size_t index, const std::shared_ptr<TreeNodeArena>& pArena);
+
 		/// Clears the branch link at \a index.
 		void clearLink(size_t index);
 
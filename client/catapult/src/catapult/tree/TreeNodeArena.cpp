@@ -0,0 +1,88 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "TreeNodeArena.h"
+#include <algorithm>
+#include <new>
+
+namespace catapult { namespace tree {
+
+	TreeNodeArena::TreeNodeArena(size_t blockSize)
+			: m_arena(blockSize)
+			, m_slotSize(0)
+			, m_slotAlignment(0)
+			, m_numActiveSlots(0)
+			, m_numFreeSlots(0)
+			, m_pFreeSlots(nullptr)
+	{}
+
+	size_t TreeNodeArena::slotSize() const {
+		return m_slotSize;
+	}
+
+	size_t TreeNodeArena::numBlocks() const {
+		return m_arena.numBlocks();
+	}
+
+	size_t TreeNodeArena::numActiveSlots() const {
+		return m_numActiveSlots;
+	}
+
+	size_t TreeNodeArena::numFreeSlots() const {
+		return m_numFreeSlots;
+	}
+
+	void* TreeNodeArena::allocate(size_t size, size_t alignment) {
+		if (0 == m_slotSize) {
+			// slots must be able to hold free list entries when they are recycled
+			m_slotSize = std::max(size, sizeof(FreeSlot));
+			m_slotAlignment = std::max(alignment, alignof(FreeSlot));
+		}
+
+		if (!isSlotAllocation(size, alignment))
+			return ::operator new(size, std::align_val_t(alignment));
+
+		++m_numActiveSlots;
+		if (!m_pFreeSlots)
+			return m_arena.allocate(m_slotSize, m_slotAlignment);
+
+		auto* pSlot = m_pFreeSlots;
+		m_pFreeSlots = pSlot->pNext;
+		--m_numFreeSlots;
+		return pSlot;
+	}
+
+	void TreeNodeArena::deallocate(void* pData, size_t size, size_t alignment) noexcept {
+		if (!isSlotAllocation(size, alignment)) {
+			::operator delete(pData, std::align_val_t(alignment));
+			return;
+		}
+
+		// slot memory is only released when the arena is destroyed
+		m_pFreeSlots = new (pData) FreeSlot{ m_pFreeSlots };
+		++m_numFreeSlots;
+		--m_numActiveSlots;
+	}
+
+	bool TreeNodeArena::isSlotAllocation(size_t size, size_t alignment) const {
+		return std::max(size, sizeof(FreeSlot)) == m_slotSize && alignment <= m_slotAlignment;
+	}
+}}
@@ -0,0 +1,127 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/utils/MemoryArena.h"
+#include <memory>
+
+namespace catapult { namespace tree {
+
+	/// Arena that services and recycles fixed size allocations of in-memory tree nodes.
+	/// \note The slot size is determined by the first allocation; allocations of other sizes fall back to the global heap.
+	/// \note This class is not thread safe.
+	class TreeNodeArena : public utils::NonCopyable {
+	public:
+		/// Default size of each block.
+		static constexpr size_t Default_Block_Size = 64 * 1024;
+
+	public:
+		/// Creates an arena that allocates memory in blocks of \a blockSize bytes.
+		explicit TreeNodeArena(size_t blockSize = Default_Block_Size);
+
+	public:
+		/// Gets the size of each slot or \c 0 if nothing has been allocated.
+		size_t slotSize() const;
+
+		/// Gets the number of blocks owned by the arena.
+		size_t numBlocks() const;
+
+		/// Gets the number of slots that are currently in use.
+		size_t numActiveSlots() const;
+
+		/// Gets the number of slots that are available for reuse.
+		size_t numFreeSlots() const;
+
+	public:
+		/// Allocates \a size bytes aligned to \a alignment.
+		void* allocate(size_t size, size_t alignment);
+
+		/// Deallocates \a pData that was allocated with \a size and \a alignment.
+		void deallocate(void* pData, size_t size, size_t alignment) noexcept;
+
+	private:
+		bool isSlotAllocation(size_t size, size_t alignment) const;
+
+	private:
+		struct FreeSlot {
+			FreeSlot* pNext;
+		};
+
+	private:
+		utils::MemoryArena m_arena;
+		size_t m_slotSize;
+		size_t m_slotAlignment;
+		size_t m_numActiveSlots;
+		size_t m_numFreeSlots;
+		FreeSlot* m_pFreeSlots;
+	};
+
+	/// Standard library compatible allocator that allocates memory from a shared TreeNodeArena.
+	/// \note Each allocator holds a reference to the arena, so the arena outlives all nodes allocated from it.
+	template<typename T>
+	class TreeNodeArenaAllocator {
+	public:
+		using value_type = T;
+
+	public:
+		/// Creates an allocator around \a pArena.
+		explicit TreeNodeArenaAllocator(const std::shared_ptr<TreeNodeArena>& pArena) noexcept : m_pArena(pArena)
+		{}
+
+		/// Creates an allocator around the same arena as \a allocator.
+		template<typename U>
+		TreeNodeArenaAllocator(const TreeNodeArenaAllocator<U>& allocator) noexcept : m_pArena(allocator.arena())
+		{}
+
+	public:
+		/// Gets the associated arena.
+		const std::shared_ptr<TreeNodeArena>& arena() const noexcept {
+			return m_pArena;
+		}
+
+	public:
+		/// Allocates storage for \a count objects.
+		T* allocate(size_t count) {
+			return static_cast<T*>(m_pArena->allocate(count * sizeof(T), alignof(T)));
+		}
+
+		/// Deallocates storage pointed to by \a pData for \a count objects.
+		void deallocate(T* pData, size_t count) noexcept {
+			m_pArena->deallocate(pData, count * sizeof(T), alignof(T));
+		}
+
+	public:
+		/// Returns \c true if this allocator is equal to \a rhs.
+		template<typename U>
+		bool operator==(const TreeNodeArenaAllocator<U>& rhs) const noexcept {
+			return m_pArena == rhs.arena();
+		}
+
+		/// Returns \c true if this allocator is not equal to \a rhs.
+		template<typename U>
+		bool operator!=(const TreeNodeArenaAllocator<U>& rhs) const noexcept {
+			return !(*this == rhs);
+		}
+
+	private:
+		std::shared_ptr<TreeNodeArena> m_pArena;
+	};
+}}
@@ -21,37 +21,16 @@
 
 #include "TreeNodePath.h"
 #include "catapult/utils/HexFormatter.h"
-#include <cstring>
 #include <ostream>
 
 namespace catapult { namespace tree {
 
-	namespace {
-		constexpr size_t CalculateByteSize(size_t offset, size_t size) {
-			// (offset, size)
-			// (2, 4) [00'11'11'00] => 2 == 4/2
-			// (3, 4) [00'01'11'10] => 3 == 4/2 + 1
-			// (2, 5) [00'11'11'10] => 3 == 5/2 + 1
-			// (3, 5) [00'01'11'11] => 3 == 5/2 + 1
-			return size / 2 + ((0 == offset % 2 && 0 == size % 2) ? 0 : 1);
-		}
-	}
-
 	TreeNodePath::TreeNodePath()
-			: m_size(0)
-			, m_adjustment(0)
+			: m_path() // zero initialize
+			, m_offset(0)
+			, m_size(0)
 	{}
 
-	TreeNodePath::TreeNodePath(const std::vector<uint8_t>& path, size_t offset, size_t size)
-			: m_size(size)
-			, m_adjustment(offset % 2) // adjustment is needed to correctly handle paths beginning at odd nibbles
-			, m_path(CalculateByteSize(offset, size)) {
-		if (0 == m_size)
-			return;
-
-		std::memcpy(m_path.data(), &path[offset / 2], m_path.size());
-	}
-
 	bool TreeNodePath::empty() const {
 		return 0 == m_size;
 	}
@@ -61,7 +40,7 @@ namespace catapult { namespace tree {
 	}
 
 	uint8_t TreeNodePath::nibbleAt(size_t index) const {
-		index += m_adjustment;
+		index += m_offset;
 		auto byte = m_path[index / 2];
 
 		// return high nibble before low nibble
@@ -81,19 +60,25 @@ namespace catapult { namespace tree {
 	}
 
 	TreeNodePath TreeNodePath::subpath(size_t offset, size_t size) const {
-		return TreeNodePath(m_path, offset + m_adjustment, size);
+		// subpaths share the (inline) nibbles of this path and only adjust the visible window
+		auto path = *this;
+		path.m_offset = static_cast<uint8_t>(m_offset + offset);
+		path.m_size = static_cast<uint8_t>(size);
+		return path;
 	}
 
 	namespace {
 		class JoinBuilder {
 		public:
-			explicit JoinBuilder(size_t size)
-					: m_index(0)
-					, m_path(size, 0)
-			{}
+			explicit JoinBuilder(size_t size) : m_index(0) {
+				if (size > 2 * TreeNodePath::Max_Key_Size)
+					CATAPULT_THROW_INVALID_ARGUMENT_1("joined path is too large", size);
+
+				m_path.fill(0);
+			}
 
 		public:
-			const std::vector<uint8_t>& path() {
+			const std::array<uint8_t, TreeNodePath::Max_Key_Size>& path() {
 				return m_path;
 			}
 
@@ -110,25 +95,25 @@ namespace catapult { namespace tree {
 
 		private:
 			size_t m_index;
-			std::vector<uint8_t> m_path;
+			std::array<uint8_t, TreeNodePath::Max_Key_Size> m_path;
 		};
 	}
 
 	TreeNodePath TreeNodePath::Join(const TreeNodePath& lhs, const TreeNodePath& rhs) {
 		auto joinedPathSize = lhs.size() + rhs.size();
-		JoinBuilder builder((joinedPathSize + 1) / 2);
+		JoinBuilder builder(joinedPathSize);
 		builder.addNibbles(lhs);
 		builder.addNibbles(rhs);
-		return TreeNodePath(builder.path(), 0, joinedPathSize);
+		return TreeNodePath(builder.path()).subpath(0, joinedPathSize);
 	}
 
 	TreeNodePath TreeNodePath::Join(const TreeNodePath& lhs, uint8_t nibble, const TreeNodePath& rhs) {
 		auto joinedPathSize = lhs.size() + 1 + rhs.size();
-		JoinBuilder builder((joinedPathSize + 1) / 2);
+		JoinBuilder builder(joinedPathSize);
 		builder.addNibbles(lhs);
 		builder.addNibble(nibble);
 		builder.addNibbles(rhs);
-		return TreeNodePath(builder.path(), 0, joinedPathSize);
+		return TreeNodePath(builder.path()).subpath(0, joinedPathSize);
 	}
 
 	std::ostream& operator<<(std::ostream& out, const TreeNodePath& path) {
@@ -21,39 +21,46 @@
 
 #pragma once
 #include "catapult/utils/traits/Traits.h"
+#include "catapult/exceptions.h"
 #include <algorithm>
+#include <array>
 #include <iosfwd>
-#include <vector>
 #include <stdint.h>
 
 namespace catapult { namespace tree {
 
 	/// Represents a path in a tree.
+	/// \note Path nibbles are stored inline, so creating, copying and taking subpaths never allocate memory.
 	class TreeNodePath {
+	public:
+		/// Maximum size of a key in bytes.
+		static constexpr size_t Max_Key_Size = 32;
+
 	public:
 		/// Creates a default path.
 		TreeNodePath();
 
 		/// Creates a path from \a key.
 		template<typename TKey>
-		explicit TreeNodePath(TKey key) : m_adjustment(0) {
+		explicit TreeNodePath(TKey key)
+				: m_path() // zero initialize
+				, m_offset(0) {
 			if constexpr (utils::traits::is_scalar_v<TKey>) {
-				m_size = 2 * sizeof(TKey);
-				m_path.resize(sizeof(TKey));
+				static_assert(sizeof(TKey) <= Max_Key_Size, "scalar key is too large");
+				m_size = static_cast<uint8_t>(2 * sizeof(TKey));
 
 				// copy in big endian byte order
 				const auto* pKeyData = reinterpret_cast<const uint8_t*>(&key);
 				std::reverse_copy(pKeyData, pKeyData + sizeof(TKey), m_path.begin());
 			} else {
-				m_size = 2 * key.size();
-				m_path.resize(key.size());
+				if (key.size() > Max_Key_Size)
+					CATAPULT_THROW_INVALID_ARGUMENT_1("key is too large to be used as path", key.size());
+
+				m_size = static_cast<uint8_t>(2 * key.size());
 				std::copy(key.cbegin(), key.cend(), m_path.begin());
 			}
 		}
 
-	private:
-		TreeNodePath(const std::vector<uint8_t>& path, size_t offset, size_t size);
-
 	public:
 		/// Returns \c true if this path is empty.
 		bool empty() const;
@@ -87,9 +94,9 @@ namespace catapult { namespace tree {
 		static TreeNodePath Join(const TreeNodePath& lhs, uint8_t nibble, const TreeNodePath& rhs);
 
 	private:
-		size_t m_size;
-		size_t m_adjustment; // used to track odd / even starting nibble
-		std::vector<uint8_t> m_path;
+		std::array<uint8_t, Max_Key_Size> m_path;
+		uint8_t m_offset; // first nibble of this path within m_path
+		uint8_t m_size;
 	};
 
 	/// Insertion operator for outputting \a path to \a out.
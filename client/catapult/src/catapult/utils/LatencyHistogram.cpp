@@ -0,0 +1,105 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "LatencyHistogram.h"
+#include "IntegerMath.h"
+#include "catapult/exceptions.h"
+#include <algorithm>
+
+namespace catapult { namespace utils {
+
+	namespace {
+		size_t GetBucketIndex(uint64_t value) {
+			if (value < LatencyHistogram::Num_Sub_Buckets)
+				return static_cast<size_t>(value);
+
+			// bucket is identified by the position of the highest set bit and the next Sub_Bucket_Bits bits
+			auto shift = Log2(value) - LatencyHistogram::Num_Sub_Bucket_Bits;
+			auto subBucket = (value >> shift) - LatencyHistogram::Num_Sub_Buckets;
+			return static_cast<size_t>(LatencyHistogram::Num_Sub_Buckets * (shift + 1) + subBucket);
+		}
+
+		uint64_t GetBucketUpperBound(size_t index) {
+			if (index < LatencyHistogram::Num_Sub_Buckets)
+				return index;
+
+			auto shift = index / LatencyHistogram::Num_Sub_Buckets - 1;
+			auto subBucket = index % LatencyHistogram::Num_Sub_Buckets;
+			auto lowerBound = (LatencyHistogram::Num_Sub_Buckets + subBucket) << shift;
+			return lowerBound + ((1ull << shift) - 1);
+		}
+	}
+
+	LatencyHistogram::LatencyHistogram()
+			: m_count(0)
+			, m_sum(0)
+			, m_max(0) {
+		for (auto& bucket : m_buckets)
+			bucket = 0;
+	}
+
+	uint64_t LatencyHistogram::count() const {
+		return m_count.load(std::memory_order_relaxed);
+	}
+
+	uint64_t LatencyHistogram::sum() const {
+		return m_sum.load(std::memory_order_relaxed);
+	}
+
+	uint64_t LatencyHistogram::max() const {
+		return m_max.load(std::memory_order_relaxed);
+	}
+
+	uint64_t LatencyHistogram::percentile(uint32_t percentile) const {
+		if (percentile > 100)
+			CATAPULT_THROW_INVALID_ARGUMENT_1("percentile must be no greater than 100", percentile);
+
+		auto numValues = count();
+		if (0 == numValues)
+			return 0;
+
+		// find the bucket containing the value with the (one-based) rank ceil(numValues * percentile / 100)
+		auto rank = std::max<uint64_t>(1, (numValues * percentile + 99) / 100);
+		auto maxValue = max();
+		uint64_t numVisitedValues = 0;
+		for (auto i = 0u; i < Num_Buckets; ++i) {
+			numVisitedValues += m_buckets[i].load(std::memory_order_relaxed);
+			if (numVisitedValues >= rank)
+				return std::min(GetBucketUpperBound(i), maxValue);
+		}
+
+		// buckets can lag behind count when values are recorded concurrently
+		return maxValue;
+	}
+
+	void LatencyHistogram::record(uint64_t value) {
+		m_buckets[GetBucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+		m_sum.fetch_add(value, std::memory_order_relaxed);
+
+		auto currentMax = m_max.load(std::memory_order_relaxed);
+		while (currentMax < value) {
+			if (m_max.compare_exchange_weak(currentMax, value, std::memory_order_relaxed))
+				break;
+		}
+
+		m_count.fetch_add(1, std::memory_order_relaxed);
+	}
+}}
@@ -0,0 +1,72 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include <array>
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace catapult { namespace utils {
+
+	/// Lock-free histogram of unsigned values (e.g. latencies) with logarithmic buckets.
+	/// \note Values less than Num_Sub_Buckets are recorded exactly, larger values are recorded with a relative error
+	///       of at most 1 / Num_Sub_Buckets.
+	class LatencyHistogram {
+	public:
+		/// Number of bits used to select a linear bucket within a power of two.
+		static constexpr uint64_t Num_Sub_Bucket_Bits = 4;
+
+		/// Number of linear buckets per power of two.
+		static constexpr uint64_t Num_Sub_Buckets = 1u << Num_Sub_Bucket_Bits;
+
+		/// Total number of buckets (exact buckets for small values followed by linear buckets for each remaining power of two).
+		static constexpr size_t Num_Buckets = Num_Sub_Buckets * (64 - Num_Sub_Bucket_Bits + 1);
+
+	public:
+		/// Creates an empty histogram.
+		LatencyHistogram();
+
+	public:
+		/// Gets the number of recorded values.
+		uint64_t count() const;
+
+		/// Gets the sum of all recorded values.
+		uint64_t sum() const;
+
+		/// Gets the maximum recorded value.
+		uint64_t max() const;
+
+		/// Gets the (approximate) value below or at which \a percentile percent of all recorded values fall.
+		/// \note Returned value is the upper bound of the matching bucket but never larger than max.
+		uint64_t percentile(uint32_t percentile) const;
+
+	public:
+		/// Records \a value.
+		void record(uint64_t value);
+
+	private:
+		std::array<std::atomic<uint64_t>, Num_Buckets> m_buckets;
+		std::atomic<uint64_t> m_count;
+		std::atomic<uint64_t> m_sum;
+		std::atomic<uint64_t> m_max;
+	};
+}}
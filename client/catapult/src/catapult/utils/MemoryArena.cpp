@@ -0,0 +1,79 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "MemoryArena.h"
+#include <algorithm>
+
+namespace catapult { namespace utils {
+
+	MemoryArena::MemoryArena(size_t blockSize)
+			: m_blockSize(std::max<size_t>(1, blockSize))
+			, m_pNext(nullptr)
+			, m_numRemainingBytes(0)
+			, m_size(0)
+	{}
+
+	size_t MemoryArena::numBlocks() const {
+		return m_blocks.size();
+	}
+
+	size_t MemoryArena::size() const {
+		return m_size;
+	}
+
+	void* MemoryArena::allocate(size_t size, size_t alignment) {
+		void* pData = m_pNext;
+		if (!m_pNext || !std::align(alignment, size, pData, m_numRemainingBytes)) {
+			// large allocations get a dedicated block so that the remainder of the current block is not wasted
+			auto paddedSize = size + alignment;
+			if (paddedSize > m_blockSize / 2) {
+				pData = allocateBlock(paddedSize);
+				auto space = paddedSize;
+				std::align(alignment, size, pData, space);
+				m_size += size;
+				return pData;
+			}
+
+			m_pNext = allocateBlock(m_blockSize);
+			m_numRemainingBytes = m_blockSize;
+			pData = m_pNext;
+			std::align(alignment, size, pData, m_numRemainingBytes);
+		}
+
+		m_pNext = static_cast<uint8_t*>(pData) + size;
+		m_numRemainingBytes -= size;
+		m_size += size;
+		return pData;
+	}
+
+	void MemoryArena::reset() {
+		m_blocks.clear();
+		m_pNext = nullptr;
+		m_numRemainingBytes = 0;
+		m_size = 0;
+	}
+
+	uint8_t* MemoryArena::allocateBlock(size_t blockSize) {
+		// note: block memory is intentionally left uninitialized
+		m_blocks.push_back(std::unique_ptr<uint8_t[]>(new uint8_t[blockSize]));
+		return m_blocks.back().get();
+	}
+}}
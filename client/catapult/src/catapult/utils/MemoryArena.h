@@ -0,0 +1,131 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "NonCopyable.h"
+#include <memory>
+#include <new>
+#include <vector>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace catapult { namespace utils {
+
+	/// Memory arena that services many small allocations from large blocks and releases all of them at once.
+	/// \note This class is not thread safe.
+	class MemoryArena : public NonCopyable {
+	public:
+		/// Default size of each block.
+		static constexpr size_t Default_Block_Size = 16 * 1024;
+
+	public:
+		/// Creates an arena that allocates memory in blocks of \a blockSize bytes.
+		explicit MemoryArena(size_t blockSize = Default_Block_Size);
+
+	public:
+		/// Gets the number of blocks owned by the arena.
+		size_t numBlocks() const;
+
+		/// Gets the total number of bytes allocated from the arena (excluding alignment padding).
+		size_t size() const;
+
+	public:
+		/// Allocates \a size bytes aligned to \a alignment.
+		/// \note Memory is only released when the arena is reset or destroyed.
+		void* allocate(size_t size, size_t alignment);
+
+		/// Releases all memory allocated from the arena.
+		void reset();
+
+	private:
+		uint8_t* allocateBlock(size_t blockSize);
+
+	private:
+		size_t m_blockSize;
+		std::vector<std::unique_ptr<uint8_t[]>> m_blocks;
+		uint8_t* m_pNext;
+		size_t m_numRemainingBytes;
+		size_t m_size;
+	};
+
+	/// Standard library compatible allocator that allocates memory from a MemoryArena.
+	/// \note A default constructed allocator is not associated with any arena and falls back to the global heap.
+	template<typename T>
+	class ArenaAllocator {
+	public:
+		using value_type = T;
+
+	public:
+		/// Creates an allocator that is not associated with any arena.
+		constexpr ArenaAllocator() noexcept : m_pArena(nullptr)
+		{}
+
+		/// Creates an allocator around \a arena.
+		explicit ArenaAllocator(MemoryArena& arena) noexcept : m_pArena(&arena)
+		{}
+
+		/// Creates an allocator around the same arena as \a allocator.
+		template<typename U>
+		ArenaAllocator(const ArenaAllocator<U>& allocator) noexcept : m_pArena(allocator.arena())
+		{}
+
+	public:
+		/// Gets the associated arena or \c nullptr when none is associated.
+		MemoryArena* arena() const noexcept {
+			return m_pArena;
+		}
+
+	public:
+		/// Allocates storage for \a count objects.
+		T* allocate(size_t count) {
+			if (!m_pArena)
+				return std::allocator<T>().allocate(count);
+
+			if (count > SIZE_MAX / sizeof(T))
+				throw std::bad_array_new_length();
+
+			return static_cast<T*>(m_pArena->allocate(count * sizeof(T), alignof(T)));
+		}
+
+		/// Deallocates storage pointed to by \a pData for \a count objects.
+		/// \note Arena memory is released when the arena is reset or destroyed.
+		void deallocate(T* pData, size_t count) noexcept {
+			if (!m_pArena)
+				std::allocator<T>().deallocate(pData, count);
+		}
+
+	public:
+		/// Returns \c true if this allocator is equal to \a rhs.
+		template<typename U>
+		bool operator==(const ArenaAllocator<U>& rhs) const noexcept {
+			return m_pArena == rhs.arena();
+		}
+
+		/// Returns \c true if this allocator is not equal to \a rhs.
+		template<typename U>
+		bool operator!=(const ArenaAllocator<U>& rhs) const noexcept {
+			return !(*this == rhs);
+		}
+
+	private:
+		MemoryArena* m_pArena;
+	};
+}}
@@ -0,0 +1,301 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "SpinReaderWriterLock.h"
+#include <algorithm>
+#include <array>
+
+namespace catapult { namespace utils {
+
+	/// Custom reader writer lock that allows multiple readers and a single writer and prefers writers.
+	/// Active readers are counted in per-thread stripes so that readers on different cores do not contend on a single cache line.
+	/// \note
+	/// - readers are not bounded by a maximum count
+	/// - writers need to inspect all stripes, so writer acquisition is more expensive than reader acquisition
+	/// - ReaderLockGuard and WriterLockGuard have the same semantics as the corresponding BasicSpinReaderWriterLock guards
+	template<typename TReaderNotificationPolicy>
+	class BasicStripedReaderWriterLock : private TReaderNotificationPolicy {
+	private:
+		static constexpr size_t Num_Stripes = 32;
+
+		// 0[active writer]|1[draining writer]|234567...[total writers]
+		static constexpr uint32_t Active_Writer_Flag = 0x8000'0000;
+		static constexpr uint32_t Draining_Writer_Flag = 0x4000'0000;
+		static constexpr uint32_t Pending_Writer_Mask = 0x3FFF'FFFF;
+		static constexpr uint32_t Exclusive_Writer_Mask = Active_Writer_Flag | Draining_Writer_Flag;
+		static constexpr uint32_t Pending_Writer_Increment = 0x0000'0001;
+
+		// pad each counter to its own cache line so that readers in different stripes do not contend with each other
+		struct alignas(64) PaddedCounter {
+			std::atomic<uint32_t> Value;
+		};
+
+	private:
+		// region WaitStepper
+
+		/// Spins briefly before yielding and finally sleeps for short intervals.
+		/// \note Sleeps are capped at one millisecond so that a released lock is observed quickly.
+		class WaitStepper {
+		private:
+			static constexpr uint32_t Num_Spins = 64;
+			static constexpr uint32_t Num_Yields = 100;
+
+		public:
+			WaitStepper() : m_numAttempts(0)
+			{}
+
+		public:
+			void wait() {
+				if (Num_Spins + Num_Yields <= m_numAttempts) {
+					std::this_thread::sleep_for(std::chrono::milliseconds(1));
+					return;
+				}
+
+				if (Num_Spins <= m_numAttempts)
+					std::this_thread::yield();
+
+				++m_numAttempts;
+			}
+
+		private:
+			uint32_t m_numAttempts;
+		};
+
+		// endregion
+
+	private:
+		// region LockGuard
+
+		/// Base class for RAII lock guards.
+		class LockGuard {
+		protected:
+			explicit LockGuard(const action& resetFunc)
+					: m_resetFunc(resetFunc)
+					, m_isMoved(false)
+			{}
+
+			~LockGuard() {
+				if (m_isMoved)
+					return;
+
+				m_resetFunc();
+			}
+
+		public:
+			LockGuard(LockGuard&& rhs) : m_resetFunc(rhs.m_resetFunc), m_isMoved(false) {
+				rhs.m_isMoved = true;
+			}
+
+		private:
+			action m_resetFunc;
+			bool m_isMoved;
+		};
+
+		// endregion
+
+	public:
+		// region WriterLockGuard
+
+		/// RAII writer lock guard.
+		class WriterLockGuard : public LockGuard {
+		public:
+			/// Creates a guard around \a writerState.
+			explicit WriterLockGuard(std::atomic<uint32_t>& writerState)
+					: LockGuard([&writerState]() {
+						// unset the active writer flag
+						writerState.fetch_sub(Exclusive_Writer_Mask + Pending_Writer_Increment);
+					})
+			{}
+
+			/// Creates a guard around \a writerState, \a numReaders and \a isActive.
+			/// \note This constructor is used when writer is created by promotion.
+			WriterLockGuard(std::atomic<uint32_t>& writerState, std::atomic<uint32_t>& numReaders, bool& isActive)
+					: LockGuard([&writerState, &numReaders, &isActive]() {
+						// change the writer back to a reader before unsetting the active writer flag
+						numReaders.fetch_add(1);
+						writerState.fetch_sub(Exclusive_Writer_Mask + Pending_Writer_Increment);
+						isActive = false;
+					})
+			{}
+
+			/// Default move constructor.
+			WriterLockGuard(WriterLockGuard&&) = default;
+		};
+
+		// endregion
+
+		// region ReaderLockGuard
+
+		/// RAII reader lock guard.
+		class ReaderLockGuard : public LockGuard {
+		public:
+			/// Creates a guard around \a lock, \a numReaders and \a notificationPolicy.
+			/// \note \a numReaders is the stripe counter that was incremented when the reader was acquired,
+			///       which allows the guard to be released by a different thread.
+			ReaderLockGuard(
+					BasicStripedReaderWriterLock& lock,
+					std::atomic<uint32_t>& numReaders,
+					TReaderNotificationPolicy& notificationPolicy)
+					: LockGuard([&numReaders, &notificationPolicy]() {
+						// decrease the number of readers by one
+						numReaders.fetch_sub(1);
+						notificationPolicy.readerReleased();
+					})
+					, m_lock(lock)
+					, m_numReaders(numReaders)
+					, m_isWriterActive(false) {
+				notificationPolicy.readerAcquired();
+			}
+
+			/// Default move constructor.
+			ReaderLockGuard(ReaderLockGuard&&) = default;
+
+		public:
+			/// Promotes this reader lock to a writer lock.
+			/// \note Deadlock is possible when promoteToWriter is called concurrently by multiple threads for the same lock.
+			///       Each of the concurrent threads holds a reader lock, so a writer lock cannot be acquired by any thread.
+			WriterLockGuard promoteToWriter() {
+				markActiveWriter();
+
+				// mark a pending write before releasing the reader so that no other readers can sneak in
+				m_lock.m_writerState.Value.fetch_add(Pending_Writer_Increment);
+				m_numReaders.fetch_sub(1);
+
+				// wait for exclusive access
+				m_lock.acquireExclusiveAccess();
+				return WriterLockGuard(m_lock.m_writerState.Value, m_numReaders, m_isWriterActive);
+			}
+
+		private:
+			void markActiveWriter() {
+				if (m_isWriterActive)
+					CATAPULT_THROW_RUNTIME_ERROR("reader lock has already been promoted");
+
+				m_isWriterActive = true;
+			}
+
+		private:
+			BasicStripedReaderWriterLock& m_lock;
+			std::atomic<uint32_t>& m_numReaders;
+			bool m_isWriterActive;
+		};
+
+		// endregion
+
+	public:
+		/// Creates an unlocked lock.
+		BasicStripedReaderWriterLock() {
+			m_writerState.Value = 0;
+			for (auto& stripe : m_stripes)
+				stripe.Value = 0;
+		}
+
+	public:
+		/// Returns \c true if there is a pending (or active) writer.
+		inline bool isWriterPending() const {
+			return 0 != (m_writerState.Value & Pending_Writer_Mask);
+		}
+
+		/// Returns \c true if there is an active writer.
+		inline bool isWriterActive() const {
+			return 0 != (m_writerState.Value & Active_Writer_Flag);
+		}
+
+		/// Returns \c true if there is an active reader.
+		inline bool isReaderActive() const {
+			return std::any_of(m_stripes.cbegin(), m_stripes.cend(), [](const auto& stripe) {
+				return 0 != stripe.Value;
+			});
+		}
+
+	public:
+		/// Blocks until a reader lock can be acquired.
+		inline ReaderLockGuard acquireReader() {
+			WaitStepper stepper;
+
+			auto& numReaders = m_stripes[GetCurrentThreadStripeIndex()].Value;
+			for (;;) {
+				// wait for any pending writes to complete
+				if (isWriterPending()) {
+					stepper.wait();
+					continue;
+				}
+
+				// optimistically register the reader and back off if a writer became pending in the meantime
+				// (sequentially consistent ordering guarantees that the reader or the writer observes the other)
+				numReaders.fetch_add(1);
+				if (!isWriterPending())
+					break;
+
+				numReaders.fetch_sub(1);
+				stepper.wait();
+			}
+
+			return ReaderLockGuard(*this, numReaders, *this);
+		}
+
+		/// Blocks until a writer lock can be acquired.
+		inline WriterLockGuard acquireWriter() {
+			// mark a pending write
+			m_writerState.Value.fetch_add(Pending_Writer_Increment);
+
+			// wait for exclusive access
+			acquireExclusiveAccess();
+			return WriterLockGuard(m_writerState.Value);
+		}
+
+	private:
+		void acquireExclusiveAccess() {
+			WaitStepper stepper;
+
+			// wait for there to be no other active or draining writer
+			auto& writerState = m_writerState.Value;
+			uint32_t expected = writerState & Pending_Writer_Mask;
+			while (!writerState.compare_exchange_strong(expected, expected | Draining_Writer_Flag)) {
+				stepper.wait();
+				expected = writerState & Pending_Writer_Mask;
+			}
+
+			// wait for all active readers to be released (new readers are blocked by the pending writer)
+			for (const auto& stripe : m_stripes) {
+				while (0 != stripe.Value)
+					stepper.wait();
+			}
+
+			writerState.fetch_or(Active_Writer_Flag);
+		}
+
+		static size_t GetCurrentThreadStripeIndex() {
+			// assign stripes to threads round robin so that concurrently running threads are spread across all stripes
+			static std::atomic<size_t> nextStripeIndex(0);
+			thread_local size_t t_stripeIndex = nextStripeIndex++ % Num_Stripes;
+			return t_stripeIndex;
+		}
+
+	private:
+		PaddedCounter m_writerState;
+		std::array<PaddedCounter, Num_Stripes> m_stripes;
+	};
+
+	/// Default striped reader writer lock.
+	using StripedReaderWriterLock = BasicStripedReaderWriterLock<DefaultReaderNotificationPolicy>;
+}}
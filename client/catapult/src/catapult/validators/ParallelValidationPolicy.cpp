@@ -24,6 +24,7 @@
 #include "catapult/thread/FutureUtils.h"
 #include "catapult/thread/IoThreadPool.h"
 #include "catapult/thread/ParallelFor.h"
+#include "catapult/thread/WorkStealingParallelFor.h"
 #include "catapult/utils/Logging.h"
 #include <boost/asio/io_context.hpp>
 #include <algorithm>
@@ -124,10 +125,16 @@ namespace catapult { namespace validators {
 
 		class DefaultParallelValidationPolicy final : public ParallelValidationPolicy {
 		public:
-			DefaultParallelValidationPolicy(thread::IoThreadPool& pool, const std::shared_ptr<const StatelessEntityValidator>& pValidator)
+			DefaultParallelValidationPolicy(
+					thread::IoThreadPool& pool,
+					const std::shared_ptr<const StatelessEntityValidator>& pValidator,
+					thread::ParallelForStrategy strategy)
 					: m_pool(pool)
-					, m_pValidator(pValidator) {
-				CATAPULT_LOG(trace) << "DefaultParallelValidationPolicy created with " << m_pool.numWorkerThreads() << " worker threads";
+					, m_pValidator(pValidator)
+					, m_strategy(strategy) {
+				CATAPULT_LOG(trace)
+						<< "DefaultParallelValidationPolicy created with " << m_pool.numWorkerThreads() << " worker threads"
+						<< (thread::ParallelForStrategy::Work_Stealing == m_strategy ? " (work stealing)" : "");
 			}
 
 		private:
@@ -143,9 +150,15 @@ namespace catapult { namespace validators {
 					return pWork->future();
 				};
 
-				return thread::compose(
-						thread::ParallelFor(m_pool.ioContext(), pWork->entityInfos(), m_pool.numWorkerThreads(), workProcessItemCallback),
-						workCompleteCallback);
+				return thread::compose(parallelFor(pWork->entityInfos(), workProcessItemCallback), workCompleteCallback);
+			}
+
+			template<typename TWorkCallback>
+			thread::future<bool> parallelFor(const model::WeakEntityInfos& entityInfos, TWorkCallback callback) const {
+				if (thread::ParallelForStrategy::Work_Stealing == m_strategy)
+					return thread::WorkStealingParallelFor(m_pool.ioContext(), entityInfos, m_pool.numWorkerThreads(), callback);
+
+				return thread::ParallelFor(m_pool.ioContext(), entityInfos, m_pool.numWorkerThreads(), callback);
 			}
 
 		public:
@@ -160,12 +173,14 @@ namespace catapult { namespace validators {
 		private:
 			thread::IoThreadPool& m_pool;
 			std::shared_ptr<const StatelessEntityValidator> m_pValidator;
+			thread::ParallelForStrategy m_strategy;
 		};
 	}
 
 	std::shared_ptr<const ParallelValidationPolicy> CreateParallelValidationPolicy(
 			thread::IoThreadPool& pool,
-			const std::shared_ptr<const StatelessEntityValidator>& pValidator) {
-		return std::make_shared<const DefaultParallelValidationPolicy>(pool, pValidator);
+			const std::shared_ptr<const StatelessEntityValidator>& pValidator,
+			thread::ParallelForStrategy strategy) {
+		return std::make_shared<const DefaultParallelValidationPolicy>(pool, pValidator, strategy);
 	}
 }}
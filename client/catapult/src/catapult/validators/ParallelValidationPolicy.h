@@ -23,7 +23,12 @@
 #include "ValidatorTypes.h"
 #include "catapult/thread/Future.h"
 
-namespace catapult { namespace thread { class IoThreadPool; } }
+namespace catapult {
+	namespace thread {
+		class IoThreadPool;
+		enum class ParallelForStrategy;
+	}
+}
 
 namespace catapult { namespace validators {
 
@@ -41,7 +46,9 @@ namespace catapult { namespace validators {
 	};
 
 	/// Creates a parallel validation policy using \a pool for parallelization and \a pValidator for validation.
+	/// Entities are distributed across \a pool threads according to \a strategy.
 	std::shared_ptr<const ParallelValidationPolicy> CreateParallelValidationPolicy(
 			thread::IoThreadPool& pool,
-			const std::shared_ptr<const StatelessEntityValidator>& pValidator);
+			const std::shared_ptr<const StatelessEntityValidator>& pValidator,
+			thread::ParallelForStrategy strategy);
 }}
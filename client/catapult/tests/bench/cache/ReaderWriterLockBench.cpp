@@ -0,0 +1,144 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/utils/SpinReaderWriterLock.h"
+#include "catapult/utils/StripedReaderWriterLock.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <unordered_map>
+
+namespace catapult { namespace cache {
+
+	namespace {
+		constexpr auto Num_Entries = 10'000u;
+		constexpr auto Num_Entries_Per_Commit = 100u;
+		constexpr auto Commit_Interval = std::chrono::milliseconds(1);
+
+		// emulates a hot cache that is read by many api threads while a single writer periodically commits blocks
+		template<typename TLock>
+		class ContendedCache {
+		public:
+			ContendedCache() : m_isRunning(true) {
+				for (auto i = 0u; i < Num_Entries; ++i)
+					m_entries.emplace(i, i);
+
+				m_writerThread = std::thread([this]() {
+					commitBlocks();
+				});
+			}
+
+		public:
+			uint64_t lookup(uint64_t key) const {
+				auto readLock = m_lock.acquireReader();
+				auto iter = m_entries.find(key % Num_Entries);
+				return m_entries.cend() == iter ? 0 : iter->second;
+			}
+
+			std::vector<uint64_t> stop() {
+				m_isRunning = false;
+				m_writerThread.join();
+				return std::move(m_commitLatencies);
+			}
+
+		private:
+			void commitBlocks() {
+				while (m_isRunning) {
+					auto start = std::chrono::steady_clock::now();
+					{
+						auto writeLock = m_lock.acquireWriter();
+						auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+						m_commitLatencies.push_back(static_cast<uint64_t>(elapsed.count()));
+
+						for (auto i = 0u; i < Num_Entries_Per_Commit; ++i)
+							++m_entries[bench::Random() % Num_Entries];
+					}
+
+					std::this_thread::sleep_for(Commit_Interval);
+				}
+			}
+
+		private:
+			std::unordered_map<uint64_t, uint64_t> m_entries;
+			mutable TLock m_lock;
+			std::atomic_bool m_isRunning;
+			std::vector<uint64_t> m_commitLatencies;
+			std::thread m_writerThread;
+		};
+
+		void SetLatencyCounters(benchmark::State& state, std::vector<uint64_t>& latencies) {
+			state.counters["commits"] = static_cast<double>(latencies.size());
+			if (latencies.empty())
+				return;
+
+			std::sort(latencies.begin(), latencies.end());
+			auto percentile = [&latencies](auto value) {
+				return static_cast<double>(latencies[(latencies.size() - 1) * value / 100]);
+			};
+
+			state.counters["commit_p50_us"] = percentile(50);
+			state.counters["commit_p99_us"] = percentile(99);
+			state.counters["commit_max_us"] = static_cast<double>(latencies.back());
+		}
+
+		template<typename TLock>
+		void BenchmarkContendedReaders(benchmark::State& state) {
+			// cache is shared by all reader threads and is only created and destroyed by the first thread
+			static std::unique_ptr<ContendedCache<TLock>> pCache;
+			if (0 == state.thread_index())
+				pCache = std::make_unique<ContendedCache<TLock>>();
+
+			for (auto _ : state)
+				benchmark::DoNotOptimize(pCache->lookup(bench::Random()));
+
+			state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+
+			if (0 == state.thread_index()) {
+				// only the first thread reports writer counters, so they are not inflated when summed across threads
+				auto latencies = pCache->stop();
+				SetLatencyCounters(state, latencies);
+				pCache.reset();
+			}
+		}
+
+		void AddThreads(benchmark::internal::Benchmark* pBenchmark) {
+			for (auto numThreads : { 1, 8, 32, 64 })
+				pBenchmark->Threads(numThreads);
+		}
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	using catapult::utils::SpinReaderWriterLock;
+	using catapult::utils::StripedReaderWriterLock;
+
+	benchmark::RegisterBenchmark("BenchmarkContendedReaders_Spin", catapult::cache::BenchmarkContendedReaders<SpinReaderWriterLock>)
+			->UseRealTime()
+			->Apply(catapult::cache::AddThreads);
+
+	benchmark::RegisterBenchmark("BenchmarkContendedReaders_Striped", catapult::cache::BenchmarkContendedReaders<StripedReaderWriterLock>)
+			->UseRealTime()
+			->Apply(catapult::cache::AddThreads);
+}
@@ -0,0 +1,242 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/cache_db/RocksDatabase.h"
+#include "catapult/cache_db/RocksInclude.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <filesystem>
+
+namespace catapult { namespace cache {
+
+	namespace {
+		constexpr size_t Key_Size = Address::Size;
+		constexpr size_t Value_Size = 128;
+		constexpr size_t Num_Operations_Per_Iteration = 1'000;
+
+		// region profiles
+
+		enum class Profile { Baseline, Point_Lookup, Bloom_Filter, Bloom_Filter_Partitioned, Bloom_Filter_Compressed };
+
+		config::NodeConfiguration::CacheDatabaseSubConfiguration CreateDatabaseConfiguration(Profile profile) {
+			auto config = config::NodeConfiguration::CacheDatabaseSubConfiguration();
+			config.MaxWriteBatchSize = utils::FileSize::FromMegabytes(5);
+			if (Profile::Baseline == profile)
+				return config;
+
+			config.BlockCacheSize = utils::FileSize::FromMegabytes(64);
+			config.MemtableMemoryBudget = utils::FileSize::FromMegabytes(64);
+			if (Profile::Point_Lookup == profile)
+				return config;
+
+			auto& columnFamilyConfig = config.DefaultColumnFamily;
+			columnFamilyConfig.BloomFilterBitsPerKey = 10;
+			columnFamilyConfig.PinL0FilterAndIndexBlocks = true;
+			if (Profile::Bloom_Filter_Partitioned == profile)
+				columnFamilyConfig.EnablePartitionedIndexFilters = true;
+
+			// compressed profile requires rocksdb to be built with LZ4 and ZSTD support
+			if (Profile::Bloom_Filter_Compressed == profile) {
+				columnFamilyConfig.Compression = config::CacheDatabaseCompression::Lz4;
+				columnFamilyConfig.BottommostCompression = config::CacheDatabaseCompression::Zstd;
+			}
+
+			return config;
+		}
+
+		// endregion
+
+		// region synthetic account state
+
+		// keys are derived from indexes so that 10M accounts can be addressed without keeping all keys in memory
+		std::string CreateKey(uint64_t index) {
+			std::string key(Key_Size, '\0');
+			auto value = index;
+			for (auto i = 0u; i < Key_Size; i += sizeof(uint64_t)) {
+				// splitmix64
+				value += 0x9E3779B97F4A7C15;
+				auto z = value;
+				z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9;
+				z = (z ^ (z >> 27)) * 0x94D049BB133111EB;
+				z ^= z >> 31;
+				std::memcpy(&key[i], &z, std::min(sizeof(uint64_t), Key_Size - i));
+			}
+
+			return key;
+		}
+
+		std::string CreateValue() {
+			std::string value(Value_Size, '\0');
+			bench::FillWithRandomData({ reinterpret_cast<uint8_t*>(value.data()), value.size() });
+			return value;
+		}
+
+		class BenchContext {
+		public:
+			BenchContext(Profile profile, uint64_t numAccounts)
+					: m_directory((std::filesystem::temp_directory_path() / "catapult.bench.cache_db").generic_string())
+					, m_numAccounts(numAccounts) {
+				std::filesystem::remove_all(m_directory);
+				m_pDatabase = std::make_unique<RocksDatabase>(RocksDatabaseSettings(
+						m_directory,
+						CreateDatabaseConfiguration(profile),
+						{ "default" },
+						FilterPruningMode::Disabled));
+
+				auto value = CreateValue();
+				for (auto i = 0u; i < m_numAccounts; ++i)
+					m_pDatabase->put(0, CreateKey(i), value);
+
+				m_pDatabase->flush();
+			}
+
+			~BenchContext() {
+				m_pDatabase.reset();
+				std::filesystem::remove_all(m_directory);
+			}
+
+		public:
+			RocksDatabase& database() {
+				return *m_pDatabase;
+			}
+
+			std::string randomExistingKey() const {
+				return CreateKey(bench::Random() % m_numAccounts);
+			}
+
+			std::string randomMissingKey() const {
+				return CreateKey(m_numAccounts + bench::Random() % m_numAccounts);
+			}
+
+		private:
+			std::string m_directory;
+			uint64_t m_numAccounts;
+			std::unique_ptr<RocksDatabase> m_pDatabase;
+		};
+
+		// endregion
+
+		// region benchmarks
+
+		template<typename TGenerateKey>
+		void BenchmarkGet(benchmark::State& state, Profile profile, TGenerateKey generateKey) {
+			BenchContext context(profile, static_cast<uint64_t>(state.range(0)));
+
+			std::vector<std::string> keys(Num_Operations_Per_Iteration);
+			RdbDataIterator iter;
+			for (auto _ : state) {
+				state.PauseTiming();
+				for (auto& key : keys)
+					key = generateKey(context);
+
+				state.ResumeTiming();
+
+				for (const auto& key : keys) {
+					context.database().get(0, key, iter);
+					benchmark::DoNotOptimize(iter);
+				}
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(Num_Operations_Per_Iteration) * state.iterations());
+		}
+
+		void BenchmarkGetExisting(benchmark::State& state, Profile profile) {
+			BenchmarkGet(state, profile, [](const auto& context) { return context.randomExistingKey(); });
+		}
+
+		void BenchmarkGetMissing(benchmark::State& state, Profile profile) {
+			BenchmarkGet(state, profile, [](const auto& context) { return context.randomMissingKey(); });
+		}
+
+		void BenchmarkMultiGetExisting(benchmark::State& state, Profile profile) {
+			BenchContext context(profile, static_cast<uint64_t>(state.range(0)));
+
+			std::vector<std::string> keys(Num_Operations_Per_Iteration);
+			std::vector<rocksdb::Slice> keySlices;
+			std::vector<RdbDataIterator> iters;
+			for (auto _ : state) {
+				state.PauseTiming();
+				keySlices.clear();
+				for (auto& key : keys) {
+					key = context.randomExistingKey();
+					keySlices.emplace_back(key);
+				}
+
+				state.ResumeTiming();
+
+				context.database().multiGet(0, keySlices, iters);
+				benchmark::DoNotOptimize(iters);
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(Num_Operations_Per_Iteration) * state.iterations());
+		}
+
+		void BenchmarkUpdateExisting(benchmark::State& state, Profile profile) {
+			BenchContext context(profile, static_cast<uint64_t>(state.range(0)));
+
+			std::vector<std::string> keys(Num_Operations_Per_Iteration);
+			auto value = CreateValue();
+			for (auto _ : state) {
+				state.PauseTiming();
+				for (auto& key : keys)
+					key = context.randomExistingKey();
+
+				state.ResumeTiming();
+
+				// simulates a block commit touching a subset of accounts
+				for (const auto& key : keys)
+					context.database().put(0, key, value);
+
+				context.database().flush();
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(Num_Operations_Per_Iteration) * state.iterations());
+		}
+
+		// endregion
+
+		void AddDefaultArguments(benchmark::internal::Benchmark& benchmark) {
+			for (auto arg : { 100'000, 1'000'000, 10'000'000 })
+				benchmark.UseRealTime()->Unit(benchmark::kMicrosecond)->Arg(arg);
+		}
+	}
+}}
+
+#define CATAPULT_REGISTER_PROFILE_BENCHMARK(BENCH_NAME, PROFILE) \
+	catapult::cache::AddDefaultArguments(*benchmark::RegisterBenchmark( \
+			#BENCH_NAME "<" #PROFILE ">", \
+			catapult::cache::BENCH_NAME, \
+			catapult::cache::Profile::PROFILE))
+
+#define CATAPULT_REGISTER_PROFILE_BENCHMARKS(BENCH_NAME) \
+	CATAPULT_REGISTER_PROFILE_BENCHMARK(BENCH_NAME, Baseline); \
+	CATAPULT_REGISTER_PROFILE_BENCHMARK(BENCH_NAME, Point_Lookup); \
+	CATAPULT_REGISTER_PROFILE_BENCHMARK(BENCH_NAME, Bloom_Filter); \
+	CATAPULT_REGISTER_PROFILE_BENCHMARK(BENCH_NAME, Bloom_Filter_Partitioned); \
+	CATAPULT_REGISTER_PROFILE_BENCHMARK(BENCH_NAME, Bloom_Filter_Compressed)
+
+void RegisterTests();
+void RegisterTests() {
+	CATAPULT_REGISTER_PROFILE_BENCHMARKS(BenchmarkGetExisting);
+	CATAPULT_REGISTER_PROFILE_BENCHMARKS(BenchmarkGetMissing);
+	CATAPULT_REGISTER_PROFILE_BENCHMARKS(BenchmarkMultiGetExisting);
+	CATAPULT_REGISTER_PROFILE_BENCHMARKS(BenchmarkUpdateExisting);
+}
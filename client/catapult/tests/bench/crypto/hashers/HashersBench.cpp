@@ -74,6 +74,43 @@ namespace catapult { namespace crypto {
 			for (auto arg : { 256, 1024, 4096, 16384})
 				benchmark.UseRealTime()->Arg(arg);
 		}
+
+		// region Sha3_256Multi
+
+		constexpr size_t Num_Multi_Messages = 1024;
+
+		template<size_t Max_Lanes>
+		void BenchmarkSha3_256Multi(benchmark::State& state) {
+			std::vector<std::vector<uint8_t>> messages(Num_Multi_Messages);
+			std::vector<RawBuffer> buffers;
+			for (auto& message : messages) {
+				message.resize(static_cast<size_t>(state.range(0)));
+				buffers.push_back(message);
+			}
+
+			std::vector<Hash256> hashes(Num_Multi_Messages);
+			for (auto _ : state) {
+				state.PauseTiming();
+				for (auto& message : messages)
+					bench::FillWithRandomData(message);
+
+				state.ResumeTiming();
+
+				Sha3_256Multi(Max_Lanes, buffers.data(), 1, buffers.size(), hashes.data());
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(Num_Multi_Messages) * state.iterations());
+			state.SetBytesProcessed(static_cast<int64_t>(Num_Multi_Messages) * state.range(0) * state.iterations());
+			state.counters["lanes"] = static_cast<double>(std::min(Max_Lanes, Sha3_256MultiMaxLanes()));
+		}
+
+		void AddMultiArguments(benchmark::internal::Benchmark& benchmark) {
+			// 64 bytes corresponds to merkle tree nodes and 256 bytes roughly to a transfer transaction
+			for (auto arg : { 64, 256, 1024 })
+				benchmark.UseRealTime()->Arg(arg);
+		}
+
+		// endregion
 	}
 }}
 
@@ -89,4 +126,8 @@ void RegisterTests() {
 	CATAPULT_REGISTER_HASHER_BENCHMARK(Sha256Double_Traits);
 	CATAPULT_REGISTER_HASHER_BENCHMARK(Sha512_Traits);
 	CATAPULT_REGISTER_HASHER_BENCHMARK(Sha3_256_Traits);
+
+	catapult::crypto::AddMultiArguments(*REGISTER_BENCHMARK(catapult::crypto::BenchmarkSha3_256Multi<1>));
+	catapult::crypto::AddMultiArguments(*REGISTER_BENCHMARK(catapult::crypto::BenchmarkSha3_256Multi<4>));
+	catapult::crypto::AddMultiArguments(*REGISTER_BENCHMARK(catapult::crypto::BenchmarkSha3_256Multi<8>));
 }
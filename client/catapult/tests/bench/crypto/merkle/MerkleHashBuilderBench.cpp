@@ -0,0 +1,141 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/crypto/IncrementalMerkleHashBuilder.h"
+#include "catapult/crypto/MerkleHashBuilder.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+
+namespace catapult { namespace crypto {
+
+	namespace {
+		std::vector<Hash256> GenerateRandomHashes(size_t count) {
+			std::vector<Hash256> hashes(count);
+			for (auto& hash : hashes)
+				bench::FillWithRandomData(hash);
+
+			return hashes;
+		}
+
+		Hash256 CalculateMerkleHash(const std::vector<Hash256>& hashes) {
+			MerkleHashBuilder builder(hashes.size());
+			for (const auto& hash : hashes)
+				builder.update(hash);
+
+			Hash256 merkleHash;
+			builder.final(merkleHash);
+			return merkleHash;
+		}
+
+		// region build
+
+		void BenchmarkMerkleHashBuilder(benchmark::State& state) {
+			auto hashes = GenerateRandomHashes(static_cast<size_t>(state.range(0)));
+			for (auto _ : state)
+				benchmark::DoNotOptimize(CalculateMerkleHash(hashes));
+
+			state.SetItemsProcessed(static_cast<int64_t>(hashes.size()) * state.iterations());
+		}
+
+		template<typename TCreateBuilder>
+		void BenchmarkIncrementalBuild(benchmark::State& state, TCreateBuilder createBuilder) {
+			auto hashes = GenerateRandomHashes(static_cast<size_t>(state.range(0)));
+			for (auto _ : state) {
+				auto builder = createBuilder();
+				for (const auto& hash : hashes)
+					builder.update(hash);
+
+				Hash256 merkleHash;
+				builder.final(merkleHash);
+				benchmark::DoNotOptimize(merkleHash);
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(hashes.size()) * state.iterations());
+		}
+
+		void BenchmarkIncrementalMerkleHashBuilder(benchmark::State& state) {
+			BenchmarkIncrementalBuild(state, []() { return IncrementalMerkleHashBuilder(); });
+		}
+
+		// endregion
+
+		// region append
+
+		// simulates a harvester adding a single transaction to a candidate set and recalculating the transactions hash
+
+		void BenchmarkMerkleHashBuilderAppend(benchmark::State& state) {
+			auto hashes = GenerateRandomHashes(static_cast<size_t>(state.range(0)));
+			for (auto _ : state) {
+				state.PauseTiming();
+				hashes.push_back(GenerateRandomHashes(1)[0]);
+				state.ResumeTiming();
+
+				benchmark::DoNotOptimize(CalculateMerkleHash(hashes));
+
+				state.PauseTiming();
+				hashes.pop_back();
+				state.ResumeTiming();
+			}
+		}
+
+		void BenchmarkIncrementalMerkleHashBuilderAppend(benchmark::State& state) {
+			IncrementalMerkleHashBuilder builder;
+			for (const auto& hash : GenerateRandomHashes(static_cast<size_t>(state.range(0))))
+				builder.update(hash);
+
+			Hash256 merkleHash;
+			builder.final(merkleHash);
+			for (auto _ : state) {
+				state.PauseTiming();
+				auto hash = GenerateRandomHashes(1)[0];
+				state.ResumeTiming();
+
+				builder.update(hash);
+				builder.final(merkleHash);
+				benchmark::DoNotOptimize(merkleHash);
+
+				state.PauseTiming();
+				builder.removeLast();
+				builder.final(merkleHash);
+				state.ResumeTiming();
+			}
+		}
+
+		// endregion
+
+		void AddDefaultArguments(benchmark::internal::Benchmark& benchmark) {
+			for (auto arg : { 1'000, 10'000, 100'000 })
+				benchmark.UseRealTime()->Arg(arg);
+		}
+	}
+}}
+
+#define CATAPULT_REGISTER_MERKLE_BENCHMARK(BENCH_NAME) \
+	catapult::crypto::AddDefaultArguments(*benchmark::RegisterBenchmark(#BENCH_NAME, catapult::crypto::BENCH_NAME))
+
+void RegisterTests();
+void RegisterTests() {
+	CATAPULT_REGISTER_MERKLE_BENCHMARK(BenchmarkMerkleHashBuilder);
+	CATAPULT_REGISTER_MERKLE_BENCHMARK(BenchmarkIncrementalMerkleHashBuilder);
+
+	CATAPULT_REGISTER_MERKLE_BENCHMARK(BenchmarkMerkleHashBuilderAppend);
+	CATAPULT_REGISTER_MERKLE_BENCHMARK(BenchmarkIncrementalMerkleHashBuilderAppend);
+}
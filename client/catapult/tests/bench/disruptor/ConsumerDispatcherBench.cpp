@@ -0,0 +1,126 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/disruptor/ConsumerDispatcher.h"
+#include "catapult/utils/MemoryUtils.h"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <future>
+#include <thread>
+
+namespace catapult { namespace disruptor {
+
+	namespace {
+		constexpr uint32_t Block_Size = sizeof(model::BlockHeader) + sizeof(model::PaddedBlockFooter);
+
+		ConsumerInput CreateInput(Height height) {
+			auto pBlock = utils::MakeUniqueWithSize<model::Block>(Block_Size);
+			std::memset(static_cast<void*>(pBlock.get()), 0, Block_Size);
+			pBlock->Size = Block_Size;
+			pBlock->Type = model::Entity_Type_Block_Normal;
+			pBlock->Height = height;
+			return ConsumerInput(model::BlockRange::FromEntity(std::move(pBlock)));
+		}
+
+		void SetLatencyCounters(benchmark::State& state, std::vector<uint64_t>& latencies) {
+			if (latencies.empty())
+				return;
+
+			std::sort(latencies.begin(), latencies.end());
+			auto percentile = [&latencies](auto value) {
+				return static_cast<double>(latencies[(latencies.size() - 1) * value / 100]);
+			};
+
+			state.counters["p50_us"] = percentile(50);
+			state.counters["p99_us"] = percentile(99);
+			state.counters["max_us"] = static_cast<double>(latencies.back());
+		}
+
+		template<ConsumerWaitStrategy WaitStrategy>
+		void BenchmarkElementLatency(benchmark::State& state) {
+			auto numConsumers = static_cast<size_t>(state.range(0));
+			auto idleTime = std::chrono::microseconds(state.range(1));
+
+			auto options = ConsumerDispatcherOptions("bench dispatcher", 1024);
+			options.ElementTraceInterval = 0;
+			options.WaitStrategy = WaitStrategy;
+			std::vector<DisruptorConsumer> consumers(numConsumers, [](const auto&) { return ConsumerResult::Continue(); });
+			ConsumerDispatcher dispatcher(options, consumers);
+
+			// measure time from submission until the last stage completes processing (including wakeup delays of all stages)
+			std::vector<uint64_t> latencies;
+			auto height = Height(1);
+			for (auto _ : state) {
+				// idle time allows consumers to exhaust spinning and (depending on strategy) block before the next element arrives
+				std::this_thread::sleep_for(idleTime);
+
+				std::promise<void> completionPromise;
+				auto completionFuture = completionPromise.get_future();
+				auto start = std::chrono::steady_clock::now();
+				dispatcher.processElement(CreateInput(height), [&completionPromise](auto, const auto&) {
+					completionPromise.set_value();
+				});
+				completionFuture.get();
+
+				auto elapsed = std::chrono::steady_clock::now() - start;
+				state.SetIterationTime(std::chrono::duration<double>(elapsed).count());
+				latencies.push_back(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count()));
+				height = height + Height(1);
+			}
+
+			dispatcher.shutdown();
+
+			state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+			SetLatencyCounters(state, latencies);
+		}
+
+		void AddArguments(benchmark::internal::Benchmark* pBenchmark) {
+			// { num consumers, idle time (us) between elements }
+			for (auto numConsumers : { 1, 4, 10 }) {
+				for (auto idleTime : { 0, 1000 })
+					pBenchmark->Args({ numConsumers, idleTime });
+			}
+		}
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	using catapult::disruptor::ConsumerWaitStrategy;
+
+	benchmark::RegisterBenchmark(
+			"BenchmarkElementLatencyBusySpin",
+			catapult::disruptor::BenchmarkElementLatency<ConsumerWaitStrategy::Busy_Spin>)
+			->UseManualTime()
+			->Apply(catapult::disruptor::AddArguments);
+
+	benchmark::RegisterBenchmark(
+			"BenchmarkElementLatencySpinThenBlock",
+			catapult::disruptor::BenchmarkElementLatency<ConsumerWaitStrategy::Spin_Then_Block>)
+			->UseManualTime()
+			->Apply(catapult::disruptor::AddArguments);
+
+	benchmark::RegisterBenchmark("BenchmarkElementLatencyBlock", catapult::disruptor::BenchmarkElementLatency<ConsumerWaitStrategy::Block>)
+			->UseManualTime()
+			->Apply(catapult::disruptor::AddArguments);
+}
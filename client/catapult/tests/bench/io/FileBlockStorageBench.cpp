@@ -0,0 +1,196 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/io/FileBlockStorage.h"
+#include "catapult/model/BlockUtils.h"
+#include "catapult/model/Elements.h"
+#include "catapult/utils/MemoryUtils.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <filesystem>
+
+namespace catapult { namespace io {
+
+	namespace {
+		constexpr uint32_t File_Database_Batch_Size = 100;
+		constexpr size_t Num_Blocks = 500;
+		constexpr size_t Num_Transactions_Per_Block = 50;
+		constexpr size_t Num_Signers = 100;
+		constexpr size_t Transaction_Payload_Size = 40;
+		constexpr size_t Num_Operations_Per_Iteration = 100;
+
+		// region synthetic blocks
+
+		template<typename T>
+		T GenerateRandomByteArray() {
+			T value;
+			bench::FillWithRandomData(value);
+			return value;
+		}
+
+		class BlockWithElement {
+		public:
+			BlockWithElement(Height height, const std::vector<Key>& signers) {
+				// transactions resemble transfers: random signatures, keys drawn from a small pool of signers, random recipients
+				auto transactionSize = static_cast<uint32_t>(sizeof(model::Transaction) + Transaction_Payload_Size);
+				auto headerSize = model::GetBlockHeaderSize(model::Entity_Type_Block_Normal);
+				auto blockSize = static_cast<uint32_t>(headerSize + Num_Transactions_Per_Block * transactionSize);
+
+				m_pBlock = utils::MakeUniqueWithSize<model::Block>(blockSize);
+				std::memset(static_cast<void*>(m_pBlock.get()), 0, blockSize);
+				m_pBlock->Size = blockSize;
+				m_pBlock->Type = model::Entity_Type_Block_Normal;
+				m_pBlock->Height = height;
+				m_pBlock->Signature = GenerateRandomByteArray<Signature>();
+				m_pBlock->SignerPublicKey = signers[bench::Random() % signers.size()];
+				m_pBlock->PreviousBlockHash = GenerateRandomByteArray<Hash256>();
+				m_pBlock->TransactionsHash = GenerateRandomByteArray<Hash256>();
+
+				auto* pTransactionData = reinterpret_cast<uint8_t*>(m_pBlock.get()) + headerSize;
+				for (auto i = 0u; i < Num_Transactions_Per_Block; ++i) {
+					auto& transaction = reinterpret_cast<model::Transaction&>(*(pTransactionData + i * transactionSize));
+					transaction.Size = transactionSize;
+					transaction.Type = static_cast<model::EntityType>(0x4154);
+					transaction.Signature = GenerateRandomByteArray<Signature>();
+					transaction.SignerPublicKey = signers[bench::Random() % signers.size()];
+					transaction.MaxFee = Amount(bench::Random() % 1'000'000);
+					transaction.Deadline = Timestamp(bench::Random());
+					bench::FillWithRandomData({ reinterpret_cast<uint8_t*>(&transaction + 1), Address::Size });
+				}
+
+				m_pBlockElement = std::make_unique<model::BlockElement>(*m_pBlock);
+				m_pBlockElement->EntityHash = GenerateRandomByteArray<Hash256>();
+				m_pBlockElement->GenerationHash = GenerateRandomByteArray<GenerationHash>();
+				for (const auto& transaction : m_pBlock->Transactions()) {
+					m_pBlockElement->Transactions.emplace_back(transaction);
+					m_pBlockElement->Transactions.back().EntityHash = GenerateRandomByteArray<Hash256>();
+					m_pBlockElement->Transactions.back().MerkleComponentHash = GenerateRandomByteArray<Hash256>();
+				}
+			}
+
+		public:
+			const model::BlockElement& blockElement() const {
+				return *m_pBlockElement;
+			}
+
+		private:
+			std::unique_ptr<model::Block> m_pBlock;
+			std::unique_ptr<model::BlockElement> m_pBlockElement;
+		};
+
+		// endregion
+
+		// region BenchContext
+
+		uint64_t GetDirectorySize(const std::string& directory) {
+			uint64_t size = 0;
+			for (const auto& entry : std::filesystem::recursive_directory_iterator(directory)) {
+				if (entry.is_regular_file())
+					size += entry.file_size();
+			}
+
+			return size;
+		}
+
+		class BenchContext {
+		public:
+			explicit BenchContext(uint32_t compressionLevel)
+					: m_directory((std::filesystem::temp_directory_path() / "catapult.bench.io").generic_string()) {
+				std::filesystem::remove_all(m_directory);
+				std::filesystem::create_directories(m_directory);
+				m_pStorage = std::make_unique<FileBlockStorage>(
+						m_directory,
+						File_Database_Batch_Size,
+						FileBlockStorageMode::None,
+						FileBlockStorageReadMode::Copy,
+						compressionLevel);
+
+				std::vector<Key> signers;
+				for (auto i = 0u; i < Num_Signers; ++i)
+					signers.push_back(GenerateRandomByteArray<Key>());
+
+				std::vector<BlockWithElement> blocks;
+				for (auto i = 0u; i < Num_Blocks; ++i)
+					blocks.emplace_back(Height(i + 1), signers);
+
+				std::vector<model::BlockElement> blockElements;
+				for (const auto& block : blocks)
+					blockElements.push_back(block.blockElement());
+
+				m_pStorage->saveBlocks(blockElements);
+			}
+
+			~BenchContext() {
+				m_pStorage.reset();
+				std::filesystem::remove_all(m_directory);
+			}
+
+		public:
+			const FileBlockStorage& storage() const {
+				return *m_pStorage;
+			}
+
+			uint64_t diskSize() const {
+				return GetDirectorySize(m_directory);
+			}
+
+		private:
+			std::string m_directory;
+			std::unique_ptr<FileBlockStorage> m_pStorage;
+		};
+
+		// endregion
+
+		// region benchmarks
+
+		void BenchmarkLoadBlockElement(benchmark::State& state) {
+			// blocks are read back right after being written, so this mostly measures decompression and not disk latency
+			BenchContext context(static_cast<uint32_t>(state.range(0)));
+
+			std::vector<Height> heights(Num_Operations_Per_Iteration);
+			for (auto _ : state) {
+				state.PauseTiming();
+				for (auto& height : heights)
+					height = Height(1 + bench::Random() % Num_Blocks);
+
+				state.ResumeTiming();
+
+				for (auto height : heights)
+					benchmark::DoNotOptimize(context.storage().loadBlockElement(height));
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(Num_Operations_Per_Iteration) * state.iterations());
+			state.counters["disk_bytes"] = static_cast<double>(context.diskSize());
+		}
+
+		// endregion
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	// level zero is the uncompressed baseline
+	for (auto compressionLevel : { 0, 1, 3, 9, 19 })
+		benchmark::RegisterBenchmark("BenchmarkLoadBlockElement", catapult::io::BenchmarkLoadBlockElement)
+				->UseRealTime()
+				->Unit(benchmark::kMicrosecond)
+				->Arg(compressionLevel);
+}
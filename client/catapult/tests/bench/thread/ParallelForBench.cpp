@@ -0,0 +1,127 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/thread/IoThreadPool.h"
+#include "catapult/thread/ParallelFor.h"
+#include "catapult/thread/WorkStealingParallelFor.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <chrono>
+
+namespace catapult { namespace thread {
+
+	namespace {
+		constexpr auto Num_Items = 4096u;
+		constexpr auto Light_Item_Cost = 100u;
+		constexpr auto Heavy_Item_Cost = 10'000u;
+
+		struct BenchmarkItem {
+			uint32_t Cost;
+			uint64_t Result;
+		};
+
+		std::vector<BenchmarkItem> CreateSkewedItems(size_t heavyPercentage) {
+			// heavy items are clustered at the front in order to simulate a block containing many expensive transactions in a row
+			std::vector<BenchmarkItem> items(Num_Items);
+			auto numHeavyItems = Num_Items * heavyPercentage / 100;
+			for (auto i = 0u; i < Num_Items; ++i)
+				items[i] = { i < numHeavyItems ? Heavy_Item_Cost : Light_Item_Cost, 0 };
+
+			return items;
+		}
+
+		void ProcessItem(BenchmarkItem& item) {
+			auto value = bench::Random();
+			for (auto i = 0u; i < item.Cost; ++i)
+				value = value * 6364136223846793005ull + 1442695040888963407ull;
+
+			benchmark::DoNotOptimize(item.Result = value);
+		}
+
+		void SetLatencyCounters(benchmark::State& state, std::vector<uint64_t>& latencies) {
+			if (latencies.empty())
+				return;
+
+			std::sort(latencies.begin(), latencies.end());
+			auto percentile = [&latencies](auto value) {
+				return static_cast<double>(latencies[(latencies.size() - 1) * value / 100]);
+			};
+
+			state.counters["p50_us"] = percentile(50);
+			state.counters["p99_us"] = percentile(99);
+			state.counters["max_us"] = static_cast<double>(latencies.back());
+		}
+
+		template<ParallelForStrategy Strategy>
+		void BenchmarkParallelFor(benchmark::State& state) {
+			auto numThreads = static_cast<size_t>(state.range(0));
+			auto items = CreateSkewedItems(static_cast<size_t>(state.range(1)));
+			auto pPool = CreateIoThreadPool(numThreads);
+			pPool->start();
+
+			auto itemCallback = [](auto& item, auto) {
+				ProcessItem(item);
+				return true;
+			};
+
+			std::vector<uint64_t> latencies;
+			for (auto _ : state) {
+				auto start = std::chrono::steady_clock::now();
+				if (ParallelForStrategy::Work_Stealing == Strategy)
+					WorkStealingParallelFor(pPool->ioContext(), items, numThreads, itemCallback).get();
+				else
+					ParallelFor(pPool->ioContext(), items, numThreads, itemCallback).get();
+
+				auto elapsed = std::chrono::steady_clock::now() - start;
+				latencies.push_back(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count()));
+			}
+
+			pPool->join();
+
+			state.SetItemsProcessed(static_cast<int64_t>(Num_Items * state.iterations()));
+			SetLatencyCounters(state, latencies);
+		}
+
+		void AddArguments(benchmark::internal::Benchmark* pBenchmark) {
+			// { num threads, percentage of heavy items }
+			for (auto numThreads : { 2, 4, 8 }) {
+				for (auto heavyPercentage : { 0, 5, 25 })
+					pBenchmark->Args({ numThreads, heavyPercentage });
+			}
+		}
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	using catapult::thread::ParallelForStrategy;
+
+	benchmark::RegisterBenchmark("BenchmarkParallelFor", catapult::thread::BenchmarkParallelFor<ParallelForStrategy::Static>)
+			->UseRealTime()
+			->Apply(catapult::thread::AddArguments);
+
+	benchmark::RegisterBenchmark(
+			"BenchmarkWorkStealingParallelFor",
+			catapult::thread::BenchmarkParallelFor<ParallelForStrategy::Work_Stealing>)
+			->UseRealTime()
+			->Apply(catapult::thread::AddArguments);
+}
@@ -0,0 +1,146 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/tree/BasePatriciaTree.h"
+#include "catapult/tree/MemoryDataSource.h"
+#include "catapult/utils/Hashers.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+
+namespace catapult { namespace tree {
+
+	namespace {
+		struct HashEncoder {
+			using KeyType = Hash256;
+			using ValueType = Hash256;
+
+			static const KeyType& EncodeKey(const KeyType& key) {
+				return key;
+			}
+
+			static const Hash256& EncodeValue(const ValueType& value) {
+				return value;
+			}
+		};
+
+		using MemoryPatriciaTree = PatriciaTree<HashEncoder, MemoryDataSource>;
+		using MemoryBasePatriciaTree = BasePatriciaTree<HashEncoder, MemoryDataSource, utils::ArrayHasher<Hash256>>;
+
+		std::vector<Hash256> GenerateRandomHashes(size_t count) {
+			std::vector<Hash256> hashes(count);
+			for (auto& hash : hashes)
+				bench::FillWithRandomData(hash);
+
+			return hashes;
+		}
+
+		// region set
+
+		// simulates updating the state hash of a block with a fresh (in-memory) tree
+
+		template<bool UseArena>
+		void BenchmarkSet(benchmark::State& state) {
+			auto keys = GenerateRandomHashes(static_cast<size_t>(state.range(0)));
+			for (auto _ : state) {
+				MemoryDataSource dataSource;
+				MemoryPatriciaTree tree(dataSource, UseArena ? std::make_shared<TreeNodeArena>() : nullptr);
+				for (const auto& key : keys)
+					tree.set(key, key);
+
+				benchmark::DoNotOptimize(tree.root());
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(keys.size()) * state.iterations());
+		}
+
+		// simulates updating the state hash of a block on top of a committed tree
+
+		void BenchmarkDeltaSet(benchmark::State& state) {
+			MemoryDataSource dataSource;
+			MemoryBasePatriciaTree tree(dataSource);
+			{
+				auto pDelta = tree.rebase();
+				for (const auto& key : GenerateRandomHashes(100'000))
+					pDelta->set(key, key);
+
+				tree.commit();
+			}
+
+			auto keys = GenerateRandomHashes(static_cast<size_t>(state.range(0)));
+			for (auto _ : state) {
+				auto pDelta = tree.rebaseDetached();
+				for (const auto& key : keys)
+					pDelta->set(key, key);
+
+				benchmark::DoNotOptimize(pDelta->root());
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(keys.size()) * state.iterations());
+		}
+
+		// endregion
+
+		// region lookup
+
+		void BenchmarkLookup(benchmark::State& state) {
+			auto keys = GenerateRandomHashes(static_cast<size_t>(state.range(0)));
+
+			MemoryDataSource dataSource;
+			MemoryBasePatriciaTree tree(dataSource);
+			{
+				auto pDelta = tree.rebase();
+				for (const auto& key : keys)
+					pDelta->set(key, key);
+
+				tree.commit();
+			}
+
+			std::vector<TreeNode> nodePath;
+			for (auto _ : state) {
+				for (const auto& key : keys) {
+					nodePath.clear();
+					benchmark::DoNotOptimize(tree.lookup(key, nodePath));
+				}
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(keys.size()) * state.iterations());
+		}
+
+		// endregion
+
+		void AddDefaultArguments(benchmark::internal::Benchmark& benchmark) {
+			for (auto arg : { 1'000, 10'000 })
+				benchmark.UseRealTime()->Arg(arg);
+		}
+	}
+}}
+
+#define CATAPULT_REGISTER_PATRICIA_BENCHMARK(BENCH_NAME, ...) \
+	catapult::tree::AddDefaultArguments(*benchmark::RegisterBenchmark(BENCH_NAME, catapult::tree::__VA_ARGS__))
+
+void RegisterTests();
+void RegisterTests() {
+	CATAPULT_REGISTER_PATRICIA_BENCHMARK("BenchmarkSet", BenchmarkSet<false>);
+	CATAPULT_REGISTER_PATRICIA_BENCHMARK("BenchmarkSetWithArena", BenchmarkSet<true>);
+	CATAPULT_REGISTER_PATRICIA_BENCHMARK("BenchmarkDeltaSet", BenchmarkDeltaSet);
+
+	CATAPULT_REGISTER_PATRICIA_BENCHMARK("BenchmarkLookup", BenchmarkLookup);
+}
@@ -20,6 +20,9 @@
 **/
 
 #include "catapult/cache/CacheDatabaseMixin.h"
+#include "catapult/cache_db/PatriciaTreeNodeCache.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/nodeps/Filesystem.h"
 #include "tests/TestHarness.h"
 
@@ -42,6 +45,14 @@ namespace catapult { namespace cache {
 				return CacheDatabaseMixin::hasPatriciaTreeSupport();
 			}
 
+			const tree::TreeNodesHasher& patriciaTreeHasher() const {
+				return CacheDatabaseMixin::patriciaTreeHasher();
+			}
+
+			PatriciaTreeNodeCache* patriciaTreeNodeCache() const {
+				return CacheDatabaseMixin::patriciaTreeNodeCache();
+			}
+
 			CacheDatabase& database() {
 				return CacheDatabaseMixin::database();
 			}
@@ -124,6 +135,58 @@ namespace catapult { namespace cache {
 		EXPECT_EQ(deltaset::ConditionalContainerMode::Storage, decltype(mixin)::GetContainerMode(config));
 	}
 
+	TEST(TEST_CLASS, PatriciaTreeHasherIsNotSetWhenStateHashPoolIsNotSet) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard;
+		CacheConfiguration config(dbDirGuard.name(), PatriciaTreeStorageMode::Enabled);
+
+		// Act:
+		ConcreteCacheDatabaseMixin mixin(config, { "default" });
+
+		// Assert:
+		EXPECT_FALSE(!!mixin.patriciaTreeHasher());
+	}
+
+	TEST(TEST_CLASS, PatriciaTreeHasherIsSetWhenStateHashPoolIsSet) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard;
+		CacheConfiguration config(dbDirGuard.name(), PatriciaTreeStorageMode::Enabled);
+		auto pPool = test::CreateStartedIoThreadPool(2);
+		config.pStateHashPool = pPool.get();
+
+		// Act:
+		ConcreteCacheDatabaseMixin mixin(config, { "default" });
+
+		// Assert:
+		EXPECT_TRUE(!!mixin.patriciaTreeHasher());
+	}
+
+	TEST(TEST_CLASS, PatriciaTreeNodeCacheIsNotSetWhenTreeNodeCacheIsNotSet) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard;
+		CacheConfiguration config(dbDirGuard.name(), PatriciaTreeStorageMode::Enabled);
+
+		// Act:
+		ConcreteCacheDatabaseMixin mixin(config, { "default" });
+
+		// Assert:
+		EXPECT_FALSE(!!mixin.patriciaTreeNodeCache());
+	}
+
+	TEST(TEST_CLASS, PatriciaTreeNodeCacheIsSharedWhenTreeNodeCacheIsSet) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard;
+		CacheConfiguration config(dbDirGuard.name(), PatriciaTreeStorageMode::Enabled);
+		config.pTreeNodeCache = std::make_shared<PatriciaTreeNodeCache>(100, 2);
+
+		// Act:
+		ConcreteCacheDatabaseMixin mixin(config, { "default" });
+
+		// Assert:
+		EXPECT_EQ(config.pTreeNodeCache.get(), mixin.patriciaTreeNodeCache());
+		EXPECT_EQ(2, config.pTreeNodeCache.use_count());
+	}
+
 	TEST(TEST_CLASS, CanFlushWhenCacheDatabaseIsDisabled) {
 		// Arrange:
 		CacheConfiguration config;
@@ -20,6 +20,7 @@
 **/
 
 #include "catapult/cache/CachePatriciaTree.h"
+#include "catapult/cache_db/PatriciaTreeNodeCache.h"
 #include "catapult/cache_db/RocksInclude.h"
 #include "catapult/tree/BasePatriciaTree.h"
 #include "tests/catapult/cache/test/PatriciaTreeTestUtils.h"
@@ -241,4 +242,69 @@ namespace catapult { namespace cache {
 	}
 
 	// endregion
+
+	// region enabled - node cache
+
+	namespace {
+		void SetTwoValues(CachePatriciaTree<DatabaseBasePatriciaTree>& tree) {
+			auto pDeltaTree = tree.rebase();
+			pDeltaTree->set(0x01'23'4A'B6, "alpha");
+			pDeltaTree->set(0x01'23'4A'99, "beta");
+			tree.commit();
+		}
+	}
+
+	TEST(TEST_CLASS, Enabled_CommitPinsTopLevelsInNodeCache) {
+		// Arrange:
+		CacheDatabaseHolder holder;
+		PatriciaTreeNodeCache nodeCache(100, 2);
+		CachePatriciaTree<DatabaseBasePatriciaTree> tree(true, holder.database(), 1, tree::TreeNodesHasher(), &nodeCache);
+
+		// Act:
+		SetTwoValues(tree);
+
+		// Assert: root branch node is cached and pinned
+		EXPECT_EQ(1u, nodeCache.size());
+		EXPECT_EQ(1u, nodeCache.numPinned());
+		EXPECT_EQ(tree.get()->root(), nodeCache.find(tree.get()->root()).hash());
+	}
+
+	TEST(TEST_CLASS, Enabled_InitializationPinsTopLevelsInNodeCache) {
+		// Arrange:
+		CacheDatabaseHolder holder;
+		Hash256 rootHash;
+		{
+			CachePatriciaTree<DatabaseBasePatriciaTree> tree(true, holder.database(), 1);
+			SetTwoValues(tree);
+			rootHash = tree.get()->root();
+		}
+
+		PatriciaTreeNodeCache nodeCache(100, 2);
+
+		// Act:
+		CachePatriciaTree<DatabaseBasePatriciaTree> tree(true, holder.database(), 1, tree::TreeNodesHasher(), &nodeCache);
+
+		// Assert:
+		EXPECT_EQ(rootHash, tree.get()->root());
+		EXPECT_EQ(1u, nodeCache.size());
+		EXPECT_EQ(1u, nodeCache.numPinned());
+	}
+
+	TEST(TEST_CLASS, Enabled_DestructionUnpinsTopLevelsInNodeCache) {
+		// Arrange:
+		CacheDatabaseHolder holder;
+		PatriciaTreeNodeCache nodeCache(100, 2);
+		{
+			CachePatriciaTree<DatabaseBasePatriciaTree> tree(true, holder.database(), 1, tree::TreeNodesHasher(), &nodeCache);
+			SetTwoValues(tree);
+
+			// Sanity:
+			EXPECT_EQ(1u, nodeCache.numPinned());
+		}
+
+		// Assert:
+		EXPECT_EQ(0u, nodeCache.numPinned());
+	}
+
+	// endregion
 }}
@@ -23,12 +23,16 @@
 #include "catapult/cache/CacheStorage.h"
 #include "catapult/cache/CatapultCacheBuilder.h"
 #include "catapult/cache/ReadOnlyCatapultCache.h"
+#include "catapult/cache_db/RocksBackgroundWriter.h"
+#include "catapult/cache_db/RocksDatabase.h"
+#include "catapult/cache_db/RocksInclude.h"
 #include "catapult/crypto/Hashes.h"
 #include "catapult/state/CatapultState.h"
 #include "tests/test/cache/CacheBasicTests.h"
 #include "tests/test/cache/SimpleCache.h"
 #include "tests/test/core/StateTestUtils.h"
 #include "tests/test/core/mocks/MockMemoryStream.h"
+#include "tests/test/nodeps/Filesystem.h"
 #include "tests/TestHarness.h"
 
 namespace catapult { namespace cache {
@@ -323,6 +327,39 @@ namespace catapult { namespace cache {
 		AssertSubCacheSizes(delta, 1);
 	}
 
+	TEST(TEST_CLASS, CommitWritesPendingSharedDatabaseChanges) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard;
+		auto pSharedDatabase = std::make_shared<RocksSharedDatabase>(
+				dbDirGuard.name(),
+				config::NodeConfiguration::CacheDatabaseSubConfiguration(),
+				nullptr);
+		auto databaseDirectory = dbDirGuard.name() + "/foo";
+		RocksDatabase database(RocksDatabaseSettings(databaseDirectory, { "default" }, FilterPruningMode::Disabled, pSharedDatabase));
+
+		CatapultCacheBuilder builder;
+		AddSubCacheWithId<2>(builder);
+		auto cache = builder.build(pSharedDatabase, nullptr);
+
+		// - add a pending change to the shared database
+		database.put(0, "hello", "world");
+
+		// Act:
+		{
+			auto delta = cache.createDelta();
+			delta.sub<test::SimpleCacheT<2>>().increment();
+			cache.commit(Height());
+		}
+
+		// Assert: sub caches are committed and pending changes are written
+		EXPECT_EQ(1u, cache.createView().sub<test::SimpleCacheT<2>>().size());
+		EXPECT_FALSE(pSharedDatabase->isCommitting());
+
+		RdbDataIterator iter;
+		database.get(0, "hello", iter);
+		EXPECT_NE(RdbDataIterator::End(), iter);
+	}
+
 	TEST(TEST_CLASS, CommitOfSubCacheInvalidatesDetachedDelta) {
 		// Arrange:
 		auto cache = CreateSimpleCatapultCache();
@@ -354,6 +391,70 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region pending writes
+
+	TEST(TEST_CLASS, WaitForPendingWritesSucceedsWithoutBackgroundWriter) {
+		// Arrange:
+		auto cache = CreateSimpleCatapultCache();
+
+		// Act + Assert:
+		EXPECT_NO_THROW(cache.waitForPendingWrites());
+	}
+
+	TEST(TEST_CLASS, WaitForPendingWritesWaitsForBackgroundWriter) {
+		// Arrange:
+		auto pBackgroundWriter = std::make_shared<RocksBackgroundWriter>(10);
+		auto cache = CatapultCache({}, nullptr, pBackgroundWriter);
+
+		auto numWrites = 0u;
+		for (auto i = 0u; i < 3; ++i) {
+			pBackgroundWriter->post([&numWrites]() {
+				std::this_thread::sleep_for(std::chrono::milliseconds(5));
+				++numWrites;
+			});
+		}
+
+		// Act:
+		cache.waitForPendingWrites();
+
+		// Assert:
+		EXPECT_EQ(3u, numWrites);
+		EXPECT_EQ(0u, pBackgroundWriter->numPendingOperations());
+	}
+
+	TEST(TEST_CLASS, OnPendingWritesCompleteInvokesHandlerImmediatelyWithoutBackgroundWriter) {
+		// Arrange:
+		auto cache = CreateSimpleCatapultCache();
+		auto numCalls = 0u;
+
+		// Act:
+		cache.onPendingWritesComplete([&numCalls]() { ++numCalls; });
+
+		// Assert:
+		EXPECT_EQ(1u, numCalls);
+	}
+
+	TEST(TEST_CLASS, OnPendingWritesCompleteInvokesHandlerAfterPendingWritesWithBackgroundWriter) {
+		// Arrange:
+		auto pBackgroundWriter = std::make_shared<RocksBackgroundWriter>(10);
+		auto cache = CatapultCache({}, nullptr, pBackgroundWriter);
+
+		std::vector<std::string> events;
+		pBackgroundWriter->post([&events]() {
+			std::this_thread::sleep_for(std::chrono::milliseconds(5));
+			events.push_back("write");
+		});
+
+		// Act:
+		cache.onPendingWritesComplete([&events]() { events.push_back("handler"); });
+		cache.waitForPendingWrites();
+
+		// Assert:
+		EXPECT_EQ(std::vector<std::string>({ "write", "handler" }), events);
+	}
+
+	// endregion
+
 	// region synchronization
 
 	namespace {
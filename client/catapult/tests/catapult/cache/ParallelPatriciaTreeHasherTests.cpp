@@ -0,0 +1,104 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/cache/ParallelPatriciaTreeHasher.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "catapult/tree/MemoryDataSource.h"
+#include "tests/catapult/cache/test/PatriciaTreeTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace cache {
+
+#define TEST_CLASS ParallelPatriciaTreeHasherTests
+
+	namespace {
+		std::vector<tree::TreeNode> CreateBranchNodes(size_t count) {
+			std::vector<tree::TreeNode> nodes;
+			for (auto i = 0u; i < count; ++i) {
+				auto branchNode = tree::BranchTreeNode(tree::TreeNodePath(static_cast<uint32_t>(i)));
+				branchNode.setLink(test::GenerateRandomByteArray<Hash256>(), i % tree::BranchTreeNode::Max_Links);
+				branchNode.setLink(test::GenerateRandomByteArray<Hash256>(), (i + 7) % tree::BranchTreeNode::Max_Links);
+				nodes.push_back(tree::TreeNode(branchNode));
+			}
+
+			return nodes;
+		}
+
+		std::vector<Hash256> CalculateExpectedHashes(const std::vector<tree::TreeNode>& nodes) {
+			// hash copies so that hashes cached by the original nodes are not affected
+			std::vector<Hash256> hashes;
+			for (const auto& node : nodes)
+				hashes.push_back(node.copy().hash());
+
+			return hashes;
+		}
+
+		void AssertCanHashNodes(uint32_t numThreads, size_t numNodes) {
+			// Arrange:
+			auto pPool = test::CreateStartedIoThreadPool(numThreads);
+			auto hasher = CreateParallelPatriciaTreeHasher(*pPool);
+
+			auto nodes = CreateBranchNodes(numNodes);
+			auto expectedHashes = CalculateExpectedHashes(nodes);
+
+			// Act:
+			hasher(nodes);
+
+			// Assert:
+			ASSERT_EQ(numNodes, nodes.size());
+			for (auto i = 0u; i < numNodes; ++i)
+				EXPECT_EQ(expectedHashes[i], nodes[i].hash()) << "threads " << numThreads << ", node " << i;
+		}
+	}
+
+	TEST(TEST_CLASS, CanHashNodesOnCallingThread) {
+		AssertCanHashNodes(4, 0);
+		AssertCanHashNodes(4, 1);
+		AssertCanHashNodes(1, 10);
+	}
+
+	TEST(TEST_CLASS, CanHashNodesInParallel) {
+		for (auto numNodes : { 2u, 3u, 4u, 5u, 16u })
+			AssertCanHashNodes(4, numNodes);
+	}
+
+	TEST(TEST_CLASS, CanCalculateTreeRootUsingHasher) {
+		// Arrange:
+		auto pPool = test::CreateStartedIoThreadPool(4);
+		std::vector<std::pair<uint32_t, std::string>> pairs;
+		for (auto i = 0u; i < 1000; ++i)
+			pairs.emplace_back(static_cast<uint32_t>((test::Random() & 0xFFFF'F000) | i), std::to_string(i));
+
+		std::vector<test::MemoryPatriciaTree::EncodedPair> encodedPairs;
+		for (const auto& pair : pairs)
+			encodedPairs.push_back(test::MemoryPatriciaTree::Encode(pair.first, pair.second));
+
+		tree::MemoryDataSource dataSource;
+		test::MemoryPatriciaTree tree(dataSource);
+
+		// Act:
+		tree.setBatch(std::move(encodedPairs), CreateParallelPatriciaTreeHasher(*pPool));
+
+		// Assert:
+		EXPECT_EQ(test::CalculateRootHash(pairs), tree.root());
+	}
+}}
@@ -157,6 +157,48 @@ namespace catapult { namespace cache {
 		EXPECT_NE(nodePathLeaf.value(), result.first);
 	}
 
+	TEST(TEST_CLASS, ViewMixin_BatchLookupReturnsFalseWhenTreeIsNullptr) {
+		// Arrange:
+		auto mixin = PatriciaTreeMixin<MemoryPatriciaTree>(nullptr);
+
+		// Act:
+		tree::PatriciaTreeBatchProof proof;
+		auto results = mixin.tryLookup(std::vector<uint32_t>{ 0x64'6F'67'65, 0x64'6F'67'64 }, proof);
+
+		// Assert:
+		ASSERT_EQ(2u, results.size());
+		for (const auto& result : results) {
+			EXPECT_FALSE(result.second);
+			EXPECT_EQ(Hash256(), result.first);
+		}
+
+		EXPECT_TRUE(proof.Nodes.empty());
+		EXPECT_EQ(std::vector<std::vector<uint32_t>>(2), proof.NodeIndexPaths);
+	}
+
+	TEST(TEST_CLASS, ViewMixin_BatchLookupForwardsToUnderlyingTreeWhenTreeIsValid) {
+		// Arrange:
+		tree::MemoryDataSource dataSource;
+		MemoryPatriciaTree tree(dataSource);
+		test::SeedTreeWithFourNodes(tree);
+
+		auto mixin = PatriciaTreeMixin<MemoryPatriciaTree>(&tree);
+
+		// Act:
+		tree::PatriciaTreeBatchProof proof;
+		auto results = mixin.tryLookup(std::vector<uint32_t>{ 0x64'6F'67'65, 0x64'6F'67'64 }, proof);
+
+		// Assert:
+		ASSERT_EQ(2u, results.size());
+		EXPECT_TRUE(results[0].second);
+		EXPECT_FALSE(results[1].second);
+
+		ASSERT_EQ(2u, proof.NodeIndexPaths.size());
+		ASSERT_FALSE(proof.NodeIndexPaths[0].empty());
+		EXPECT_EQ(tree.root(), proof.Nodes[proof.NodeIndexPaths[0][0]].hash());
+		EXPECT_EQ(proof.NodeIndexPaths[0], proof.NodeIndexPaths[1]);
+	}
+
 	// endregion
 
 	// region PatriciaTreeDeltaMixin - supportsMerkleRoot
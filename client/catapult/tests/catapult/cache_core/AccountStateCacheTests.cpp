@@ -492,6 +492,120 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region prefetch
+
+	namespace {
+		template<typename TAction>
+		void RunPrefetchTest(const CacheConfiguration& cacheConfig, TAction action) {
+			// Arrange: add two accounts and commit them
+			AccountStateCache cache(cacheConfig, Default_Cache_Options);
+			auto addresses = test::GenerateRandomDataVector<Address>(3);
+			{
+				auto delta = cache.createDelta();
+				delta->addAccount(addresses[0], Height(123));
+				delta->addAccount(addresses[1], Height(234));
+				delta->find(addresses[1]).get().Balances.credit(Currency_Mosaic_Id, Amount(100));
+				cache.commit();
+			}
+
+			// Act: prefetch all three accounts, including an unknown one
+			auto delta = cache.createDelta();
+			delta->prefetch({ addresses, {} });
+
+			// Assert:
+			action(*delta, addresses);
+		}
+
+		void AssertPrefetchedAccounts(AccountStateCacheDelta& delta, const std::vector<Address>& addresses) {
+			EXPECT_EQ(2u, delta.size());
+
+			EXPECT_TRUE(delta.contains(addresses[0]));
+			EXPECT_TRUE(delta.contains(addresses[1]));
+			EXPECT_FALSE(delta.contains(addresses[2]));
+
+			EXPECT_EQ(Height(123), delta.find(addresses[0]).get().AddressHeight);
+			EXPECT_EQ(Amount(100), delta.find(addresses[1]).get().Balances.get(Currency_Mosaic_Id));
+			EXPECT_FALSE(!!delta.find(addresses[2]).tryGet());
+		}
+	}
+
+	TEST(TEST_CLASS, PrefetchHasNoEffectWhenCacheDatabaseIsDisabled) {
+		RunPrefetchTest(CacheConfiguration(), AssertPrefetchedAccounts);
+	}
+
+	TEST(TEST_CLASS, PrefetchLoadsKnownAccountsWhenCacheDatabaseIsEnabled) {
+		test::TempDirectoryGuard dbDirGuard;
+		RunPrefetchTest(CacheConfiguration(dbDirGuard.name(), PatriciaTreeStorageMode::Disabled), AssertPrefetchedAccounts);
+	}
+
+	TEST(TEST_CLASS, PrefetchedAccountsCanBeModifiedAndAdded) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard;
+		RunPrefetchTest(CacheConfiguration(dbDirGuard.name(), PatriciaTreeStorageMode::Disabled), [](auto& delta, const auto& addresses) {
+			// Act: modify a prefetched account and add a prefetched unknown account
+			delta.find(addresses[1]).get().Balances.credit(Currency_Mosaic_Id, Amount(50));
+			delta.addAccount(addresses[2], Height(345));
+
+			// Assert:
+			EXPECT_EQ(3u, delta.size());
+			EXPECT_EQ(Amount(150), delta.find(addresses[1]).get().Balances.get(Currency_Mosaic_Id));
+			EXPECT_EQ(Height(345), delta.find(addresses[2]).get().AddressHeight);
+
+			EXPECT_EQ(1u, delta.addedElements().size());
+			EXPECT_EQ(1u, delta.modifiedElements().size());
+			EXPECT_EQ(0u, delta.removedElements().size());
+		});
+	}
+
+	namespace {
+		void AssertPrefetchLoaderCanBeUsedAfterDeltaIsDestroyed(const CacheConfiguration& cacheConfig) {
+			// Arrange: add two accounts and commit them
+			AccountStateCache cache(cacheConfig, Default_Cache_Options);
+			auto addresses = test::GenerateRandomDataVector<Address>(3);
+			{
+				auto delta = cache.createDelta();
+				delta->addAccount(addresses[0], Height(123));
+				delta->addAccount(addresses[1], Height(234));
+				cache.commit();
+			}
+
+			// - create a loader and destroy the delta used to create it
+			StatePrefetchLoader loader;
+			{
+				auto delta = cache.createDelta();
+				loader = delta->createPrefetchLoader();
+			}
+
+			// - commit another account
+			{
+				auto delta = cache.createDelta();
+				delta->addAccount(addresses[2], Height(345));
+				cache.commit();
+			}
+
+			// Act: load all three accounts
+			loader({ addresses, {} });
+
+			// Assert: cache was not modified by loader
+			auto view = cache.createView();
+			EXPECT_EQ(3u, view->size());
+			EXPECT_EQ(Height(123), view->find(addresses[0]).get().AddressHeight);
+			EXPECT_EQ(Height(234), view->find(addresses[1]).get().AddressHeight);
+			EXPECT_EQ(Height(345), view->find(addresses[2]).get().AddressHeight);
+		}
+	}
+
+	TEST(TEST_CLASS, PrefetchLoaderCanBeUsedAfterDeltaIsDestroyedWhenCacheDatabaseIsDisabled) {
+		AssertPrefetchLoaderCanBeUsedAfterDeltaIsDestroyed(CacheConfiguration());
+	}
+
+	TEST(TEST_CLASS, PrefetchLoaderCanBeUsedAfterDeltaIsDestroyedWhenCacheDatabaseIsEnabled) {
+		test::TempDirectoryGuard dbDirGuard;
+		AssertPrefetchLoaderCanBeUsedAfterDeltaIsDestroyed(CacheConfiguration(dbDirGuard.name(), PatriciaTreeStorageMode::Disabled));
+	}
+
+	// endregion
+
 	// region addAccount (basic)
 
 	ID_BASED_TEST(AddAccountChangesSizeOfCache) {
@@ -0,0 +1,299 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/cache_db/PatriciaTreeNodeCache.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace cache {
+
+#define TEST_CLASS PatriciaTreeNodeCacheTests
+
+	namespace {
+		constexpr auto Num_Shards = 16u;
+
+		tree::BranchTreeNode CreateRandomBranchNode() {
+			tree::BranchTreeNode node(tree::TreeNodePath(test::Random()));
+			node.setLink(test::GenerateRandomByteArray<Hash256>(), 3);
+			node.setLink(test::GenerateRandomByteArray<Hash256>(), 11);
+			return node;
+		}
+
+		std::vector<tree::TreeNode> CreateBranchNodesInSameShard(size_t count) {
+			// nodes are sharded by the last byte of their hashes
+			std::vector<tree::TreeNode> nodes;
+			while (nodes.size() < count) {
+				auto node = tree::TreeNode(CreateRandomBranchNode());
+				if (0 == node.hash()[Hash256::Size - 1] % Num_Shards)
+					nodes.push_back(std::move(node));
+			}
+
+			return nodes;
+		}
+
+		void AssertCached(PatriciaTreeNodeCache& cache, const tree::TreeNode& expectedNode) {
+			auto node = cache.find(expectedNode.hash());
+			ASSERT_TRUE(node.isBranch());
+			EXPECT_EQ(expectedNode.path(), node.path());
+			EXPECT_EQ(expectedNode.hash(), node.hash());
+		}
+
+		void AssertNotCached(PatriciaTreeNodeCache& cache, const tree::TreeNode& node) {
+			EXPECT_TRUE(cache.find(node.hash()).empty());
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreateEmptyCache) {
+		// Act:
+		PatriciaTreeNodeCache cache(100, 3);
+
+		// Assert:
+		EXPECT_EQ(100u, cache.maxSize());
+		EXPECT_EQ(3u, cache.numPinnedLevels());
+		EXPECT_EQ(0u, cache.size());
+		EXPECT_EQ(0u, cache.numPinned());
+		EXPECT_EQ(0u, cache.numHits());
+		EXPECT_EQ(0u, cache.numMisses());
+	}
+
+	// endregion
+
+	// region find / insert
+
+	TEST(TEST_CLASS, FindReturnsEmptyNodeWhenNodeIsNotCached) {
+		// Arrange:
+		PatriciaTreeNodeCache cache(100, 0);
+		cache.insert(tree::TreeNode(CreateRandomBranchNode()));
+
+		// Act:
+		auto node = cache.find(test::GenerateRandomByteArray<Hash256>());
+
+		// Assert:
+		EXPECT_TRUE(node.empty());
+		EXPECT_EQ(0u, cache.numHits());
+		EXPECT_EQ(1u, cache.numMisses());
+	}
+
+	TEST(TEST_CLASS, CanInsertAndFindBranchNode) {
+		// Arrange:
+		PatriciaTreeNodeCache cache(100, 0);
+		auto branchNode = CreateRandomBranchNode();
+
+		// Act:
+		cache.insert(tree::TreeNode(branchNode));
+		auto node = cache.find(branchNode.hash());
+
+		// Assert:
+		EXPECT_EQ(1u, cache.size());
+		ASSERT_TRUE(node.isBranch());
+		EXPECT_EQ(branchNode.path(), node.path());
+		EXPECT_EQ(branchNode.link(3), node.asBranchNode().link(3));
+		EXPECT_EQ(branchNode.link(11), node.asBranchNode().link(11));
+		EXPECT_EQ(branchNode.hash(), node.hash());
+
+		EXPECT_EQ(1u, cache.numHits());
+		EXPECT_EQ(0u, cache.numMisses());
+	}
+
+	TEST(TEST_CLASS, InsertIgnoresLeafAndEmptyNodes) {
+		// Arrange:
+		PatriciaTreeNodeCache cache(100, 0);
+		auto leafNode = tree::LeafTreeNode(tree::TreeNodePath(test::Random()), test::GenerateRandomByteArray<Hash256>());
+
+		// Act:
+		cache.insert(tree::TreeNode(leafNode));
+		cache.insert(tree::TreeNode());
+
+		// Assert:
+		EXPECT_EQ(0u, cache.size());
+		EXPECT_TRUE(cache.find(leafNode.hash()).empty());
+	}
+
+	TEST(TEST_CLASS, InsertIgnoresCachedNodes) {
+		// Arrange:
+		PatriciaTreeNodeCache cache(100, 0);
+		auto node = tree::TreeNode(CreateRandomBranchNode());
+
+		// Act:
+		cache.insert(node);
+		cache.insert(node);
+
+		// Assert:
+		EXPECT_EQ(1u, cache.size());
+		AssertCached(cache, node);
+	}
+
+	TEST(TEST_CLASS, InsertReplacesLinkedNodesWithLinks) {
+		// Arrange:
+		PatriciaTreeNodeCache cache(100, 0);
+		auto leafNode = tree::LeafTreeNode(tree::TreeNodePath(test::Random()), test::GenerateRandomByteArray<Hash256>());
+		auto branchNode = CreateRandomBranchNode();
+		branchNode.setLink(tree::TreeNode(leafNode), 7);
+
+		// Act:
+		cache.insert(tree::TreeNode(branchNode));
+		auto node = cache.find(branchNode.hash());
+
+		// Assert:
+		ASSERT_TRUE(node.isBranch());
+		EXPECT_TRUE(node.asBranchNode().hasLink(7));
+		EXPECT_FALSE(node.asBranchNode().hasLinkedNode(7));
+		EXPECT_EQ(leafNode.hash(), node.asBranchNode().link(7));
+		EXPECT_EQ(branchNode.hash(), node.hash());
+	}
+
+	TEST(TEST_CLASS, ZeroSizeCacheDoesNotCacheNodes) {
+		// Arrange:
+		PatriciaTreeNodeCache cache(0, 0);
+		auto node = tree::TreeNode(CreateRandomBranchNode());
+
+		// Act:
+		cache.insert(node);
+
+		// Assert:
+		EXPECT_EQ(0u, cache.size());
+		AssertNotCached(cache, node);
+	}
+
+	// endregion
+
+	// region eviction
+
+	TEST(TEST_CLASS, CacheSizeDoesNotExceedMaxSize) {
+		// Arrange:
+		PatriciaTreeNodeCache cache(20, 0);
+
+		// Act:
+		for (auto i = 0u; i < 1000; ++i)
+			cache.insert(tree::TreeNode(CreateRandomBranchNode()));
+
+		// Assert:
+		EXPECT_EQ(20u, cache.size());
+	}
+
+	TEST(TEST_CLASS, InsertEvictsNodeWhenShardIsFull) {
+		// Arrange: each shard can hold a single node
+		PatriciaTreeNodeCache cache(Num_Shards, 0);
+		auto nodes = CreateBranchNodesInSameShard(2);
+		cache.insert(nodes[0]);
+
+		// Act:
+		cache.insert(nodes[1]);
+
+		// Assert:
+		EXPECT_EQ(1u, cache.size());
+		AssertNotCached(cache, nodes[0]);
+		AssertCached(cache, nodes[1]);
+	}
+
+	TEST(TEST_CLASS, InsertEvictsNodesInInsertionOrderWhenAllNodesAreReferenced) {
+		// Arrange: each shard can hold two nodes
+		PatriciaTreeNodeCache cache(2 * Num_Shards, 0);
+		auto nodes = CreateBranchNodesInSameShard(3);
+		cache.insert(nodes[0]);
+		cache.insert(nodes[1]);
+
+		// Act:
+		cache.insert(nodes[2]);
+
+		// Assert:
+		EXPECT_EQ(2u, cache.size());
+		AssertNotCached(cache, nodes[0]);
+		AssertCached(cache, nodes[1]);
+		AssertCached(cache, nodes[2]);
+	}
+
+	// endregion
+
+	// region pin / unpin
+
+	TEST(TEST_CLASS, PinnedNodeIsNotEvicted) {
+		// Arrange:
+		PatriciaTreeNodeCache cache(Num_Shards, 0);
+		auto nodes = CreateBranchNodesInSameShard(2);
+		cache.insert(nodes[0]);
+
+		// Act:
+		cache.pin(nodes[0].hash());
+		cache.insert(nodes[1]);
+
+		// Assert:
+		EXPECT_EQ(1u, cache.size());
+		EXPECT_EQ(1u, cache.numPinned());
+		AssertCached(cache, nodes[0]);
+		AssertNotCached(cache, nodes[1]);
+	}
+
+	TEST(TEST_CLASS, NodeIsPinnedUntilAllPinsAreRemoved) {
+		// Arrange:
+		PatriciaTreeNodeCache cache(Num_Shards, 0);
+		auto nodes = CreateBranchNodesInSameShard(2);
+		cache.insert(nodes[0]);
+
+		// Act:
+		cache.pin(nodes[0].hash());
+		cache.pin(nodes[0].hash());
+		cache.unpin(nodes[0].hash());
+		cache.insert(nodes[1]);
+
+		// Assert:
+		EXPECT_EQ(1u, cache.numPinned());
+		AssertCached(cache, nodes[0]);
+		AssertNotCached(cache, nodes[1]);
+	}
+
+	TEST(TEST_CLASS, UnpinnedNodeCanBeEvicted) {
+		// Arrange:
+		PatriciaTreeNodeCache cache(Num_Shards, 0);
+		auto nodes = CreateBranchNodesInSameShard(2);
+		cache.insert(nodes[0]);
+
+		// Act:
+		cache.pin(nodes[0].hash());
+		cache.unpin(nodes[0].hash());
+		cache.unpin(nodes[0].hash());
+		cache.insert(nodes[1]);
+
+		// Assert:
+		EXPECT_EQ(0u, cache.numPinned());
+		AssertNotCached(cache, nodes[0]);
+		AssertCached(cache, nodes[1]);
+	}
+
+	TEST(TEST_CLASS, PinHasNoEffectWhenNodeIsNotCached) {
+		// Arrange:
+		PatriciaTreeNodeCache cache(Num_Shards, 0);
+		auto nodes = CreateBranchNodesInSameShard(2);
+
+		// Act:
+		cache.pin(nodes[0].hash());
+		cache.insert(nodes[0]);
+		cache.insert(nodes[1]);
+
+		// Assert:
+		EXPECT_EQ(0u, cache.numPinned());
+		AssertNotCached(cache, nodes[0]);
+		AssertCached(cache, nodes[1]);
+	}
+
+	// endregion
+}}
@@ -20,6 +20,7 @@
 **/
 
 #include "catapult/cache_db/PatriciaTreeRdbDataSource.h"
+#include "catapult/cache_db/PatriciaTreeNodeCache.h"
 #include "tests/test/nodeps/Filesystem.h"
 #include "tests/test/tree/PatriciaTreeDataSourceTests.h"
 
@@ -74,4 +75,194 @@ namespace catapult { namespace cache {
 	}
 
 	DEFINE_PATRICIA_TREE_DATA_SOURCE_TESTS(RocksDataSourceTraits)
+
+	// region node cache
+
+	namespace {
+		class NodeCacheTestContext {
+		public:
+			explicit NodeCacheTestContext(size_t numPinnedLevels = 0)
+					: m_db(DefaultSettings(m_dbDirGuard.name()))
+					, m_container(m_db, 0)
+					, m_nodeCache(100, numPinnedLevels) {
+				m_container.setSize(0);
+			}
+
+		public:
+			auto& container() {
+				return m_container;
+			}
+
+			auto& nodeCache() {
+				return m_nodeCache;
+			}
+
+		private:
+			test::TempDirectoryGuard m_dbDirGuard;
+			RocksDatabase m_db;
+			PatriciaTreeContainer m_container;
+			PatriciaTreeNodeCache m_nodeCache;
+		};
+
+		tree::LeafTreeNode CreateRandomLeafNode() {
+			return tree::LeafTreeNode(tree::TreeNodePath(test::Random()), test::GenerateRandomByteArray<Hash256>());
+		}
+
+		tree::BranchTreeNode CreateBranchNode(const std::vector<std::pair<Hash256, size_t>>& links) {
+			tree::BranchTreeNode node(tree::TreeNodePath(test::Random()));
+			for (const auto& link : links)
+				node.setLink(link.first, link.second);
+
+			return node;
+		}
+	}
+
+	TEST(TEST_CLASS, SetAddsBranchNodesToNodeCache) {
+		// Arrange:
+		NodeCacheTestContext context;
+		PatriciaTreeRdbDataSource dataSource(context.container(), &context.nodeCache());
+
+		auto leafNode = CreateRandomLeafNode();
+		auto branchNode = CreateBranchNode({ { leafNode.hash(), 2 } });
+
+		// Act:
+		dataSource.set(leafNode);
+		dataSource.set(branchNode);
+
+		// Assert: only the branch node is cached
+		EXPECT_EQ(1u, context.nodeCache().size());
+		EXPECT_EQ(branchNode.hash(), context.nodeCache().find(branchNode.hash()).hash());
+	}
+
+	TEST(TEST_CLASS, GetAddsLoadedBranchNodesToNodeCache) {
+		// Arrange: save nodes without node cache
+		NodeCacheTestContext context;
+		auto leafNode = CreateRandomLeafNode();
+		auto branchNode = CreateBranchNode({ { leafNode.hash(), 2 } });
+		{
+			PatriciaTreeRdbDataSource dataSource(context.container());
+			dataSource.set(leafNode);
+			dataSource.set(branchNode);
+		}
+
+		PatriciaTreeRdbDataSource dataSource(context.container(), &context.nodeCache());
+
+		// Act:
+		auto loadedLeafNode = dataSource.get(leafNode.hash());
+		auto loadedBranchNode = dataSource.get(branchNode.hash());
+
+		// Assert:
+		EXPECT_EQ(leafNode.hash(), loadedLeafNode.hash());
+		EXPECT_EQ(branchNode.hash(), loadedBranchNode.hash());
+
+		EXPECT_EQ(1u, context.nodeCache().size());
+		EXPECT_EQ(0u, context.nodeCache().numHits());
+		EXPECT_EQ(2u, context.nodeCache().numMisses());
+	}
+
+	TEST(TEST_CLASS, GetReturnsNodeFromNodeCacheWhenCached) {
+		// Arrange: only add node to node cache
+		NodeCacheTestContext context;
+		auto branchNode = CreateBranchNode({ { test::GenerateRandomByteArray<Hash256>(), 2 } });
+		context.nodeCache().insert(tree::TreeNode(branchNode));
+
+		PatriciaTreeRdbDataSource dataSource(context.container(), &context.nodeCache());
+
+		// Act:
+		auto node = dataSource.get(branchNode.hash());
+
+		// Assert:
+		EXPECT_EQ(0u, dataSource.size());
+		EXPECT_EQ(branchNode.hash(), node.hash());
+		EXPECT_EQ(1u, context.nodeCache().numHits());
+	}
+
+	namespace {
+		struct SeededTree {
+			Hash256 RootHash;
+			std::vector<Hash256> LevelOneHashes;
+		};
+
+		// root branch => two branches => two leaves
+		SeededTree SeedTree(PatriciaTreeRdbDataSource& dataSource) {
+			auto leafNode1 = CreateRandomLeafNode();
+			auto leafNode2 = CreateRandomLeafNode();
+			auto branchNode1 = CreateBranchNode({ { leafNode1.hash(), 0 } });
+			auto branchNode2 = CreateBranchNode({ { leafNode2.hash(), 1 } });
+			auto rootNode = CreateBranchNode({ { branchNode1.hash(), 3 }, { branchNode2.hash(), 4 } });
+
+			for (const auto& leafNode : { leafNode1, leafNode2 })
+				dataSource.set(leafNode);
+
+			for (const auto& branchNode : { branchNode1, branchNode2, rootNode })
+				dataSource.set(branchNode);
+
+			return { rootNode.hash(), { branchNode1.hash(), branchNode2.hash() } };
+		}
+
+		void AssertPinTopLevels(size_t numPinnedLevels, size_t expectedNumPinned) {
+			// Arrange:
+			NodeCacheTestContext context(numPinnedLevels);
+			PatriciaTreeRdbDataSource dataSource(context.container(), &context.nodeCache());
+			auto seededTree = SeedTree(dataSource);
+
+			// Act:
+			dataSource.pinTopLevels(seededTree.RootHash);
+
+			// Assert:
+			EXPECT_EQ(expectedNumPinned, context.nodeCache().numPinned()) << "levels " << numPinnedLevels;
+		}
+	}
+
+	TEST(TEST_CLASS, PinTopLevelsPinsBranchNodesInTopLevels) {
+		AssertPinTopLevels(0, 0);
+		AssertPinTopLevels(1, 1);
+		AssertPinTopLevels(2, 3);
+		AssertPinTopLevels(3, 3);
+	}
+
+	TEST(TEST_CLASS, PinTopLevelsUnpinsPreviouslyPinnedNodes) {
+		// Arrange:
+		NodeCacheTestContext context(2);
+		PatriciaTreeRdbDataSource dataSource(context.container(), &context.nodeCache());
+		auto seededTree = SeedTree(dataSource);
+		dataSource.pinTopLevels(seededTree.RootHash);
+
+		// Act: pin subtree
+		dataSource.pinTopLevels(seededTree.LevelOneHashes[0]);
+
+		// Assert:
+		EXPECT_EQ(1u, context.nodeCache().numPinned());
+	}
+
+	TEST(TEST_CLASS, PinTopLevelsHasNoEffectWithoutNodeCache) {
+		// Arrange:
+		NodeCacheTestContext context(2);
+		PatriciaTreeRdbDataSource dataSource(context.container());
+		auto seededTree = SeedTree(dataSource);
+
+		// Act:
+		dataSource.pinTopLevels(seededTree.RootHash);
+
+		// Assert:
+		EXPECT_EQ(0u, context.nodeCache().size());
+	}
+
+	TEST(TEST_CLASS, DestructorUnpinsAllPinnedNodes) {
+		// Arrange:
+		NodeCacheTestContext context(2);
+		{
+			PatriciaTreeRdbDataSource dataSource(context.container(), &context.nodeCache());
+			dataSource.pinTopLevels(SeedTree(dataSource).RootHash);
+
+			// Sanity:
+			EXPECT_EQ(3u, context.nodeCache().numPinned());
+		}
+
+		// Assert:
+		EXPECT_EQ(0u, context.nodeCache().numPinned());
+		EXPECT_EQ(3u, context.nodeCache().size());
+	}
+
+	// endregion
 }}
@@ -82,6 +82,15 @@ namespace catapult { namespace cache {
 			RdbDataIterator* pIterator;
 		};
 
+		struct MultiFindParamsType {
+		public:
+			explicit MultiFindParamsType(const std::vector<RawBuffer>& keys) : Keys(keys)
+			{}
+
+		public:
+			std::vector<RawBuffer> Keys;
+		};
+
 		struct PruneParamsType {
 		public:
 			explicit PruneParamsType(uint64_t boundary) : Boundary(boundary)
@@ -115,6 +124,15 @@ namespace catapult { namespace cache {
 				iterator.setFound(IsKeyFound);
 			}
 
+			void find(const std::vector<RawBuffer>& keys, std::vector<RdbDataIterator>& iterators) const {
+				MultiFindParams.push(keys);
+
+				// only mark keys with even indexes as found
+				iterators.resize(keys.size());
+				for (auto i = 0u; i < keys.size(); ++i)
+					iterators[i].setFound(0 == i % 2);
+			}
+
 			auto prune(uint64_t pruningBoundary) {
 				PruneParams.push(pruningBoundary);
 				return NumPruned;
@@ -129,6 +147,7 @@ namespace catapult { namespace cache {
 
 			test::ParamsCapture<InsertParamsType> InsertParams;
 			mutable test::ParamsCapture<FindParamsType> FindParams;
+			mutable test::ParamsCapture<MultiFindParamsType> MultiFindParams;
 			test::ParamsCapture<PruneParamsType> PruneParams;
 			test::ParamsCapture<RemoveParamsType> RemoveParams;
 		};
@@ -152,6 +171,10 @@ namespace catapult { namespace cache {
 				m_db.find(key, iterator);
 			}
 
+			void find(const std::vector<RawBuffer>& keys, std::vector<RdbDataIterator>& iterators) const {
+				m_db.find(keys, iterators);
+			}
+
 			size_t prune(uint64_t pruningBoundary) {
 				return m_db.prune(pruningBoundary);
 			}
@@ -236,6 +259,48 @@ namespace catapult { namespace cache {
 		EXPECT_EQ(&iter.dbIterator(), params.pIterator);
 	}
 
+	TEST(TEST_CLASS, MultiFindSerializesKeysAndForwardsToContainer) {
+		// Arrange:
+		MockDb db;
+		auto container = CreateContainer(db);
+
+		// Act:
+		std::vector<test::StringKey> keys{ test::StringKey("hello"), test::StringKey("amazing"), test::StringKey("world") };
+		auto iters = container.find(keys);
+
+		// Assert: all keys were forwarded in a single call
+		ASSERT_EQ(1u, db.MultiFindParams.params().size());
+		const auto& params = db.MultiFindParams.params()[0];
+		ASSERT_EQ(3u, params.Keys.size());
+		for (auto i = 0u; i < keys.size(); ++i) {
+			EXPECT_EQ(test::AsBytePointer(keys[i].data()), params.Keys[i].pData) << "key at " << i;
+			EXPECT_EQ(keys[i].size(), params.Keys[i].Size) << "key at " << i;
+		}
+
+		// - single key find was not called
+		EXPECT_EQ(0u, db.FindParams.params().size());
+
+		// - iterators are ordered like keys
+		ASSERT_EQ(3u, iters.size());
+		EXPECT_NE(container.cend(), iters[0]);
+		EXPECT_EQ(container.cend(), iters[1]);
+		EXPECT_NE(container.cend(), iters[2]);
+	}
+
+	TEST(TEST_CLASS, MultiFindForwardsEmptyKeysToContainer) {
+		// Arrange:
+		MockDb db;
+		auto container = CreateContainer(db);
+
+		// Act:
+		auto iters = container.find(std::vector<test::StringKey>());
+
+		// Assert:
+		ASSERT_EQ(1u, db.MultiFindParams.params().size());
+		EXPECT_TRUE(db.MultiFindParams.params()[0].Keys.empty());
+		EXPECT_TRUE(iters.empty());
+	}
+
 	TEST(TEST_CLASS, PruneExtractsBoundaryFromKeyAndForwardsToContainer) {
 		// Arrange:
 		MockDb db;
@@ -0,0 +1,158 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/cache_db/RocksBackgroundWriter.h"
+#include "tests/TestHarness.h"
+#include <future>
+
+namespace catapult { namespace cache {
+
+#define TEST_CLASS RocksBackgroundWriterTests
+
+	// region constructor
+
+	TEST(TEST_CLASS, CannotCreateWriterWithZeroMaxPendingOperations) {
+		EXPECT_THROW(RocksBackgroundWriter(0), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, CanCreateWriter) {
+		// Act:
+		RocksBackgroundWriter writer(7);
+
+		// Assert:
+		EXPECT_EQ(7u, writer.maxPendingOperations());
+		EXPECT_EQ(0u, writer.numPendingOperations());
+	}
+
+	// endregion
+
+	// region post + drain
+
+	TEST(TEST_CLASS, DrainWaitsForAllPostedOperations) {
+		// Arrange:
+		RocksBackgroundWriter writer(10);
+		std::vector<size_t> ids;
+
+		// Act:
+		for (auto i = 0u; i < 5; ++i)
+			writer.post([&ids, i]() { ids.push_back(i); });
+
+		writer.drain();
+
+		// Assert: operations were executed in submission order
+		EXPECT_EQ(std::vector<size_t>({ 0, 1, 2, 3, 4 }), ids);
+		EXPECT_EQ(0u, writer.numPendingOperations());
+	}
+
+	TEST(TEST_CLASS, DrainReturnsImmediatelyWhenNoOperationsArePending) {
+		// Arrange:
+		RocksBackgroundWriter writer(10);
+
+		// Act + Assert:
+		EXPECT_NO_THROW(writer.drain());
+	}
+
+	TEST(TEST_CLASS, DestructorExecutesAllPendingOperations) {
+		// Arrange:
+		std::vector<size_t> ids;
+		std::promise<void> unblockPromise;
+		auto unblockFuture = unblockPromise.get_future().share();
+		{
+			RocksBackgroundWriter writer(10);
+			writer.post([unblockFuture]() { unblockFuture.wait(); });
+			for (auto i = 0u; i < 3; ++i)
+				writer.post([&ids, i]() { ids.push_back(i); });
+
+			// Sanity:
+			EXPECT_EQ(4u, writer.numPendingOperations());
+
+			// Act:
+			unblockPromise.set_value();
+		}
+
+		// Assert:
+		EXPECT_EQ(std::vector<size_t>({ 0, 1, 2 }), ids);
+	}
+
+	TEST(TEST_CLASS, PostBlocksWhenMaxPendingOperationsArePending) {
+		// Arrange: block the writer thread with first operation
+		RocksBackgroundWriter writer(2);
+		std::promise<void> unblockPromise;
+		auto unblockFuture = unblockPromise.get_future().share();
+		writer.post([unblockFuture]() { unblockFuture.wait(); });
+		writer.post([]() {});
+
+		// Act:
+		auto postFuture = std::async(std::launch::async, [&writer]() { writer.post([]() {}); });
+		auto status = postFuture.wait_for(std::chrono::milliseconds(50));
+
+		// Assert:
+		EXPECT_EQ(std::future_status::timeout, status);
+		EXPECT_EQ(2u, writer.numPendingOperations());
+
+		// Act: unblock the writer thread
+		unblockPromise.set_value();
+		postFuture.get();
+		writer.drain();
+
+		// Assert:
+		EXPECT_EQ(0u, writer.numPendingOperations());
+	}
+
+	// endregion
+
+	// region failure
+
+	namespace {
+		void PostFailingOperation(RocksBackgroundWriter& writer, std::vector<size_t>& ids) {
+			writer.post([&ids]() { ids.push_back(1); });
+			writer.post([]() { CATAPULT_THROW_RUNTIME_ERROR("write failed"); });
+			writer.post([&ids]() { ids.push_back(3); });
+		}
+	}
+
+	TEST(TEST_CLASS, DrainRethrowsFailure) {
+		// Arrange:
+		RocksBackgroundWriter writer(10);
+		std::vector<size_t> ids;
+		PostFailingOperation(writer, ids);
+
+		// Act + Assert: operations after failed operation were discarded
+		EXPECT_THROW(writer.drain(), catapult_runtime_error);
+		EXPECT_EQ(std::vector<size_t>({ 1 }), ids);
+		EXPECT_EQ(0u, writer.numPendingOperations());
+	}
+
+	TEST(TEST_CLASS, PostRethrowsFailure) {
+		// Arrange:
+		RocksBackgroundWriter writer(10);
+		std::vector<size_t> ids;
+		PostFailingOperation(writer, ids);
+		EXPECT_THROW(writer.drain(), catapult_runtime_error);
+
+		// Act + Assert: operation is not executed
+		EXPECT_THROW(writer.post([&ids]() { ids.push_back(4); }), catapult_runtime_error);
+		EXPECT_THROW(writer.drain(), catapult_runtime_error);
+		EXPECT_EQ(std::vector<size_t>({ 1 }), ids);
+	}
+
+	// endregion
+}}
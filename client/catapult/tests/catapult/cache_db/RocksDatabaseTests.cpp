@@ -20,6 +20,8 @@
 **/
 
 #include "catapult/cache_db/RocksDatabase.h"
+#include "catapult/cache_db/RocksBackgroundWriter.h"
+#include "catapult/cache_db/RocksWriteQueue.h"
 #include "catapult/io/FileLock.h"
 #include "catapult/io/RawFile.h"
 #include "tests/catapult/cache_db/test/RdbTestUtils.h"
@@ -27,6 +29,7 @@
 #include "tests/test/nodeps/Filesystem.h"
 #include "tests/TestHarness.h"
 #include <filesystem>
+#include <future>
 
 namespace catapult { namespace cache {
 
@@ -114,6 +117,76 @@ namespace catapult { namespace cache {
 		EXPECT_TRUE(database.canPrune());
 	}
 
+	namespace {
+		auto CreateTunedSettings(const std::string& databaseDirectory, const std::shared_ptr<RocksBlockCache>& pBlockCache) {
+			auto config = config::NodeConfiguration::CacheDatabaseSubConfiguration();
+			config.BlockCacheSize = utils::FileSize::FromMegabytes(8);
+			config.DefaultColumnFamily.BloomFilterBitsPerKey = 10;
+			config.DefaultColumnFamily.BloomFilterPrefixSize = 4;
+			config.DefaultColumnFamily.Compression = config::CacheDatabaseCompression::None;
+			config.DefaultColumnFamily.BottommostCompression = config::CacheDatabaseCompression::None;
+
+			auto& columnFamilyConfig = config.ColumnFamilyOverrides["*:foo"];
+			columnFamilyConfig.BloomFilterBitsPerKey = 16;
+			columnFamilyConfig.EnablePartitionedIndexFilters = true;
+			columnFamilyConfig.PinL0FilterAndIndexBlocks = true;
+
+			return RocksDatabaseSettings(databaseDirectory, config, { "default", "foo" }, FilterPruningMode::Disabled, pBlockCache);
+		}
+
+		void AssertCanWriteAndReadAllColumns(RocksDatabase& database) {
+			// Act:
+			database.put(0, "hello", "amazing");
+			database.put(1, "hello", "world");
+			database.flush();
+
+			RdbDataIterator iter1;
+			database.get(0, "hello", iter1);
+
+			RdbDataIterator iter2;
+			database.get(1, "hello", iter2);
+
+			// Assert:
+			test::AssertIteratorValue("amazing", iter1);
+			test::AssertIteratorValue("world", iter2);
+		}
+	}
+
+	TEST(TEST_CLASS, CanOpenDatabaseWithTunedColumnFamilies) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard;
+
+		// Act:
+		RocksDatabase database(CreateTunedSettings(dbDirGuard.name(), nullptr));
+
+		// Assert:
+		EXPECT_EQ((std::vector<std::string>{ "default", "foo" }), database.columnFamilyNames());
+		AssertCanWriteAndReadAllColumns(database);
+	}
+
+	TEST(TEST_CLASS, CanOpenMultipleDatabasesWithSharedBlockCache) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard;
+		auto pBlockCache = std::make_shared<RocksBlockCache>(utils::FileSize::FromMegabytes(8));
+
+		// Act:
+		RocksDatabase database1(CreateTunedSettings(dbDirGuard.name() + "/alpha", pBlockCache));
+		RocksDatabase database2(CreateTunedSettings(dbDirGuard.name() + "/beta", pBlockCache));
+
+		// Assert:
+		AssertCanWriteAndReadAllColumns(database1);
+		AssertCanWriteAndReadAllColumns(database2);
+	}
+
+	TEST(TEST_CLASS, CanCreateBlockCache) {
+		// Act:
+		RocksBlockCache blockCache(utils::FileSize::FromMegabytes(3));
+
+		// Assert:
+		EXPECT_EQ(utils::FileSize::FromMegabytes(3), blockCache.capacity());
+		EXPECT_TRUE(!!blockCache.cache());
+	}
+
 	TEST(TEST_CLASS, CanCreatePlaceholderDatabase) {
 		// Act:
 		RocksDatabase database;
@@ -384,6 +457,88 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region multiGet
+
+	TEST(TEST_CLASS, DefaultCreatedRdbDoesNotAllowMultiGet) {
+		// Arrange:
+		RocksDatabase database;
+
+		// Act + Assert:
+		std::vector<RdbDataIterator> iters;
+		EXPECT_THROW(database.multiGet(0, { "hello" }, iters), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, MultiGetWithNoKeysReturnsNoResults) {
+		// Arrange:
+		test::RdbTestContext context(DefaultSettings());
+		auto& database = context.database();
+
+		// Act:
+		std::vector<RdbDataIterator> iters(3);
+		database.multiGet(0, {}, iters);
+
+		// Assert:
+		EXPECT_TRUE(iters.empty());
+	}
+
+	TEST(TEST_CLASS, CanReadFromDbWithMultiGet_ExistentAndNonexistent) {
+		// Arrange:
+		test::RdbTestContext context(DefaultSettings(), [](auto& db, const auto& columns) {
+			db.Put(rocksdb::WriteOptions(), columns[0], "hello", "amazing");
+			db.Put(rocksdb::WriteOptions(), columns[0], "world", "awesome");
+		});
+		auto& database = context.database();
+
+		// Act:
+		std::vector<RdbDataIterator> iters;
+		database.multiGet(0, { "world", "nonexistent", "hello" }, iters);
+
+		// Assert: results are ordered like keys
+		ASSERT_EQ(3u, iters.size());
+		test::AssertIteratorValue("awesome", iters[0]);
+		EXPECT_EQ(RdbDataIterator::End(), iters[1]);
+		test::AssertIteratorValue("amazing", iters[2]);
+	}
+
+	TEST(TEST_CLASS, CanReadFromDbWithMultiGet_DifferentColumns) {
+		// Arrange:
+		test::RdbTestContext context(MultiColumnSettings(), [](auto& db, const auto& columns) {
+			db.Put(rocksdb::WriteOptions(), columns[0], "hello", "amazing");
+			db.Put(rocksdb::WriteOptions(), columns[1], "hello", "awesome");
+			db.Put(rocksdb::WriteOptions(), columns[1], "world", "incredible");
+		});
+		auto& database = context.database();
+
+		// Act:
+		std::vector<RdbDataIterator> iters;
+		database.multiGet(1, { "hello", "world" }, iters);
+
+		// Assert:
+		ASSERT_EQ(2u, iters.size());
+		test::AssertIteratorValue("awesome", iters[0]);
+		test::AssertIteratorValue("incredible", iters[1]);
+	}
+
+	TEST(TEST_CLASS, MultiGetReplacesPreviousResults) {
+		// Arrange:
+		test::RdbTestContext context(DefaultSettings(), [](auto& db, const auto& columns) {
+			db.Put(rocksdb::WriteOptions(), columns[0], "hello", "amazing");
+		});
+		auto& database = context.database();
+
+		std::vector<RdbDataIterator> iters;
+		database.multiGet(0, { "hello", "hello" }, iters);
+
+		// Act:
+		database.multiGet(0, { "nonexistent" }, iters);
+
+		// Assert:
+		ASSERT_EQ(1u, iters.size());
+		EXPECT_EQ(RdbDataIterator::End(), iters[0]);
+	}
+
+	// endregion
+
 	// region iterators
 
 	namespace {
@@ -496,6 +651,470 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region shared database
+
+	namespace {
+		auto CreateSharedDatabase(const std::string& databaseDirectory) {
+			auto config = config::NodeConfiguration::CacheDatabaseSubConfiguration();
+			config.MaxWriteBatchSize = utils::FileSize::FromKilobytes(100);
+			return std::make_shared<RocksSharedDatabase>(databaseDirectory, config, nullptr);
+		}
+
+		auto CreateSharedSettings(
+				const std::string& cacheName,
+				const std::shared_ptr<RocksSharedDatabase>& pSharedDatabase,
+				FilterPruningMode pruningMode = FilterPruningMode::Disabled) {
+			auto databaseDirectory = pSharedDatabase->databaseDirectory() + "/" + cacheName;
+			return RocksDatabaseSettings(databaseDirectory, { "default", "foo" }, pruningMode, pSharedDatabase);
+		}
+
+		bool Contains(RocksDatabase& database, size_t columnId, const std::string& key) {
+			RdbDataIterator iter;
+			database.get(columnId, key, iter);
+			return RdbDataIterator::End() != iter;
+		}
+	}
+
+	TEST(TEST_CLASS, SharedDatabaseCanHostMultipleCacheDatabases) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard;
+		auto pSharedDatabase = CreateSharedDatabase(dbDirGuard.name());
+		RocksDatabase database1(CreateSharedSettings("alpha", pSharedDatabase));
+		RocksDatabase database2(CreateSharedSettings("beta", pSharedDatabase));
+
+		// Act:
+		database1.put(0, "hello", "amazing");
+		database1.put(1, "hello", "world");
+		database2.put(1, "hello", "moon");
+		database1.flush();
+		database2.flush();
+
+		// Assert: databases with same column family names do not collide
+		RdbDataIterator iter;
+		database1.get(0, "hello", iter);
+		test::AssertIteratorValue("amazing", iter);
+		database1.get(1, "hello", iter);
+		test::AssertIteratorValue("world", iter);
+
+		EXPECT_FALSE(Contains(database2, 0, "hello"));
+		database2.get(1, "hello", iter);
+		test::AssertIteratorValue("moon", iter);
+	}
+
+	TEST(TEST_CLASS, SharedDatabaseFlushWritesImmediatelyOutsideOfCommit) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard;
+		auto pSharedDatabase = CreateSharedDatabase(dbDirGuard.name());
+		RocksDatabase database(CreateSharedSettings("alpha", pSharedDatabase));
+
+		// Act:
+		database.put(0, "hello", "amazing");
+		database.flush();
+
+		// Assert:
+		EXPECT_FALSE(pSharedDatabase->isCommitting());
+		EXPECT_TRUE(Contains(database, 0, "hello"));
+	}
+
+	TEST(TEST_CLASS, SharedDatabaseDefersAllWritesUntilCommit) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard;
+		auto pSharedDatabase = CreateSharedDatabase(dbDirGuard.name());
+		RocksDatabase database1(CreateSharedSettings("alpha", pSharedDatabase));
+		RocksDatabase database2(CreateSharedSettings("beta", pSharedDatabase));
+
+		// Act:
+		pSharedDatabase->beginCommit();
+		database1.put(0, "hello", "amazing");
+		database1.flush();
+		database2.put(1, "hello", "world");
+		database2.flush();
+
+		// Assert: nothing is written during commit
+		EXPECT_TRUE(pSharedDatabase->isCommitting());
+		EXPECT_FALSE(Contains(database1, 0, "hello"));
+		EXPECT_FALSE(Contains(database2, 1, "hello"));
+
+		// Act:
+		pSharedDatabase->commit();
+
+		// Assert: everything is written after commit
+		EXPECT_FALSE(pSharedDatabase->isCommitting());
+		EXPECT_TRUE(Contains(database1, 0, "hello"));
+		EXPECT_TRUE(Contains(database2, 1, "hello"));
+	}
+
+	TEST(TEST_CLASS, SharedDatabaseCommitGuardCommitWritesAllPendingChanges) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard;
+		auto pSharedDatabase = CreateSharedDatabase(dbDirGuard.name());
+		RocksDatabase database(CreateSharedSettings("alpha", pSharedDatabase));
+
+		// Act:
+		{
+			RocksSharedDatabaseCommitGuard guard(pSharedDatabase.get());
+			database.put(0, "hello", "amazing");
+			database.flush();
+
+			// Sanity:
+			EXPECT_TRUE(pSharedDatabase->isCommitting());
+			EXPECT_FALSE(Contains(database, 0, "hello"));
+
+			guard.commit();
+		}
+
+		// Assert:
+		EXPECT_FALSE(pSharedDatabase->isCommitting());
+		EXPECT_TRUE(Contains(database, 0, "hello"));
+	}
+
+	namespace {
+		void AssertAbandonedCommitLeavesNothingToFlush(const std::shared_ptr<RocksSharedDatabase>& pSharedDatabase) {
+			// Arrange:
+			RocksDatabase database1(CreateSharedSettings("alpha", pSharedDatabase));
+			RocksDatabase database2(CreateSharedSettings("beta", pSharedDatabase));
+
+			// - first sub cache commits successfully and second sub cache commit throws
+			auto failingCommit = [&pSharedDatabase, &database1, &database2]() {
+				RocksSharedDatabaseCommitGuard guard(pSharedDatabase.get());
+				database1.put(0, "hello", "amazing");
+				database1.flush();
+
+				database2.put(1, "hello", "world");
+				CATAPULT_THROW_RUNTIME_ERROR("sub cache commit failed");
+			};
+
+			// Act:
+			EXPECT_THROW(failingCommit(), catapult_runtime_error);
+			pSharedDatabase->flush();
+			pSharedDatabase->writeQueue().drain();
+
+			// Assert: commit is no longer in progress and no changes from the failed commit are written
+			EXPECT_FALSE(pSharedDatabase->isCommitting());
+			EXPECT_FALSE(Contains(database1, 0, "hello"));
+			EXPECT_FALSE(Contains(database2, 1, "hello"));
+		}
+	}
+
+	TEST(TEST_CLASS, SharedDatabaseCommitGuardDiscardsPendingChangesWhenDestroyedWithoutCommit) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard;
+		auto pSharedDatabase = CreateSharedDatabase(dbDirGuard.name());
+
+		// Act + Assert:
+		AssertAbandonedCommitLeavesNothingToFlush(pSharedDatabase);
+	}
+
+	TEST(TEST_CLASS, SharedDatabaseCommitGuardDiscardsPendingChangesWhenDestroyedWithoutCommitWithBackgroundWriter) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard;
+		auto config = config::NodeConfiguration::CacheDatabaseSubConfiguration();
+		auto pWriter = std::make_shared<RocksBackgroundWriter>(10);
+		auto pSharedDatabase = std::make_shared<RocksSharedDatabase>(dbDirGuard.name(), config, nullptr, pWriter);
+
+		// Act + Assert:
+		AssertAbandonedCommitLeavesNothingToFlush(pSharedDatabase);
+	}
+
+	TEST(TEST_CLASS, SharedDatabaseCommitGuardDoesNotAffectNextCommitAfterAbandonedCommit) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard;
+		auto pSharedDatabase = CreateSharedDatabase(dbDirGuard.name());
+		RocksDatabase database(CreateSharedSettings("alpha", pSharedDatabase));
+
+		{
+			RocksSharedDatabaseCommitGuard guard(pSharedDatabase.get());
+			database.put(0, "hello", "amazing");
+		}
+
+		// Act:
+		{
+			RocksSharedDatabaseCommitGuard guard(pSharedDatabase.get());
+			database.put(0, "world", "awesome");
+			guard.commit();
+		}
+
+		// Assert: only changes from the successful commit are written
+		EXPECT_FALSE(Contains(database, 0, "hello"));
+		EXPECT_TRUE(Contains(database, 0, "world"));
+	}
+
+	TEST(TEST_CLASS, SharedDatabaseCommitGuardCanGuardNoDatabase) {
+		// Arrange:
+		RocksSharedDatabaseCommitGuard guard(nullptr);
+
+		// Act + Assert:
+		EXPECT_NO_THROW(guard.commit());
+	}
+
+	TEST(TEST_CLASS, SharedDatabaseCanBeReopened) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard;
+		{
+			auto pSharedDatabase = CreateSharedDatabase(dbDirGuard.name());
+			RocksDatabase database(CreateSharedSettings("alpha", pSharedDatabase));
+			database.put(1, "hello", "world");
+			database.flush();
+		}
+
+		// Act:
+		auto pSharedDatabase = CreateSharedDatabase(dbDirGuard.name());
+		RocksDatabase database(CreateSharedSettings("alpha", pSharedDatabase));
+
+		// Assert:
+		RdbDataIterator iter;
+		database.get(1, "hello", iter);
+		test::AssertIteratorValue("world", iter);
+	}
+
+	namespace {
+		size_t SeedAndPruneSharedDatabase(FilterPruningMode pruningMode) {
+			// Arrange: create 120 even keys (0 - 238)
+			test::TempDirectoryGuard dbDirGuard;
+			auto pSharedDatabase = CreateSharedDatabase(dbDirGuard.name());
+			RocksDatabase database(CreateSharedSettings("alpha", pSharedDatabase, pruningMode));
+			for (auto i = 0u; i < 120; ++i)
+				database.put(0, test::ToSlice(static_cast<uint64_t>(i * 2)), test::EvenKeyToValue(i * 2));
+
+			database.flush();
+
+			// Act: prune all keys < 200
+			return database.prune(0, 200);
+		}
+	}
+
+	TEST(TEST_CLASS, SharedDatabasePruneRemovesAllValuesBelowBoundaryWhenEnabled) {
+		// Act:
+		auto numPruned = SeedAndPruneSharedDatabase(FilterPruningMode::Enabled);
+
+		// Assert:
+		EXPECT_EQ(100u, numPruned);
+	}
+
+	TEST(TEST_CLASS, SharedDatabasePruneHasNoEffectWhenDisabled) {
+		// Act:
+		auto numPruned = SeedAndPruneSharedDatabase(FilterPruningMode::Disabled);
+
+		// Assert:
+		EXPECT_EQ(0u, numPruned);
+	}
+
+	// endregion
+
+	// region background writer
+
+	namespace {
+		auto CreateBatchConfiguration() {
+			auto config = config::NodeConfiguration::CacheDatabaseSubConfiguration();
+			config.MaxWriteBatchSize = utils::FileSize::FromKilobytes(100);
+			return config;
+		}
+
+		class BackgroundWriterTestContext {
+		public:
+			BackgroundWriterTestContext()
+					: m_pWriter(std::make_shared<RocksBackgroundWriter>(10))
+					, m_database(RocksDatabaseSettings(
+							m_dbDirGuard.name(),
+							CreateBatchConfiguration(),
+							{ "default", "foo" },
+							FilterPruningMode::Enabled,
+							nullptr,
+							m_pWriter))
+					, m_unblockFuture(m_unblockPromise.get_future().share())
+			{}
+
+			~BackgroundWriterTestContext() {
+				unblock();
+			}
+
+		public:
+			auto& writer() {
+				return *m_pWriter;
+			}
+
+			auto& database() {
+				return m_database;
+			}
+
+		public:
+			void block() {
+				m_pWriter->post([unblockFuture = m_unblockFuture]() { unblockFuture.wait(); });
+			}
+
+			void unblock() {
+				if (m_isUnblocked)
+					return;
+
+				m_unblockPromise.set_value();
+				m_isUnblocked = true;
+			}
+
+		private:
+			test::TempDirectoryGuard m_dbDirGuard;
+			std::shared_ptr<RocksBackgroundWriter> m_pWriter;
+			RocksDatabase m_database;
+			std::promise<void> m_unblockPromise;
+			std::shared_future<void> m_unblockFuture;
+			bool m_isUnblocked = false;
+		};
+	}
+
+	TEST(TEST_CLASS, BackgroundWriterWritesFlushedChanges) {
+		// Arrange:
+		BackgroundWriterTestContext context;
+
+		// Act:
+		context.database().put(1, "hello", "world");
+		context.database().flush();
+		context.writer().drain();
+
+		// Assert:
+		EXPECT_TRUE(Contains(context.database(), 1, "hello"));
+		EXPECT_EQ(0u, context.writer().numPendingOperations());
+	}
+
+	TEST(TEST_CLASS, BackgroundWriterPendingPutsAreReadable) {
+		// Arrange:
+		BackgroundWriterTestContext context;
+		context.block();
+
+		// Act:
+		context.database().put(0, "hello", "amazing");
+		context.database().put(1, "hello", "world");
+		context.database().flush();
+		context.database().put(1, "hello", "moon");
+		context.database().flush();
+
+		// Assert: newest pending values are returned
+		EXPECT_EQ(3u, context.writer().numPendingOperations());
+
+		RdbDataIterator iter;
+		context.database().get(0, "hello", iter);
+		test::AssertIteratorValue("amazing", iter);
+		context.database().get(1, "hello", iter);
+		test::AssertIteratorValue("moon", iter);
+	}
+
+	TEST(TEST_CLASS, BackgroundWriterPendingDeletesHideWrittenValues) {
+		// Arrange:
+		BackgroundWriterTestContext context;
+		context.database().put(1, "hello", "world");
+		context.database().flush();
+		context.writer().drain();
+		context.block();
+
+		// Act:
+		context.database().del(1, "hello");
+		context.database().flush();
+
+		// Assert:
+		EXPECT_EQ(2u, context.writer().numPendingOperations());
+		EXPECT_FALSE(Contains(context.database(), 1, "hello"));
+	}
+
+	TEST(TEST_CLASS, BackgroundWriterMultiGetReturnsPendingValues) {
+		// Arrange:
+		BackgroundWriterTestContext context;
+		context.database().put(0, "alpha", "first");
+		context.database().put(0, "beta", "second");
+		context.database().flush();
+		context.writer().drain();
+		context.block();
+
+		context.database().put(0, "alpha", "third");
+		context.database().del(0, "beta");
+		context.database().flush();
+
+		// Act:
+		std::vector<RdbDataIterator> iterators;
+		context.database().multiGet(0, { "alpha", "beta", "gamma" }, iterators);
+
+		// Assert:
+		ASSERT_EQ(3u, iterators.size());
+		test::AssertIteratorValue("third", iterators[0]);
+		EXPECT_EQ(RdbDataIterator::End(), iterators[1]);
+		EXPECT_EQ(RdbDataIterator::End(), iterators[2]);
+	}
+
+	namespace {
+		void AssertPendingChangesAreDiscardedWhenWriteFails(BackgroundWriterTestContext& context) {
+			// Arrange: block the writer with an operation that fails
+			std::promise<void> failPromise;
+			context.writer().post([failFuture = failPromise.get_future().share()]() {
+				failFuture.wait();
+				CATAPULT_THROW_RUNTIME_ERROR("write failed");
+			});
+
+			context.database().put(1, "hello", "moon");
+			context.database().del(1, "alpha");
+			context.database().flush();
+
+			// Sanity:
+			RdbDataIterator iter;
+			context.database().get(1, "hello", iter);
+			test::AssertIteratorValue("moon", iter);
+
+			// Act: fail the blocking operation, which discards the pending write
+			failPromise.set_value();
+			EXPECT_THROW(context.writer().drain(), catapult_runtime_error);
+		}
+	}
+
+	TEST(TEST_CLASS, BackgroundWriterPendingChangesAreNotReadableAfterWriteFails) {
+		// Arrange:
+		BackgroundWriterTestContext context;
+		context.database().put(1, "hello", "world");
+		context.database().put(1, "alpha", "beta");
+		context.database().flush();
+		context.writer().drain();
+
+		// Act:
+		AssertPendingChangesAreDiscardedWhenWriteFails(context);
+
+		// Assert: written values are returned
+		RdbDataIterator iter;
+		context.database().get(1, "hello", iter);
+		test::AssertIteratorValue("world", iter);
+
+		std::vector<RdbDataIterator> iterators;
+		context.database().multiGet(1, { "hello", "alpha" }, iterators);
+		ASSERT_EQ(2u, iterators.size());
+		test::AssertIteratorValue("world", iterators[0]);
+		test::AssertIteratorValue("beta", iterators[1]);
+	}
+
+	TEST(TEST_CLASS, BackgroundWriterPendingChangesAreClearedByFlushAfterWriteFails) {
+		// Arrange:
+		BackgroundWriterTestContext context;
+		AssertPendingChangesAreDiscardedWhenWriteFails(context);
+
+		// Act: flush rethrows the failure and discards the new changes too
+		context.database().put(1, "hello", "sun");
+		EXPECT_THROW(context.database().flush(), catapult_runtime_error);
+
+		// Assert:
+		EXPECT_FALSE(Contains(context.database(), 1, "hello"));
+	}
+
+	TEST(TEST_CLASS, BackgroundWriterPruneWaitsForPendingWrites) {
+		// Arrange:
+		BackgroundWriterTestContext context;
+		for (auto i = 0u; i < 120; ++i)
+			context.database().put(0, test::ToSlice(static_cast<uint64_t>(i * 2)), test::EvenKeyToValue(i * 2));
+
+		context.database().flush();
+
+		// Act: prune all keys < 200
+		auto numPruned = context.database().prune(0, 200);
+
+		// Assert:
+		EXPECT_EQ(100u, numPruned);
+		EXPECT_EQ(0u, context.writer().numPendingOperations());
+	}
+
+	// endregion
+
 	// region batch processing
 
 	namespace {
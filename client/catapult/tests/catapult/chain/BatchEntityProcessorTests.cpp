@@ -33,7 +33,11 @@ namespace catapult { namespace chain {
 	namespace {
 		class ProcessorTestContext {
 		public:
-			ProcessorTestContext() : m_processor(CreateBatchEntityProcessor(m_executionConfig.Config))
+			ProcessorTestContext() : ProcessorTestContext(StatePrefetcher())
+			{}
+
+			explicit ProcessorTestContext(const StatePrefetcher& prefetcher)
+					: m_processor(CreateProcessor(m_executionConfig.Config, prefetcher))
 			{}
 
 		public:
@@ -149,6 +153,12 @@ namespace catapult { namespace chain {
 				assertObserverEntities(entityInfos);
 			}
 
+		private:
+			static BatchEntityProcessor CreateProcessor(ExecutionConfiguration config, const StatePrefetcher& prefetcher) {
+				config.Prefetcher = prefetcher;
+				return CreateBatchEntityProcessor(config);
+			}
+
 		private:
 			test::MockExecutionConfiguration m_executionConfig;
 			BatchEntityProcessor m_processor;
@@ -245,6 +255,59 @@ namespace catapult { namespace chain {
 		AssertValidatorContext(capturedParams[i++].Context, Height(250), Timestamp(777));
 	}
 
+	// region prefetcher
+
+	namespace {
+		struct PrefetcherParams {
+			size_t NumCalls = 0;
+			size_t NumEntityInfos = 0;
+			const cache::CatapultCacheDelta* pCacheDelta = nullptr;
+		};
+
+		StatePrefetcher CreateCapturingPrefetcher(PrefetcherParams& params) {
+			return [&params](const auto& entityInfos, auto& cacheDelta) {
+				++params.NumCalls;
+				params.NumEntityInfos = entityInfos.size();
+				params.pCacheDelta = &cacheDelta;
+			};
+		}
+	}
+
+	TEST(TEST_CLASS, PrefetcherIsNotCalledWhenProcessingZeroEntities) {
+		// Arrange:
+		PrefetcherParams params;
+		ProcessorTestContext context(CreateCapturingPrefetcher(params));
+
+		// Act:
+		auto result = context.process(Height(246), Timestamp(721), model::WeakEntityInfos());
+
+		// Assert:
+		EXPECT_EQ(ValidationResult::Neutral, result);
+		EXPECT_EQ(0u, params.NumCalls);
+	}
+
+	TEST(TEST_CLASS, PrefetcherIsCalledOnceForAllEntities) {
+		// Arrange:
+		PrefetcherParams params;
+		ProcessorTestContext context(CreateCapturingPrefetcher(params));
+		auto pBlock = test::GenerateBlockWithTransactions(3);
+		auto entityInfos = ExtractEntityInfosFromBlock(*pBlock);
+
+		// Act:
+		auto result = context.process(Height(247), Timestamp(723), entityInfos);
+
+		// Assert: prefetcher does not affect processing
+		EXPECT_EQ(ValidationResult::Success, result);
+		context.assertCounters(4, 8, 8);
+		context.assertEntityInfos(entityInfos);
+
+		EXPECT_EQ(1u, params.NumCalls);
+		EXPECT_EQ(4u, params.NumEntityInfos);
+		EXPECT_TRUE(!!params.pCacheDelta);
+	}
+
+	// endregion
+
 #define SHORT_CIRCUIT_TRAITS_BASED_TEST(TEST_NAME) \
 	template<ValidationResult TResult> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
 	TEST(TEST_CLASS, TEST_NAME##_Neutral) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<ValidationResult::Neutral>(); } \
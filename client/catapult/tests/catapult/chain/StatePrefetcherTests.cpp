@@ -0,0 +1,249 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/chain/StatePrefetcher.h"
+#include "catapult/cache/CatapultCache.h"
+#include "catapult/cache_core/AccountStateCache.h"
+#include "catapult/model/Address.h"
+#include "catapult/model/NotificationSubscriber.h"
+#include "catapult/model/Notifications.h"
+#include "tests/test/cache/CacheTestUtils.h"
+#include "tests/test/core/AddressTestUtils.h"
+#include "tests/test/core/ResolverTestUtils.h"
+#include "tests/test/core/mocks/MockNotificationPublisher.h"
+#include "tests/test/nodeps/Random.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace chain {
+
+#define TEST_CLASS StatePrefetcherTests
+
+	namespace {
+		constexpr auto Network_Identifier = model::NetworkIdentifier::Testnet;
+
+		// publishes all notifications raised by a custom function for each entity
+		class CustomNotificationPublisher : public model::NotificationPublisher {
+		public:
+			explicit CustomNotificationPublisher(const consumer<model::NotificationSubscriber&>& publish) : m_publish(publish)
+			{}
+
+		public:
+			void publish(const model::WeakEntityInfo&, model::NotificationSubscriber& sub) const override {
+				m_publish(sub);
+			}
+
+		private:
+			consumer<model::NotificationSubscriber&> m_publish;
+		};
+
+		class EntitiesHolder {
+		public:
+			explicit EntitiesHolder(size_t count) : m_entities(count) {
+				for (auto& entity : m_entities) {
+					entity.Network = Network_Identifier;
+					m_entityInfos.emplace_back(entity, m_hash);
+				}
+			}
+
+		public:
+			const model::WeakEntityInfos& entityInfos() const {
+				return m_entityInfos;
+			}
+
+		private:
+			std::vector<model::VerifiableEntity> m_entities;
+			Hash256 m_hash;
+			model::WeakEntityInfos m_entityInfos;
+		};
+
+		auto CollectKeys(size_t numEntities, const consumer<model::NotificationSubscriber&>& publish) {
+			EntitiesHolder holder(numEntities);
+			CustomNotificationPublisher publisher(publish);
+			return CollectStatePrefetchKeys(holder.entityInfos(), publisher, test::CreateResolverContextXor());
+		}
+
+		void AssertUnorderedEqual(const std::vector<Address>& expected, const std::vector<Address>& actual) {
+			EXPECT_EQ(model::AddressSet(expected.cbegin(), expected.cend()), model::AddressSet(actual.cbegin(), actual.cend()));
+			EXPECT_EQ(expected.size(), actual.size());
+		}
+
+		void AssertUnorderedEqual(const std::vector<MosaicId>& expected, const std::vector<MosaicId>& actual) {
+			EXPECT_EQ(std::set<MosaicId>(expected.cbegin(), expected.cend()), std::set<MosaicId>(actual.cbegin(), actual.cend()));
+			EXPECT_EQ(expected.size(), actual.size());
+		}
+	}
+
+	// region CollectStatePrefetchKeys
+
+	TEST(TEST_CLASS, CollectReturnsNoKeysWhenThereAreNoEntities) {
+		// Act:
+		auto numPublishCalls = 0u;
+		auto keys = CollectKeys(0, [&numPublishCalls](auto&) { ++numPublishCalls; });
+
+		// Assert:
+		EXPECT_EQ(0u, numPublishCalls);
+		EXPECT_TRUE(keys.Addresses.empty());
+		EXPECT_TRUE(keys.MosaicIds.empty());
+	}
+
+	TEST(TEST_CLASS, CollectIgnoresUnrelatedNotifications) {
+		// Act:
+		auto keys = CollectKeys(3, [](auto& sub) {
+			sub.notify(model::EntityNotification(Network_Identifier, model::EntityType(), 1, 1, 1));
+		});
+
+		// Assert:
+		EXPECT_TRUE(keys.Addresses.empty());
+		EXPECT_TRUE(keys.MosaicIds.empty());
+	}
+
+	TEST(TEST_CLASS, CollectExtractsAddressesFromAccountNotifications) {
+		// Arrange:
+		auto address1 = test::GenerateRandomByteArray<Address>();
+		auto address2 = test::GenerateRandomByteArray<Address>();
+		auto publicKey = test::GenerateRandomByteArray<Key>();
+
+		// Act:
+		auto keys = CollectKeys(1, [&address1, &address2, &publicKey](auto& sub) {
+			sub.notify(model::AccountAddressNotification(address1));
+			sub.notify(model::AccountAddressNotification(test::UnresolveXor(address2)));
+			sub.notify(model::AccountPublicKeyNotification(publicKey));
+		});
+
+		// Assert:
+		auto address3 = model::PublicKeyToAddress(publicKey, Network_Identifier);
+		AssertUnorderedEqual({ address1, address2, address3 }, keys.Addresses);
+		EXPECT_TRUE(keys.MosaicIds.empty());
+	}
+
+	TEST(TEST_CLASS, CollectExtractsAddressesAndMosaicIdsFromBalanceNotifications) {
+		// Arrange:
+		auto addresses = test::GenerateRandomDataVector<Address>(3);
+
+		// Act:
+		auto keys = CollectKeys(1, [&addresses](auto& sub) {
+			sub.notify(model::BalanceTransferNotification(
+					addresses[0],
+					test::UnresolveXor(addresses[1]),
+					test::UnresolveXor(MosaicId(123)),
+					Amount(10)));
+			sub.notify(model::BalanceDebitNotification(addresses[2], test::UnresolveXor(MosaicId(234)), Amount(20)));
+		});
+
+		// Assert:
+		AssertUnorderedEqual(addresses, keys.Addresses);
+		AssertUnorderedEqual({ MosaicId(123), MosaicId(234) }, keys.MosaicIds);
+	}
+
+	TEST(TEST_CLASS, CollectExtractsAddressesAndMosaicIdsFromMosaicRequiredNotifications) {
+		// Arrange:
+		auto address = test::GenerateRandomByteArray<Address>();
+
+		// Act:
+		auto keys = CollectKeys(1, [&address](auto& sub) {
+			sub.notify(model::MosaicRequiredNotification(test::UnresolveXor(address), test::UnresolveXor(MosaicId(345))));
+			sub.notify(model::MosaicRequiredNotification(address, MosaicId(456)));
+		});
+
+		// Assert:
+		AssertUnorderedEqual({ address }, keys.Addresses);
+		AssertUnorderedEqual({ MosaicId(345), MosaicId(456) }, keys.MosaicIds);
+	}
+
+	TEST(TEST_CLASS, CollectDeduplicatesKeysAcrossEntities) {
+		// Arrange:
+		auto addresses = test::GenerateRandomDataVector<Address>(2);
+
+		// Act:
+		auto keys = CollectKeys(4, [&addresses](auto& sub) {
+			sub.notify(model::BalanceTransferNotification(addresses[0], addresses[1], test::UnresolveXor(MosaicId(123)), Amount(10)));
+		});
+
+		// Assert:
+		AssertUnorderedEqual(addresses, keys.Addresses);
+		AssertUnorderedEqual({ MosaicId(123) }, keys.MosaicIds);
+	}
+
+	// endregion
+
+	// region CreateStatePrefetcher
+
+	namespace {
+		void RunPrefetcherTest(size_t numEntities, size_t numExpectedPublishCalls) {
+			// Arrange:
+			ExecutionContextConfiguration config;
+			config.ResolverContextFactory = [](const auto&) { return test::CreateResolverContextXor(); };
+
+			auto pPublisher = std::make_shared<mocks::MockNotificationPublisher>();
+			auto prefetcher = CreateStatePrefetcher(config, pPublisher);
+
+			auto cache = test::CreateEmptyCatapultCache();
+			auto cacheDelta = cache.createDelta();
+			EntitiesHolder holder(numEntities);
+
+			// Act:
+			prefetcher(holder.entityInfos(), cacheDelta);
+
+			// Assert:
+			EXPECT_EQ(numExpectedPublishCalls, pPublisher->numPublishCalls());
+		}
+	}
+
+	TEST(TEST_CLASS, PrefetcherBypassesPublisherWhenThereAreNoEntities) {
+		RunPrefetcherTest(0, 0);
+	}
+
+	TEST(TEST_CLASS, PrefetcherPublishesAllEntities) {
+		RunPrefetcherTest(3, 3);
+	}
+
+	// endregion
+
+	// region CreateDetachedStateLoader
+
+	TEST(TEST_CLASS, DetachedStateLoaderDoesNotModifyCache) {
+		// Arrange:
+		auto cache = test::CreateEmptyCatapultCache();
+		auto address = test::GenerateRandomByteArray<Address>();
+		{
+			auto cacheDelta = cache.createDelta();
+			cacheDelta.sub<cache::AccountStateCache>().addAccount(address, Height(1));
+			cache.commit(Height(1));
+		}
+
+		cache::StatePrefetchKeys keys;
+		keys.Addresses = { address, test::GenerateRandomByteArray<Address>() };
+		keys.MosaicIds = { test::GenerateRandomValue<MosaicId>() };
+
+		auto loader = CreateDetachedStateLoader(cache);
+
+		// Act:
+		loader(keys);
+
+		// Assert:
+		auto view = cache.createView();
+		const auto& accountStateCache = view.sub<cache::AccountStateCache>();
+		EXPECT_EQ(1u, accountStateCache.size());
+		EXPECT_TRUE(accountStateCache.contains(address));
+	}
+
+	// endregion
+}}
@@ -122,6 +122,9 @@ namespace catapult { namespace config {
 			EXPECT_TRUE(config.EnableAutoSyncCleanup);
 
 			EXPECT_EQ(100u, config.FileDatabaseBatchSize);
+			EXPECT_FALSE(config.EnableMemoryMappedBlockReads);
+			EXPECT_EQ(utils::FileSize::FromMegabytes(50), config.BlockElementCacheSize);
+			EXPECT_EQ(0u, config.BlockStorageCompressionLevel);
 
 			EXPECT_TRUE(config.EnableTransactionSpamThrottling);
 			EXPECT_EQ(Amount(10'000'000), config.TransactionSpamThrottlingMaxBoostFee);
@@ -129,6 +132,7 @@ namespace catapult { namespace config {
 			EXPECT_EQ(84u, config.MaxHashesPerSyncAttempt);
 			EXPECT_EQ(42u, config.MaxBlocksPerSyncAttempt);
 			EXPECT_EQ(utils::FileSize::FromMegabytes(100), config.MaxChainBytesPerSyncAttempt);
+			EXPECT_EQ(1u, config.StateHashCalculationInterval);
 
 			EXPECT_EQ(utils::TimeSpan::FromMinutes(10), config.ShortLivedCacheTransactionDuration);
 			EXPECT_EQ(utils::TimeSpan::FromMinutes(100), config.ShortLivedCacheBlockDuration);
@@ -140,6 +144,7 @@ namespace catapult { namespace config {
 			EXPECT_EQ(model::TransactionSelectionStrategy::Oldest, config.TransactionSelectionStrategy);
 			EXPECT_EQ(utils::FileSize::FromMegabytes(5), config.UnconfirmedTransactionsCacheMaxResponseSize);
 			EXPECT_EQ(utils::FileSize::FromMegabytes(20), config.UnconfirmedTransactionsCacheMaxSize);
+			EXPECT_EQ(1000u, config.MaxStatePathKeysPerRequest);
 
 			EXPECT_EQ(utils::TimeSpan::FromSeconds(10), config.ConnectTimeout);
 			EXPECT_EQ(utils::TimeSpan::FromSeconds(60), config.SyncTimeout);
@@ -155,9 +160,13 @@ namespace catapult { namespace config {
 			EXPECT_EQ(8192u, config.TransactionDisruptorSlotCount);
 			EXPECT_EQ(utils::FileSize::FromMegabytes(20), config.TransactionDisruptorMaxMemorySize);
 			EXPECT_EQ(10u, config.TransactionElementTraceInterval);
+			EXPECT_EQ(0u, config.TransactionDisruptorMaxCoalescedSize);
 
 			EXPECT_TRUE(config.EnableDispatcherAbortWhenFull);
 			EXPECT_TRUE(config.EnableDispatcherInputAuditing);
+			EXPECT_FALSE(config.EnableWorkStealingValidation);
+			EXPECT_EQ(16u, config.MinSignatureBatchSize);
+			EXPECT_EQ(32u, config.StatePrefetchBlockCount);
 
 			EXPECT_EQ(5'000u, config.MaxTrackedNodes);
 
@@ -179,6 +188,26 @@ namespace catapult { namespace config {
 
 			EXPECT_EQ(utils::FileSize::FromMegabytes(5), config.CacheDatabase.MaxWriteBatchSize);
 
+			EXPECT_FALSE(config.CacheDatabase.EnableSharedBlockCache);
+			EXPECT_FALSE(config.CacheDatabase.EnableSharedDatabase);
+
+			EXPECT_FALSE(config.CacheDatabase.EnableAsyncCommit);
+			EXPECT_EQ(64u, config.CacheDatabase.MaxPendingWrites);
+
+			EXPECT_EQ(4u, config.CacheDatabase.StateHashThreadCount);
+
+			EXPECT_EQ(100'000u, config.CacheDatabase.TreeNodeCacheSize);
+			EXPECT_EQ(2u, config.CacheDatabase.TreeNodeCachePinnedLevels);
+
+			EXPECT_EQ(0u, config.CacheDatabase.DefaultColumnFamily.BloomFilterBitsPerKey);
+			EXPECT_EQ(0u, config.CacheDatabase.DefaultColumnFamily.BloomFilterPrefixSize);
+			EXPECT_EQ(CacheDatabaseCompression::Default, config.CacheDatabase.DefaultColumnFamily.Compression);
+			EXPECT_EQ(CacheDatabaseCompression::Default, config.CacheDatabase.DefaultColumnFamily.BottommostCompression);
+			EXPECT_FALSE(config.CacheDatabase.DefaultColumnFamily.EnablePartitionedIndexFilters);
+			EXPECT_FALSE(config.CacheDatabase.DefaultColumnFamily.PinL0FilterAndIndexBlocks);
+
+			EXPECT_TRUE(config.CacheDatabase.ColumnFamilyOverrides.empty());
+
 			EXPECT_EQ("", config.Local.Host);
 			EXPECT_EQ("", config.Local.FriendlyName);
 			EXPECT_EQ(ionet::GetCurrentServerVersion(), config.Local.Version);
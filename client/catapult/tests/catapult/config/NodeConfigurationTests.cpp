@@ -45,6 +45,9 @@ namespace catapult { namespace config {
 							{ "enableAutoSyncCleanup", "true" },
 
 							{ "fileDatabaseBatchSize", "888" },
+							{ "enableMemoryMappedBlockReads", "true" },
+							{ "blockElementCacheSize", "17MB" },
+							{ "blockStorageCompressionLevel", "7" },
 
 							{ "enableTransactionSpamThrottling", "true" },
 							{ "transactionSpamThrottlingMaxBoostFee", "54'123" },
@@ -52,6 +55,7 @@ namespace catapult { namespace config {
 							{ "maxHashesPerSyncAttempt", "74" },
 							{ "maxBlocksPerSyncAttempt", "50" },
 							{ "maxChainBytesPerSyncAttempt", "2MB" },
+							{ "stateHashCalculationInterval", "25" },
 
 							{ "shortLivedCacheTransactionDuration", "17h" },
 							{ "shortLivedCacheBlockDuration", "23m" },
@@ -63,6 +67,7 @@ namespace catapult { namespace config {
 							{ "transactionSelectionStrategy", "maximize-fee" },
 							{ "unconfirmedTransactionsCacheMaxResponseSize", "234KB" },
 							{ "unconfirmedTransactionsCacheMaxSize", "98MB" },
+							{ "maxStatePathKeysPerRequest", "321" },
 
 							{ "connectTimeout", "4m" },
 							{ "syncTimeout", "5m" },
@@ -78,9 +83,13 @@ namespace catapult { namespace config {
 							{ "transactionDisruptorSlotCount", "9876" },
 							{ "transactionDisruptorMaxMemorySize", "101KB" },
 							{ "transactionElementTraceInterval", "98" },
+							{ "transactionDisruptorMaxCoalescedSize", "345" },
 
 							{ "enableDispatcherAbortWhenFull", "true" },
 							{ "enableDispatcherInputAuditing", "true" },
+							{ "enableWorkStealingValidation", "true" },
+							{ "minSignatureBatchSize", "48" },
+							{ "statePrefetchBlockCount", "12" },
 
 							{ "maxTrackedNodes", "222" },
 
@@ -104,7 +113,36 @@ namespace catapult { namespace config {
 							{ "blockCacheSize", "111MB" },
 							{ "memtableMemoryBudget", "45MB" },
 
-							{ "maxWriteBatchSize", "17KB" }
+							{ "maxWriteBatchSize", "17KB" },
+
+							{ "enableSharedBlockCache", "true" },
+							{ "enableSharedDatabase", "true" },
+
+							{ "enableAsyncCommit", "true" },
+							{ "maxPendingWrites", "27" },
+
+							{ "stateHashThreadCount", "6" },
+
+							{ "treeNodeCacheSize", "1234" },
+							{ "treeNodeCachePinnedLevels", "3" },
+
+							{ "bloomFilterBitsPerKey", "10" },
+							{ "bloomFilterPrefixSize", "8" },
+							{ "compression", "lz4" },
+							{ "bottommostCompression", "zstd" },
+							{ "enablePartitionedIndexFilters", "true" },
+							{ "pinL0FilterAndIndexBlocks", "true" }
+						}
+					},
+					{
+						"cache_database:accountstatecache:patricia_tree",
+						{
+							{ "bloomFilterBitsPerKey", "16" },
+							{ "bloomFilterPrefixSize", "0" },
+							{ "compression", "none" },
+							{ "bottommostCompression", "lz4" },
+							{ "enablePartitionedIndexFilters", "false" },
+							{ "pinL0FilterAndIndexBlocks", "true" }
 						}
 					},
 					{
@@ -169,6 +207,9 @@ namespace catapult { namespace config {
 				EXPECT_FALSE(config.EnableAutoSyncCleanup);
 
 				EXPECT_EQ(0u, config.FileDatabaseBatchSize);
+				EXPECT_FALSE(config.EnableMemoryMappedBlockReads);
+				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.BlockElementCacheSize);
+				EXPECT_EQ(0u, config.BlockStorageCompressionLevel);
 
 				EXPECT_FALSE(config.EnableTransactionSpamThrottling);
 				EXPECT_EQ(Amount(), config.TransactionSpamThrottlingMaxBoostFee);
@@ -176,6 +217,7 @@ namespace catapult { namespace config {
 				EXPECT_EQ(0u, config.MaxHashesPerSyncAttempt);
 				EXPECT_EQ(0u, config.MaxBlocksPerSyncAttempt);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.MaxChainBytesPerSyncAttempt);
+				EXPECT_EQ(0u, config.StateHashCalculationInterval);
 
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.ShortLivedCacheTransactionDuration);
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.ShortLivedCacheBlockDuration);
@@ -187,6 +229,7 @@ namespace catapult { namespace config {
 				EXPECT_EQ(model::TransactionSelectionStrategy::Oldest, config.TransactionSelectionStrategy);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.UnconfirmedTransactionsCacheMaxResponseSize);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.UnconfirmedTransactionsCacheMaxSize);
+				EXPECT_EQ(0u, config.MaxStatePathKeysPerRequest);
 
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.ConnectTimeout);
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.SyncTimeout);
@@ -202,9 +245,13 @@ namespace catapult { namespace config {
 				EXPECT_EQ(0u, config.TransactionDisruptorSlotCount);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.TransactionDisruptorMaxMemorySize);
 				EXPECT_EQ(0u, config.TransactionElementTraceInterval);
+				EXPECT_EQ(0u, config.TransactionDisruptorMaxCoalescedSize);
 
 				EXPECT_FALSE(config.EnableDispatcherAbortWhenFull);
 				EXPECT_FALSE(config.EnableDispatcherInputAuditing);
+				EXPECT_FALSE(config.EnableWorkStealingValidation);
+				EXPECT_EQ(0u, config.MinSignatureBatchSize);
+				EXPECT_EQ(0u, config.StatePrefetchBlockCount);
 
 				EXPECT_EQ(0u, config.MaxTrackedNodes);
 
@@ -226,6 +273,26 @@ namespace catapult { namespace config {
 
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.CacheDatabase.MaxWriteBatchSize);
 
+				EXPECT_FALSE(config.CacheDatabase.EnableSharedBlockCache);
+				EXPECT_FALSE(config.CacheDatabase.EnableSharedDatabase);
+
+				EXPECT_FALSE(config.CacheDatabase.EnableAsyncCommit);
+				EXPECT_EQ(0u, config.CacheDatabase.MaxPendingWrites);
+
+				EXPECT_EQ(0u, config.CacheDatabase.StateHashThreadCount);
+
+				EXPECT_EQ(0u, config.CacheDatabase.TreeNodeCacheSize);
+				EXPECT_EQ(0u, config.CacheDatabase.TreeNodeCachePinnedLevels);
+
+				EXPECT_EQ(0u, config.CacheDatabase.DefaultColumnFamily.BloomFilterBitsPerKey);
+				EXPECT_EQ(0u, config.CacheDatabase.DefaultColumnFamily.BloomFilterPrefixSize);
+				EXPECT_EQ(CacheDatabaseCompression::Default, config.CacheDatabase.DefaultColumnFamily.Compression);
+				EXPECT_EQ(CacheDatabaseCompression::Default, config.CacheDatabase.DefaultColumnFamily.BottommostCompression);
+				EXPECT_FALSE(config.CacheDatabase.DefaultColumnFamily.EnablePartitionedIndexFilters);
+				EXPECT_FALSE(config.CacheDatabase.DefaultColumnFamily.PinL0FilterAndIndexBlocks);
+
+				EXPECT_TRUE(config.CacheDatabase.ColumnFamilyOverrides.empty());
+
 				EXPECT_EQ("", config.Local.Host);
 				EXPECT_EQ("", config.Local.FriendlyName);
 				EXPECT_EQ(ionet::NodeVersion(), config.Local.Version);
@@ -266,6 +333,9 @@ namespace catapult { namespace config {
 				EXPECT_TRUE(config.EnableAutoSyncCleanup);
 
 				EXPECT_EQ(888u, config.FileDatabaseBatchSize);
+				EXPECT_TRUE(config.EnableMemoryMappedBlockReads);
+				EXPECT_EQ(utils::FileSize::FromMegabytes(17), config.BlockElementCacheSize);
+				EXPECT_EQ(7u, config.BlockStorageCompressionLevel);
 
 				EXPECT_TRUE(config.EnableTransactionSpamThrottling);
 				EXPECT_EQ(Amount(54'123), config.TransactionSpamThrottlingMaxBoostFee);
@@ -273,6 +343,7 @@ namespace catapult { namespace config {
 				EXPECT_EQ(74u, config.MaxHashesPerSyncAttempt);
 				EXPECT_EQ(50u, config.MaxBlocksPerSyncAttempt);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(2), config.MaxChainBytesPerSyncAttempt);
+				EXPECT_EQ(25u, config.StateHashCalculationInterval);
 
 				EXPECT_EQ(utils::TimeSpan::FromHours(17), config.ShortLivedCacheTransactionDuration);
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(23), config.ShortLivedCacheBlockDuration);
@@ -284,6 +355,7 @@ namespace catapult { namespace config {
 				EXPECT_EQ(model::TransactionSelectionStrategy::Maximize_Fee, config.TransactionSelectionStrategy);
 				EXPECT_EQ(utils::FileSize::FromKilobytes(234), config.UnconfirmedTransactionsCacheMaxResponseSize);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(98), config.UnconfirmedTransactionsCacheMaxSize);
+				EXPECT_EQ(321u, config.MaxStatePathKeysPerRequest);
 
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(4), config.ConnectTimeout);
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(5), config.SyncTimeout);
@@ -299,9 +371,13 @@ namespace catapult { namespace config {
 				EXPECT_EQ(9876u, config.TransactionDisruptorSlotCount);
 				EXPECT_EQ(utils::FileSize::FromKilobytes(101), config.TransactionDisruptorMaxMemorySize);
 				EXPECT_EQ(98u, config.TransactionElementTraceInterval);
+				EXPECT_EQ(345u, config.TransactionDisruptorMaxCoalescedSize);
 
 				EXPECT_TRUE(config.EnableDispatcherAbortWhenFull);
 				EXPECT_TRUE(config.EnableDispatcherInputAuditing);
+				EXPECT_TRUE(config.EnableWorkStealingValidation);
+				EXPECT_EQ(48u, config.MinSignatureBatchSize);
+				EXPECT_EQ(12u, config.StatePrefetchBlockCount);
 
 				EXPECT_EQ(222u, config.MaxTrackedNodes);
 
@@ -323,6 +399,33 @@ namespace catapult { namespace config {
 
 				EXPECT_EQ(utils::FileSize::FromKilobytes(17), config.CacheDatabase.MaxWriteBatchSize);
 
+				EXPECT_TRUE(config.CacheDatabase.EnableSharedBlockCache);
+				EXPECT_TRUE(config.CacheDatabase.EnableSharedDatabase);
+
+				EXPECT_TRUE(config.CacheDatabase.EnableAsyncCommit);
+				EXPECT_EQ(27u, config.CacheDatabase.MaxPendingWrites);
+
+				EXPECT_EQ(6u, config.CacheDatabase.StateHashThreadCount);
+
+				EXPECT_EQ(1234u, config.CacheDatabase.TreeNodeCacheSize);
+				EXPECT_EQ(3u, config.CacheDatabase.TreeNodeCachePinnedLevels);
+
+				EXPECT_EQ(10u, config.CacheDatabase.DefaultColumnFamily.BloomFilterBitsPerKey);
+				EXPECT_EQ(8u, config.CacheDatabase.DefaultColumnFamily.BloomFilterPrefixSize);
+				EXPECT_EQ(CacheDatabaseCompression::Lz4, config.CacheDatabase.DefaultColumnFamily.Compression);
+				EXPECT_EQ(CacheDatabaseCompression::Zstd, config.CacheDatabase.DefaultColumnFamily.BottommostCompression);
+				EXPECT_TRUE(config.CacheDatabase.DefaultColumnFamily.EnablePartitionedIndexFilters);
+				EXPECT_TRUE(config.CacheDatabase.DefaultColumnFamily.PinL0FilterAndIndexBlocks);
+
+				ASSERT_EQ(1u, config.CacheDatabase.ColumnFamilyOverrides.size());
+				const auto& columnFamilyConfig = config.CacheDatabase.ColumnFamilyOverrides.at("accountstatecache:patricia_tree");
+				EXPECT_EQ(16u, columnFamilyConfig.BloomFilterBitsPerKey);
+				EXPECT_EQ(0u, columnFamilyConfig.BloomFilterPrefixSize);
+				EXPECT_EQ(CacheDatabaseCompression::None, columnFamilyConfig.Compression);
+				EXPECT_EQ(CacheDatabaseCompression::Lz4, columnFamilyConfig.BottommostCompression);
+				EXPECT_FALSE(columnFamilyConfig.EnablePartitionedIndexFilters);
+				EXPECT_TRUE(columnFamilyConfig.PinL0FilterAndIndexBlocks);
+
 				EXPECT_EQ("alice.com", config.Local.Host);
 				EXPECT_EQ("a GREAT node", config.Local.FriendlyName);
 				EXPECT_EQ(ionet::NodeVersion(0x04010203), config.Local.Version);
@@ -356,6 +459,90 @@ namespace catapult { namespace config {
 
 	DEFINE_CONFIGURATION_TESTS(NodeConfigurationTests, Node)
 
+	// region cache database column families
+
+	namespace {
+		void AssertCannotLoadWithCacheDatabaseSection(const std::string& section) {
+			// Arrange:
+			auto properties = NodeConfigurationTraits::CreateProperties();
+			auto overrideProperties = properties["cache_database:accountstatecache:patricia_tree"];
+			properties.emplace(section, overrideProperties);
+
+			// Act + Assert:
+			EXPECT_THROW(NodeConfiguration::LoadFromBag(std::move(properties)), catapult_invalid_argument) << section;
+		}
+	}
+
+	TEST(TEST_CLASS, CanLoadConfigurationWithMultipleColumnFamilyOverrides) {
+		// Arrange:
+		auto properties = NodeConfigurationTraits::CreateProperties();
+		auto overrideProperties = properties["cache_database:accountstatecache:patricia_tree"];
+		overrideProperties[0].second = "7";
+		properties.emplace("cache_database:*:default", overrideProperties);
+
+		// Act:
+		auto config = NodeConfiguration::LoadFromBag(std::move(properties));
+
+		// Assert:
+		const auto& overrides = config.CacheDatabase.ColumnFamilyOverrides;
+		ASSERT_EQ(2u, overrides.size());
+		EXPECT_EQ(16u, overrides.at("accountstatecache:patricia_tree").BloomFilterBitsPerKey);
+		EXPECT_EQ(7u, overrides.at("*:default").BloomFilterBitsPerKey);
+	}
+
+	TEST(TEST_CLASS, CannotLoadConfigurationWithMalformedColumnFamilyOverrideSection) {
+		AssertCannotLoadWithCacheDatabaseSection("cache_database:");
+		AssertCannotLoadWithCacheDatabaseSection("cache_database:accountstatecache");
+		AssertCannotLoadWithCacheDatabaseSection("cache_database::default");
+		AssertCannotLoadWithCacheDatabaseSection("cache_database:accountstatecache:");
+	}
+
+	namespace {
+		auto CreateCacheDatabaseConfigurationWithOverrides() {
+			auto config = NodeConfiguration::CacheDatabaseSubConfiguration();
+			config.DefaultColumnFamily.BloomFilterBitsPerKey = 1;
+			config.ColumnFamilyOverrides["*:default"].BloomFilterBitsPerKey = 2;
+			config.ColumnFamilyOverrides["alpha:default"].BloomFilterBitsPerKey = 3;
+			config.ColumnFamilyOverrides["alpha:patricia_tree"].BloomFilterBitsPerKey = 4;
+			return config;
+		}
+
+		uint32_t GetBloomFilterBitsPerKey(
+				const NodeConfiguration::CacheDatabaseSubConfiguration& config,
+				const std::string& cacheName,
+				const std::string& columnFamilyName) {
+			return GetCacheDatabaseColumnFamilyConfiguration(config, cacheName, columnFamilyName).BloomFilterBitsPerKey;
+		}
+	}
+
+	TEST(TEST_CLASS, GetCacheDatabaseColumnFamilyConfigurationPrefersExactOverride) {
+		// Arrange:
+		auto config = CreateCacheDatabaseConfigurationWithOverrides();
+
+		// Act + Assert:
+		EXPECT_EQ(3u, GetBloomFilterBitsPerKey(config, "alpha", "default"));
+		EXPECT_EQ(4u, GetBloomFilterBitsPerKey(config, "alpha", "patricia_tree"));
+	}
+
+	TEST(TEST_CLASS, GetCacheDatabaseColumnFamilyConfigurationFallsBackToWildcardOverride) {
+		// Arrange:
+		auto config = CreateCacheDatabaseConfigurationWithOverrides();
+
+		// Act + Assert:
+		EXPECT_EQ(2u, GetBloomFilterBitsPerKey(config, "beta", "default"));
+	}
+
+	TEST(TEST_CLASS, GetCacheDatabaseColumnFamilyConfigurationFallsBackToDefaultColumnFamily) {
+		// Arrange:
+		auto config = CreateCacheDatabaseConfigurationWithOverrides();
+
+		// Act + Assert:
+		EXPECT_EQ(1u, GetBloomFilterBitsPerKey(config, "beta", "patricia_tree"));
+		EXPECT_EQ(1u, GetBloomFilterBitsPerKey(config, "alpha", "metadata"));
+	}
+
+	// endregion
+
 	// region utils
 
 	namespace {
@@ -24,12 +24,14 @@
 #include "catapult/crypto/Signer.h"
 #include "catapult/model/NotificationSubscriber.h"
 #include "catapult/model/TransactionStatus.h"
+#include "catapult/thread/ParallelFor.h"
 #include "catapult/utils/RandomGenerator.h"
 #include "tests/catapult/consumers/test/ConsumerTestUtils.h"
 #include "tests/test/core/BlockTestUtils.h"
 #include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/nodeps/KeyTestUtils.h"
 #include "tests/TestHarness.h"
+#include <mutex>
 
 namespace catapult { namespace consumers {
 
@@ -90,10 +92,10 @@ namespace catapult { namespace consumers {
 			MockSignatureNotificationPublisher(
 					const GenerationHashSeed& generationHashSeed,
 					const std::vector<NotificationDescriptor>& descriptors,
-					const std::unordered_set<size_t>& alwaysVerifiableIndexes)
+					const model::WeakEntityInfos& alwaysVerifiableEntityInfos)
 					: m_generationHashSeed(generationHashSeed)
 					, m_descriptors(descriptors)
-					, m_alwaysVerifiableIndexes(alwaysVerifiableIndexes)
+					, m_alwaysVerifiableEntityInfos(alwaysVerifiableEntityInfos)
 			{}
 
 		public:
@@ -103,7 +105,12 @@ namespace catapult { namespace consumers {
 
 		public:
 			void publish(const model::WeakEntityInfo& entityInfo, model::NotificationSubscriber& sub) const override {
-				auto isAlwaysVerifiable = m_alwaysVerifiableIndexes.cend() != m_alwaysVerifiableIndexes.find(m_entityInfos.size());
+				// entities can be published concurrently by multiple threads
+				std::lock_guard<std::mutex> lock(m_mutex);
+				auto isAlwaysVerifiable = m_alwaysVerifiableEntityInfos.cend() != std::find(
+						m_alwaysVerifiableEntityInfos.cbegin(),
+						m_alwaysVerifiableEntityInfos.cend(),
+						entityInfo);
 				m_entityInfos.push_back(entityInfo);
 
 				for (const auto& descriptor : m_descriptors) {
@@ -134,14 +141,24 @@ namespace catapult { namespace consumers {
 		private:
 			const GenerationHashSeed& m_generationHashSeed;
 			std::vector<NotificationDescriptor> m_descriptors;
-			std::unordered_set<size_t> m_alwaysVerifiableIndexes;
+			model::WeakEntityInfos m_alwaysVerifiableEntityInfos;
 			mutable model::WeakEntityInfos m_entityInfos;
+			mutable std::mutex m_mutex;
 
 			// backing for data stored by reference in SignatureNotification (for test purposes, only sign hashes)
 			// use list so that tests will work with arbitrary number of elements without requiring preallocation
 			mutable std::list<SignatureInput> m_signatureInputs;
 		};
 
+		model::WeakEntityInfos SortByEntity(const model::WeakEntityInfos& entityInfos) {
+			// entities are published in arbitrary order, so compare them in a deterministic (address) order
+			auto sortedEntityInfos = entityInfos;
+			std::sort(sortedEntityInfos.begin(), sortedEntityInfos.end(), [](const auto& lhs, const auto& rhs) {
+				return &lhs.entity() < &rhs.entity();
+			});
+			return sortedEntityInfos;
+		}
+
 		// endregion
 
 		// region BlockTraits
@@ -157,25 +174,27 @@ namespace catapult { namespace consumers {
 			};
 		}
 
-		struct BlockTraits {
+		template<thread::ParallelForStrategy Strategy, size_t MinBatchSize>
+		struct BlockTraitsT {
 		public:
 			struct TestContext {
 			public:
 				explicit TestContext(
 						const std::vector<NotificationDescriptor>& descriptors,
-						const std::unordered_set<size_t>& alwaysVerifiableIndexes = {},
+						const model::WeakEntityInfos& alwaysVerifiableEntityInfos = {},
 						const RequiresValidationPredicate& requiresValidationPredicate = RequiresAllPredicate)
 						: GenerationHashSeed(test::GenerateRandomByteArray<catapult::GenerationHashSeed>())
 						, pPublisher(std::make_shared<MockSignatureNotificationPublisher>(
 								GenerationHashSeed,
 								descriptors,
-								alwaysVerifiableIndexes))
+								alwaysVerifiableEntityInfos))
 						, pPool(test::CreateStartedIoThreadPool())
 						, Consumer(CreateBlockBatchSignatureConsumer(
 								GenerationHashSeed,
 								CreateRandomFiller(),
 								pPublisher,
 								*pPool,
+								BatchSignatureOptions{ Strategy, MinBatchSize },
 								requiresValidationPredicate))
 				{}
 
@@ -209,7 +228,7 @@ namespace catapult { namespace consumers {
 				// Assert:
 				EXPECT_EQ(numExpectedEntities, entityInfos.size());
 				EXPECT_EQ(expectedEntityInfos.size(), entityInfos.size());
-				EXPECT_EQ(expectedEntityInfos, entityInfos);
+				EXPECT_EQ(SortByEntity(expectedEntityInfos), SortByEntity(entityInfos));
 			}
 
 			static void AssertAllSignaturesVerify(const std::vector<NotificationDescriptor>& descriptors) {
@@ -230,7 +249,9 @@ namespace catapult { namespace consumers {
 				auto elements = CreateMultipleEntityElements();
 				StripVerifiable(descriptors[0]);
 				StripVerifiable(descriptors[3]);
-				TestContext context(descriptors, { 0, 2, 4 });
+				model::WeakEntityInfos entityInfos;
+				ExtractMatchingEntityInfos(elements, entityInfos, RequiresAllPredicate);
+				TestContext context(descriptors, { entityInfos[0], entityInfos[2], entityInfos[4] });
 
 				// Act:
 				auto result = context.Consumer(elements);
@@ -254,6 +275,10 @@ namespace catapult { namespace consumers {
 			}
 		};
 
+		using BlockTraits = BlockTraitsT<thread::ParallelForStrategy::Static, 1>;
+		using BlockSingleBatchTraits = BlockTraitsT<thread::ParallelForStrategy::Static, 1000>;
+		using BlockWorkStealingTraits = BlockTraitsT<thread::ParallelForStrategy::Work_Stealing, 1>;
+
 		// endregion
 
 		// region TransactionTraits
@@ -269,24 +294,26 @@ namespace catapult { namespace consumers {
 			return entityInfos;
 		}
 
-		struct TransactionTraits {
+		template<thread::ParallelForStrategy Strategy, size_t MinBatchSize>
+		struct TransactionTraitsT {
 		public:
 			struct TestContext {
 			public:
 				explicit TestContext(
 						const std::vector<NotificationDescriptor>& descriptors,
-						const std::unordered_set<size_t>& alwaysVerifiableIndexes = {})
+						const model::WeakEntityInfos& alwaysVerifiableEntityInfos = {})
 						: GenerationHashSeed(test::GenerateRandomByteArray<catapult::GenerationHashSeed>())
 						, pPublisher(std::make_shared<MockSignatureNotificationPublisher>(
 								GenerationHashSeed,
 								descriptors,
-								alwaysVerifiableIndexes))
+								alwaysVerifiableEntityInfos))
 						, pPool(test::CreateStartedIoThreadPool())
 						, Consumer(CreateTransactionBatchSignatureConsumer(
 								GenerationHashSeed,
 								CreateRandomFiller(),
 								pPublisher,
 								*pPool,
+								BatchSignatureOptions{ Strategy, MinBatchSize },
 								[this](const auto& transaction, const auto& hash, auto result) {
 									// notice that transaction.Deadline is used as transaction marker
 									FailedTransactionStatuses.emplace_back(hash, transaction.Deadline, utils::to_underlying_type(result));
@@ -320,7 +347,7 @@ namespace catapult { namespace consumers {
 					size_t numExpectedEntities) {
 				EXPECT_EQ(numExpectedEntities, entityInfos.size());
 				EXPECT_EQ(expectedEntityInfos.size(), entityInfos.size());
-				EXPECT_EQ(expectedEntityInfos, entityInfos);
+				EXPECT_EQ(SortByEntity(expectedEntityInfos), SortByEntity(entityInfos));
 			}
 
 			static void AssertAllSignaturesVerify(const std::vector<NotificationDescriptor>& descriptors) {
@@ -349,7 +376,7 @@ namespace catapult { namespace consumers {
 				auto elements = CreateMultipleEntityElements();
 				StripVerifiable(descriptors[0]);
 				StripVerifiable(descriptors[3]);
-				TestContext context(descriptors, { 0, 2, 4 });
+				TestContext context(descriptors, FilterEntityInfos(elements, { 0, 2 }));
 
 				// Act:
 				auto result = context.Consumer(elements);
@@ -408,13 +435,21 @@ namespace catapult { namespace consumers {
 			}
 		};
 
+		using TransactionTraits = TransactionTraitsT<thread::ParallelForStrategy::Static, 1>;
+		using TransactionSingleBatchTraits = TransactionTraitsT<thread::ParallelForStrategy::Static, 1000>;
+		using TransactionWorkStealingTraits = TransactionTraitsT<thread::ParallelForStrategy::Work_Stealing, 1>;
+
 		// endregion
 	}
 
 #define ALL_TEST(TEST_NAME) \
 	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
 	TEST(BLOCK_TEST_CLASS, TEST_NAME) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<BlockTraits>(); } \
+	TEST(BLOCK_TEST_CLASS, TEST_NAME##_SingleBatch) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<BlockSingleBatchTraits>(); } \
+	TEST(BLOCK_TEST_CLASS, TEST_NAME##_WorkStealing) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<BlockWorkStealingTraits>(); } \
 	TEST(TRANSACTION_TEST_CLASS, TEST_NAME) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<TransactionTraits>(); } \
+	TEST(TRANSACTION_TEST_CLASS, TEST_NAME##_SingleBatch) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<TransactionSingleBatchTraits>(); } \
+	TEST(TRANSACTION_TEST_CLASS, TEST_NAME##_WorkStealing) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<TransactionWorkStealingTraits>(); } \
 	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
 
 	// region all - no signatures
@@ -26,8 +26,10 @@
 #include "catapult/chain/ChainResults.h"
 #include "catapult/consumers/InputUtils.h"
 #include "catapult/model/BlockUtils.h"
+#include "catapult/model/BlockchainConfiguration.h"
 #include "tests/catapult/consumers/test/ConsumerTestUtils.h"
 #include "tests/test/cache/CacheTestUtils.h"
+#include "tests/test/cache/SimpleCache.h"
 #include "tests/test/core/BlockTestUtils.h"
 #include "tests/test/nodeps/KeyTestUtils.h"
 #include "tests/test/nodeps/ParamsCapture.h"
@@ -205,7 +207,9 @@ namespace catapult { namespace consumers {
 
 		struct ProcessorTestContext {
 		public:
-			explicit ProcessorTestContext(ReceiptValidationMode receiptValidationMode = ReceiptValidationMode::Disabled)
+			explicit ProcessorTestContext(
+					ReceiptValidationMode receiptValidationMode = ReceiptValidationMode::Disabled,
+					uint32_t stateHashCalculationInterval = 1)
 					: BlockHitPredicateFactory(BlockHitPredicate) {
 				Processor = CreateBlockchainProcessor(
 						[this](const auto& cache) {
@@ -214,21 +218,24 @@ namespace catapult { namespace consumers {
 						[this](auto height, auto timestamp, const auto& entities, auto& state) {
 							return BatchEntityProcessor(height, timestamp, entities, state);
 						},
-						receiptValidationMode);
+						receiptValidationMode,
+						stateHashCalculationInterval,
+						[this]() { return FinalizedHeightHashPair; });
 			}
 
 		public:
 			MockBlockHitPredicate BlockHitPredicate;
 			MockBlockHitPredicateFactory BlockHitPredicateFactory;
 			MockBatchEntityProcessor BatchEntityProcessor;
+			model::HeightHashPair FinalizedHeightHashPair;
 			BlockchainProcessor Processor;
 
 		public:
 			ValidationResult Process(
+					cache::CatapultCache& cache,
 					const model::BlockElement& parentBlockElement,
 					BlockElements& elements,
 					const std::function<PrepareAccountMode (Height)>& lookupPrepareAccountMode) {
-				auto cache = test::CreateCatapultCacheWithMarkerAccount();
 				auto cacheDelta = cache.createDelta();
 
 				// set vrf keys for all block signers
@@ -250,6 +257,14 @@ namespace catapult { namespace consumers {
 				return Processor(WeakBlockInfo(parentBlockElement), elements, observerState);
 			}
 
+			ValidationResult Process(
+					const model::BlockElement& parentBlockElement,
+					BlockElements& elements,
+					const std::function<PrepareAccountMode (Height)>& lookupPrepareAccountMode) {
+				auto cache = test::CreateCatapultCacheWithMarkerAccount();
+				return Process(cache, parentBlockElement, elements, lookupPrepareAccountMode);
+			}
+
 			ValidationResult Process(const model::BlockElement& parentBlockElement, BlockElements& elements) {
 				return Process(parentBlockElement, elements, [](auto) { return PrepareAccountMode::Default; });
 			}
@@ -687,6 +702,175 @@ namespace catapult { namespace consumers {
 		context.assertBatchEntityProcessorCalls(elements);
 	}
 
+	namespace {
+		enum class FinalizationMode { None, Matching_Hash, Different_Hash };
+
+		ValidationResult ProcessWithInvalidStateHash(
+				uint32_t stateHashCalculationInterval,
+				size_t invalidIndex,
+				size_t finalizedIndex,
+				FinalizationMode finalizationMode = FinalizationMode::Matching_Hash) {
+			// Arrange: process blocks at heights 12, 13, 14
+			ProcessorTestContext context(ReceiptValidationMode::Disabled, stateHashCalculationInterval);
+			auto pParentBlock = test::GenerateEmptyRandomBlock();
+			auto elements = test::CreateBlockElements(3);
+			PrepareChain(Height(11), *pParentBlock, elements);
+
+			if (FinalizationMode::None != finalizationMode) {
+				context.FinalizedHeightHashPair = {
+					elements[finalizedIndex].Block.Height,
+					FinalizationMode::Matching_Hash == finalizationMode
+							? elements[finalizedIndex].EntityHash
+							: test::GenerateRandomByteArray<Hash256>()
+				};
+			}
+
+			test::FillWithRandomData(const_cast<model::Block&>(elements[invalidIndex].Block).StateHash);
+
+			// Act:
+			return context.Process(*pParentBlock, elements);
+		}
+	}
+
+	TEST(TEST_CLASS, StateHashIsNotCheckedForFinalizedBlocksBetweenCalculationIntervals) {
+		// Act: block at height 13 is finalized
+		auto result1 = ProcessWithInvalidStateHash(10, 0, 1);
+		auto result2 = ProcessWithInvalidStateHash(10, 1, 1);
+
+		// Assert:
+		EXPECT_EQ(ValidationResult::Success, result1);
+		EXPECT_EQ(ValidationResult::Success, result2);
+	}
+
+	TEST(TEST_CLASS, StateHashIsCheckedForBlocksBetweenCalculationIntervalsWhenNoBlocksAreFinalized) {
+		// Act:
+		auto result1 = ProcessWithInvalidStateHash(10, 0, 0, FinalizationMode::None);
+		auto result2 = ProcessWithInvalidStateHash(10, 1, 0, FinalizationMode::None);
+
+		// Assert:
+		EXPECT_EQ(chain::Failure_Chain_Block_Inconsistent_State_Hash, result1);
+		EXPECT_EQ(chain::Failure_Chain_Block_Inconsistent_State_Hash, result2);
+	}
+
+	TEST(TEST_CLASS, StateHashIsCheckedForBlocksAboveFinalizedHeight) {
+		// Act: block at height 12 is finalized
+		auto result = ProcessWithInvalidStateHash(10, 1, 0);
+
+		// Assert:
+		EXPECT_EQ(chain::Failure_Chain_Block_Inconsistent_State_Hash, result);
+	}
+
+	TEST(TEST_CLASS, StateHashIsCheckedForBlocksBetweenCalculationIntervalsWhenFinalizedHashDoesNotMatch) {
+		// Act: a different block at height 13 is finalized
+		auto result1 = ProcessWithInvalidStateHash(10, 0, 1, FinalizationMode::Different_Hash);
+		auto result2 = ProcessWithInvalidStateHash(10, 1, 1, FinalizationMode::Different_Hash);
+
+		// Assert:
+		EXPECT_EQ(chain::Failure_Chain_Block_Inconsistent_State_Hash, result1);
+		EXPECT_EQ(chain::Failure_Chain_Block_Inconsistent_State_Hash, result2);
+	}
+
+	TEST(TEST_CLASS, StateHashIsCheckedForFinalizedBlocksAtCalculationIntervals) {
+		// Act: all blocks are finalized
+		auto result1 = ProcessWithInvalidStateHash(12, 0, 2);
+		auto result2 = ProcessWithInvalidStateHash(13, 1, 2);
+
+		// Assert:
+		EXPECT_EQ(chain::Failure_Chain_Block_Inconsistent_State_Hash, result1);
+		EXPECT_EQ(chain::Failure_Chain_Block_Inconsistent_State_Hash, result2);
+	}
+
+	TEST(TEST_CLASS, StateHashIsAlwaysCheckedForLastBlock) {
+		// Act: all blocks are finalized
+		auto result1 = ProcessWithInvalidStateHash(10, 2, 2);
+		auto result2 = ProcessWithInvalidStateHash(0, 2, 2);
+
+		// Assert:
+		EXPECT_EQ(chain::Failure_Chain_Block_Inconsistent_State_Hash, result1);
+		EXPECT_EQ(chain::Failure_Chain_Block_Inconsistent_State_Hash, result2);
+	}
+
+	TEST(TEST_CLASS, StateHashIsCheckedForAllBlocksWhenCalculationIntervalIsZero) {
+		// Act: all blocks are finalized
+		auto result = ProcessWithInvalidStateHash(0, 1, 2);
+
+		// Assert:
+		EXPECT_EQ(chain::Failure_Chain_Block_Inconsistent_State_Hash, result);
+	}
+
+	namespace {
+		cache::CatapultCache CreateCatapultCacheWithSubCacheMerkleRoots() {
+			auto config = model::BlockchainConfiguration::Uninitialized();
+			config.VotingSetGrouping = 1;
+
+			std::vector<std::unique_ptr<cache::SubCachePlugin>> subCaches(3);
+			test::CoreSystemCacheFactory::CreateSubCaches(config, subCaches);
+			subCaches[2] = test::MakeConfigurationFreeSubCachePlugin<test::SimpleCacheT<2>, test::SimpleCacheStorageTraits>(
+					test::SimpleCacheViewMode::Merkle_Root);
+
+			auto cache = cache::CatapultCache(std::move(subCaches));
+			test::AddMarkerAccount(cache);
+			return cache;
+		}
+
+		std::vector<std::vector<Hash256>> PrepareStateHashes(cache::CatapultCache& cache, BlockElements& elements) {
+			std::vector<std::vector<Hash256>> subCacheMerkleRootsGroups;
+			auto cacheDelta = cache.createDelta();
+			for (auto& element : elements) {
+				auto stateHashInfo = cacheDelta.calculateStateHash(element.Block.Height);
+				const_cast<model::Block&>(element.Block).StateHash = stateHashInfo.StateHash;
+				subCacheMerkleRootsGroups.push_back(stateHashInfo.SubCacheMerkleRoots);
+			}
+
+			return subCacheMerkleRootsGroups;
+		}
+	}
+
+	TEST(TEST_CLASS, StateHashIsCheckedForFinalizedBlocksBetweenCalculationIntervalsWhenSubCacheMerkleRootsArePresent) {
+		// Arrange: process blocks at heights 12, 13, 14 with block at height 13 finalized
+		ProcessorTestContext context(ReceiptValidationMode::Disabled, 10);
+		auto pParentBlock = test::GenerateEmptyRandomBlock();
+		auto elements = test::CreateBlockElements(3);
+		PrepareChain(Height(11), *pParentBlock, elements);
+		context.FinalizedHeightHashPair = { elements[1].Block.Height, elements[1].EntityHash };
+
+		auto cache = CreateCatapultCacheWithSubCacheMerkleRoots();
+		PrepareStateHashes(cache, elements);
+		test::FillWithRandomData(const_cast<model::Block&>(elements[0].Block).StateHash);
+
+		// Act:
+		auto result = context.Process(cache, test::BlockToBlockElement(*pParentBlock), elements, [](auto) {
+			return PrepareAccountMode::Default;
+		});
+
+		// Assert:
+		EXPECT_EQ(chain::Failure_Chain_Block_Inconsistent_State_Hash, result);
+	}
+
+	TEST(TEST_CLASS, SubCacheMerkleRootsAreStoredForFinalizedBlocksBetweenCalculationIntervals) {
+		// Arrange: process blocks at heights 12, 13, 14 with block at height 13 finalized
+		ProcessorTestContext context(ReceiptValidationMode::Disabled, 10);
+		auto pParentBlock = test::GenerateEmptyRandomBlock();
+		auto elements = test::CreateBlockElements(3);
+		PrepareChain(Height(11), *pParentBlock, elements);
+		context.FinalizedHeightHashPair = { elements[1].Block.Height, elements[1].EntityHash };
+
+		auto cache = CreateCatapultCacheWithSubCacheMerkleRoots();
+		auto expectedSubCacheMerkleRootsGroups = PrepareStateHashes(cache, elements);
+
+		// Act:
+		auto result = context.Process(cache, test::BlockToBlockElement(*pParentBlock), elements, [](auto) {
+			return PrepareAccountMode::Default;
+		});
+
+		// Assert: all blocks are stored with their own sub cache merkle roots
+		EXPECT_EQ(ValidationResult::Success, result);
+		for (auto i = 0u; i < elements.size(); ++i) {
+			EXPECT_EQ(1u, elements[i].SubCacheMerkleRoots.size()) << "sub cache merkle roots at " << i;
+			EXPECT_EQ(expectedSubCacheMerkleRootsGroups[i], elements[i].SubCacheMerkleRoots) << "sub cache merkle roots at " << i;
+		}
+	}
+
 	// endregion
 
 	// region invalid - block receipts hash
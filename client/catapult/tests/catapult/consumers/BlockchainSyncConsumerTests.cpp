@@ -247,6 +247,30 @@ namespace catapult { namespace consumers {
 
 		// endregion
 
+		// region MockPreBlocksWritten
+
+		class MockPreBlocksWritten : public RaisableErrorSource {
+		public:
+			MockPreBlocksWritten() : m_numCalls(0)
+			{}
+
+		public:
+			size_t numCalls() const {
+				return m_numCalls;
+			}
+
+		public:
+			void operator()() const {
+				raise("MockPreBlocksWritten");
+				++const_cast<MockPreBlocksWritten*>(this)->m_numCalls;
+			}
+
+		private:
+			size_t m_numCalls;
+		};
+
+		// endregion
+
 		// region MockPreStateWritten
 
 		struct PreStateWrittenParams {
@@ -473,6 +497,9 @@ namespace catapult { namespace consumers {
 				handlers.StateChange = [this](const auto& changeInfo) {
 					return StateChange(changeInfo);
 				};
+				handlers.PreBlocksWritten = [this]() {
+					return PreBlocksWritten();
+				};
 				handlers.PreStateWritten = [this](const auto& cacheDelta, auto height) {
 					return PreStateWritten(cacheDelta, height);
 				};
@@ -498,6 +525,7 @@ namespace catapult { namespace consumers {
 			MockUndoBlock UndoBlock;
 			MockProcessor Processor;
 			MockStateChange StateChange;
+			MockPreBlocksWritten PreBlocksWritten;
 			MockPreStateWritten PreStateWritten;
 			MockTransactionsChange TransactionsChange;
 			MockCommitStep CommitStep;
@@ -589,6 +617,7 @@ namespace catapult { namespace consumers {
 				EXPECT_EQ(0u, Cache.sub<cache::BlockStatisticCache>().createView()->size());
 
 				// - no state changes were announced
+				EXPECT_EQ(0u, PreBlocksWritten.numCalls());
 				EXPECT_EQ(0u, StateChange.params().size());
 				EXPECT_EQ(0u, PreStateWritten.params().size());
 
@@ -626,6 +655,9 @@ namespace catapult { namespace consumers {
 						Cache.sub<cache::BlockStatisticCache>().createView()->size());
 				EXPECT_EQ(chainHeight, Cache.createView().height());
 
+				// - pre blocks written checkpoint was announced
+				EXPECT_EQ(1u, PreBlocksWritten.numCalls());
+
 				// - state changes were announced
 				ASSERT_EQ(1u, StateChange.params().size());
 				const auto& stateChangeParams = StateChange.params()[0];
@@ -1383,6 +1415,23 @@ namespace catapult { namespace consumers {
 		EXPECT_EQ(0u, context.CommitStep.params().size());
 	}
 
+	TEST(TEST_CLASS, CommitStepsAreCorrectWhenPreBlocksWrittenFails) {
+		// Arrange:
+		ConsumerTestContext context;
+		context.seedStorage(Height(7));
+		auto input = CreateInput(Height(6), 4);
+
+		// - simulate pre blocks written failure
+		context.PreBlocksWritten.setError();
+
+		// Act:
+		EXPECT_THROW(context.Consumer(input), catapult_runtime_error);
+
+		// Assert: no blocks were written
+		EXPECT_EQ(0u, context.CommitStep.params().size());
+		EXPECT_EQ(Height(7), context.Storage.view().chainHeight());
+	}
+
 	TEST(TEST_CLASS, CommitStepsAreCorrectWhenWritingStateFails) {
 		// Arrange:
 		ConsumerTestContext context;
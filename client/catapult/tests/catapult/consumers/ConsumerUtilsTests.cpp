@@ -24,12 +24,16 @@
 #include "catapult/disruptor/ConsumerInput.h"
 #include "catapult/ionet/NodeInteractionResult.h"
 #include "catapult/validators/ValidationResult.h"
+#include "tests/test/core/TransactionTestUtils.h"
+#include "tests/test/other/DisruptorTestUtils.h"
 #include "tests/TestHarness.h"
 
 namespace catapult { namespace consumers {
 
 #define TEST_CLASS ConsumerUtilsTests
 
+	// region ToNodeInteractionResult
+
 	namespace {
 		void AssertNodeInteractionResult(ionet::NodeInteractionResultCode expectedCode, validators::ValidationResult validationResult) {
 			// Arrange:
@@ -69,4 +73,82 @@ namespace catapult { namespace consumers {
 		AssertNodeInteractionResult(ionet::NodeInteractionResultCode::Failure, static_cast<validators::ValidationResult>(0x80001234));
 		AssertNodeInteractionResult(ionet::NodeInteractionResultCode::Failure, static_cast<validators::ValidationResult>(0x81234567));
 	}
+
+	// endregion
+
+	// region ForEachSourceCompletionResult
+
+	namespace {
+		struct SourceCompletionResult {
+			model::NodeIdentity SourceIdentity;
+			disruptor::ConsumerCompletionResult CompletionResult;
+		};
+
+		std::vector<SourceCompletionResult> CollectSourceCompletionResults(
+				const disruptor::ConsumerInput& input,
+				const disruptor::ConsumerCompletionResult& completionResult) {
+			std::vector<SourceCompletionResult> sourceCompletionResults;
+			ForEachSourceCompletionResult(input, completionResult, [&sourceCompletionResults](const auto& identity, const auto& result) {
+				sourceCompletionResults.push_back({ identity, result });
+			});
+			return sourceCompletionResults;
+		}
+
+		disruptor::ConsumerCompletionResult CreateAbortedCompletionResult() {
+			disruptor::ConsumerCompletionResult completionResult;
+			completionResult.CompletionStatus = disruptor::CompletionStatus::Aborted;
+			completionResult.CompletionCode = utils::to_underlying_type(validators::ValidationResult::Failure);
+			completionResult.ResultSeverity = disruptor::ConsumerResultSeverity::Fatal;
+			completionResult.FinalConsumerPosition = 3;
+			return completionResult;
+		}
+	}
+
+	TEST(TEST_CLASS, ForEachSourceCompletionResultForwardsInputResultForUnpartitionedInput) {
+		// Arrange:
+		auto identityKey = test::GenerateRandomByteArray<Key>();
+		disruptor::ConsumerInput input({ test::CreateTransactionEntityRange(2), { identityKey, "11.22.33.44" } });
+
+		// Act:
+		auto sourceCompletionResults = CollectSourceCompletionResults(input, CreateAbortedCompletionResult());
+
+		// Assert:
+		ASSERT_EQ(1u, sourceCompletionResults.size());
+		EXPECT_EQ(identityKey, sourceCompletionResults[0].SourceIdentity.PublicKey);
+		EXPECT_EQ("11.22.33.44", sourceCompletionResults[0].SourceIdentity.Host);
+		test::AssertEqual(CreateAbortedCompletionResult(), sourceCompletionResults[0].CompletionResult);
+	}
+
+	TEST(TEST_CLASS, ForEachSourceCompletionResultForwardsPartitionResultsForPartitionedInput) {
+		// Arrange: only abort the second partition
+		auto identityKeys = test::GenerateRandomDataVector<Key>(3);
+		std::vector<model::AnnotatedTransactionRange> ranges;
+		ranges.push_back({ test::CreateTransactionEntityRange(2), { identityKeys[0], "11.22.33.44" } });
+		ranges.push_back({ test::CreateTransactionEntityRange(1), { identityKeys[1], "55.66.77.88" } });
+		ranges.push_back({ test::CreateTransactionEntityRange(3), { identityKeys[2], "99.88.77.66" } });
+		disruptor::ConsumerInput input(std::move(ranges));
+
+		auto partitionResult = disruptor::ConsumerResult::Abort(
+				utils::to_underlying_type(validators::ValidationResult::Neutral),
+				disruptor::ConsumerResultSeverity::Neutral);
+		input.partitions()[1].Result = partitionResult;
+
+		disruptor::ConsumerCompletionResult completionResult;
+		completionResult.FinalConsumerPosition = 3;
+
+		// Act:
+		auto sourceCompletionResults = CollectSourceCompletionResults(input, completionResult);
+
+		// Assert:
+		ASSERT_EQ(3u, sourceCompletionResults.size());
+		for (auto i = 0u; i < sourceCompletionResults.size(); ++i)
+			EXPECT_EQ(identityKeys[i], sourceCompletionResults[i].SourceIdentity.PublicKey) << "result at " << i;
+
+		test::AssertEqual(completionResult, sourceCompletionResults[0].CompletionResult);
+		const auto& partitionCompletionResult = sourceCompletionResults[1].CompletionResult;
+		test::AssertAborted(partitionCompletionResult, partitionResult.CompletionCode, partitionResult.ResultSeverity, 3);
+		test::AssertEqual(completionResult, sourceCompletionResults[2].CompletionResult);
+	}
+
+	// endregion
 }}
@@ -336,4 +336,92 @@ namespace catapult { namespace consumers {
 	}
 
 	// endregion
+
+	// region partitioned input
+
+	namespace {
+		ConsumerInput CreatePartitionedInput(const std::vector<size_t>& partitionSizes) {
+			std::vector<model::AnnotatedTransactionRange> ranges;
+			for (auto partitionSize : partitionSizes)
+				ranges.push_back({ test::CreateTransactionEntityRange(partitionSize), { test::GenerateRandomByteArray<Key>(), "" } });
+
+			ConsumerInput input(std::move(ranges));
+			for (auto& element : input.transactions())
+				element.OptionalExtractedAddresses = std::make_shared<model::UnresolvedAddressSet>();
+
+			return input;
+		}
+
+		std::vector<size_t> GetAddedTransactionInfosSizes(const MockNewTransactionsProcessor& processor) {
+			std::vector<size_t> sizes;
+			for (const auto& params : processor.params())
+				sizes.push_back(params.AddedTransactionInfos.size());
+
+			return sizes;
+		}
+	}
+
+	TEST(TEST_CLASS, PartitionedInputIsForwardedPerPartition) {
+		// Arrange:
+		ConsumerTestContext context;
+		auto input = CreatePartitionedInput({ 2, 1, 3 });
+
+		// Act:
+		auto result = context.Consumer(input);
+
+		// Assert: the consumer detached the input
+		test::AssertConsumed(result, validators::ValidationResult::Success);
+		EXPECT_TRUE(input.empty());
+
+		// - the new transactions handler was called once per partition
+		EXPECT_EQ(std::vector<size_t>({ 2, 1, 3 }), GetAddedTransactionInfosSizes(context.NewTransactionsProcessor));
+
+		for (const auto& partition : input.partitions())
+			test::AssertConsumed(partition.Result, validators::ValidationResult::Success);
+	}
+
+	TEST(TEST_CLASS, PartitionedInputResultsAreAttributedToPartitions) {
+		// Arrange: fail all transactions in the second partition and skip all transactions in the third partition
+		ConsumerTestContext context(3, 50);
+		auto input = CreatePartitionedInput({ 2, 3, 1 });
+		for (auto i = 2u; i < 5; ++i)
+			input.transactions()[i].ResultSeverity = disruptor::ConsumerResultSeverity::Failure;
+
+		input.transactions()[5].ResultSeverity = disruptor::ConsumerResultSeverity::Neutral;
+
+		// Act:
+		auto result = context.Consumer(input);
+
+		// Assert: only the second partition is banned
+		test::AssertAborted(result, validators::ValidationResult::Failure, disruptor::ConsumerResultSeverity::Failure);
+		EXPECT_EQ(std::vector<size_t>({ 2, 0, 0 }), GetAddedTransactionInfosSizes(context.NewTransactionsProcessor));
+
+		const auto& partitions = input.partitions();
+		test::AssertConsumed(partitions[0].Result, validators::ValidationResult::Success);
+		test::AssertAborted(partitions[1].Result, validators::ValidationResult::Failure, disruptor::ConsumerResultSeverity::Fatal);
+		test::AssertConsumed(partitions[2].Result, validators::ValidationResult::Neutral);
+	}
+
+	TEST(TEST_CLASS, PartitionedInputSkipsPreviouslyAbortedPartitions) {
+		// Arrange:
+		ConsumerTestContext context;
+		auto input = CreatePartitionedInput({ 2, 3 });
+		input.partitions()[0].Result = disruptor::ConsumerResult::Abort(123, disruptor::ConsumerResultSeverity::Fatal);
+		for (auto i = 0u; i < 2; ++i)
+			input.transactions()[i].ResultSeverity = disruptor::ConsumerResultSeverity::Neutral;
+
+		// Act:
+		auto result = context.Consumer(input);
+
+		// Assert: the new transactions handler was only called for the second partition
+		test::AssertAborted(result, validators::ValidationResult::Failure, disruptor::ConsumerResultSeverity::Failure);
+		EXPECT_EQ(std::vector<size_t>({ 3 }), GetAddedTransactionInfosSizes(context.NewTransactionsProcessor));
+
+		const auto& partitions = input.partitions();
+		EXPECT_EQ(123u, partitions[0].Result.CompletionCode);
+		EXPECT_EQ(disruptor::ConsumerResultSeverity::Fatal, partitions[0].Result.ResultSeverity);
+		test::AssertConsumed(partitions[1].Result, validators::ValidationResult::Success);
+	}
+
+	// endregion
 }}
@@ -0,0 +1,270 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/consumers/BlockConsumers.h"
+#include "catapult/cache/CatapultCache.h"
+#include "catapult/model/Address.h"
+#include "catapult/model/NotificationSubscriber.h"
+#include "catapult/model/ResolverContext.h"
+#include "tests/catapult/consumers/test/ConsumerInputFactory.h"
+#include "tests/catapult/consumers/test/ConsumerTestUtils.h"
+#include "tests/test/cache/CacheTestUtils.h"
+#include "tests/test/core/BlockTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
+#include "tests/TestHarness.h"
+#include <mutex>
+#include <thread>
+
+namespace catapult { namespace consumers {
+
+#define TEST_CLASS StatePrefetchConsumerTests
+
+	namespace {
+		// region test context
+
+		UnresolvedAddress ToUnresolvedSignerAddress(const model::VerifiableEntity& entity) {
+			return model::PublicKeyToAddress(entity.SignerPublicKey, entity.Network).copyTo<UnresolvedAddress>();
+		}
+
+		Address Resolve(const UnresolvedAddress& unresolvedAddress) {
+			auto address = unresolvedAddress.copyTo<Address>();
+			address[Address::Size - 1] ^= 0xFF;
+			return address;
+		}
+
+		class MockSignerAddressNotificationPublisher : public model::NotificationPublisher {
+		public:
+			void publish(const model::WeakEntityInfo& entityInfo, model::NotificationSubscriber& sub) const override {
+				sub.notify(model::AccountAddressNotification(ToUnresolvedSignerAddress(entityInfo.entity())));
+			}
+		};
+
+		class TestContext {
+		public:
+			explicit TestContext(uint32_t maxBlocksPerPrefetch)
+					: m_cache(test::CreateEmptyCatapultCache())
+					, m_pPool(test::CreateStartedIoThreadPool(1))
+					, m_numResolverContextFactoryCalls(0)
+					, m_isLoaderBlocked(false) {
+				chain::ExecutionContextConfiguration executionContextConfig;
+				executionContextConfig.ResolverContextFactory = [this](const auto&) {
+					++m_numResolverContextFactoryCalls;
+					return model::ResolverContext(
+							[](const auto& mosaicId) { return MosaicId(mosaicId.unwrap()); },
+							[](const auto& address) { return Resolve(address); });
+				};
+
+				m_consumer = CreateBlockStatePrefetchConsumer(
+						m_cache,
+						executionContextConfig,
+						std::make_shared<MockSignerAddressNotificationPublisher>(),
+						*m_pPool,
+						maxBlocksPerPrefetch,
+						[this](const auto& keys) {
+							WAIT_FOR_VALUE_EXPR(false, m_isLoaderBlocked.load());
+
+							std::lock_guard<std::mutex> lock(m_mutex);
+							m_loadedAddresses.emplace_back(keys.Addresses.cbegin(), keys.Addresses.cend());
+						});
+			}
+
+			~TestContext() {
+				m_isLoaderBlocked = false;
+				m_pPool->join();
+			}
+
+		public:
+			auto numResolverContextFactoryCalls() const {
+				return m_numResolverContextFactoryCalls.load();
+			}
+
+			auto numLoads() const {
+				std::lock_guard<std::mutex> lock(m_mutex);
+				return m_loadedAddresses.size();
+			}
+
+			auto loadedAddresses() const {
+				std::lock_guard<std::mutex> lock(m_mutex);
+				return m_loadedAddresses;
+			}
+
+		public:
+			const auto& consumer() const {
+				return m_consumer;
+			}
+
+			void blockLoader() {
+				m_isLoaderBlocked = true;
+			}
+
+			void unblockLoader() {
+				m_isLoaderBlocked = false;
+			}
+
+			void destroyConsumer() {
+				m_consumer = disruptor::ConstBlockConsumer();
+			}
+
+		private:
+			cache::CatapultCache m_cache;
+			std::unique_ptr<thread::IoThreadPool> m_pPool;
+			disruptor::ConstBlockConsumer m_consumer;
+			std::atomic<size_t> m_numResolverContextFactoryCalls;
+			std::atomic_bool m_isLoaderBlocked;
+
+			mutable std::mutex m_mutex;
+			std::vector<model::AddressSet> m_loadedAddresses;
+		};
+
+		model::AddressSet GetExpectedAddresses(const BlockElements& elements, size_t startIndex, size_t endIndex) {
+			model::AddressSet addresses;
+			for (auto i = startIndex; i < endIndex; ++i) {
+				const auto& block = elements[i].Block;
+				addresses.insert(Resolve(ToUnresolvedSignerAddress(block)));
+				for (const auto& transaction : block.Transactions())
+					addresses.insert(Resolve(ToUnresolvedSignerAddress(transaction)));
+			}
+
+			return addresses;
+		}
+
+		disruptor::ConsumerInput CreateInputWithBlocks(size_t numBlocks) {
+			std::vector<std::unique_ptr<model::Block>> blocks;
+			std::vector<const model::Block*> blockPointers;
+			for (auto i = 0u; i < numBlocks; ++i) {
+				blocks.push_back(test::GenerateBlockWithTransactions(2, Height(12 + i)));
+				blockPointers.push_back(blocks.back().get());
+			}
+
+			return test::CreateConsumerInputFromBlocks(blockPointers);
+		}
+
+		// endregion
+	}
+
+	// region basic
+
+	TEST(TEST_CLASS, CanProcessZeroEntities) {
+		// Arrange:
+		TestContext context(3);
+
+		// Assert:
+		test::AssertPassthroughForEmptyInput(context.consumer());
+		EXPECT_EQ(0u, context.numResolverContextFactoryCalls());
+		EXPECT_EQ(0u, context.numLoads());
+	}
+
+	TEST(TEST_CLASS, ConsumerDoesNotWaitForStateToBeLoaded) {
+		// Arrange:
+		TestContext context(3);
+		auto input = CreateInputWithBlocks(5);
+		context.blockLoader();
+
+		// Act:
+		auto result = context.consumer()(input.blocks());
+
+		// Assert: the consumer completed while the loader is still blocked
+		test::AssertContinued(result);
+		EXPECT_EQ(0u, context.numLoads());
+
+		// - unblock the loader and wait for all loads
+		context.unblockLoader();
+		WAIT_FOR_VALUE_EXPR(2u, context.numLoads());
+	}
+
+	TEST(TEST_CLASS, ConsumerDestructionWaitsForPendingLoads) {
+		// Arrange:
+		TestContext context(3);
+		auto input = CreateInputWithBlocks(5);
+		context.blockLoader();
+		context.consumer()(input.blocks());
+
+		// Act: destroy the consumer while the loads are blocked
+		std::atomic_bool isDestroyed(false);
+		std::thread destroyThread([&context, &isDestroyed]() {
+			context.destroyConsumer();
+			isDestroyed = true;
+		});
+
+		test::Pause();
+		auto isDestroyedWhileBlocked = isDestroyed.load();
+
+		context.unblockLoader();
+		destroyThread.join();
+
+		// Assert: the consumer was only destroyed after all loads completed
+		EXPECT_FALSE(isDestroyedWhileBlocked);
+		EXPECT_TRUE(isDestroyed);
+		EXPECT_EQ(2u, context.numLoads());
+	}
+
+	// endregion
+
+	// region chunking
+
+	namespace {
+		void AssertLoadedInChunks(uint32_t maxBlocksPerPrefetch, size_t numBlocks, const std::vector<size_t>& expectedChunkEndIndexes) {
+			// Arrange:
+			TestContext context(maxBlocksPerPrefetch);
+			auto input = CreateInputWithBlocks(numBlocks);
+
+			// Act:
+			auto result = context.consumer()(input.blocks());
+			WAIT_FOR_VALUE_EXPR(expectedChunkEndIndexes.size(), context.numLoads());
+
+			// Assert: keys of each chunk are resolved using a separate resolver context (and cache view)
+			test::AssertContinued(result);
+			EXPECT_EQ(expectedChunkEndIndexes.size(), context.numResolverContextFactoryCalls());
+
+			// - keys of consecutive blocks are loaded together (single pool thread preserves order)
+			auto loadedAddresses = context.loadedAddresses();
+			ASSERT_EQ(expectedChunkEndIndexes.size(), loadedAddresses.size());
+
+			auto startIndex = 0u;
+			for (auto i = 0u; i < expectedChunkEndIndexes.size(); ++i) {
+				auto expectedAddresses = GetExpectedAddresses(input.blocks(), startIndex, expectedChunkEndIndexes[i]);
+				EXPECT_EQ(3 * (expectedChunkEndIndexes[i] - startIndex), expectedAddresses.size()) << "chunk " << i;
+				EXPECT_EQ(expectedAddresses, loadedAddresses[i]) << "chunk " << i;
+				startIndex = static_cast<uint32_t>(expectedChunkEndIndexes[i]);
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, CanLoadAllBlocksTogether) {
+		AssertLoadedInChunks(5, 5, { 5 });
+		AssertLoadedInChunks(10, 5, { 5 });
+	}
+
+	TEST(TEST_CLASS, CanLoadBlocksInChunks) {
+		AssertLoadedInChunks(2, 5, { 2, 4, 5 });
+		AssertLoadedInChunks(3, 6, { 3, 6 });
+	}
+
+	TEST(TEST_CLASS, CanLoadEachBlockSeparately) {
+		AssertLoadedInChunks(1, 3, { 1, 2, 3 });
+	}
+
+	TEST(TEST_CLASS, ZeroMaxBlocksPerPrefetchLoadsEachBlockSeparately) {
+		AssertLoadedInChunks(0, 3, { 1, 2, 3 });
+	}
+
+	// endregion
+}}
@@ -22,6 +22,7 @@
 #include "catapult/crypto/Hashes.h"
 #include "catapult/utils/HexParser.h"
 #include "tests/TestHarness.h"
+#include <set>
 
 namespace catapult { namespace crypto {
 
@@ -756,4 +757,120 @@ namespace catapult { namespace crypto {
 	}
 
 	// endregion
+
+	// region Sha3_256Multi
+
+	namespace {
+		std::vector<Hash256> CalculateSha3_256Multi(size_t maxLanes, const std::vector<RawBuffer>& buffers, size_t numBuffersPerMessage) {
+			std::vector<Hash256> hashes(buffers.size() / numBuffersPerMessage);
+			Sha3_256Multi(maxLanes, buffers.data(), numBuffersPerMessage, hashes.size(), hashes.data());
+			return hashes;
+		}
+
+		template<size_t Max_Lanes>
+		void AssertSha3_256MultiMatchesSingleCallVariant(const std::vector<size_t>& messageSizes) {
+			// Arrange:
+			std::vector<std::vector<uint8_t>> messages;
+			std::vector<RawBuffer> buffers;
+			for (auto messageSize : messageSizes)
+				messages.push_back(test::GenerateRandomVector(messageSize));
+
+			for (const auto& message : messages)
+				buffers.push_back(message);
+
+			// Act:
+			auto hashes = CalculateSha3_256Multi(Max_Lanes, buffers, 1);
+
+			// Assert:
+			ASSERT_EQ(messages.size(), hashes.size());
+			for (auto i = 0u; i < messages.size(); ++i) {
+				Hash256 expectedHash;
+				Sha3_256(messages[i], expectedHash);
+				EXPECT_EQ(expectedHash, hashes[i]) << "message at " << i << " with size " << messages[i].size();
+			}
+		}
+	}
+
+#define SHA3_MULTI_LANES_TEST(TEST_NAME) \
+	template<size_t Max_Lanes> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
+	TEST(TEST_CLASS, TEST_NAME##_OneLane) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<1>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_FourLanes) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<4>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_EightLanes) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<8>(); } \
+	template<size_t Max_Lanes> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
+
+	TEST(TEST_CLASS, Sha3_256MultiMaxLanesIsSupportedLaneCount) {
+		// Act:
+		auto maxLanes = Sha3_256MultiMaxLanes();
+
+		// Assert:
+		EXPECT_CONTAINS(std::set<size_t>({ 1, 4, 8 }), maxLanes);
+	}
+
+	SHA3_MULTI_LANES_TEST(Sha3_256Multi_CanHashZeroMessages) {
+		// Act:
+		auto hashes = CalculateSha3_256Multi(Max_Lanes, {}, 1);
+
+		// Assert:
+		EXPECT_TRUE(hashes.empty());
+	}
+
+	SHA3_MULTI_LANES_TEST(Sha3_256Multi_SampleTestVectors) {
+		// Arrange:
+		std::vector<std::vector<uint8_t>> messages;
+		std::vector<RawBuffer> buffers;
+		for (const auto& input : Sha3_256_Traits::SampleTestVectorsInput())
+			messages.push_back(test::HexStringToVector(input));
+
+		for (const auto& message : messages)
+			buffers.push_back(message);
+
+		// Act:
+		auto hashes = CalculateSha3_256Multi(Max_Lanes, buffers, 1);
+
+		// Assert:
+		auto expectedHashes = Sha3_256_Traits::SampleTestVectorsOutput();
+		ASSERT_EQ(expectedHashes.size(), hashes.size());
+		for (auto i = 0u; i < expectedHashes.size(); ++i)
+			EXPECT_EQ(utils::ParseByteArray<Hash256>(expectedHashes[i]), hashes[i]) << "test vector at " << i;
+	}
+
+	SHA3_MULTI_LANES_TEST(Sha3_256Multi_SingleMessageMatchesSingleCallVariant) {
+		AssertSha3_256MultiMatchesSingleCallVariant<Max_Lanes>({ 100 });
+	}
+
+	SHA3_MULTI_LANES_TEST(Sha3_256Multi_EqualSizeMessagesMatchSingleCallVariant) {
+		AssertSha3_256MultiMatchesSingleCallVariant<Max_Lanes>(std::vector<size_t>(17, 64));
+	}
+
+	SHA3_MULTI_LANES_TEST(Sha3_256Multi_DifferentSizeMessagesMatchSingleCallVariant) {
+		// Assert: sizes around rate (136) boundaries
+		AssertSha3_256MultiMatchesSingleCallVariant<Max_Lanes>({ 0, 1, 135, 136, 137, 271, 272, 273, 1000, 7, 64, 0, 500, 2, 136 });
+	}
+
+	SHA3_MULTI_LANES_TEST(Sha3_256Multi_MessagesAreConcatenationsOfBuffers) {
+		// Arrange: each message is composed of three buffers, some of which are empty
+		std::vector<std::vector<uint8_t>> parts;
+		for (auto size : { 64, 32, 0, 0, 0, 0, 100, 36, 200, 1, 135, 1, 0, 136, 0 })
+			parts.push_back(test::GenerateRandomVector(static_cast<size_t>(size)));
+
+		std::vector<RawBuffer> buffers;
+		for (const auto& part : parts)
+			buffers.push_back(part);
+
+		// Act:
+		auto hashes = CalculateSha3_256Multi(Max_Lanes, buffers, 3);
+
+		// Assert:
+		ASSERT_EQ(5u, hashes.size());
+		for (auto i = 0u; i < hashes.size(); ++i) {
+			Sha3_256_Builder builder;
+			builder.update({ buffers[3 * i], buffers[3 * i + 1], buffers[3 * i + 2] });
+
+			Hash256 expectedHash;
+			builder.final(expectedHash);
+			EXPECT_EQ(expectedHash, hashes[i]) << "message at " << i;
+		}
+	}
+
+	// endregion
 }}
@@ -0,0 +1,337 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/crypto/IncrementalMerkleHashBuilder.h"
+#include "catapult/crypto/Hashes.h"
+#include "catapult/crypto/MerkleHashBuilder.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace crypto {
+
+#define TEST_CLASS IncrementalMerkleHashBuilderTests
+
+	namespace {
+		using Hashes = std::vector<Hash256>;
+
+		Hash256 CalculateExpectedMerkleHash(const Hashes& hashes) {
+			MerkleHashBuilder builder;
+			for (const auto& hash : hashes)
+				builder.update(hash);
+
+			Hash256 merkleHash;
+			builder.final(merkleHash);
+			return merkleHash;
+		}
+
+		Hashes CalculateExpectedMerkleTree(const Hashes& hashes) {
+			MerkleHashBuilder builder;
+			for (const auto& hash : hashes)
+				builder.update(hash);
+
+			Hashes tree;
+			builder.final(tree);
+			return tree;
+		}
+
+		void AssertMerkleHash(IncrementalMerkleHashBuilder& builder, const Hashes& hashes, const std::string& message = std::string()) {
+			Hash256 merkleHash;
+			builder.final(merkleHash);
+
+			EXPECT_EQ(hashes.size(), builder.size()) << message;
+			EXPECT_EQ(CalculateExpectedMerkleHash(hashes), merkleHash) << message;
+		}
+
+		class CountingParentHasher {
+		public:
+			MerkleParentHasher hasher() {
+				return [this](const auto* pBuffers, auto count, auto* pHashes) {
+					m_numHashes += count;
+					Sha3_256Multi(pBuffers, 2, count, pHashes);
+				};
+			}
+
+			size_t numHashes() const {
+				return m_numHashes;
+			}
+
+		private:
+			size_t m_numHashes = 0;
+		};
+	}
+
+	// region basic
+
+	TEST(TEST_CLASS, CanCreateEmptyBuilder) {
+		// Act:
+		IncrementalMerkleHashBuilder builder;
+
+		// Assert:
+		EXPECT_EQ(0u, builder.size());
+		AssertMerkleHash(builder, {});
+	}
+
+	TEST(TEST_CLASS, CanCalculateMerkleHashForSingleLeaf) {
+		// Arrange:
+		auto hash = test::GenerateRandomByteArray<Hash256>();
+		IncrementalMerkleHashBuilder builder;
+
+		// Act:
+		builder.update(hash);
+
+		// Assert:
+		Hash256 merkleHash;
+		builder.final(merkleHash);
+		EXPECT_EQ(hash, merkleHash);
+	}
+
+	TEST(TEST_CLASS, MerkleHashMatchesMerkleHashBuilder) {
+		for (auto numLeaves : { 2u, 3u, 4u, 5u, 7u, 8u, 9u, 16u, 17u, 100u, 1000u }) {
+			// Arrange:
+			auto hashes = test::GenerateRandomDataVector<Hash256>(numLeaves);
+			IncrementalMerkleHashBuilder builder;
+
+			// Act:
+			for (const auto& hash : hashes)
+				builder.update(hash);
+
+			// Assert:
+			AssertMerkleHash(builder, hashes, "leaves " + std::to_string(numLeaves));
+		}
+	}
+
+	TEST(TEST_CLASS, MerkleTreeMatchesMerkleHashBuilder) {
+		for (auto numLeaves : { 0u, 1u, 2u, 3u, 5u, 8u, 9u, 100u }) {
+			// Arrange:
+			auto hashes = test::GenerateRandomDataVector<Hash256>(numLeaves);
+			IncrementalMerkleHashBuilder builder;
+			for (const auto& hash : hashes)
+				builder.update(hash);
+
+			// Act:
+			Hashes tree;
+			builder.final(tree);
+
+			// Assert:
+			EXPECT_EQ(CalculateExpectedMerkleTree(hashes), tree) << "leaves " << numLeaves;
+		}
+	}
+
+	TEST(TEST_CLASS, CanUseCustomParentHasher) {
+		// Arrange:
+		CountingParentHasher parentHasher;
+		auto hashes = test::GenerateRandomDataVector<Hash256>(5);
+		IncrementalMerkleHashBuilder builder(parentHasher.hasher());
+		for (const auto& hash : hashes)
+			builder.update(hash);
+
+		// Act + Assert: 3 + 2 + 1 parents
+		AssertMerkleHash(builder, hashes);
+		EXPECT_EQ(6u, parentHasher.numHashes());
+	}
+
+	// endregion
+
+	// region update
+
+	TEST(TEST_CLASS, CanCalculateMerkleHashAfterEachUpdate) {
+		// Arrange:
+		auto hashes = test::GenerateRandomDataVector<Hash256>(33);
+		IncrementalMerkleHashBuilder builder;
+
+		for (auto i = 0u; i < hashes.size(); ++i) {
+			// Act:
+			builder.update(hashes[i]);
+
+			// Assert:
+			AssertMerkleHash(builder, Hashes(hashes.cbegin(), hashes.cbegin() + i + 1), "leaves " + std::to_string(i + 1));
+		}
+	}
+
+	TEST(TEST_CLASS, UpdateRehashesSinglePath) {
+		// Arrange: 16 leaves => 4 levels above the leaves
+		CountingParentHasher parentHasher;
+		auto hashes = test::GenerateRandomDataVector<Hash256>(17);
+		IncrementalMerkleHashBuilder builder(parentHasher.hasher());
+		for (auto i = 0u; i < 16; ++i)
+			builder.update(hashes[i]);
+
+		Hash256 merkleHash;
+		builder.final(merkleHash);
+		auto numInitialHashes = parentHasher.numHashes();
+
+		// Act: 17 leaves => 5 levels above the leaves
+		builder.update(hashes[16]);
+
+		// Assert:
+		AssertMerkleHash(builder, hashes);
+		EXPECT_EQ(15u, numInitialHashes);
+		EXPECT_EQ(15u + 5, parentHasher.numHashes());
+	}
+
+	// endregion
+
+	// region replace
+
+	TEST(TEST_CLASS, CanReplaceLeaves) {
+		// Arrange:
+		auto hashes = test::GenerateRandomDataVector<Hash256>(11);
+		IncrementalMerkleHashBuilder builder;
+		for (const auto& hash : hashes)
+			builder.update(hash);
+
+		AssertMerkleHash(builder, hashes);
+
+		for (auto index : { 0u, 5u, 10u, 5u }) {
+			// Act:
+			hashes[index] = test::GenerateRandomByteArray<Hash256>();
+			builder.replace(index, hashes[index]);
+
+			// Assert:
+			AssertMerkleHash(builder, hashes, "index " + std::to_string(index));
+		}
+	}
+
+	TEST(TEST_CLASS, CanReplaceMultipleLeavesBeforeCalculatingMerkleHash) {
+		// Arrange:
+		auto hashes = test::GenerateRandomDataVector<Hash256>(11);
+		IncrementalMerkleHashBuilder builder;
+		for (const auto& hash : hashes)
+			builder.update(hash);
+
+		AssertMerkleHash(builder, hashes);
+
+		// Act:
+		for (auto index : { 1u, 6u, 9u }) {
+			hashes[index] = test::GenerateRandomByteArray<Hash256>();
+			builder.replace(index, hashes[index]);
+		}
+
+		// Assert:
+		AssertMerkleHash(builder, hashes);
+	}
+
+	TEST(TEST_CLASS, ReplaceRehashesSinglePath) {
+		// Arrange:
+		CountingParentHasher parentHasher;
+		auto hashes = test::GenerateRandomDataVector<Hash256>(16);
+		IncrementalMerkleHashBuilder builder(parentHasher.hasher());
+		for (const auto& hash : hashes)
+			builder.update(hash);
+
+		AssertMerkleHash(builder, hashes);
+
+		// Act:
+		hashes[6] = test::GenerateRandomByteArray<Hash256>();
+		builder.replace(6, hashes[6]);
+
+		// Assert: 16 leaves => 4 levels above the leaves
+		AssertMerkleHash(builder, hashes);
+		EXPECT_EQ(15u + 4, parentHasher.numHashes());
+	}
+
+	TEST(TEST_CLASS, CannotReplaceLeafWithOutOfRangeIndex) {
+		// Arrange:
+		IncrementalMerkleHashBuilder builder;
+		for (const auto& hash : test::GenerateRandomDataVector<Hash256>(5))
+			builder.update(hash);
+
+		// Act + Assert:
+		EXPECT_THROW(builder.replace(5, test::GenerateRandomByteArray<Hash256>()), catapult_out_of_range);
+	}
+
+	// endregion
+
+	// region removeLast
+
+	TEST(TEST_CLASS, CanCalculateMerkleHashAfterEachRemoval) {
+		// Arrange:
+		auto hashes = test::GenerateRandomDataVector<Hash256>(33);
+		IncrementalMerkleHashBuilder builder;
+		for (const auto& hash : hashes)
+			builder.update(hash);
+
+		AssertMerkleHash(builder, hashes);
+
+		while (!hashes.empty()) {
+			// Act:
+			builder.removeLast();
+			hashes.pop_back();
+
+			// Assert:
+			AssertMerkleHash(builder, hashes, "leaves " + std::to_string(hashes.size()));
+		}
+	}
+
+	TEST(TEST_CLASS, CanRemoveReplacedLeavesBeforeCalculatingMerkleHash) {
+		// Arrange:
+		auto hashes = test::GenerateRandomDataVector<Hash256>(11);
+		IncrementalMerkleHashBuilder builder;
+		for (const auto& hash : hashes)
+			builder.update(hash);
+
+		AssertMerkleHash(builder, hashes);
+
+		// Act:
+		builder.replace(9, test::GenerateRandomByteArray<Hash256>());
+		builder.replace(10, test::GenerateRandomByteArray<Hash256>());
+		builder.removeLast();
+		builder.removeLast();
+		hashes.resize(9);
+
+		// Assert:
+		AssertMerkleHash(builder, hashes);
+	}
+
+	TEST(TEST_CLASS, CanAddLeavesAfterRemoval) {
+		// Arrange:
+		auto hashes = test::GenerateRandomDataVector<Hash256>(9);
+		IncrementalMerkleHashBuilder builder;
+		for (const auto& hash : hashes)
+			builder.update(hash);
+
+		AssertMerkleHash(builder, hashes);
+
+		// Act:
+		for (auto i = 0u; i < 7; ++i)
+			builder.removeLast();
+
+		hashes.resize(2);
+		AssertMerkleHash(builder, hashes);
+
+		for (const auto& hash : test::GenerateRandomDataVector<Hash256>(4)) {
+			builder.update(hash);
+			hashes.push_back(hash);
+		}
+
+		// Assert:
+		AssertMerkleHash(builder, hashes);
+	}
+
+	TEST(TEST_CLASS, CannotRemoveLeafFromEmptyBuilder) {
+		// Arrange:
+		IncrementalMerkleHashBuilder builder;
+
+		// Act + Assert:
+		EXPECT_THROW(builder.removeLast(), catapult_out_of_range);
+	}
+
+	// endregion
+}}
@@ -116,11 +116,10 @@ namespace catapult { namespace crypto {
 		}
 
 		template<typename TTraits, typename TMutator>
-		void AssertSignedPayloadsCannotBeVerifiedAsBatches(TMutator mutator) {
+		void AssertSignedPayloadsCannotBeVerifiedAsBatches(size_t count, std::unordered_set<size_t>&& failedIndexes, TMutator mutator) {
 			// Arrange:
 			DataHolder dataHolder;
-			auto signatureInputs = CreateSignatureInputs(Default_Signature_Count, dataHolder);
-			std::unordered_set<size_t> failedIndexes{ 1, 17, 58 };
+			auto signatureInputs = CreateSignatureInputs(count, dataHolder);
 			for (auto index : failedIndexes)
 				mutator(signatureInputs, index);
 
@@ -131,6 +130,15 @@ namespace catapult { namespace crypto {
 			TTraits::AssertVerifyResult(result, false, failedIndexes);
 		}
 
+		template<typename TTraits, typename TMutator>
+		void AssertSignedPayloadsCannotBeVerifiedAsBatches(TMutator mutator) {
+			AssertSignedPayloadsCannotBeVerifiedAsBatches<TTraits>(Default_Signature_Count, { 1, 17, 58 }, mutator);
+		}
+
+		void CorruptSignature(std::vector<SignatureInput>& signatureInputs, size_t index) {
+			const_cast<Signature&>(signatureInputs[index].Signature)[5] ^= 0xFF;
+		}
+
 		RandomFiller CreateRandomFiller() {
 			return [](auto* pOut, auto count) {
 				// can use low entropy source for tests
@@ -233,6 +241,14 @@ namespace catapult { namespace crypto {
 		});
 	}
 
+	VERIFY_MULTI_TEST(SignedPayloadsCannotBeVerifiedAsBatches_FailureInSecondBatch) {
+		AssertSignedPayloadsCannotBeVerifiedAsBatches<TTraits>(Default_Signature_Count, { 70, 98 }, CorruptSignature);
+	}
+
+	VERIFY_MULTI_TEST(SignedPayloadsCannotBeVerifiedAsBatches_FailureInSignaturesNotBatchVerified) {
+		AssertSignedPayloadsCannotBeVerifiedAsBatches<TTraits>(66, { 65 }, CorruptSignature); // last two signatures are not batch verified
+	}
+
 	VERIFY_MULTI_TEST(SignedPayloadsCannotBeVerifiedAsBatches_NonCanonicalSignature) {
 		AssertSignedPayloadsCannotBeVerifiedAsBatches<TTraits>([](auto& signatureInputs, auto index) {
 			auto payload = SignVerifyTraits::GetPayloadForNonCanonicalSignatureTest();
@@ -22,6 +22,7 @@
 #include "catapult/disruptor/BatchRangeDispatcher.h"
 #include "tests/test/core/BlockTestUtils.h"
 #include "tests/TestHarness.h"
+#include <mutex>
 
 namespace catapult { namespace disruptor {
 
@@ -291,4 +292,144 @@ namespace catapult { namespace disruptor {
 	}
 
 	// endregion
+
+	// region dispatch (coalescing)
+
+	namespace {
+		struct CoalescedInputInfo {
+			InputSource Source;
+			size_t NumPartitions;
+			std::vector<Height::ValueType> Heights;
+		};
+
+		class CoalescedInputCollector {
+		public:
+			size_t size() const {
+				std::lock_guard<std::mutex> guard(m_mutex);
+				return m_inputInfos.size();
+			}
+
+			// sort by source and then by number of blocks to make comparisons independent of dispatch order
+			std::vector<CoalescedInputInfo> sortedInputInfos() const {
+				std::lock_guard<std::mutex> guard(m_mutex);
+				auto inputInfos = m_inputInfos;
+				std::sort(inputInfos.begin(), inputInfos.end(), [](const auto& lhs, const auto& rhs) {
+					return std::make_pair(lhs.Source, lhs.Heights.size()) < std::make_pair(rhs.Source, rhs.Heights.size());
+				});
+				return inputInfos;
+			}
+
+		public:
+			void insert(ConsumerInput&& input) {
+				CoalescedInputInfo inputInfo{ input.source(), input.partitions().size(), {} };
+				for (const auto& block : input.blocks())
+					inputInfo.Heights.push_back(block.Block.Height.unwrap());
+
+				std::sort(inputInfo.Heights.begin(), inputInfo.Heights.end());
+
+				std::lock_guard<std::mutex> guard(m_mutex);
+				m_inputInfos.push_back(std::move(inputInfo));
+			}
+
+		private:
+			std::vector<CoalescedInputInfo> m_inputInfos;
+			mutable std::mutex m_mutex;
+		};
+
+		template<typename TQueueFunc>
+		std::vector<CoalescedInputInfo> RunCoalescingTest(size_t maxCoalescedSize, size_t numExpectedInputs, TQueueFunc queue) {
+			// Arrange:
+			CoalescedInputCollector collector;
+			auto inputCaptureConsumer = [&collector](auto&& input) {
+				collector.insert(std::move(input));
+				return ConsumerResult::Continue();
+			};
+
+			ConsumerDispatcher dispatcher({ "BatchDispatcherTests", 16u }, { inputCaptureConsumer });
+			BatchBlockRangeDispatcher batchDispatcher(dispatcher, Default_Equality_Strategy, maxCoalescedSize);
+			queue(batchDispatcher);
+
+			// Act:
+			batchDispatcher.dispatch();
+
+			// Assert:
+			EXPECT_TRUE(batchDispatcher.empty());
+			EXPECT_EQ(numExpectedInputs, dispatcher.numAddedElements());
+
+			// - wait for processing to finish
+			WAIT_FOR_VALUE_EXPR(numExpectedInputs, collector.size());
+			return collector.sortedInputInfos();
+		}
+
+		void AssertCoalescedInput(
+				const CoalescedInputInfo& inputInfo,
+				InputSource expectedSource,
+				size_t expectedNumPartitions,
+				const std::vector<Height::ValueType>& expectedHeights) {
+			EXPECT_EQ(expectedSource, inputInfo.Source);
+			EXPECT_EQ(expectedNumPartitions, inputInfo.NumPartitions);
+			EXPECT_EQ(expectedHeights, inputInfo.Heights);
+		}
+	}
+
+	TEST(TEST_CLASS, DispatchWithCoalescingCanForwardRangesFromDifferentIdentitiesAsSingleInput) {
+		// Act:
+		auto inputInfos = RunCoalescingTest(10, 1, [](auto& batchDispatcher) {
+			auto keys = test::GenerateRandomDataVector<Key>(3);
+			batchDispatcher.queue({ CreateBlockEntityRange(3, Height(6)), { keys[0], "a" } }, InputSource::Remote_Push);
+			batchDispatcher.queue({ CreateBlockEntityRange(2, Height(20)), { keys[1], "a" } }, InputSource::Remote_Push);
+			batchDispatcher.queue({ CreateBlockEntityRange(1, Height(9)), { keys[0], "a" } }, InputSource::Remote_Push);
+			batchDispatcher.queue({ CreateBlockEntityRange(1, Height(30)), { keys[2], "a" } }, InputSource::Remote_Push);
+		});
+
+		// Assert:
+		ASSERT_EQ(1u, inputInfos.size());
+		AssertCoalescedInput(inputInfos[0], InputSource::Remote_Push, 3, { 6, 7, 8, 9, 20, 21, 30 });
+	}
+
+	TEST(TEST_CLASS, DispatchWithCoalescingDoesNotCoalesceRangesFromDifferentSources) {
+		// Act:
+		auto inputInfos = RunCoalescingTest(10, 2, [](auto& batchDispatcher) {
+			auto keys = test::GenerateRandomDataVector<Key>(3);
+			batchDispatcher.queue({ CreateBlockEntityRange(3, Height(6)), { keys[0], "a" } }, InputSource::Local);
+			batchDispatcher.queue({ CreateBlockEntityRange(2, Height(20)), { keys[1], "a" } }, InputSource::Remote_Push);
+			batchDispatcher.queue({ CreateBlockEntityRange(1, Height(30)), { keys[2], "a" } }, InputSource::Remote_Push);
+		});
+
+		// Assert: single identity inputs are not partitioned
+		ASSERT_EQ(2u, inputInfos.size());
+		AssertCoalescedInput(inputInfos[0], InputSource::Local, 0, { 6, 7, 8 });
+		AssertCoalescedInput(inputInfos[1], InputSource::Remote_Push, 2, { 20, 21, 30 });
+	}
+
+	TEST(TEST_CLASS, DispatchWithCoalescingForwardsMultipleInputsWhenMaxCoalescedSizeIsExceeded) {
+		// Act:
+		auto inputInfos = RunCoalescingTest(4, 2, [](auto& batchDispatcher) {
+			auto keys = test::GenerateRandomDataVector<Key>(3);
+			batchDispatcher.queue({ CreateBlockEntityRange(2, Height(10)), { keys[0], "a" } }, InputSource::Remote_Push);
+			batchDispatcher.queue({ CreateBlockEntityRange(2, Height(10)), { keys[1], "a" } }, InputSource::Remote_Push);
+			batchDispatcher.queue({ CreateBlockEntityRange(2, Height(10)), { keys[2], "a" } }, InputSource::Remote_Push);
+		});
+
+		// Assert:
+		ASSERT_EQ(2u, inputInfos.size());
+		AssertCoalescedInput(inputInfos[0], InputSource::Remote_Push, 0, { 10, 11 });
+		AssertCoalescedInput(inputInfos[1], InputSource::Remote_Push, 2, { 10, 10, 11, 11 });
+	}
+
+	TEST(TEST_CLASS, DispatchWithCoalescingForwardsRangeLargerThanMaxCoalescedSizeAlone) {
+		// Act:
+		auto inputInfos = RunCoalescingTest(3, 2, [](auto& batchDispatcher) {
+			auto keys = test::GenerateRandomDataVector<Key>(2);
+			batchDispatcher.queue({ CreateBlockEntityRange(5, Height(10)), { keys[0], "a" } }, InputSource::Remote_Push);
+			batchDispatcher.queue({ CreateBlockEntityRange(1, Height(30)), { keys[1], "a" } }, InputSource::Remote_Push);
+		});
+
+		// Assert:
+		ASSERT_EQ(2u, inputInfos.size());
+		AssertCoalescedInput(inputInfos[0], InputSource::Remote_Push, 0, { 30 });
+		AssertCoalescedInput(inputInfos[1], InputSource::Remote_Push, 0, { 10, 11, 12, 13, 14 });
+	}
+
+	// endregion
 }}
@@ -475,6 +475,93 @@ namespace catapult { namespace disruptor {
 
 	// endregion
 
+	// region wait strategies
+
+#define WAIT_STRATEGY_BASED_TEST(TEST_NAME) \
+	template<ConsumerWaitStrategy TWaitStrategy> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
+	TEST(TEST_CLASS, TEST_NAME##_BusySpin) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<ConsumerWaitStrategy::Busy_Spin>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_SpinThenBlock) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<ConsumerWaitStrategy::Spin_Then_Block>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_Block) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<ConsumerWaitStrategy::Block>(); } \
+	template<ConsumerWaitStrategy TWaitStrategy> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
+
+	namespace {
+		template<ConsumerWaitStrategy WaitStrategy>
+		ConsumerDispatcherOptions CreateOptionsWithWaitStrategy() {
+			auto options = Test_Dispatcher_Options;
+			options.WaitStrategy = WaitStrategy;
+			return options;
+		}
+	}
+
+	WAIT_STRATEGY_BASED_TEST(CanConsumeAndInspectAllElementsWithMultipleConsumers) {
+		// Arrange:
+		auto ranges = test::PrepareRanges(5);
+		auto expectedHeights = GetExpectedHeights(ranges);
+		CollectedHeights collectedHeights[3];
+		CollectedHeights inspectedHeights;
+		std::vector<CompletionStatus> inspectedStatuses;
+
+		// Act:
+		ConsumerDispatcher dispatcher(
+				CreateOptionsWithWaitStrategy<TWaitStrategy>(),
+				{
+					CreateConsumer(collectedHeights[0]),
+					CreateConsumer(collectedHeights[1]),
+					CreateConsumer(collectedHeights[2])
+				},
+				CreateCollectingInspector(inspectedHeights, inspectedStatuses));
+
+		// - push multiple elements
+		ProcessAll(dispatcher, std::move(ranges));
+		WAIT_FOR_VALUE_EXPR(5u, inspectedHeights.size());
+		WAIT_FOR_ZERO_EXPR(dispatcher.numActiveElements());
+
+		// Assert:
+		EXPECT_EQ(expectedHeights, collectedHeights[0].get());
+		EXPECT_EQ(expectedHeights, collectedHeights[1].get());
+		EXPECT_EQ(expectedHeights, collectedHeights[2].get());
+		EXPECT_EQ(expectedHeights, inspectedHeights.get());
+		EXPECT_EQ(std::vector<CompletionStatus>(5, CompletionStatus::Normal), inspectedStatuses);
+	}
+
+	WAIT_STRATEGY_BASED_TEST(ConsumersAreWokenWhenElementsArePushedAfterIdlePeriod) {
+		// Arrange:
+		CollectedHeights collectedHeights[2];
+		CollectedHeights inspectedHeights;
+		std::vector<CompletionStatus> inspectedStatuses;
+		ConsumerDispatcher dispatcher(
+				CreateOptionsWithWaitStrategy<TWaitStrategy>(),
+				{ CreateConsumer(collectedHeights[0]), CreateConsumer(collectedHeights[1]) },
+				CreateCollectingInspector(inspectedHeights, inspectedStatuses));
+
+		// Act: push elements one by one and let consumers go idle (and block, if supported) in between
+		for (auto i = 1u; i <= 3; ++i) {
+			test::Sleep(20);
+			dispatcher.processElement(ConsumerInput(test::CreateBlockEntityRange(1)));
+			WAIT_FOR_VALUE_EXPR(i, inspectedHeights.size());
+		}
+
+		// Assert:
+		EXPECT_EQ(3u, collectedHeights[0].size());
+		EXPECT_EQ(3u, collectedHeights[1].size());
+		EXPECT_EQ(3u, inspectedHeights.size());
+	}
+
+	WAIT_STRATEGY_BASED_TEST(ShutdownStopsIdleConsumers) {
+		// Arrange:
+		ConsumerDispatcher dispatcher(CreateOptionsWithWaitStrategy<TWaitStrategy>(), { CreateNoOpConsumer(), CreateNoOpConsumer() });
+		test::Sleep(20);
+
+		// Act: shutdown does not deadlock when consumers are waiting
+		dispatcher.shutdown();
+
+		// Assert:
+		EXPECT_EQ(2u, dispatcher.size());
+		EXPECT_FALSE(dispatcher.isRunning());
+	}
+
+	// endregion
+
 	// region element marking
 
 	namespace {
@@ -549,6 +636,270 @@ namespace catapult { namespace disruptor {
 
 	// endregion
 
+	// region consumer stages
+
+	namespace {
+		void AssertCannotCreateWithStages(const std::vector<DisruptorConsumerStage>& consumerStages) {
+			// Act + Assert:
+			auto inspector = [](const auto&, const auto&) {};
+			EXPECT_THROW(ConsumerDispatcher(Test_Dispatcher_Options, consumerStages, inspector), catapult_invalid_argument);
+		}
+
+		auto CreateCountingConsumer(std::atomic<size_t>& counter) {
+			return [&counter](const auto&) {
+				++counter;
+				return ConsumerResult::Continue();
+			};
+		}
+	}
+
+	TEST(TEST_CLASS, CannotCreateDispatcherWithEmptyConsumerStage) {
+		AssertCannotCreateWithStages({ { CreateNoOpConsumer() }, {}, { CreateNoOpConsumer() } });
+	}
+
+	TEST(TEST_CLASS, CannotCreateDispatcherWithMultipleConsumersInLastStage) {
+		AssertCannotCreateWithStages({ { CreateNoOpConsumer() }, { CreateNoOpConsumer(), CreateNoOpConsumer() } });
+	}
+
+	TEST(TEST_CLASS, CanCreateDispatcherWithConsumerStages) {
+		// Arrange + Act:
+		std::vector<DisruptorConsumerStage> consumerStages{
+			{ CreateNoOpConsumer() },
+			{ CreateNoOpConsumer(), CreateNoOpConsumer(), CreateNoOpConsumer() },
+			{ CreateNoOpConsumer() }
+		};
+		ConsumerDispatcher dispatcher(Test_Dispatcher_Options, consumerStages, [](const auto&, const auto&) {});
+
+		// Assert:
+		EXPECT_EQ(Test_Dispatcher_Options.DispatcherName, dispatcher.name());
+		EXPECT_EQ(5u, dispatcher.size());
+		AssertHasProcessedNoElements(dispatcher);
+	}
+
+	TEST(TEST_CLASS, CanConsumeAndInspectAllElementsWithParallelConsumerStage) {
+		// Arrange:
+		auto ranges = test::PrepareRanges(5);
+		auto expectedHeights = GetExpectedHeights(ranges);
+		CollectedHeights collectedHeights[5];
+		CollectedHeights inspectedHeights;
+		std::vector<CompletionStatus> inspectedStatuses;
+
+		// Act:
+		std::vector<DisruptorConsumerStage> consumerStages{
+			{ CreateConsumer(collectedHeights[0]) },
+			{ CreateConsumer(collectedHeights[1]), CreateConsumer(collectedHeights[2]), CreateConsumer(collectedHeights[3]) },
+			{ CreateConsumer(collectedHeights[4]) }
+		};
+		ConsumerDispatcher dispatcher(
+				Test_Dispatcher_Options,
+				consumerStages,
+				CreateCollectingInspector(inspectedHeights, inspectedStatuses));
+
+		// - push multiple elements
+		ProcessAll(dispatcher, std::move(ranges));
+		WAIT_FOR_VALUE_EXPR(5u, inspectedHeights.size());
+		WAIT_FOR_ZERO_EXPR(dispatcher.numActiveElements());
+
+		// Assert:
+		EXPECT_EQ(ranges.size(), dispatcher.numAddedElements());
+		EXPECT_EQ(utils::FileSize(), dispatcher.memorySize());
+		for (auto i = 0u; i < 5; ++i)
+			EXPECT_EQ(expectedHeights, collectedHeights[i].get()) << i;
+
+		EXPECT_EQ(expectedHeights, inspectedHeights.get());
+		EXPECT_EQ(std::vector<CompletionStatus>(5, CompletionStatus::Normal), inspectedStatuses);
+	}
+
+	TEST(TEST_CLASS, NextStageWaitsForAllConsumersInParallelStage) {
+		// Arrange: block the second consumer of the parallel stage
+		test::AutoSetFlag continueFlag;
+		std::atomic<size_t> numFastConsumerCalls(0);
+		std::atomic<size_t> numLastConsumerCalls(0);
+		std::vector<DisruptorConsumerStage> consumerStages{
+			{
+				CreateCountingConsumer(numFastConsumerCalls),
+				[pContinueFlag = continueFlag.state()](const auto&) {
+					pContinueFlag->wait();
+					return ConsumerResult::Continue();
+				}
+			},
+			{ CreateCountingConsumer(numLastConsumerCalls) }
+		};
+		ConsumerDispatcher dispatcher(Test_Dispatcher_Options, consumerStages, [](const auto&, const auto&) {});
+
+		// Act:
+		ProcessAll(dispatcher, test::PrepareRanges(3));
+		WAIT_FOR_VALUE(3u, numFastConsumerCalls);
+		test::Pause();
+
+		// Assert: the last stage is waiting for the blocked consumer
+		EXPECT_EQ(0u, numLastConsumerCalls);
+		EXPECT_EQ(0u, dispatcher.consumerLag(0));
+		EXPECT_EQ(3u, dispatcher.consumerLag(1));
+		EXPECT_EQ(0u, dispatcher.consumerLag(2));
+
+		// Act: unblock the blocked consumer
+		continueFlag.state()->set();
+		WAIT_FOR_ZERO_EXPR(dispatcher.numActiveElements());
+
+		// Assert:
+		EXPECT_EQ(3u, numLastConsumerCalls);
+		for (auto i = 0u; i < 3; ++i)
+			EXPECT_EQ(0u, dispatcher.consumerLag(i)) << i;
+	}
+
+	TEST(TEST_CLASS, MarkedElementsInParallelStageAreSkippedBySubsequentStages) {
+		// Arrange:
+		CollectedHeights collectedHeights;
+		CollectedHeights inspectedHeights;
+		std::vector<CompletionStatus> inspectedStatuses;
+		auto ranges = test::PrepareRanges(5);
+		auto height = 0u;
+		for (auto& range : ranges)
+			range.begin()->Height = Height(++height);
+
+		auto expectedHeights = test::Filter(GetExpectedHeights(ranges), [](const auto& heights) {
+			return 1 == heights[0].unwrap() % 2;
+		});
+
+		// Act:
+		std::vector<DisruptorConsumerStage> consumerStages{
+			{ CreateNoOpConsumer(), CreateSkipIfFirstBlockIsEvenConsumer() },
+			{ CreateConsumer(collectedHeights) }
+		};
+		ConsumerDispatcher dispatcher(
+				Test_Dispatcher_Options,
+				consumerStages,
+				CreateCollectingInspector(inspectedHeights, inspectedStatuses));
+
+		// - push multiple elements
+		ProcessAll(dispatcher, std::move(ranges));
+		WAIT_FOR_VALUE_EXPR(5u, inspectedHeights.size());
+		WAIT_FOR_ZERO_EXPR(dispatcher.numActiveElements());
+
+		// Assert:
+		EXPECT_EQ(expectedHeights, collectedHeights.get());
+
+		// - ranges have heights 1-5, where even heights should be aborted
+		auto expectedStatuses = std::vector<CompletionStatus>(5, CompletionStatus::Normal);
+		expectedStatuses[1] = CompletionStatus::Aborted;
+		expectedStatuses[3] = CompletionStatus::Aborted;
+		EXPECT_EQ(expectedStatuses, inspectedStatuses);
+	}
+
+	// endregion
+
+	// region consumer statistics + lag
+
+	TEST(TEST_CLASS, CannotAccessConsumerStatisticsOrLagForUnknownLevel) {
+		// Arrange:
+		ConsumerDispatcher dispatcher(Test_Dispatcher_Options, { CreateNoOpConsumer(), CreateNoOpConsumer() });
+
+		// Act + Assert:
+		EXPECT_THROW(dispatcher.consumerStatistics(2), catapult_invalid_argument);
+		EXPECT_THROW(dispatcher.consumerLag(2), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, ConsumerStatisticsAreInitiallyEmpty) {
+		// Arrange:
+		ConsumerDispatcher dispatcher(Test_Dispatcher_Options, { CreateNoOpConsumer(), CreateNoOpConsumer() });
+
+		// Act + Assert:
+		for (auto level = 0u; level < 2; ++level) {
+			EXPECT_EQ(0u, dispatcher.consumerStatistics(level).WaitTimes.count()) << level;
+			EXPECT_EQ(0u, dispatcher.consumerStatistics(level).ProcessingTimes.count()) << level;
+			EXPECT_EQ(0u, dispatcher.consumerLag(level)) << level;
+		}
+	}
+
+	TEST(TEST_CLASS, ConsumerStatisticsAreRecordedForAllConsumers) {
+		// Arrange: second consumer is slow
+		std::atomic<size_t> numInspectorCalls(0);
+		ConsumerDispatcher dispatcher(
+				Test_Dispatcher_Options,
+				{
+					CreateNoOpConsumer(),
+					[](const auto&) {
+						test::Sleep(5);
+						return ConsumerResult::Continue();
+					},
+					CreateNoOpConsumer()
+				},
+				[&numInspectorCalls](const auto&, const auto&) { ++numInspectorCalls; });
+
+		// Act:
+		ProcessAll(dispatcher, test::PrepareRanges(4));
+		WAIT_FOR_VALUE(4u, numInspectorCalls);
+
+		// Assert: all consumers recorded all elements
+		for (auto level = 0u; level < 3; ++level) {
+			const auto& statistics = dispatcher.consumerStatistics(level);
+			EXPECT_EQ(4u, statistics.WaitTimes.count()) << level;
+			EXPECT_EQ(4u, statistics.ProcessingTimes.count()) << level;
+			EXPECT_EQ(0u, dispatcher.consumerLag(level)) << level;
+		}
+
+		// - slow consumer processing times are recorded
+		EXPECT_LE(5'000u, dispatcher.consumerStatistics(1).ProcessingTimes.percentile(50));
+		EXPECT_LE(4 * 5'000u, dispatcher.consumerStatistics(1).ProcessingTimes.sum());
+
+		// - elements queued behind slow consumer had to wait (all elements were pushed at once, so at least the last one waited)
+		EXPECT_LE(5'000u, dispatcher.consumerStatistics(1).WaitTimes.max());
+	}
+
+	TEST(TEST_CLASS, ConsumerStatisticsAreNotRecordedForSkippedElements) {
+		// Arrange: first consumer aborts all elements
+		std::atomic<size_t> numInspectorCalls(0);
+		ConsumerDispatcher dispatcher(
+				Test_Dispatcher_Options,
+				{ [](const auto&) { return ConsumerResult::Abort(); }, CreateNoOpConsumer() },
+				[&numInspectorCalls](const auto&, const auto&) { ++numInspectorCalls; });
+
+		// Act:
+		ProcessAll(dispatcher, test::PrepareRanges(3));
+		WAIT_FOR_VALUE(3u, numInspectorCalls);
+
+		// Assert:
+		EXPECT_EQ(3u, dispatcher.consumerStatistics(0).ProcessingTimes.count());
+		EXPECT_EQ(0u, dispatcher.consumerStatistics(1).WaitTimes.count());
+		EXPECT_EQ(0u, dispatcher.consumerStatistics(1).ProcessingTimes.count());
+	}
+
+	TEST(TEST_CLASS, ConsumerLagReportsNumberOfElementsPendingForConsumer) {
+		// Arrange: block the second consumer
+		test::AutoSetFlag continueFlag;
+		std::atomic<size_t> numFirstConsumerCalls(0);
+		ConsumerDispatcher dispatcher(Test_Dispatcher_Options, {
+			[&numFirstConsumerCalls](const auto&) {
+				++numFirstConsumerCalls;
+				return ConsumerResult::Continue();
+			},
+			[pContinueFlag = continueFlag.state()](const auto&) {
+				pContinueFlag->wait();
+				return ConsumerResult::Continue();
+			},
+			CreateNoOpConsumer()
+		});
+
+		// Act:
+		ProcessAll(dispatcher, test::PrepareRanges(3));
+		WAIT_FOR_VALUE(3u, numFirstConsumerCalls);
+
+		// Assert: all elements are pending for the second consumer (one is being processed)
+		EXPECT_EQ(0u, dispatcher.consumerLag(0));
+		EXPECT_EQ(3u, dispatcher.consumerLag(1));
+		EXPECT_EQ(0u, dispatcher.consumerLag(2));
+
+		// Act: unblock the second consumer
+		continueFlag.state()->set();
+		WAIT_FOR_ZERO_EXPR(dispatcher.numActiveElements());
+
+		// Assert:
+		EXPECT_EQ(0u, dispatcher.consumerLag(1));
+	}
+
+	// endregion
+
 	// region consumer exception
 
 #ifdef __clang__
@@ -29,17 +29,18 @@ namespace catapult { namespace disruptor {
 	TEST(TEST_CLASS, CanCreateAnEntry) {
 		// Arrange:
 		auto level = 123u;
-		ConsumerEntry consumer(level);
+		ConsumerEntry consumer(level, 456);
 
 		// Assert:
 		EXPECT_EQ(123u, consumer.level());
+		EXPECT_EQ(456u, consumer.index());
 		EXPECT_EQ(0u, consumer.position());
 	}
 
 	TEST(TEST_CLASS, CanAdvanceConsumerPosition) {
 		// Arrange:
 		auto level = 123u;
-		ConsumerEntry consumer(level);
+		ConsumerEntry consumer(level, 456);
 
 		// Act:
 		for (auto i = 0; i < 10; ++i)
@@ -47,6 +48,7 @@ namespace catapult { namespace disruptor {
 
 		// Assert:
 		EXPECT_EQ(123u, consumer.level());
+		EXPECT_EQ(456u, consumer.index());
 		EXPECT_EQ(10u, consumer.position());
 	}
 }}
@@ -32,6 +32,7 @@ namespace catapult { namespace disruptor {
 
 		struct BlockTraits : public test::BlockTraits {
 			using EntityType = model::Block;
+			using AnnotatedRangeType = model::AnnotatedBlockRange;
 
 			static auto GenerateRandomEntity(uint32_t size) {
 				return test::GenerateBlockWithTransactions(test::ConstTransactions{ test::GenerateRandomTransactionWithSize(size) });
@@ -44,6 +45,7 @@ namespace catapult { namespace disruptor {
 
 		struct TransactionTraits : public test::TransactionTraits {
 			using EntityType = model::Transaction;
+			using AnnotatedRangeType = model::AnnotatedTransactionRange;
 
 			static constexpr auto GenerateRandomEntity = test::GenerateRandomTransactionWithSize;
 
@@ -122,6 +124,7 @@ namespace catapult { namespace disruptor {
 		TTraits::AssertInput(input, 3, entities, InputSource::Local);
 		EXPECT_EQ(identityKey, input.sourceIdentity().PublicKey);
 		EXPECT_EQ("11.22.33.44", input.sourceIdentity().Host);
+		EXPECT_TRUE(input.partitions().empty());
 	}
 
 	ENTITY_TRAITS_BASED_TEST(CanCreateConsumerInputAroundSingleEntity) {
@@ -132,6 +135,57 @@ namespace catapult { namespace disruptor {
 		AssertConsumerInputCreation<TTraits>({ 143, 143, 143 });
 	}
 
+	namespace {
+		void AssertPartition(
+				const ConsumerInputPartition& partition,
+				const model::NodeIdentity& expectedSourceIdentity,
+				size_t expectedStartIndex,
+				size_t expectedSize) {
+			EXPECT_EQ(expectedSourceIdentity.PublicKey, partition.SourceIdentity.PublicKey);
+			EXPECT_EQ(expectedSourceIdentity.Host, partition.SourceIdentity.Host);
+			EXPECT_EQ(expectedStartIndex, partition.StartIndex);
+			EXPECT_EQ(expectedSize, partition.Size);
+			EXPECT_EQ(CompletionStatus::Normal, partition.Result.CompletionStatus);
+		}
+	}
+
+	ENTITY_TRAITS_BASED_TEST(CanCreateConsumerInputAroundRangesFromMultipleSources) {
+		// Arrange:
+		std::vector<model::NodeIdentity> identities{
+			{ test::GenerateRandomByteArray<Key>(), "11.22.33.44" },
+			{ test::GenerateRandomByteArray<Key>(), "55.66.77.88" },
+			{ test::GenerateRandomByteArray<Key>(), "99.88.77.66" },
+			{ test::GenerateRandomByteArray<Key>(), "55.44.33.22" }
+		};
+
+		std::vector<typename TTraits::AnnotatedRangeType> ranges;
+		ranges.push_back({ CreateEntityRange<TTraits>({ 143, 143 }), identities[0] });
+		ranges.push_back({ decltype(ranges[0].Range)(), identities[1] });
+		ranges.push_back({ CreateEntityRange<TTraits>({ 143 }), identities[2] });
+		ranges.push_back({ CreateEntityRange<TTraits>({ 143, 143, 143 }), identities[3] });
+
+		test::EntitiesVector entities;
+		for (const auto& range : ranges) {
+			auto rangeEntities = test::ExtractEntities(range.Range);
+			entities.insert(entities.end(), rangeEntities.cbegin(), rangeEntities.cend());
+		}
+
+		// Act:
+		auto input = ConsumerInput(std::move(ranges), InputSource::Local);
+
+		// Assert:
+		TTraits::AssertInput(input, 6, entities, InputSource::Local);
+		EXPECT_EQ(Key(), input.sourceIdentity().PublicKey);
+		EXPECT_EQ("", input.sourceIdentity().Host);
+
+		// - empty ranges are not partitioned
+		const auto& partitions = input.partitions();
+		ASSERT_EQ(3u, partitions.size());
+		AssertPartition(partitions[0], identities[0], 0, 2);
+		AssertPartition(partitions[1], identities[2], 2, 1);
+		AssertPartition(partitions[2], identities[3], 3, 3);
+	}
+
 	// endregion
 
 	// region memorySize
@@ -300,6 +354,21 @@ namespace catapult { namespace disruptor {
 		EXPECT_EQ("2 txes [00DA2896] from Remote_Pull with size 643B", str);
 	}
 
+	TEST(TEST_CLASS, CanOutputTransactionConsumerInputFromMultipleSources) {
+		// Arrange:
+		std::vector<model::AnnotatedTransactionRange> ranges;
+		ranges.push_back({ CreateEntityRange<TransactionTraits>({ 143 }), { test::GenerateRandomByteArray<Key>(), "11.22.33.44" } });
+		ranges.push_back({ CreateEntityRange<TransactionTraits>({ 500 }), { test::GenerateRandomByteArray<Key>(), "55.66.77.88" } });
+		ConsumerInput input(std::move(ranges), InputSource::Remote_Pull);
+		input.transactions()[0].EntityHash = { { 0x00, 0xDA, 0x28, 0x96, 0xFF } };
+
+		// Act:
+		auto str = test::ToString(input);
+
+		// Assert:
+		EXPECT_EQ("2 txes [00DA2896] from Remote_Pull (2 identities) with size 643B", str);
+	}
+
 	TEST(TEST_CLASS, CanOutputTransactionConsumerInputWithDetachedRange) {
 		// Arrange:
 		auto input = PrepareTransactionConsumerInputForOutputTests();
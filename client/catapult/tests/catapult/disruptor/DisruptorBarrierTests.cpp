@@ -20,7 +20,9 @@
 **/
 
 #include "catapult/disruptor/DisruptorBarrier.h"
+#include "tests/test/nodeps/Waits.h"
 #include "tests/TestHarness.h"
+#include <thread>
 
 namespace catapult { namespace disruptor {
 
@@ -46,4 +48,162 @@ namespace catapult { namespace disruptor {
 		EXPECT_EQ(100u, barrier.level());
 		EXPECT_EQ(2u, barrier.position());
 	}
+
+	// region advanceTo
+
+	TEST(TEST_CLASS, CanAdvanceBarrierToGreaterPosition) {
+		// Arrange:
+		DisruptorBarrier barrier(100, 1);
+
+		// Act:
+		barrier.advanceTo(5);
+
+		// Assert:
+		EXPECT_EQ(100u, barrier.level());
+		EXPECT_EQ(5u, barrier.position());
+	}
+
+	TEST(TEST_CLASS, CannotAdvanceBarrierToEqualOrLesserPosition) {
+		// Arrange:
+		DisruptorBarrier barrier(100, 5);
+
+		// Act:
+		barrier.advanceTo(5);
+		barrier.advanceTo(3);
+
+		// Assert:
+		EXPECT_EQ(100u, barrier.level());
+		EXPECT_EQ(5u, barrier.position());
+	}
+
+	TEST(TEST_CLASS, ConcurrentAdvanceToCallsLeaveBarrierAtGreatestPosition) {
+		// Arrange:
+		DisruptorBarrier barrier(100, 0);
+
+		// Act:
+		std::vector<std::thread> threads;
+		for (auto i = 0u; i < 4; ++i) {
+			threads.emplace_back([&barrier, i]() {
+				for (auto position = 1u; position <= 1000; ++position)
+					barrier.advanceTo(position * 4 + i);
+			});
+		}
+
+		for (auto& thread : threads)
+			thread.join();
+
+		// Assert:
+		EXPECT_EQ(4003u, barrier.position());
+	}
+
+	// endregion
+
+	// region wait / notifyAll
+
+	namespace {
+		template<typename TAction>
+		void RunWaitTest(DisruptorBarrier& barrier, std::atomic_bool& keepWaiting, PositionType position, TAction action) {
+			// Arrange:
+			std::atomic_bool isWaitComplete(false);
+			std::thread waiter([&barrier, &keepWaiting, position, &isWaitComplete]() {
+				barrier.wait(position, keepWaiting);
+				isWaitComplete = true;
+			});
+
+			// Sanity: waiter is blocked
+			test::Sleep(25);
+			EXPECT_FALSE(isWaitComplete);
+
+			// Act:
+			action();
+
+			// Assert: waiter is unblocked
+			WAIT_FOR(isWaitComplete);
+			waiter.join();
+		}
+	}
+
+	TEST(TEST_CLASS, WaitReturnsImmediatelyWhenPositionIsDifferent) {
+		// Arrange:
+		DisruptorBarrier barrier(100, 5);
+		std::atomic_bool keepWaiting(true);
+
+		// Act: no deadlock
+		barrier.wait(4, keepWaiting);
+		barrier.wait(6, keepWaiting);
+
+		// Assert:
+		EXPECT_EQ(5u, barrier.position());
+	}
+
+	TEST(TEST_CLASS, WaitReturnsImmediatelyWhenKeepWaitingIsUnset) {
+		// Arrange:
+		DisruptorBarrier barrier(100, 5);
+		std::atomic_bool keepWaiting(false);
+
+		// Act: no deadlock
+		barrier.wait(5, keepWaiting);
+
+		// Assert:
+		EXPECT_EQ(5u, barrier.position());
+	}
+
+	TEST(TEST_CLASS, WaitReturnsWhenBarrierIsAdvanced) {
+		// Arrange:
+		DisruptorBarrier barrier(100, 5);
+		std::atomic_bool keepWaiting(true);
+
+		// Act + Assert:
+		RunWaitTest(barrier, keepWaiting, 5, [&barrier]() { barrier.advance(); });
+		EXPECT_EQ(6u, barrier.position());
+	}
+
+	TEST(TEST_CLASS, WaitReturnsWhenBarrierIsAdvancedToGreaterPosition) {
+		// Arrange:
+		DisruptorBarrier barrier(100, 5);
+		std::atomic_bool keepWaiting(true);
+
+		// Act + Assert:
+		RunWaitTest(barrier, keepWaiting, 5, [&barrier]() { barrier.advanceTo(8); });
+		EXPECT_EQ(8u, barrier.position());
+	}
+
+	TEST(TEST_CLASS, WaitReturnsWhenKeepWaitingIsUnsetAndWaitersAreNotified) {
+		// Arrange:
+		DisruptorBarrier barrier(100, 5);
+		std::atomic_bool keepWaiting(true);
+
+		// Act + Assert:
+		RunWaitTest(barrier, keepWaiting, 5, [&barrier, &keepWaiting]() {
+			keepWaiting = false;
+			barrier.notifyAll();
+		});
+		EXPECT_EQ(5u, barrier.position());
+	}
+
+	TEST(TEST_CLASS, AdvanceWakesAllWaiters) {
+		// Arrange:
+		DisruptorBarrier barrier(100, 5);
+		std::atomic_bool keepWaiting(true);
+		std::atomic<size_t> numCompletedWaits(0);
+
+		std::vector<std::thread> waiters;
+		for (auto i = 0u; i < 3; ++i) {
+			waiters.emplace_back([&barrier, &keepWaiting, &numCompletedWaits]() {
+				barrier.wait(5, keepWaiting);
+				++numCompletedWaits;
+			});
+		}
+
+		// Act:
+		test::Sleep(25);
+		barrier.advance();
+
+		// Assert:
+		WAIT_FOR_VALUE(3u, numCompletedWaits);
+		for (auto& waiter : waiters)
+			waiter.join();
+	}
+
+	// endregion
 }}
@@ -192,4 +192,133 @@ namespace catapult { namespace disruptor {
 			++i;
 		}
 	}
+
+	// region FromTransactionConsumers - partitioned input
+
+	namespace {
+		constexpr auto Fatal_Abort_Result = ConsumerResult::Abort(123, ConsumerResultSeverity::Fatal);
+
+		ConsumerInput CreatePartitionedTransactionInput(const std::vector<size_t>& partitionSizes) {
+			std::vector<model::AnnotatedTransactionRange> ranges;
+			for (auto partitionSize : partitionSizes) {
+				auto sourceIdentity = model::NodeIdentity{ test::GenerateRandomByteArray<Key>(), "11.22.33.44" };
+				ranges.push_back({ test::CreateTransactionEntityRange(partitionSize), sourceIdentity });
+			}
+
+			return ConsumerInput(std::move(ranges), InputSource::Remote_Push);
+		}
+
+		template<typename TAction>
+		ConsumerResult InvokeSingleTransactionConsumer(ConsumerInput& input, ConsumerResult consumerResult, TAction action) {
+			std::vector<TransactionConsumer> typedConsumers{
+				[consumerResult, action](auto& elements) {
+					action(elements);
+					return consumerResult;
+				}
+			};
+
+			auto consumers = DisruptorConsumersFromTransactionConsumers(typedConsumers);
+			return consumers[0](input);
+		}
+
+		void AssertElementSeverities(const ConsumerInput& input, const std::vector<ConsumerResultSeverity>& expectedSeverities) {
+			const auto& elements = input.transactions();
+			ASSERT_EQ(expectedSeverities.size(), elements.size());
+			for (auto i = 0u; i < elements.size(); ++i)
+				EXPECT_EQ(expectedSeverities[i], elements[i].ResultSeverity) << "element at " << i;
+		}
+	}
+
+	TEST(TEST_CLASS, FromTransactionConsumers_PartitionedInputIsUnchangedWhenConsumerContinues) {
+		// Arrange:
+		auto input = CreatePartitionedTransactionInput({ 2, 3, 1 });
+
+		// Act:
+		auto result = InvokeSingleTransactionConsumer(input, ConsumerResult::Continue(), [](const auto&) {});
+
+		// Assert:
+		test::AssertContinued(result);
+		for (const auto& partition : input.partitions())
+			test::AssertContinued(partition.Result);
+	}
+
+	TEST(TEST_CLASS, FromTransactionConsumers_PartitionedInputIsAbortedWhenConsumerAbortsWithoutRejectingElements) {
+		// Arrange:
+		auto input = CreatePartitionedTransactionInput({ 2, 3, 1 });
+
+		// Act:
+		auto result = InvokeSingleTransactionConsumer(input, Fatal_Abort_Result, [](const auto&) {});
+
+		// Assert: abort cannot be attributed to any partition, so the entire input is aborted
+		test::AssertAborted(result, 123, ConsumerResultSeverity::Fatal);
+		for (const auto& partition : input.partitions())
+			test::AssertContinued(partition.Result);
+	}
+
+	TEST(TEST_CLASS, FromTransactionConsumers_AbortIsAttributedOnlyToPartitionsWithRejectedElements) {
+		// Arrange:
+		auto input = CreatePartitionedTransactionInput({ 2, 3, 1 });
+
+		// Act: reject an element in the second partition
+		auto result = InvokeSingleTransactionConsumer(input, Fatal_Abort_Result, [](auto& elements) {
+			elements[3].ResultSeverity = ConsumerResultSeverity::Failure;
+		});
+
+		// Assert: processing continues for the other partitions
+		test::AssertContinued(result);
+
+		const auto& partitions = input.partitions();
+		test::AssertContinued(partitions[0].Result);
+		test::AssertAborted(partitions[1].Result, 123, ConsumerResultSeverity::Fatal);
+		test::AssertContinued(partitions[2].Result);
+
+		// - remaining elements from the rejected partition are skipped
+		using Severity = ConsumerResultSeverity;
+		AssertElementSeverities(input, {
+			Severity::Success, Severity::Success,
+			Severity::Neutral, Severity::Failure, Severity::Neutral,
+			Severity::Success
+		});
+	}
+
+	TEST(TEST_CLASS, FromTransactionConsumers_PartitionedInputIsAbortedWhenAllPartitionsHaveRejectedElements) {
+		// Arrange:
+		auto input = CreatePartitionedTransactionInput({ 2, 1 });
+
+		// Act: reject an element in each partition
+		auto result = InvokeSingleTransactionConsumer(input, Fatal_Abort_Result, [](auto& elements) {
+			elements[1].ResultSeverity = ConsumerResultSeverity::Failure;
+			elements[2].ResultSeverity = ConsumerResultSeverity::Neutral;
+		});
+
+		// Assert:
+		test::AssertAborted(result, 123, ConsumerResultSeverity::Fatal);
+		for (const auto& partition : input.partitions())
+			test::AssertAborted(partition.Result, 123, ConsumerResultSeverity::Fatal);
+
+		using Severity = ConsumerResultSeverity;
+		AssertElementSeverities(input, { Severity::Neutral, Severity::Failure, Severity::Neutral });
+	}
+
+	TEST(TEST_CLASS, FromTransactionConsumers_AbortIsNotReattributedToPreviouslyAbortedPartitions) {
+		// Arrange: abort the first partition
+		auto input = CreatePartitionedTransactionInput({ 2, 3, 1 });
+		input.partitions()[0].Result = ConsumerResult::Abort(111, ConsumerResultSeverity::Failure);
+
+		// Act: reject an element in the first and second partitions
+		auto result = InvokeSingleTransactionConsumer(input, Fatal_Abort_Result, [](auto& elements) {
+			elements[0].ResultSeverity = ConsumerResultSeverity::Failure;
+			elements[4].ResultSeverity = ConsumerResultSeverity::Failure;
+		});
+
+		// Assert:
+		test::AssertContinued(result);
+
+		const auto& partitions = input.partitions();
+		test::AssertAborted(partitions[0].Result, 111, ConsumerResultSeverity::Failure);
+		test::AssertAborted(partitions[1].Result, 123, ConsumerResultSeverity::Fatal);
+		test::AssertContinued(partitions[2].Result);
+	}
+
+	// endregion
 }}
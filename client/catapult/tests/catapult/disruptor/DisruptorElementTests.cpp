@@ -44,12 +44,14 @@ namespace catapult { namespace disruptor {
 			static void AssertDisruptorElementCreation(size_t numBlocks) {
 				// Act::
 				test::EntitiesVector entities;
+				auto startTime = DisruptorElement::Clock::now();
 				auto element = DisruptorElement(CreateInput(numBlocks, entities), 17, EmptyProcessingCompleteFunc);
 
 				// Assert:
 				AssertInput(element.input(), numBlocks, entities, InputSource::Unknown);
 				EXPECT_EQ(17u, element.id());
 				EXPECT_FALSE(element.isSkipped());
+				EXPECT_LE(startTime, element.readyTime());
 			}
 		};
 
@@ -58,12 +60,14 @@ namespace catapult { namespace disruptor {
 			static void AssertDisruptorElementCreation(size_t numTransactions) {
 				// Act:
 				test::EntitiesVector entities;
+				auto startTime = DisruptorElement::Clock::now();
 				auto element = DisruptorElement(CreateInput(numTransactions, entities), 17, EmptyProcessingCompleteFunc);
 
 				// Assert:
 				AssertInput(element.input(), numTransactions, entities, InputSource::Unknown);
 				EXPECT_EQ(17u, element.id());
 				EXPECT_FALSE(element.isSkipped());
+				EXPECT_LE(startTime, element.readyTime());
 			}
 		};
 	}
@@ -74,6 +78,7 @@ namespace catapult { namespace disruptor {
 
 	TEST(TEST_CLASS, CanCreateEmptyDisruptorElement) {
 		// Act:
+		auto startTime = DisruptorElement::Clock::now();
 		DisruptorElement element;
 
 		// Assert:
@@ -81,6 +86,7 @@ namespace catapult { namespace disruptor {
 		EXPECT_EQ(static_cast<uint64_t>(-1), element.id());
 		EXPECT_FALSE(element.isSkipped());
 		test::AssertContinued(element.completionResult());
+		EXPECT_LE(startTime, element.readyTime());
 	}
 
 	ENTITY_TRAITS_BASED_TEST(CanCreateDisruptorElementAroundSingleEntity) {
@@ -106,6 +112,45 @@ namespace catapult { namespace disruptor {
 		test::AssertAborted(element.completionResult(), 9, static_cast<ConsumerResultSeverity>(8), 7);
 	}
 
+	TEST(TEST_CLASS, MarkSkippedPreservesFirstResultWhenSubsequentResultIsNotMoreSevere) {
+		// Arrange:
+		DisruptorElement element;
+		element.markSkipped(7, CreateConsumerResult(9, 2));
+
+		// Act:
+		element.markSkipped(5, CreateConsumerResult(11, 2));
+		element.markSkipped(6, CreateConsumerResult(12, 1));
+
+		// Assert:
+		EXPECT_TRUE(element.isSkipped());
+		test::AssertAborted(element.completionResult(), 9, static_cast<ConsumerResultSeverity>(2), 7);
+	}
+
+	TEST(TEST_CLASS, MarkSkippedReplacesFirstResultWhenSubsequentResultIsMoreSevere) {
+		// Arrange:
+		DisruptorElement element;
+		element.markSkipped(7, CreateConsumerResult(9, 2));
+
+		// Act:
+		element.markSkipped(5, CreateConsumerResult(11, 3));
+
+		// Assert:
+		EXPECT_TRUE(element.isSkipped());
+		test::AssertAborted(element.completionResult(), 11, static_cast<ConsumerResultSeverity>(3), 5);
+	}
+
+	TEST(TEST_CLASS, CanSetDisruptorElementReadyTime) {
+		// Arrange:
+		DisruptorElement element;
+		auto readyTime = element.readyTime() + std::chrono::milliseconds(123);
+
+		// Act:
+		element.setReadyTime(readyTime);
+
+		// Assert:
+		EXPECT_EQ(readyTime, element.readyTime());
+	}
+
 	TEST(TEST_CLASS, CanOutputDisruptorElement) {
 		// Arrange:
 		auto pTransaction1 = test::GenerateRandomTransaction();
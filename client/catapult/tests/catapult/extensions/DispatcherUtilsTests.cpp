@@ -123,6 +123,71 @@ namespace catapult { namespace extensions {
 		isElementCallbackUnblocked.state()->set();
 	}
 
+	namespace {
+		std::unordered_map<std::string, uint64_t> GetCounterValues(const ServiceLocator& locator) {
+			std::unordered_map<std::string, uint64_t> counters;
+			for (const auto& counter : locator.counters())
+				counters[counter.id().name()] = counter.value();
+
+			return counters;
+		}
+	}
+
+	TEST(TEST_CLASS, CanAddDispatcherConsumerCountersToLocator) {
+		// Arrange: create a dispatcher with two consumers, the first of which blocks until unblocked
+		test::AutoSetFlag isConsumerUnblocked;
+		auto options = disruptor::ConsumerDispatcherOptions{ "ConsumerDispatcherTests", 16u * 1024 };
+		auto pDispatcher = std::make_shared<disruptor::ConsumerDispatcher>(options, std::vector<disruptor::DisruptorConsumer>{
+			[pIsUnblocked = isConsumerUnblocked.state()](const auto&) {
+				pIsUnblocked->wait();
+				return disruptor::ConsumerResult::Continue();
+			},
+			[](const auto&) {
+				return disruptor::ConsumerResult::Continue();
+			}
+		});
+
+		for (auto i = 0u; i < 3; ++i)
+			pDispatcher->processElement(disruptor::ConsumerInput(test::CreateTransactionEntityRange(1)));
+
+		// - create a locator and register the service
+		config::CatapultKeys keys;
+		ServiceLocator locator(keys);
+		locator.registerRootedService("foo", pDispatcher);
+
+		// Act:
+		AddDispatcherConsumerCounters(locator, "foo", "XYZ", { "ALPH", "BETA" });
+		auto blockedCounters = GetCounterValues(locator);
+
+		isConsumerUnblocked.state()->set();
+		WAIT_FOR_ZERO_EXPR(pDispatcher->numActiveElements());
+		auto drainedCounters = GetCounterValues(locator);
+
+		// Assert: all elements were pending in the first consumer while it was blocked
+		ASSERT_EQ(6u, blockedCounters.size());
+		EXPECT_EQ(3u, blockedCounters.at("XYZ ALPH LAG"));
+		EXPECT_EQ(0u, blockedCounters.at("XYZ BETA LAG"));
+
+		// - statistics were recorded after elements were drained
+		for (auto i = 0u; i < 2; ++i) {
+			auto namePrefix = std::string(0 == i ? "XYZ ALPH " : "XYZ BETA ");
+			const auto& statistics = pDispatcher->consumerStatistics(i);
+			EXPECT_EQ(3u, statistics.WaitTimes.count()) << namePrefix;
+			EXPECT_EQ(statistics.WaitTimes.percentile(99), drainedCounters.at(namePrefix + "WAIT")) << namePrefix;
+			EXPECT_EQ(statistics.ProcessingTimes.percentile(99), drainedCounters.at(namePrefix + "PROC")) << namePrefix;
+			EXPECT_EQ(0u, drainedCounters.at(namePrefix + "LAG")) << namePrefix;
+		}
+	}
+
+	TEST(TEST_CLASS, CannotAddDispatcherConsumerCountersWithTooLongConsumerNames) {
+		// Arrange:
+		config::CatapultKeys keys;
+		ServiceLocator locator(keys);
+
+		// Act + Assert: "XYZ ALPHA WAIT" exceeds the maximum counter name size
+		EXPECT_THROW(AddDispatcherConsumerCounters(locator, "foo", "XYZ", { "ALPHA" }), catapult_invalid_argument);
+	}
+
 	TEST(TEST_CLASS, CanCreateBatchTransactionTask) {
 		// Arrange:
 		auto pDispatcher = CreateDispatcher();
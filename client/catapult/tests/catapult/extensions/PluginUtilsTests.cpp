@@ -36,6 +36,7 @@ namespace catapult { namespace extensions {
 		test::MutableCatapultConfiguration config;
 		config.Node.EnableCacheDatabaseStorage = true;
 		config.Node.CacheDatabase.MaxWriteBatchSize = utils::FileSize::FromKilobytes(123);
+		config.Node.MaxStatePathKeysPerRequest = 456;
 		config.User.DataDirectory = "foo_bar";
 
 		// Act:
@@ -45,6 +46,7 @@ namespace catapult { namespace extensions {
 		EXPECT_TRUE(storageConfig.PreferCacheDatabase);
 		EXPECT_EQ("foo_bar/statedb", storageConfig.CacheDatabaseDirectory);
 		EXPECT_EQ(utils::FileSize::FromKilobytes(123), storageConfig.CacheDatabaseConfig.MaxWriteBatchSize);
+		EXPECT_EQ(456u, storageConfig.MaxStatePathKeysPerRequest);
 	}
 
 	namespace {
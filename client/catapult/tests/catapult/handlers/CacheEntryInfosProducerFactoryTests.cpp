@@ -93,7 +93,7 @@ namespace catapult { namespace handlers {
 
 		private:
 			CacheDataMap m_map;
-			mutable utils::SpinReaderWriterLock m_lock;
+			mutable utils::StripedReaderWriterLock m_lock;
 		};
 
 		class MockCacheSerializer {
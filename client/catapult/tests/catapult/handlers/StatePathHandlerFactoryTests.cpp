@@ -21,9 +21,10 @@
 
 #include "catapult/handlers/StatePathHandlerFactory.h"
 #include "catapult/cache/SynchronizedCache.h"
-#include "catapult/utils/SpinReaderWriterLock.h"
+#include "catapult/utils/StripedReaderWriterLock.h"
 #include "tests/test/plugins/BasicBatchHandlerTests.h"
 #include "tests/TestHarness.h"
+#include <numeric>
 #include <unordered_map>
 
 namespace catapult { namespace handlers {
@@ -68,9 +69,10 @@ namespace catapult { namespace handlers {
 
 		class MockCacheView {
 		public:
-			MockCacheView(bool result, const StatePath& path)
+			MockCacheView(bool result, const StatePath& path, std::vector<TestPayloadType>& batchLookupKeys)
 					: m_result(result)
 					, m_path(path)
+					, m_batchLookupKeys(batchLookupKeys)
 			{}
 
 		public:
@@ -81,9 +83,23 @@ namespace catapult { namespace handlers {
 				return std::make_pair(Hash256(), m_result);
 			}
 
+			auto tryLookup(const std::vector<uint64_t>& keys, tree::PatriciaTreeBatchProof& proof) const {
+				// all keys share the same path
+				for (const auto& node : m_path)
+					proof.Nodes.push_back(node.copy());
+
+				std::vector<uint32_t> nodeIndexPath(m_path.size());
+				std::iota(nodeIndexPath.begin(), nodeIndexPath.end(), 0);
+				proof.NodeIndexPaths.resize(keys.size(), nodeIndexPath);
+
+				m_batchLookupKeys.insert(m_batchLookupKeys.end(), keys.cbegin(), keys.cend());
+				return std::vector<std::pair<Hash256, bool>>(keys.size(), std::make_pair(Hash256(), m_result));
+			}
+
 		private:
 			const bool m_result;
 			const StatePath& m_path;
+			std::vector<TestPayloadType>& m_batchLookupKeys;
 		};
 
 		class MockCache {
@@ -94,7 +110,13 @@ namespace catapult { namespace handlers {
 		public:
 			auto createView() const {
 				auto readLock = m_lock.acquireReader();
-				return cache::LockedCacheView<MockCacheView>(MockCacheView(m_lookupResult, m_path), std::move(readLock));
+				auto view = MockCacheView(m_lookupResult, m_path, m_batchLookupKeys);
+				return cache::LockedCacheView<MockCacheView>(std::move(view), std::move(readLock));
+			}
+
+		public:
+			const auto& batchLookupKeys() const {
+				return m_batchLookupKeys;
 			}
 
 		public:
@@ -108,9 +130,10 @@ namespace catapult { namespace handlers {
 			}
 
 		private:
-			mutable utils::SpinReaderWriterLock m_lock;
+			mutable utils::StripedReaderWriterLock m_lock;
 			bool m_lookupResult;
 			StatePath m_path;
+			mutable std::vector<TestPayloadType> m_batchLookupKeys;
 		};
 
 		// endregion
@@ -253,4 +276,171 @@ namespace catapult { namespace handlers {
 					AssertReturnedValue(expectedResponse, handlerContext.response());
 				});
 	}
+
+	// region batch
+
+	namespace {
+		constexpr auto Mock_Batch_Packet_Type = static_cast<ionet::PacketType>(0x1235);
+
+		constexpr uint32_t Max_Batch_Keys = 10;
+
+		struct BatchStatePathRequestTraits {
+			static constexpr auto Packet_Type = Mock_Batch_Packet_Type;
+
+			using KeyType = TestPayloadType;
+		};
+
+		struct BatchStatePathHandlerFactoryTraits : public StatePathHandlerFactoryTraits {
+		public:
+			static constexpr auto Packet_Type = Mock_Batch_Packet_Type;
+
+		public:
+			static void RegisterHandler(ionet::ServerPacketHandlers& handlers, const MockCache& cache) {
+				RegisterBatchStatePathHandler<BatchStatePathRequestTraits>(handlers, cache, Max_Batch_Keys);
+			}
+		};
+
+		using BasicBatchStatePathHandlerTests = test::BasicBatchHandlerTests<
+			BatchStatePathHandlerFactoryTraits,
+			CacheHandlerTraits<BatchStatePathHandlerFactoryTraits>>;
+
+		template<typename TArrange, typename TAssertResponse>
+		void AssertBatchPacketIsAccepted(uint32_t numKeys, TArrange arrange, TAssertResponse assertResponse) {
+			// Arrange:
+			StatePathHandlerFactoryTraits::TestContext testContext;
+			ionet::ServerPacketHandlers handlers;
+			BatchStatePathHandlerFactoryTraits::RegisterHandler(handlers, testContext.getCache());
+			auto pPacket = test::CreateRandomPacket(numKeys * Payload_Size, Mock_Batch_Packet_Type);
+			arrange(testContext);
+
+			// Act:
+			ionet::ServerPacketHandlerContext handlerContext;
+			EXPECT_TRUE(handlers.process(*pPacket, handlerContext));
+
+			// Assert: the handler was called with all keys and has the correct header
+			const auto* pKeys = reinterpret_cast<const TestPayloadType*>(pPacket->Data());
+			EXPECT_EQ(std::vector<TestPayloadType>(pKeys, pKeys + numKeys), testContext.getCache().batchLookupKeys());
+
+			ASSERT_TRUE(handlerContext.hasResponse());
+			assertResponse(handlerContext);
+		}
+
+		std::vector<uint8_t> SerializeBatchProof(const std::vector<uint8_t>& serializedPath, size_t numNodes, size_t numKeys) {
+			std::vector<uint8_t> serializedProof;
+			auto appendValue = [&serializedProof](auto value) {
+				const auto* pValue = reinterpret_cast<const uint8_t*>(&value);
+				serializedProof.insert(serializedProof.end(), pValue, pValue + sizeof(value));
+			};
+
+			appendValue(static_cast<uint32_t>(numNodes));
+			appendValue(static_cast<uint32_t>(numKeys));
+
+			auto offset = 0u;
+			for (auto i = 0u; i < numNodes; ++i) {
+				// leaf nodes (even) and branch nodes with 16 links (odd) have fixed sizes
+				auto nodeSize = static_cast<uint16_t>(2 + sizeof(uint64_t) + (i % 2 ? 2 + 16 * Hash256::Size : Hash256::Size));
+				appendValue(nodeSize);
+				serializedProof.insert(serializedProof.end(), &serializedPath[offset], &serializedPath[offset] + nodeSize);
+				offset += nodeSize;
+			}
+
+			for (auto i = 0u; i < numKeys; ++i) {
+				appendValue(static_cast<uint8_t>(numNodes));
+				for (auto j = 0u; j < numNodes; ++j)
+					appendValue(static_cast<uint32_t>(j));
+			}
+
+			return serializedProof;
+		}
+	}
+
+#define MAKE_BASIC_BATCH_STATE_PATH_HANDLER_TEST(NAME) TEST(TEST_CLASS, Batch_##NAME) { BasicBatchStatePathHandlerTests::Assert##NAME(); }
+
+	MAKE_BASIC_BATCH_STATE_PATH_HANDLER_TEST(TooSmallPacketIsRejected)
+	MAKE_BASIC_BATCH_STATE_PATH_HANDLER_TEST(PacketWithWrongTypeIsRejected)
+	MAKE_BASIC_BATCH_STATE_PATH_HANDLER_TEST(PacketWithInvalidPayloadIsRejected)
+	MAKE_BASIC_BATCH_STATE_PATH_HANDLER_TEST(PacketWithTooSmallPayloadIsRejected)
+	MAKE_BASIC_BATCH_STATE_PATH_HANDLER_TEST(PacketWithNoPayloadIsRejected)
+
+	TEST(TEST_CLASS, Batch_PacketWithTooManyKeysIsRejected) {
+		// Arrange:
+		StatePathHandlerFactoryTraits::TestContext testContext;
+		ionet::ServerPacketHandlers handlers;
+		BatchStatePathHandlerFactoryTraits::RegisterHandler(handlers, testContext.getCache());
+		auto pPacket = test::CreateRandomPacket((Max_Batch_Keys + 1) * Payload_Size, Mock_Batch_Packet_Type);
+
+		// Act:
+		ionet::ServerPacketHandlerContext handlerContext;
+		EXPECT_TRUE(handlers.process(*pPacket, handlerContext));
+
+		// Assert: the cache was not queried and no response was set
+		EXPECT_TRUE(testContext.getCache().batchLookupKeys().empty());
+		EXPECT_FALSE(handlerContext.hasResponse());
+	}
+
+	TEST(TEST_CLASS, Batch_PacketWithMaxKeysIsAccepted) {
+		// Assert: no element in cache, so response packet only contains empty paths
+		auto expectedResponse = SerializeBatchProof({}, 0, Max_Batch_Keys);
+		AssertBatchPacketIsAccepted(
+				Max_Batch_Keys,
+				[](const auto&) {},
+				[&expectedResponse](const auto& handlerContext) {
+					auto expectedSize = sizeof(ionet::PacketHeader) + expectedResponse.size();
+					test::AssertPacketHeader(handlerContext, expectedSize, Mock_Batch_Packet_Type);
+					AssertReturnedValue(expectedResponse, handlerContext.response());
+				});
+	}
+
+	TEST(TEST_CLASS, Batch_ValidPacketIsAcceptedWhenCacheIsEmpty) {
+		// Arrange:
+		auto expectedResponse = SerializeBatchProof({}, 0, 3);
+
+		// Assert: no element in cache, so response packet only contains empty paths
+		AssertBatchPacketIsAccepted(
+				3,
+				[](const auto&) {},
+				[&expectedResponse](const auto& handlerContext) {
+					auto expectedSize = sizeof(ionet::PacketHeader) + expectedResponse.size();
+					test::AssertPacketHeader(handlerContext, expectedSize, Mock_Batch_Packet_Type);
+					AssertReturnedValue(expectedResponse, handlerContext.response());
+				});
+	}
+
+	TEST(TEST_CLASS, Batch_NegativeProofsAreReturnedWhenCacheDoesNotContainKeys) {
+		// Arrange:
+		std::vector<uint8_t> expectedResponse;
+
+		AssertBatchPacketIsAccepted(
+				3,
+				[&expectedResponse](auto& testContext) {
+					// - make tryLookup return negative proofs
+					expectedResponse = SerializeBatchProof(testContext.getCache().setLookupResult(false, 5), 5, 3);
+				},
+				[&expectedResponse](const auto& handlerContext) {
+					// Assert: response packet contains serialized proof
+					auto expectedSize = sizeof(ionet::PacketHeader) + expectedResponse.size();
+					test::AssertPacketHeader(handlerContext, expectedSize, Mock_Batch_Packet_Type);
+					AssertReturnedValue(expectedResponse, handlerContext.response());
+				});
+	}
+
+	TEST(TEST_CLASS, Batch_PositiveProofsAreReturnedWhenCacheContainsKeys) {
+		// Arrange:
+		std::vector<uint8_t> expectedResponse;
+
+		AssertBatchPacketIsAccepted(
+				4,
+				[&expectedResponse](auto& testContext) {
+					// - make tryLookup return positive proofs
+					expectedResponse = SerializeBatchProof(testContext.getCache().setLookupResult(true, 10), 10, 4);
+				},
+				[&expectedResponse](const auto& handlerContext) {
+					// Assert: response packet contains serialized proof
+					auto expectedSize = sizeof(ionet::PacketHeader) + expectedResponse.size();
+					test::AssertPacketHeader(handlerContext, expectedSize, Mock_Batch_Packet_Type);
+					AssertReturnedValue(expectedResponse, handlerContext.response());
+				});
+	}
+
+	// endregion
 }}
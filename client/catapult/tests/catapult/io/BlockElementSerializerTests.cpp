@@ -300,6 +300,76 @@ namespace catapult { namespace io {
 
 	// endregion
 
+	// region ReadBlockElementView
+
+	TEST(TEST_CLASS, CanReadBlockElementViewWithTransactionHashesAndSubCacheMerkleRoots) {
+		// Arrange:
+		auto context = PrepareReadTestContext(3, 4);
+		auto pBuffer = std::make_shared<std::vector<uint8_t>>(context.Buffer);
+
+		// Act:
+		auto pBlockElement = ReadBlockElementView(*pBuffer, pBuffer);
+
+		// Assert: block references buffer
+		EXPECT_EQ(pBuffer->data(), reinterpret_cast<const uint8_t*>(&pBlockElement->Block));
+		EXPECT_EQ(*context.pBlock, pBlockElement->Block);
+		EXPECT_EQ(context.Hashes[0], pBlockElement->EntityHash);
+		EXPECT_EQ(context.GenerationHash, pBlockElement->GenerationHash);
+
+		ASSERT_EQ(4u, pBlockElement->SubCacheMerkleRoots.size());
+		EXPECT_EQ(std::vector<Hash256>(&context.Hashes[8], &context.Hashes[12]), pBlockElement->SubCacheMerkleRoots);
+		ASSERT_EQ(3u, pBlockElement->Transactions.size());
+		AssertReadTransactions(context, *pBlockElement);
+		EXPECT_FALSE(!!pBlockElement->OptionalStatement);
+	}
+
+	TEST(TEST_CLASS, BlockElementViewExtendsBufferOwnerLifetime) {
+		// Arrange:
+		auto context = PrepareReadTestContext(3, 0);
+		auto pBuffer = std::make_shared<std::vector<uint8_t>>(context.Buffer);
+
+		// Act:
+		auto pBlockElement = ReadBlockElementView(*pBuffer, pBuffer);
+		pBuffer.reset();
+
+		// Assert:
+		EXPECT_EQ(*context.pBlock, pBlockElement->Block);
+		ASSERT_EQ(3u, pBlockElement->Transactions.size());
+		AssertReadTransactions(context, *pBlockElement);
+	}
+
+	TEST(TEST_CLASS, CannotReadBlockElementViewWithInvalidBlockSize) {
+		// Arrange:
+		auto context = PrepareReadTestContext(0, 0);
+		auto pBuffer = std::make_shared<std::vector<uint8_t>>(context.Buffer);
+		reinterpret_cast<model::Block&>((*pBuffer)[0]).Size = static_cast<uint32_t>(pBuffer->size() + 1);
+
+		// Act + Assert:
+		EXPECT_THROW(ReadBlockElementView(*pBuffer, pBuffer), catapult_file_io_error);
+	}
+
+	TEST(TEST_CLASS, CannotReadBlockElementViewWithTruncatedMetadata) {
+		// Arrange:
+		auto context = PrepareReadTestContext(3, 4);
+		auto pBuffer = std::make_shared<std::vector<uint8_t>>(context.Buffer);
+		pBuffer->pop_back();
+
+		// Act + Assert:
+		EXPECT_THROW(ReadBlockElementView(*pBuffer, pBuffer), catapult_file_io_error);
+	}
+
+	TEST(TEST_CLASS, CannotReadBlockElementViewWithTrailingData) {
+		// Arrange:
+		auto context = PrepareReadTestContext(3, 4);
+		auto pBuffer = std::make_shared<std::vector<uint8_t>>(context.Buffer);
+		pBuffer->push_back(42);
+
+		// Act + Assert:
+		EXPECT_THROW(ReadBlockElementView(*pBuffer, pBuffer), catapult_file_io_error);
+	}
+
+	// endregion
+
 	// region Roundtrip
 
 	namespace {
@@ -20,6 +20,7 @@
 **/
 
 #include "catapult/io/BlockStorageCache.h"
+#include "catapult/io/RecentBlockElementCache.h"
 #include "tests/test/core/BlockStorageTests.h"
 #include "tests/test/nodeps/LockTestUtils.h"
 #include "tests/TestHarness.h"
@@ -53,6 +54,12 @@ namespace catapult { namespace io {
 				modifier.commit();
 			}
 
+			void saveBlocks(const std::vector<model::BlockElement>& blockElements) override {
+				auto modifier = m_cache.modifier();
+				modifier.saveBlocks(blockElements);
+				modifier.commit();
+			}
+
 			void dropBlocksAfter(Height height) override {
 				auto modifier = m_cache.modifier();
 				modifier.dropBlocksAfter(height);
@@ -487,6 +494,157 @@ namespace catapult { namespace io {
 
 	// endregion
 
+	// region recent block element cache
+
+	namespace {
+		constexpr auto Recent_Block_Element_Cache_Size = utils::FileSize::FromMegabytes(1);
+	}
+
+	TEST(TEST_CLASS, RecentBlockElementCacheIsNotUsedWhenDisabled) {
+		// Arrange:
+		BlockStorageCache cache(mocks::CreateMemoryBlockStorage(Delegation_Chain_Size), mocks::CreateMemoryBlockStorage(0));
+
+		// Act:
+		for (auto i = 0u; i < 2; ++i) {
+			cache.view().loadBlock(Height(7));
+			cache.view().loadBlockElement(Height(7));
+		}
+
+		// Assert:
+		const auto& recentBlockElements = cache.recentBlockElementCache();
+		EXPECT_EQ(0u, recentBlockElements.size());
+		EXPECT_EQ(0u, recentBlockElements.numHits());
+		EXPECT_EQ(0u, recentBlockElements.numMisses());
+	}
+
+	TEST(TEST_CLASS, RecentBlockElementCacheIsNotUsedForChainTip) {
+		// Arrange:
+		BlockStorageCache cache(
+				mocks::CreateMemoryBlockStorage(Delegation_Chain_Size),
+				mocks::CreateMemoryBlockStorage(0),
+				Recent_Block_Element_Cache_Size);
+
+		// Act:
+		cache.view().loadBlock(Height(Delegation_Chain_Size));
+		cache.view().loadBlockElement(Height(Delegation_Chain_Size));
+
+		// Assert:
+		const auto& recentBlockElements = cache.recentBlockElementCache();
+		EXPECT_EQ(0u, recentBlockElements.size());
+		EXPECT_EQ(0u, recentBlockElements.numHits());
+		EXPECT_EQ(0u, recentBlockElements.numMisses());
+	}
+
+	TEST(TEST_CLASS, LoadBlockElementPopulatesRecentBlockElementCache) {
+		// Arrange:
+		auto pStorage = mocks::CreateMemoryBlockStorage(Delegation_Chain_Size);
+		auto pStorageRaw = pStorage.get();
+		BlockStorageCache cache(std::move(pStorage), mocks::CreateMemoryBlockStorage(0), Recent_Block_Element_Cache_Size);
+
+		// Act:
+		auto pBlockElement1 = cache.view().loadBlockElement(Height(7));
+		auto pBlockElement2 = cache.view().loadBlockElement(Height(7));
+
+		// Assert:
+		test::AssertEqual(*pStorageRaw->loadBlockElement(Height(7)), *pBlockElement1);
+		EXPECT_EQ(pBlockElement1, pBlockElement2);
+
+		const auto& recentBlockElements = cache.recentBlockElementCache();
+		EXPECT_EQ(1u, recentBlockElements.size());
+		EXPECT_EQ(1u, recentBlockElements.numHits());
+		EXPECT_EQ(1u, recentBlockElements.numMisses());
+	}
+
+	TEST(TEST_CLASS, LoadBlockPopulatesRecentBlockElementCache) {
+		// Arrange:
+		auto pStorage = mocks::CreateMemoryBlockStorage(Delegation_Chain_Size);
+		auto pStorageRaw = pStorage.get();
+		BlockStorageCache cache(std::move(pStorage), mocks::CreateMemoryBlockStorage(0), Recent_Block_Element_Cache_Size);
+
+		// Act:
+		auto pBlock = cache.view().loadBlock(Height(7));
+		auto pBlockElement = cache.view().loadBlockElement(Height(7));
+
+		// Assert:
+		EXPECT_EQ(*pStorageRaw->loadBlock(Height(7)), *pBlock);
+		EXPECT_EQ(&pBlockElement->Block, pBlock.get());
+
+		const auto& recentBlockElements = cache.recentBlockElementCache();
+		EXPECT_EQ(1u, recentBlockElements.size());
+		EXPECT_EQ(1u, recentBlockElements.numHits());
+		EXPECT_EQ(1u, recentBlockElements.numMisses());
+	}
+
+	TEST(TEST_CLASS, RecentBlockElementCacheIsNotInvalidatedWhenCommitIsNotCalled) {
+		// Arrange:
+		BlockStorageCache cache(
+				mocks::CreateMemoryBlockStorage(Delegation_Chain_Size),
+				mocks::CreateMemoryBlockStorage(0),
+				Recent_Block_Element_Cache_Size);
+		for (auto i = 5u; i <= 10; ++i)
+			cache.view().loadBlockElement(Height(i));
+
+		// Act:
+		cache.modifier().dropBlocksAfter(Height(7));
+
+		// Assert:
+		EXPECT_EQ(6u, cache.recentBlockElementCache().size());
+	}
+
+	TEST(TEST_CLASS, CommitInvalidatesRecentBlockElementsAfterDropHeight) {
+		// Arrange:
+		BlockStorageCache cache(
+				mocks::CreateMemoryBlockStorage(Delegation_Chain_Size),
+				mocks::CreateMemoryBlockStorage(0),
+				Recent_Block_Element_Cache_Size);
+		for (auto i = 5u; i <= 10; ++i)
+			cache.view().loadBlockElement(Height(i));
+
+		// Act:
+		auto pNewBlock = test::GenerateBlockWithTransactions(5, Height(8));
+		auto newBlockElement = test::CreateBlockElementForSaveTests(*pNewBlock);
+		{
+			auto modifier = cache.modifier();
+			modifier.dropBlocksAfter(Height(7));
+			modifier.saveBlock(newBlockElement);
+			modifier.commit();
+		}
+
+		// Assert: blocks at and below drop height are still cached
+		EXPECT_EQ(3u, cache.recentBlockElementCache().size());
+
+		// - new block is loaded from storage
+		EXPECT_EQ(Height(8), cache.view().chainHeight());
+		test::AssertEqual(newBlockElement, *cache.view().loadBlockElement(Height(8)));
+	}
+
+	TEST(TEST_CLASS, CommitInvalidatesRecentBlockElementsReplacedByNewBlocks) {
+		// Arrange:
+		BlockStorageCache cache(mocks::CreateMemoryBlockStorage(12), mocks::CreateMemoryBlockStorage(0), Recent_Block_Element_Cache_Size);
+		for (auto i = 5u; i <= 11; ++i)
+			cache.view().loadBlockElement(Height(i));
+
+		// Act: replace blocks 9 and 10 so that a cached block at height 9 would be stale
+		auto pNewBlock1 = test::GenerateBlockWithTransactions(5, Height(9));
+		auto pNewBlock2 = test::GenerateBlockWithTransactions(5, Height(10));
+		auto newBlockElement1 = test::CreateBlockElementForSaveTests(*pNewBlock1);
+		auto newBlockElement2 = test::CreateBlockElementForSaveTests(*pNewBlock2);
+		{
+			auto modifier = cache.modifier();
+			modifier.dropBlocksAfter(Height(8));
+			modifier.saveBlocks({ newBlockElement1, newBlockElement2 });
+			modifier.commit();
+		}
+
+		// Assert:
+		EXPECT_EQ(Height(10), cache.view().chainHeight());
+		EXPECT_EQ(4u, cache.recentBlockElementCache().size());
+		test::AssertEqual(newBlockElement1, *cache.view().loadBlockElement(Height(9)));
+		test::AssertEqual(newBlockElement2, *cache.view().loadBlockElement(Height(10)));
+	}
+
+	// endregion
+
 	// region synchronization
 
 	namespace {
@@ -0,0 +1,180 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/io/FileBlockStorage.h"
+#include "catapult/config/CatapultDataDirectory.h"
+#include "catapult/io/PayloadCompression.h"
+#include "catapult/io/RawFile.h"
+#include "tests/test/core/BlockStorageTests.h"
+#include "tests/test/core/StorageTestUtils.h"
+#include "tests/test/nodeps/Filesystem.h"
+#include "tests/test/nodeps/TestConstants.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace io {
+
+#define TEST_CLASS CompressedFileBlockStorageTests
+
+	namespace {
+		constexpr uint32_t Compression_Level = 3;
+
+		struct CompressedFileTraits {
+			using Guard = test::TempDirectoryGuard;
+			using StorageType = FileBlockStorage;
+
+			static std::unique_ptr<StorageType> OpenStorage(const std::string& destination, uint32_t fileDatabaseBatchSize = 1) {
+				return std::make_unique<StorageType>(
+						destination,
+						fileDatabaseBatchSize,
+						FileBlockStorageMode::Hash_Index,
+						FileBlockStorageReadMode::Copy,
+						Compression_Level);
+			}
+
+			static std::unique_ptr<StorageType> PrepareStorage(const std::string& destination, Height height = Height()) {
+				test::PrepareStorage(destination);
+				if (Height() != height)
+					test::FakeHeight(destination, height.unwrap());
+
+				return OpenStorage(destination, test::File_Database_Batch_Size);
+			}
+		};
+
+		struct SavedBlockContext {
+			std::unique_ptr<model::Block> pBlock;
+			model::BlockElement Element;
+		};
+
+		SavedBlockContext SaveBlock(FileBlockStorage& storage, Height height) {
+			auto pBlock = test::GenerateBlockWithTransactions(5, height);
+			auto element = test::BlockToBlockElement(*pBlock, test::GenerateRandomByteArray<Hash256>());
+			element.OptionalStatement = test::GenerateRandomStatements({ 2, 1, 3 });
+			storage.saveBlock(element);
+			return { std::move(pBlock), element };
+		}
+
+		std::vector<uint8_t> ReadStoredPayload(const std::string& directory, const std::string& extension, Height height) {
+			// read raw file contents because database always decompresses payloads
+			auto groupHeight = Height(height.unwrap() / test::File_Database_Batch_Size * test::File_Database_Batch_Size);
+			auto filename = config::CatapultDataDirectory(directory).storageDir(groupHeight).storageFile(extension);
+			RawFile rawFile(filename, OpenMode::Read_Only);
+
+			// header contains start offsets of all payloads in batch
+			std::vector<uint64_t> offsets(test::File_Database_Batch_Size);
+			rawFile.read({ reinterpret_cast<uint8_t*>(offsets.data()), offsets.size() * sizeof(uint64_t) });
+
+			auto index = height.unwrap() % test::File_Database_Batch_Size;
+			auto bodyStartOffset = offsets[index];
+			auto bodyEndOffset = index + 1 < offsets.size() && 0 != offsets[index + 1] ? offsets[index + 1] : rawFile.size();
+
+			std::vector<uint8_t> buffer(bodyEndOffset - bodyStartOffset);
+			rawFile.seek(bodyStartOffset);
+			rawFile.read(buffer);
+			return buffer;
+		}
+	}
+
+	DEFINE_BLOCK_STORAGE_TESTS(CompressedFileTraits)
+	DEFINE_PRUNABLE_BLOCK_STORAGE_TESTS(CompressedFileTraits)
+
+	// region constructor
+
+	TEST(TEST_CLASS, CannotCreateWithMemoryMappedReads) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+
+		// Act + Assert:
+		EXPECT_THROW(
+				FileBlockStorage(
+						tempDir.name(),
+						test::File_Database_Batch_Size,
+						FileBlockStorageMode::Hash_Index,
+						FileBlockStorageReadMode::Memory_Mapped,
+						Compression_Level),
+				catapult_invalid_argument);
+	}
+
+	// endregion
+
+	// region compression
+
+	TEST(TEST_CLASS, SavedBlockAndStatementAreStoredCompressed) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto pStorage = CompressedFileTraits::PrepareStorage(tempDir.name());
+
+		// Act:
+		auto context = SaveBlock(*pStorage, Height(2));
+
+		// Assert:
+		auto storedBlockPayload = ReadStoredPayload(tempDir.name(), ".dat", Height(2));
+		auto storedStatementPayload = ReadStoredPayload(tempDir.name(), ".stmt", Height(2));
+		EXPECT_TRUE(IsCompressedPayload(storedBlockPayload));
+		EXPECT_TRUE(IsCompressedPayload(storedStatementPayload));
+
+		auto blockPayload = DecompressPayload(storedBlockPayload);
+		ASSERT_LE(context.pBlock->Size, blockPayload.size());
+		EXPECT_EQ_MEMORY(context.pBlock.get(), blockPayload.data(), context.pBlock->Size);
+	}
+
+	TEST(TEST_CLASS, SavedBlocksAreStoredCompressed) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto pStorage = CompressedFileTraits::PrepareStorage(tempDir.name());
+
+		auto pBlock1 = test::GenerateBlockWithTransactions(5, Height(2));
+		auto pBlock2 = test::GenerateBlockWithTransactions(5, Height(3));
+		auto blockElements = std::vector<model::BlockElement>{
+			test::BlockToBlockElement(*pBlock1, test::GenerateRandomByteArray<Hash256>()),
+			test::BlockToBlockElement(*pBlock2, test::GenerateRandomByteArray<Hash256>())
+		};
+
+		// Act:
+		pStorage->saveBlocks(blockElements);
+
+		// Assert:
+		EXPECT_TRUE(IsCompressedPayload(ReadStoredPayload(tempDir.name(), ".dat", Height(2))));
+		EXPECT_TRUE(IsCompressedPayload(ReadStoredPayload(tempDir.name(), ".dat", Height(3))));
+	}
+
+	TEST(TEST_CLASS, CanReadUncompressedBlocksAfterEnablingCompression) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		test::PrepareStorage(tempDir.name());
+
+		auto pUncompressedStorage = std::make_unique<FileBlockStorage>(tempDir.name(), test::File_Database_Batch_Size);
+		auto context = SaveBlock(*pUncompressedStorage, Height(2));
+		pUncompressedStorage.reset();
+
+		// Act:
+		auto pStorage = CompressedFileTraits::OpenStorage(tempDir.name(), test::File_Database_Batch_Size);
+		auto context2 = SaveBlock(*pStorage, Height(3));
+
+		// Assert: both uncompressed and compressed blocks can be read
+		EXPECT_FALSE(IsCompressedPayload(ReadStoredPayload(tempDir.name(), ".dat", Height(2))));
+		EXPECT_TRUE(IsCompressedPayload(ReadStoredPayload(tempDir.name(), ".dat", Height(3))));
+
+		test::AssertEqual(context.Element, *test::LoadBlockElementWithStatements(*pStorage, Height(2)));
+		test::AssertEqual(context2.Element, *test::LoadBlockElementWithStatements(*pStorage, Height(3)));
+	}
+
+	// endregion
+}}
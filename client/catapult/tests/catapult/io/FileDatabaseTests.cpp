@@ -20,6 +20,7 @@
 **/
 
 #include "catapult/io/FileDatabase.h"
+#include "catapult/io/PayloadCompression.h"
 #include "catapult/io/RawFile.h"
 #include "tests/test/nodeps/Filesystem.h"
 #include "tests/TestHarness.h"
@@ -35,8 +36,10 @@ namespace catapult { namespace io {
 
 		class TestContext {
 		public:
-			explicit TestContext(size_t batchSize = Batch_Size)
-					: m_database(config::CatapultDirectory(m_tempDir.name()), { batchSize, ".bin" })
+			explicit TestContext(size_t batchSize = Batch_Size, bool enableMemoryMappedReads = false, uint32_t compressionLevel = 0)
+					: m_database(
+							config::CatapultDirectory(m_tempDir.name()),
+							{ batchSize, ".bin", enableMemoryMappedReads, compressionLevel })
 			{}
 
 		public:
@@ -44,6 +47,10 @@ namespace catapult { namespace io {
 				return m_database;
 			}
 
+			FileDatabase createDatabase(size_t batchSize, uint32_t compressionLevel) const {
+				return FileDatabase(config::CatapultDirectory(m_tempDir.name()), { batchSize, ".bin", false, compressionLevel });
+			}
+
 			size_t countDatabaseFiles() const {
 				return test::CountFilesAndDirectories(m_tempDir.name());
 			}
@@ -91,6 +98,25 @@ namespace catapult { namespace io {
 			}
 		}
 
+		void WriteAllBatched(FileDatabase& database, size_t startId, const std::vector<std::vector<uint8_t>>& payloads) {
+			std::vector<RawBuffer> buffers;
+			for (const auto& payload : payloads)
+				buffers.push_back(payload);
+
+			database.writePayloads(startId, buffers);
+		}
+
+		std::vector<uint8_t> ReadAll(const FileDatabase& database, uint64_t id) {
+			size_t size = 0;
+			auto pInputStream = database.inputStream(id, &size);
+
+			std::vector<uint8_t> buffer(size);
+			pInputStream->read(buffer);
+
+			EXPECT_TRUE(pInputStream->eof()) << "payload " << id;
+			return buffer;
+		}
+
 		std::vector<uint8_t> MakeHeader(const std::vector<uint64_t>& offsets) {
 			std::vector<uint8_t> buffer(offsets.size() * sizeof(uint64_t));
 			std::memcpy(buffer.data(), offsets.data(), buffer.size());
@@ -412,6 +438,114 @@ namespace catapult { namespace io {
 
 	// endregion
 
+	// region writePayloads
+
+	TEST(TEST_CLASS, CanWritePayloadsAcrossMultipleFiles) {
+		// Arrange:
+		TestContext context;
+
+		// Act:
+		auto payloads = CreatePayloads({ 50, 10, 30, 10, 20, 90, 40, 60 });
+		WriteAllBatched(context.database(), 13, payloads);
+
+		// Assert: layout is identical to individually written payloads
+		EXPECT_EQ(1u, context.countDatabaseFiles());
+		EXPECT_EQ(3u, context.countDatabaseFiles(0));
+
+		auto contents2 = context.readAll(10);
+		auto contents3 = context.readAll(15);
+		auto contents4 = context.readAll(20);
+		EXPECT_EQ(Concatenate({ MakeHeader({ 0, 0, 0, 40, 90 }), payloads[0], payloads[1] }), contents2);
+		EXPECT_EQ(
+				Concatenate({ MakeHeader({ 40, 70, 80, 100, 190 }), payloads[2], payloads[3], payloads[4], payloads[5], payloads[6] }),
+				contents3);
+		EXPECT_EQ(Concatenate({ MakeHeader({ 40, 0, 0, 0, 0 }), payloads[7] }), contents4);
+	}
+
+	TEST(TEST_CLASS, CanWritePayloadsAfterIndividuallyWrittenPayloads) {
+		// Arrange:
+		TestContext context;
+
+		auto payloads = CreatePayloads({ 50, 10, 30 });
+		WriteAll(context.database(), 13, payloads);
+
+		// Act:
+		auto newPayloads = CreatePayloads({ 25, 15, 35 });
+		WriteAllBatched(context.database(), 16, newPayloads);
+
+		// Assert:
+		auto contents2 = context.readAll(10);
+		auto contents3 = context.readAll(15);
+		EXPECT_EQ(Concatenate({ MakeHeader({ 0, 0, 0, 40, 90 }), payloads[0], payloads[1] }), contents2);
+		EXPECT_EQ(
+				Concatenate({ MakeHeader({ 40, 70, 95, 110, 0 }), payloads[2], newPayloads[0], newPayloads[1], newPayloads[2] }),
+				contents3);
+	}
+
+	TEST(TEST_CLASS, CanRewritePayloadsInMiddleFile) {
+		// Arrange:
+		TestContext context;
+
+		auto payloads = CreatePayloads({ 50, 10, 30, 10, 20, 90, 40, 60 });
+		WriteAll(context.database(), 13, payloads);
+
+		// Act:
+		auto newPayloads = CreatePayloads({ 25, 15 });
+		WriteAllBatched(context.database(), 16, newPayloads);
+
+		// Assert: subsequent header slots in rewritten file are cleared
+		auto contents3 = context.readAll(15);
+		EXPECT_EQ(Concatenate({ MakeHeader({ 40, 70, 95, 0, 0 }), payloads[2], newPayloads[0], newPayloads[1] }), contents3);
+	}
+
+	TEST(TEST_CLASS, CanReadPayloadsWrittenByWritePayloads) {
+		// Arrange:
+		TestContext context;
+
+		auto payloads = CreatePayloads({ 50, 10, 30, 10, 20, 90, 40, 60 });
+		WriteAllBatched(context.database(), 13, payloads);
+
+		// Act + Assert:
+		for (auto i = 0u; i < payloads.size(); ++i) {
+			auto pInputStream = context.database().inputStream(13 + i);
+
+			std::vector<uint8_t> buffer(payloads[i].size());
+			pInputStream->read(buffer);
+			EXPECT_EQ(payloads[i], buffer) << "payload " << i;
+			EXPECT_TRUE(pInputStream->eof()) << "payload " << i;
+		}
+	}
+
+	TEST(TEST_CLASS, CanWritePayloadsInHeaderlessMode) {
+		// Arrange:
+		TestContext context(1);
+
+		// Act:
+		auto payloads = CreatePayloads({ 50, 10, 30 });
+		WriteAllBatched(context.database(), 10, payloads);
+
+		// Assert:
+		EXPECT_EQ(1u, context.countDatabaseFiles());
+		EXPECT_EQ(3u, context.countDatabaseFiles(0));
+
+		EXPECT_EQ(payloads[0], context.readAll(10));
+		EXPECT_EQ(payloads[1], context.readAll(11));
+		EXPECT_EQ(payloads[2], context.readAll(12));
+	}
+
+	TEST(TEST_CLASS, WritePayloadsWithNoPayloadsCreatesNoFiles) {
+		// Arrange:
+		TestContext context;
+
+		// Act:
+		context.database().writePayloads(13, {});
+
+		// Assert:
+		EXPECT_EQ(0u, context.countDatabaseFiles());
+	}
+
+	// endregion
+
 	// region read
 
 #define READ_TEST(TEST_NAME) \
@@ -591,6 +725,192 @@ namespace catapult { namespace io {
 
 	// endregion
 
+	// region compression
+
+	namespace {
+		constexpr uint32_t Compression_Level = 3;
+
+		std::vector<std::vector<uint8_t>> CreateCompressiblePayloads(std::initializer_list<size_t> sizes) {
+			auto payloads = CreatePayloads(sizes);
+			for (auto& payload : payloads)
+				std::fill(payload.begin(), payload.begin() + static_cast<std::ptrdiff_t>(payload.size() / 2), static_cast<uint8_t>(0));
+
+			return payloads;
+		}
+	}
+
+	TEST(TEST_CLASS, CannotCreateWithUnsupportedCompressionLevel) {
+		EXPECT_THROW(TestContext(Batch_Size, false, MaxPayloadCompressionLevel() + 1), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, CompressedOutputStreamDoesNotWritePayloadUntilFlushed) {
+		// Arrange:
+		TestContext context(Batch_Size, false, Compression_Level);
+		auto payload = test::GenerateRandomVector(100);
+
+		// Act:
+		auto pOutputStream = context.database().outputStream(12);
+		pOutputStream->write(payload);
+
+		// Assert:
+		EXPECT_EQ(0u, context.countDatabaseFiles());
+		EXPECT_FALSE(context.database().contains(12));
+
+		// Act:
+		pOutputStream->flush();
+
+		// Assert:
+		EXPECT_TRUE(context.database().contains(12));
+		EXPECT_EQ(payload, ReadAll(context.database(), 12));
+	}
+
+	TEST(TEST_CLASS, CompressedOutputStreamWritesPayloadWhenDestroyedWithoutFlush) {
+		// Arrange:
+		TestContext context(Batch_Size, false, Compression_Level);
+		auto payload = test::GenerateRandomVector(100);
+
+		// Act:
+		{
+			auto pOutputStream = context.database().outputStream(12);
+			pOutputStream->write(payload);
+		}
+
+		// Assert:
+		EXPECT_TRUE(context.database().contains(12));
+		EXPECT_EQ(payload, ReadAll(context.database(), 12));
+	}
+
+	TEST(TEST_CLASS, CompressedOutputStreamDoesNotRewritePayloadWhenFlushedWithoutNewData) {
+		// Arrange:
+		TestContext context(Batch_Size, false, Compression_Level);
+		auto payload = test::GenerateRandomVector(100);
+
+		auto pOutputStream = context.database().outputStream(12);
+		pOutputStream->write(payload);
+		pOutputStream->flush();
+		auto contents = context.readAll(10);
+
+		// Act:
+		pOutputStream->flush();
+		pOutputStream.reset();
+
+		// Assert:
+		EXPECT_EQ(contents, context.readAll(10));
+		EXPECT_EQ(payload, ReadAll(context.database(), 12));
+	}
+
+	TEST(TEST_CLASS, CanWriteAndReadCompressedPayloadsAcrossMultipleFiles) {
+		// Arrange:
+		TestContext context(Batch_Size, false, Compression_Level);
+		auto payloads = CreateCompressiblePayloads({ 500, 100, 300, 100, 200, 900, 400, 600 });
+
+		// Act:
+		WriteAllBatched(context.database(), 13, { payloads[0], payloads[1], payloads[2], payloads[3] });
+		for (auto i = 4u; i < payloads.size(); ++i) {
+			auto pOutputStream = context.database().outputStream(13 + i);
+			pOutputStream->write(payloads[i]);
+			pOutputStream->flush();
+		}
+
+		// Assert:
+		EXPECT_EQ(3u, context.countDatabaseFiles(0));
+		for (auto i = 0u; i < payloads.size(); ++i)
+			EXPECT_EQ(payloads[i], ReadAll(context.database(), 13 + i)) << "payload " << i;
+	}
+
+	TEST(TEST_CLASS, CompressedPayloadsAreStoredCompressed) {
+		// Arrange:
+		TestContext context(Batch_Size, false, Compression_Level);
+		auto payloads = CreateCompressiblePayloads({ 500, 1000 });
+
+		// Act:
+		WriteAllBatched(context.database(), 10, payloads);
+
+		// Assert: header offsets reference compressed payloads
+		auto contents = context.readAll(10);
+		ASSERT_LT(Batch_Size * sizeof(uint64_t), contents.size());
+		EXPECT_GT(Batch_Size * sizeof(uint64_t) + 1500, contents.size());
+
+		std::vector<uint64_t> offsets(3);
+		std::memcpy(offsets.data(), contents.data(), 2 * sizeof(uint64_t));
+		offsets[2] = contents.size();
+		for (auto i = 0u; i < 2; ++i) {
+			auto compressedPayload = RawBuffer(contents.data() + offsets[i], offsets[i + 1] - offsets[i]);
+			EXPECT_TRUE(IsCompressedPayload(compressedPayload)) << "payload " << i;
+			EXPECT_EQ(payloads[i], DecompressPayload(compressedPayload)) << "payload " << i;
+		}
+	}
+
+	TEST(TEST_CLASS, CanReadUncompressedPayloadsWhenCompressionIsEnabled) {
+		// Arrange:
+		TestContext context;
+		auto payloads = CreatePayloads({ 50, 10, 30 });
+		WriteAll(context.database(), 13, payloads);
+
+		auto compressedDatabase = context.createDatabase(Batch_Size, Compression_Level);
+
+		// Act + Assert:
+		for (auto i = 0u; i < payloads.size(); ++i)
+			EXPECT_EQ(payloads[i], ReadAll(compressedDatabase, 13 + i)) << "payload " << i;
+	}
+
+	TEST(TEST_CLASS, CanMixCompressedAndUncompressedPayloadsInSingleFile) {
+		// Arrange:
+		TestContext context;
+		auto payloads = CreateCompressiblePayloads({ 50, 100, 300 });
+		WriteAll(context.database(), 10, { payloads[0] });
+
+		auto compressedDatabase = context.createDatabase(Batch_Size, Compression_Level);
+
+		// Act:
+		WriteAllBatched(compressedDatabase, 11, { payloads[1], payloads[2] });
+
+		// Assert:
+		for (auto i = 0u; i < payloads.size(); ++i)
+			EXPECT_EQ(payloads[i], ReadAll(compressedDatabase, 10 + i)) << "payload " << i;
+	}
+
+	namespace {
+		void AssertCompressedPayloadsAreDecompressedWhenCompressionIsDisabled(size_t batchSize) {
+			// Arrange:
+			TestContext context(batchSize, false, Compression_Level);
+			auto payloads = CreateCompressiblePayloads({ 500, 100 });
+			WriteAllBatched(context.database(), 10, payloads);
+
+			auto uncompressedDatabase = context.createDatabase(batchSize, 0);
+
+			// Act + Assert:
+			for (auto i = 0u; i < payloads.size(); ++i)
+				EXPECT_EQ(payloads[i], ReadAll(uncompressedDatabase, 10 + i)) << "payload " << i;
+		}
+	}
+
+	TEST(TEST_CLASS, CompressedPayloadsAreDecompressedWhenCompressionIsDisabled) {
+		AssertCompressedPayloadsAreDecompressedWhenCompressionIsDisabled(Batch_Size);
+	}
+
+	TEST(TEST_CLASS, CompressedPayloadsAreDecompressedWhenCompressionIsDisabledInHeaderlessMode) {
+		AssertCompressedPayloadsAreDecompressedWhenCompressionIsDisabled(1);
+	}
+
+	TEST(TEST_CLASS, CanWriteAndReadCompressedPayloadsInHeaderlessMode) {
+		// Arrange:
+		TestContext context(1, false, Compression_Level);
+		auto payloads = CreateCompressiblePayloads({ 500, 100, 300 });
+
+		// Act:
+		WriteAllBatched(context.database(), 10, payloads);
+
+		// Assert:
+		EXPECT_EQ(3u, context.countDatabaseFiles(0));
+		for (auto i = 0u; i < payloads.size(); ++i) {
+			EXPECT_TRUE(IsCompressedPayload(context.readAll(10 + i))) << "payload " << i;
+			EXPECT_EQ(payloads[i], ReadAll(context.database(), 10 + i)) << "payload " << i;
+		}
+	}
+
+	// endregion
+
 	// region read + write without header
 
 	TEST(TEST_CLASS, CanWriteAcrossMultipleFilesInHeaderlessMode) {
@@ -679,4 +999,182 @@ namespace catapult { namespace io {
 	}
 
 	// endregion
+
+	// region memory mapped reads
+
+	namespace {
+		std::vector<uint8_t> ToVector(const RawBuffer& buffer) {
+			return std::vector<uint8_t>(buffer.pData, buffer.pData + buffer.Size);
+		}
+	}
+
+	TEST(TEST_CLASS, CannotReadMappedPayloadWhenMemoryMappedReadsAreDisabled) {
+		// Arrange:
+		TestContext context;
+
+		auto payloads = CreatePayloads({ 50, 10, 30 });
+		WriteAll(context.database(), 10, payloads);
+
+		// Act + Assert:
+		EXPECT_THROW(context.database().mappedPayload(10), catapult_invalid_argument);
+	}
+
+	READ_TEST(CanReadMappedPayloadInFile) {
+		// Arrange:
+		TestContext context(Batch_Size, true);
+
+		auto payloads = CreatePayloads({ 50, 10, 30, 20, 15 });
+		WriteAll(context.database(), 10, payloads);
+
+		// Act:
+		auto mappedPayload = context.database().mappedPayload(10 + Payload_Index);
+
+		// Assert:
+		ASSERT_TRUE(!!mappedPayload.pOwner);
+		EXPECT_EQ(payloads[Payload_Index], ToVector(mappedPayload.Data));
+	}
+
+	TEST(TEST_CLASS, CanReadMappedLastPayloadInPartiallyFullFile) {
+		// Arrange:
+		TestContext context(Batch_Size, true);
+
+		auto payloads = CreatePayloads({ 50, 10, 30 });
+		WriteAll(context.database(), 10, payloads);
+
+		// Act:
+		auto mappedPayload = context.database().mappedPayload(12);
+
+		// Assert:
+		EXPECT_EQ(payloads[2], ToVector(mappedPayload.Data));
+	}
+
+	TEST(TEST_CLASS, CannotReadUnwrittenMappedPayloadInPartiallyFullFile) {
+		// Arrange:
+		TestContext context(Batch_Size, true);
+
+		auto payloads = CreatePayloads({ 50, 10, 30 });
+		WriteAll(context.database(), 10, payloads);
+
+		// Act + Assert:
+		EXPECT_THROW(context.database().mappedPayload(13), catapult_file_io_error);
+	}
+
+	TEST(TEST_CLASS, CanReadMappedPayloadAppendedAfterFileWasMapped) {
+		// Arrange:
+		TestContext context(Batch_Size, true);
+
+		auto payloads = CreatePayloads({ 50, 10, 30 });
+		WriteAll(context.database(), 10, { payloads[0] });
+		auto mappedPayload1 = context.database().mappedPayload(10);
+
+		// Act:
+		WriteAll(context.database(), 11, { payloads[1], payloads[2] });
+		auto mappedPayload2 = context.database().mappedPayload(11);
+		auto mappedPayload3 = context.database().mappedPayload(12);
+
+		// Assert:
+		EXPECT_EQ(payloads[0], ToVector(mappedPayload1.Data));
+		EXPECT_EQ(payloads[1], ToVector(mappedPayload2.Data));
+		EXPECT_EQ(payloads[2], ToVector(mappedPayload3.Data));
+	}
+
+	TEST(TEST_CLASS, CanRewritePayloadWhenMemoryMappedReadsAreEnabled) {
+		// Arrange:
+		TestContext context(Batch_Size, true);
+
+		auto payloads = CreatePayloads({ 50, 10, 30, 20, 15 });
+		WriteAll(context.database(), 10, payloads);
+
+		// Act:
+		auto newPayload = test::GenerateRandomVector(50);
+		WriteAll(context.database(), 12, { newPayload });
+
+		// Assert: no temporary files remain and contents are identical to in place rewrite
+		EXPECT_EQ(1u, context.countDatabaseFiles());
+		EXPECT_EQ(1u, context.countDatabaseFiles(0));
+
+		auto contents = context.readAll(10);
+		EXPECT_EQ(Concatenate({ MakeHeader({ 40, 90, 100, 0, 0 }), payloads[0], payloads[1], newPayload }), contents);
+		EXPECT_EQ(newPayload, ToVector(context.database().mappedPayload(12).Data));
+	}
+
+	TEST(TEST_CLASS, MappedPayloadIsUnchangedByRewrite) {
+		// Arrange:
+		TestContext context(Batch_Size, true);
+
+		auto payloads = CreatePayloads({ 50, 10, 30, 20, 15 });
+		WriteAll(context.database(), 10, payloads);
+		auto mappedPayload = context.database().mappedPayload(13);
+
+		// Act: rewrite a preceding payload, which drops the mapped payload from the file
+		WriteAll(context.database(), 11, { test::GenerateRandomVector(7) });
+
+		// Assert: original view is still valid
+		EXPECT_EQ(payloads[3], ToVector(mappedPayload.Data));
+		EXPECT_THROW(context.database().mappedPayload(13), catapult_file_io_error);
+	}
+
+	TEST(TEST_CLASS, CanReadMappedPayloadInHeaderlessMode) {
+		// Arrange:
+		TestContext context(1, true);
+
+		auto payloads = CreatePayloads({ 50, 10, 30 });
+		WriteAll(context.database(), 10, payloads);
+
+		// Act:
+		auto mappedPayload1 = context.database().mappedPayload(10);
+		auto mappedPayload3 = context.database().mappedPayload(12);
+
+		// Assert:
+		EXPECT_EQ(payloads[0], ToVector(mappedPayload1.Data));
+		EXPECT_EQ(payloads[2], ToVector(mappedPayload3.Data));
+	}
+
+	namespace {
+		void AssertCanReadMappedCompressedPayloads(size_t batchSize) {
+			// Arrange: write compressed payloads and read them with compression disabled
+			TestContext context(batchSize, true);
+			auto payloads = CreateCompressiblePayloads({ 500, 100, 300 });
+
+			auto compressedDatabase = context.createDatabase(batchSize, Compression_Level);
+			WriteAllBatched(compressedDatabase, 10, payloads);
+
+			for (auto i = 0u; i < payloads.size(); ++i) {
+				// Act:
+				auto mappedPayload = context.database().mappedPayload(10 + i);
+
+				// Assert: payloads are decompressed instead of being mapped as stored
+				ASSERT_TRUE(!!mappedPayload.pOwner);
+				EXPECT_EQ(payloads[i], ToVector(mappedPayload.Data)) << "payload " << i;
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, CanReadMappedCompressedPayloads) {
+		AssertCanReadMappedCompressedPayloads(Batch_Size);
+	}
+
+	TEST(TEST_CLASS, CanReadMappedCompressedPayloadsInHeaderlessMode) {
+		AssertCanReadMappedCompressedPayloads(1);
+	}
+
+	TEST(TEST_CLASS, MappedPayloadIsUnchangedByRewriteInHeaderlessMode) {
+		// Arrange:
+		TestContext context(1, true);
+
+		auto payloads = CreatePayloads({ 50, 10, 30 });
+		WriteAll(context.database(), 10, payloads);
+		auto mappedPayload = context.database().mappedPayload(11);
+
+		// Act:
+		auto newPayload = test::GenerateRandomVector(7);
+		WriteAll(context.database(), 11, { newPayload });
+
+		// Assert:
+		EXPECT_EQ(3u, context.countDatabaseFiles(0));
+		EXPECT_EQ(payloads[1], ToVector(mappedPayload.Data));
+		EXPECT_EQ(newPayload, ToVector(context.database().mappedPayload(11).Data));
+	}
+
+	// endregion
 }}
@@ -260,5 +260,63 @@ namespace catapult { namespace io {
 		AssertValues(values, { 1, 12, 13, 4 });
 	}
 
+	TEST(TEST_CLASS, StorageCanSaveAllAscendingKeys) {
+		// Arrange:
+		TestContext context;
+		context.seed(2);
+
+		// Act:
+		context.hashFile().saveAll(Height(2), { ToValue(12), ToValue(13), ToValue(14) });
+
+		auto values = context.hashFile().loadRangeFrom(Height(1), 4);
+
+		// Assert:
+		ASSERT_EQ(5 * ValueType::Size, fs::file_size(context.filename("00000")));
+		AssertValues(values, { 1, 12, 13, 14 });
+	}
+
+	TEST(TEST_CLASS, StorageCanSaveAllKeysSpanningMultipleFiles) {
+		// Arrange:
+		TestContext context;
+		context.seed(Files_Per_Storage_Directory - 5);
+
+		std::vector<ValueType> valuesToSave;
+		for (auto i = 0u; i < 10; ++i)
+			valuesToSave.push_back(ToValue(Files_Per_Storage_Directory - 5 + i));
+
+		// Act:
+		context.hashFile().saveAll(Height(Files_Per_Storage_Directory - 5), valuesToSave);
+
+		auto values = context.hashFile().loadRangeFrom(Height(Files_Per_Storage_Directory - 10), 15);
+
+		// Assert:
+		EXPECT_EQ(Files_Per_Storage_Directory * ValueType::Size, fs::file_size(context.filename("00000")));
+		EXPECT_EQ(5 * ValueType::Size, fs::file_size(context.filename("00001")));
+		AssertValues(values, Files_Per_Storage_Directory - 10, 15);
+	}
+
+	TEST(TEST_CLASS, StorageCannotSaveAllSkippingSomeKeys) {
+		// Arrange:
+		TestContext context;
+		context.seed(2);
+
+		// Act + Assert:
+		EXPECT_THROW(context.hashFile().saveAll(Height(4), { ToValue(14), ToValue(15) }), catapult_file_io_error);
+	}
+
+	TEST(TEST_CLASS, StorageCanSaveAllOverwritingExistingKeys) {
+		// Arrange:
+		TestContext context;
+		context.seed(5);
+
+		// Act:
+		context.hashFile().saveAll(Height(2), { ToValue(12), ToValue(13) });
+
+		auto values = context.hashFile().loadRangeFrom(Height(1), 4);
+
+		// Assert:
+		AssertValues(values, { 1, 12, 13, 4 });
+	}
+
 	// endregion
 }}
@@ -0,0 +1,177 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/io/FileBlockStorage.h"
+#include "catapult/io/PodIoUtils.h"
+#include "tests/test/core/BlockStorageTests.h"
+#include "tests/test/core/StorageTestUtils.h"
+#include "tests/test/nodeps/Filesystem.h"
+#include "tests/test/nodeps/TestConstants.h"
+#include "tests/TestHarness.h"
+#include <filesystem>
+
+namespace catapult { namespace io {
+
+#define TEST_CLASS MemoryMappedFileBlockStorageTests
+
+	namespace {
+		struct MemoryMappedFileTraits {
+			using Guard = test::TempDirectoryGuard;
+			using StorageType = FileBlockStorage;
+
+			static std::unique_ptr<StorageType> OpenStorage(const std::string& destination, uint32_t fileDatabaseBatchSize = 1) {
+				return std::make_unique<StorageType>(
+						destination,
+						fileDatabaseBatchSize,
+						FileBlockStorageMode::Hash_Index,
+						FileBlockStorageReadMode::Memory_Mapped);
+			}
+
+			static std::unique_ptr<StorageType> PrepareStorage(const std::string& destination, Height height = Height()) {
+				test::PrepareStorage(destination);
+				if (Height() != height)
+					test::FakeHeight(destination, height.unwrap());
+
+				return OpenStorage(destination, test::File_Database_Batch_Size);
+			}
+		};
+
+		struct SavedBlockContext {
+			std::unique_ptr<model::Block> pBlock;
+			model::BlockElement Element;
+		};
+
+		SavedBlockContext SaveBlock(FileBlockStorage& storage, Height height) {
+			auto pBlock = test::GenerateBlockWithTransactions(5, height);
+			auto element = test::BlockToBlockElement(*pBlock, test::GenerateRandomByteArray<Hash256>());
+			storage.saveBlock(element);
+			return { std::move(pBlock), element };
+		}
+	}
+
+	DEFINE_BLOCK_STORAGE_TESTS(MemoryMappedFileTraits)
+	DEFINE_PRUNABLE_BLOCK_STORAGE_TESTS(MemoryMappedFileTraits)
+
+	// region view lifetime
+
+	TEST(TEST_CLASS, LoadedBlockIsUnchangedWhenBlockIsOverwritten) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto pStorage = MemoryMappedFileTraits::PrepareStorage(tempDir.name());
+		auto context = SaveBlock(*pStorage, Height(2));
+		auto pBlock = pStorage->loadBlock(Height(2));
+		auto pBlockElement = pStorage->loadBlockElement(Height(2));
+
+		// Act:
+		pStorage->dropBlocksAfter(Height(1));
+		auto newContext = SaveBlock(*pStorage, Height(2));
+
+		// Assert: previously loaded views are unchanged
+		EXPECT_EQ(*context.pBlock, *pBlock);
+		test::AssertEqual(context.Element, *pBlockElement);
+
+		// - newly loaded views contain new data
+		EXPECT_EQ(*newContext.pBlock, *pStorage->loadBlock(Height(2)));
+		test::AssertEqual(newContext.Element, *pStorage->loadBlockElement(Height(2)));
+	}
+
+	TEST(TEST_CLASS, LoadedBlockElementIsUnchangedWhenStorageIsPurged) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto pStorage = MemoryMappedFileTraits::PrepareStorage(tempDir.name());
+		auto context = SaveBlock(*pStorage, Height(2));
+		auto pBlockElement = pStorage->loadBlockElement(Height(2));
+
+		// Act:
+		pStorage->purge();
+
+		// Assert:
+		test::AssertEqual(context.Element, *pBlockElement);
+	}
+
+	TEST(TEST_CLASS, CanLoadBlocksSavedAfterFileWasMapped) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto pStorage = MemoryMappedFileTraits::PrepareStorage(tempDir.name());
+		auto context1 = SaveBlock(*pStorage, Height(2));
+		auto pBlockElement1 = pStorage->loadBlockElement(Height(2));
+
+		// Act:
+		auto context2 = SaveBlock(*pStorage, Height(3));
+		auto pBlockElement2 = pStorage->loadBlockElement(Height(3));
+
+		// Assert:
+		test::AssertEqual(context1.Element, *pBlockElement1);
+		test::AssertEqual(context2.Element, *pBlockElement2);
+	}
+
+	// endregion
+
+	// region storage trailing and truncated data
+
+	TEST(TEST_CLASS, CannotReadSavedBlockElementWithTrailingData) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		{
+			auto pStorage = MemoryMappedFileTraits::PrepareStorage(tempDir.name());
+			SaveBlock(*pStorage, Height(2));
+		}
+
+		// - append some data
+		{
+			io::RawFile file(tempDir.name() + "/00000/00000.dat", io::OpenMode::Read_Append);
+			file.seek(file.size());
+			std::vector<uint8_t> buffer{ 42 };
+			file.write(buffer);
+		}
+
+		// Act + Assert:
+		auto pStorage = MemoryMappedFileTraits::OpenStorage(tempDir.name(), test::File_Database_Batch_Size);
+		EXPECT_THROW(pStorage->loadBlockElement(Height(2)), catapult_file_io_error);
+	}
+
+	TEST(TEST_CLASS, CannotLoadSavedBlockWithTruncatedData) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		uint32_t blockSize;
+		{
+			auto pStorage = MemoryMappedFileTraits::PrepareStorage(tempDir.name());
+			blockSize = SaveBlock(*pStorage, Height(2)).pBlock->Size;
+		}
+
+		// - truncate the file so that it ends one byte before the end of the block
+		auto filename = tempDir.name() + "/00000/00000.dat";
+		uint64_t bodyStartOffset;
+		{
+			io::RawFile file(filename, io::OpenMode::Read_Only);
+			file.seek(2 * sizeof(uint64_t));
+			bodyStartOffset = Read64(file);
+		}
+
+		std::filesystem::resize_file(filename, bodyStartOffset + blockSize - 1);
+
+		// Act + Assert:
+		auto pStorage = MemoryMappedFileTraits::OpenStorage(tempDir.name(), test::File_Database_Batch_Size);
+		EXPECT_THROW(pStorage->loadBlock(Height(2)), catapult_runtime_error);
+	}
+
+	// endregion
+}}
@@ -0,0 +1,150 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/io/MemoryMappedFile.h"
+#include "catapult/io/RawFile.h"
+#include "tests/test/nodeps/Filesystem.h"
+#include "tests/TestHarness.h"
+#include <filesystem>
+
+using catapult::test::TempFileGuard;
+
+namespace catapult { namespace io {
+
+#define TEST_CLASS MemoryMappedFileTests
+
+	namespace {
+		auto WriteRandomVectorToFile(const std::string& filename, size_t size) {
+			auto inputData = test::GenerateRandomVector(size);
+			RawFile file(filename, OpenMode::Read_Write);
+			file.write(inputData);
+			return inputData;
+		}
+	}
+
+	// region ctor
+
+	TEST(TEST_CLASS, MappingNonexistentFileThrows) {
+		// Arrange:
+		TempFileGuard guard("abcdefghijklmnopqrstuvwxyz");
+
+		// Act + Assert:
+		EXPECT_THROW(MemoryMappedFile(guard.name()), catapult_file_io_error);
+	}
+
+	TEST(TEST_CLASS, CanMapEmptyFile) {
+		// Arrange:
+		TempFileGuard guard("test.dat");
+		WriteRandomVectorToFile(guard.name(), 0);
+
+		// Act:
+		MemoryMappedFile mapping(guard.name());
+
+		// Assert:
+		EXPECT_EQ(0u, mapping.size());
+		EXPECT_FALSE(!!mapping.data());
+	}
+
+	TEST(TEST_CLASS, CanMapFile) {
+		// Arrange:
+		TempFileGuard guard("test.dat");
+		auto inputData = WriteRandomVectorToFile(guard.name(), 12345);
+
+		// Act:
+		MemoryMappedFile mapping(guard.name());
+
+		// Assert:
+		ASSERT_EQ(inputData.size(), mapping.size());
+		EXPECT_EQ_MEMORY(inputData.data(), mapping.data(), inputData.size());
+	}
+
+	// endregion
+
+	// region file changes
+
+	TEST(TEST_CLASS, MappingIsNotExtendedWhenFileGrows) {
+		// Arrange:
+		TempFileGuard guard("test.dat");
+		auto inputData = WriteRandomVectorToFile(guard.name(), 100);
+		MemoryMappedFile mapping(guard.name());
+
+		// Act:
+		{
+			RawFile file(guard.name(), OpenMode::Read_Append);
+			file.seek(file.size());
+			file.write(test::GenerateRandomVector(50));
+		}
+
+		// Assert:
+		ASSERT_EQ(100u, mapping.size());
+		EXPECT_EQ_MEMORY(inputData.data(), mapping.data(), inputData.size());
+	}
+
+	TEST(TEST_CLASS, MappingIsUnchangedWhenFileIsReplaced) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto filename = (std::filesystem::path(tempDir.name()) / "test.dat").generic_string();
+		auto replacementFilename = filename + ".tmp";
+		auto inputData = WriteRandomVectorToFile(filename, 100);
+		MemoryMappedFile mapping(filename);
+
+		// Act:
+		WriteRandomVectorToFile(replacementFilename, 100);
+		std::filesystem::rename(replacementFilename, filename);
+
+		// Assert:
+		ASSERT_EQ(100u, mapping.size());
+		EXPECT_EQ_MEMORY(inputData.data(), mapping.data(), inputData.size());
+	}
+
+	// endregion
+
+	// region advise
+
+	TEST(TEST_CLASS, CanAdviseAccessPatterns) {
+		// Arrange:
+		TempFileGuard guard("test.dat");
+		auto inputData = WriteRandomVectorToFile(guard.name(), 10000);
+		MemoryMappedFile mapping(guard.name());
+
+		// Act: hints do not change data
+		mapping.advise(0, mapping.size(), MemoryAccessPattern::Sequential);
+		mapping.advise(5000, 1234, MemoryAccessPattern::Will_Need);
+		mapping.advise(9000, 5000, MemoryAccessPattern::Will_Need);
+		mapping.advise(20000, 100, MemoryAccessPattern::Will_Need);
+
+		// Assert:
+		ASSERT_EQ(inputData.size(), mapping.size());
+		EXPECT_EQ_MEMORY(inputData.data(), mapping.data(), inputData.size());
+	}
+
+	TEST(TEST_CLASS, CanAdviseAccessPatternsForEmptyFile) {
+		// Arrange:
+		TempFileGuard guard("test.dat");
+		WriteRandomVectorToFile(guard.name(), 0);
+		MemoryMappedFile mapping(guard.name());
+
+		// Act + Assert: no exception
+		mapping.advise(0, 100, MemoryAccessPattern::Sequential);
+	}
+
+	// endregion
+}}
@@ -97,14 +97,67 @@ namespace catapult { namespace io {
 		// endregion
 	}
 
-	// region MoveBlockFiles
-
 #define TRAITS_BASED_TEST(TEST_NAME) \
 	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
 	TEST(TEST_CLASS, TEST_NAME##_WithoutStatements) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<BlocksWithoutStatementTraits>(); } \
 	TEST(TEST_CLASS, TEST_NAME##_WithStatements) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<BlocksWithStatementTraits>(); } \
 	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
 
+	// region CopyBlockFiles
+
+	TRAITS_BASED_TEST(CanCopyBlockFilesWhenDestinationIsEmpty) {
+		// Arrange: destination 0 blocks, source 4 blocks
+		auto destination = mocks::MockMemoryBlockStorage();
+		auto source = mocks::MockMemoryBlockStorage();
+		auto sourceBlocks = CreateBlockElements<TTraits>(2, 5);
+
+		PopulateBlockStorage(source, sourceBlocks);
+
+		// Act:
+		CopyBlockFiles(source, destination, Height(2));
+
+		// Assert: blocks are present in both destination and source
+		AssertStorage(sourceBlocks, destination);
+		AssertStorage(sourceBlocks, source);
+		EXPECT_EQ(Height(5), source.chainHeight());
+	}
+
+	TRAITS_BASED_TEST(CanCopyBlockFilesWhenDestinationHasForkedChain) {
+		// Arrange: destination 4 blocks, source 2 blocks
+		auto destination = mocks::MockMemoryBlockStorage();
+		auto source = mocks::MockMemoryBlockStorage();
+		auto destinationBlocks = CreateBlockElements<TTraits>(2, 5);
+		auto sourceBlocks = CreateBlockElements<TTraits>(3, 4);
+
+		PopulateBlockStorage(destination, destinationBlocks);
+		PopulateBlockStorage(source, sourceBlocks);
+
+		// Act:
+		CopyBlockFiles(source, destination, Height(3));
+
+		// Assert: blocks are present in both destination and source
+		AssertStorage(sourceBlocks, destination);
+		AssertStorage(sourceBlocks, source);
+		EXPECT_EQ(Height(4), destination.chainHeight());
+		EXPECT_EQ(Height(4), source.chainHeight());
+	}
+
+	TRAITS_BASED_TEST(CopyBlockFilesThrowsWhenStartHeightIsLessThanOne) {
+		// Arrange: destination 0 blocks, source 4 blocks
+		auto destination = mocks::MockMemoryBlockStorage();
+		auto source = mocks::MockMemoryBlockStorage();
+		auto sourceBlocks = CreateBlockElements<TTraits>(2, 5);
+
+		PopulateBlockStorage(source, sourceBlocks);
+
+		// Act + Assert:
+		EXPECT_THROW(CopyBlockFiles(source, destination, Height(0)), catapult_invalid_argument);
+	}
+
+	// endregion
+
+	// region MoveBlockFiles
+
 	TRAITS_BASED_TEST(CanMoveBlockFilesWhenDestinationHasNormalChain) {
 		// Arrange: destination 0 blocks, source 4 blocks
 		auto destination = mocks::MockMemoryBlockStorage();
@@ -0,0 +1,180 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/io/PayloadCompression.h"
+#include "tests/test/nodeps/Random.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace io {
+
+#define TEST_CLASS PayloadCompressionTests
+
+	namespace {
+		std::vector<uint8_t> GenerateCompressibleVector(size_t size) {
+			auto buffer = test::GenerateRandomVector(size);
+			for (auto i = 0u; i < buffer.size(); ++i)
+				buffer[i] = 0 == i % 4 ? buffer[i] : 0;
+
+			return buffer;
+		}
+	}
+
+	// region MaxPayloadCompressionLevel
+
+	TEST(TEST_CLASS, MaxPayloadCompressionLevelIsNonzero) {
+		EXPECT_LT(0u, MaxPayloadCompressionLevel());
+	}
+
+	// endregion
+
+	// region IsCompressedPayload
+
+	TEST(TEST_CLASS, IsCompressedPayloadReturnsFalseForShortBuffer) {
+		// Arrange:
+		auto compressed = CompressPayload(test::GenerateRandomVector(100), 1);
+
+		// Act + Assert:
+		EXPECT_FALSE(IsCompressedPayload({ compressed.data(), 0 }));
+		EXPECT_FALSE(IsCompressedPayload({ compressed.data(), 3 }));
+	}
+
+	TEST(TEST_CLASS, IsCompressedPayloadReturnsFalseForUncompressedBuffer) {
+		// Arrange:
+		auto buffer = std::vector<uint8_t>{ 0x10, 0x20, 0x30, 0x40, 0x50 };
+
+		// Act + Assert:
+		EXPECT_FALSE(IsCompressedPayload(buffer));
+	}
+
+	TEST(TEST_CLASS, IsCompressedPayloadReturnsTrueForCompressedBuffer) {
+		// Arrange:
+		auto compressed = CompressPayload(test::GenerateRandomVector(100), 1);
+
+		// Act + Assert:
+		EXPECT_TRUE(IsCompressedPayload(compressed));
+	}
+
+	// endregion
+
+	// region CompressPayload
+
+	TEST(TEST_CLASS, CannotCompressPayloadWithZeroCompressionLevel) {
+		// Arrange:
+		auto buffer = test::GenerateRandomVector(100);
+
+		// Act + Assert:
+		EXPECT_THROW(CompressPayload(buffer, 0), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, CannotCompressPayloadWithUnsupportedCompressionLevel) {
+		// Arrange:
+		auto buffer = test::GenerateRandomVector(100);
+
+		// Act + Assert:
+		EXPECT_THROW(CompressPayload(buffer, MaxPayloadCompressionLevel() + 1), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, CompressPayloadReducesSizeOfCompressibleBuffer) {
+		// Arrange:
+		auto buffer = GenerateCompressibleVector(1000);
+
+		// Act:
+		auto compressed = CompressPayload(buffer, 3);
+
+		// Assert:
+		EXPECT_GT(buffer.size(), compressed.size());
+	}
+
+	TEST(TEST_CLASS, CompressPayloadIsDeterministic) {
+		// Arrange:
+		auto buffer = GenerateCompressibleVector(1000);
+
+		// Act:
+		auto compressed1 = CompressPayload(buffer, 3);
+		auto compressed2 = CompressPayload(buffer, 3);
+
+		// Assert:
+		EXPECT_EQ(compressed1, compressed2);
+	}
+
+	// endregion
+
+	// region DecompressPayload
+
+	namespace {
+		void AssertCanRoundtrip(const std::vector<uint8_t>& buffer, uint32_t compressionLevel) {
+			// Act:
+			auto decompressed = DecompressPayload(CompressPayload(buffer, compressionLevel));
+
+			// Assert:
+			EXPECT_EQ(buffer, decompressed) << "size " << buffer.size() << ", level " << compressionLevel;
+		}
+	}
+
+	TEST(TEST_CLASS, CanRoundtripEmptyPayload) {
+		AssertCanRoundtrip({}, 3);
+	}
+
+	TEST(TEST_CLASS, CanRoundtripRandomPayload) {
+		for (auto compressionLevel : { 1u, 3u, MaxPayloadCompressionLevel() })
+			AssertCanRoundtrip(test::GenerateRandomVector(1234), compressionLevel);
+	}
+
+	TEST(TEST_CLASS, CanRoundtripCompressiblePayload) {
+		for (auto compressionLevel : { 1u, 3u, MaxPayloadCompressionLevel() })
+			AssertCanRoundtrip(GenerateCompressibleVector(1234), compressionLevel);
+	}
+
+	TEST(TEST_CLASS, DecompressPayloadIgnoresTrailingFrames) {
+		// Arrange:
+		auto buffer1 = GenerateCompressibleVector(1000);
+		auto buffer2 = test::GenerateRandomVector(500);
+		auto compressed = CompressPayload(buffer1, 3);
+		auto compressed2 = CompressPayload(buffer2, 3);
+		compressed.insert(compressed.end(), compressed2.cbegin(), compressed2.cend());
+
+		// Act:
+		auto decompressed = DecompressPayload(compressed);
+
+		// Assert:
+		EXPECT_EQ(buffer1, decompressed);
+	}
+
+	TEST(TEST_CLASS, CannotDecompressUncompressedPayload) {
+		// Arrange:
+		auto buffer = test::GenerateRandomVector(100);
+		buffer[0] = 0;
+
+		// Act + Assert:
+		EXPECT_THROW(DecompressPayload(buffer), catapult_runtime_error);
+	}
+
+	TEST(TEST_CLASS, CannotDecompressTruncatedPayload) {
+		// Arrange:
+		auto compressed = CompressPayload(GenerateCompressibleVector(1000), 3);
+		compressed.resize(compressed.size() - 1);
+
+		// Act + Assert:
+		EXPECT_THROW(DecompressPayload(compressed), catapult_runtime_error);
+	}
+
+	// endregion
+}}
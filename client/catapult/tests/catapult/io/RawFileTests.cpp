@@ -264,6 +264,67 @@ namespace catapult { namespace io {
 		EXPECT_EQ(inputData.size(), rawFile.position());
 	}
 
+	WRITING_TRAITS_BASED_TEST(WriteBuffersWritesAllBuffersAndAltersSizeAndPosition) {
+		// Arrange:
+		TempFileGuard guard("test.dat");
+		auto inputData = test::GenerateRandomVector(Default_Bytes_Written);
+
+		// Act:
+		{
+			RawFile rawFile(guard.name(), TTraits::Mode);
+			rawFile.writeBuffers({
+				{ inputData.data(), 50 },
+				{ inputData.data() + 50, 0 },
+				{ inputData.data() + 50, Default_Bytes_Written - 50 }
+			});
+
+			// Assert:
+			EXPECT_EQ(inputData.size(), rawFile.size());
+			EXPECT_EQ(inputData.size(), rawFile.position());
+		}
+
+		RawFile readFile(guard.name(), OpenMode::Read_Only);
+		std::vector<uint8_t> buffer(Default_Bytes_Written);
+		readFile.read(buffer);
+		EXPECT_EQ(inputData, buffer);
+	}
+
+	TEST(TEST_CLASS, WriteBuffersCanOverwriteDataInTheMiddle) {
+		// Arrange:
+		TempFileGuard guard("test.dat");
+		auto inputData = WriteRandomVectorToFile(guard);
+		auto partialData = test::GenerateRandomVector(20);
+
+		// Act:
+		{
+			RawFile rawFile(guard.name(), OpenMode::Read_Append);
+			rawFile.seek(10);
+			rawFile.writeBuffers({ { partialData.data(), 5 }, { partialData.data() + 5, 15 } });
+
+			// Assert:
+			EXPECT_EQ(Default_Bytes_Written, rawFile.size());
+			EXPECT_EQ(30u, rawFile.position());
+		}
+
+		std::memcpy(&inputData[10], partialData.data(), partialData.size());
+
+		RawFile readFile(guard.name(), OpenMode::Read_Only);
+		std::vector<uint8_t> buffer(Default_Bytes_Written);
+		readFile.read(buffer);
+		EXPECT_EQ(inputData, buffer);
+	}
+
+	TEST(TEST_CLASS, WriteBuffersOnReadOnlyFileThrowsException) {
+		// Arrange:
+		TempFileGuard guard("test.dat");
+		auto inputData = WriteRandomVectorToFile(guard);
+
+		RawFile rawFile(guard.name(), OpenMode::Read_Only);
+
+		// Act + Assert:
+		EXPECT_THROW(rawFile.writeBuffers({ inputData }), catapult_file_io_error);
+	}
+
 	TEST(TEST_CLASS, WriteOnReadOnlyFileThrowsException) {
 		// Arrange:
 		TempFileGuard guard("test.dat");
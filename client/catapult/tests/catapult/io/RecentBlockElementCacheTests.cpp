@@ -0,0 +1,249 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/io/RecentBlockElementCache.h"
+#include "tests/test/core/BlockTestUtils.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace io {
+
+#define TEST_CLASS RecentBlockElementCacheTests
+
+	namespace {
+		std::shared_ptr<const model::BlockElement> CreateBlockElement(Height height, uint32_t numTransactions = 0) {
+			auto pBlock = std::shared_ptr<model::Block>(test::GenerateBlockWithTransactions(numTransactions, height));
+			auto pBlockElement = std::make_shared<model::BlockElement>(test::BlockToBlockElement(*pBlock));
+			return std::shared_ptr<const model::BlockElement>(pBlockElement.get(), [pBlock, pBlockElement](const auto*) {});
+		}
+
+		uint64_t GetMemorySize(const model::BlockElement& blockElement) {
+			return sizeof(model::BlockElement)
+					+ blockElement.Block.Size
+					+ blockElement.Transactions.size() * sizeof(model::TransactionElement)
+					+ blockElement.SubCacheMerkleRoots.size() * Hash256::Size;
+		}
+
+		// creates a cache that can hold \a numBlockElements block elements without transactions
+		RecentBlockElementCache CreateCache(size_t numBlockElements) {
+			auto blockElementSize = GetMemorySize(*CreateBlockElement(Height(1)));
+			return RecentBlockElementCache(utils::FileSize::FromBytes(numBlockElements * blockElementSize));
+		}
+
+		void AssertCachedHeights(RecentBlockElementCache& cache, const std::vector<Height>& expectedHeights, Height maxHeight) {
+			for (auto height = Height(1); height <= maxHeight; height = height + Height(1)) {
+				auto isExpected = expectedHeights.cend() != std::find(expectedHeights.cbegin(), expectedHeights.cend(), height);
+				EXPECT_EQ(isExpected, !!cache.find(height)) << "height " << height;
+			}
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreateEmptyCache) {
+		// Act:
+		RecentBlockElementCache cache(utils::FileSize::FromKilobytes(123));
+
+		// Assert:
+		EXPECT_EQ(utils::FileSize::FromKilobytes(123), cache.maxMemorySize());
+		EXPECT_EQ(utils::FileSize(), cache.memorySize());
+		EXPECT_EQ(0u, cache.size());
+		EXPECT_EQ(0u, cache.numHits());
+		EXPECT_EQ(0u, cache.numMisses());
+	}
+
+	// endregion
+
+	// region find / insert
+
+	TEST(TEST_CLASS, FindReturnsNullptrWhenBlockElementIsNotCached) {
+		// Arrange:
+		auto cache = CreateCache(3);
+		cache.insert(CreateBlockElement(Height(4)));
+
+		// Act:
+		auto pBlockElement = cache.find(Height(5));
+
+		// Assert:
+		EXPECT_FALSE(!!pBlockElement);
+		EXPECT_EQ(0u, cache.numHits());
+		EXPECT_EQ(1u, cache.numMisses());
+	}
+
+	TEST(TEST_CLASS, FindReturnsBlockElementWhenCached) {
+		// Arrange:
+		auto cache = CreateCache(3);
+		auto pOriginalBlockElement = CreateBlockElement(Height(4), 3);
+		cache.insert(CreateBlockElement(Height(3)));
+		cache.insert(pOriginalBlockElement);
+
+		// Act:
+		auto pBlockElement = cache.find(Height(4));
+
+		// Assert:
+		EXPECT_EQ(pOriginalBlockElement, pBlockElement);
+		EXPECT_EQ(1u, cache.numHits());
+		EXPECT_EQ(0u, cache.numMisses());
+	}
+
+	TEST(TEST_CLASS, InsertUpdatesSizeAndMemorySize) {
+		// Arrange:
+		auto cache = CreateCache(10);
+		auto pBlockElement1 = CreateBlockElement(Height(3), 2);
+		auto pBlockElement2 = CreateBlockElement(Height(4), 3);
+
+		// Act:
+		cache.insert(pBlockElement1);
+		cache.insert(pBlockElement2);
+
+		// Assert:
+		EXPECT_EQ(2u, cache.size());
+		EXPECT_EQ(utils::FileSize::FromBytes(GetMemorySize(*pBlockElement1) + GetMemorySize(*pBlockElement2)), cache.memorySize());
+	}
+
+	TEST(TEST_CLASS, InsertReplacesBlockElementWithSameHeight) {
+		// Arrange:
+		auto cache = CreateCache(3);
+		auto pBlockElement1 = CreateBlockElement(Height(4));
+		auto pBlockElement2 = CreateBlockElement(Height(4));
+		cache.insert(pBlockElement1);
+
+		// Act:
+		cache.insert(pBlockElement2);
+
+		// Assert:
+		EXPECT_EQ(1u, cache.size());
+		EXPECT_EQ(utils::FileSize::FromBytes(GetMemorySize(*pBlockElement2)), cache.memorySize());
+		EXPECT_EQ(pBlockElement2, cache.find(Height(4)));
+	}
+
+	TEST(TEST_CLASS, InsertDoesNotCacheBlockElementLargerThanMaxMemorySize) {
+		// Arrange:
+		auto cache = CreateCache(1);
+
+		// Act:
+		cache.insert(CreateBlockElement(Height(4), 3));
+
+		// Assert:
+		EXPECT_EQ(0u, cache.size());
+		EXPECT_EQ(utils::FileSize(), cache.memorySize());
+	}
+
+	TEST(TEST_CLASS, InsertDoesNothingWhenMaxMemorySizeIsZero) {
+		// Arrange:
+		RecentBlockElementCache cache((utils::FileSize()));
+
+		// Act:
+		cache.insert(CreateBlockElement(Height(4)));
+
+		// Assert:
+		EXPECT_EQ(0u, cache.size());
+		EXPECT_FALSE(!!cache.find(Height(4)));
+	}
+
+	// endregion
+
+	// region eviction
+
+	TEST(TEST_CLASS, InsertEvictsLeastRecentlyInsertedBlockElements) {
+		// Arrange:
+		auto cache = CreateCache(3);
+
+		// Act:
+		for (auto i = 1u; i <= 5; ++i)
+			cache.insert(CreateBlockElement(Height(i)));
+
+		// Assert:
+		EXPECT_EQ(3u, cache.size());
+		AssertCachedHeights(cache, { Height(3), Height(4), Height(5) }, Height(5));
+	}
+
+	TEST(TEST_CLASS, InsertEvictsLeastRecentlyFoundBlockElements) {
+		// Arrange:
+		auto cache = CreateCache(3);
+		for (auto i = 1u; i <= 3; ++i)
+			cache.insert(CreateBlockElement(Height(i)));
+
+		// - mark height 1 as most recently used
+		cache.find(Height(1));
+
+		// Act:
+		cache.insert(CreateBlockElement(Height(4)));
+
+		// Assert:
+		EXPECT_EQ(3u, cache.size());
+		AssertCachedHeights(cache, { Height(1), Height(3), Height(4) }, Height(4));
+	}
+
+	TEST(TEST_CLASS, InsertEvictsMultipleBlockElementsWhenRequired) {
+		// Arrange:
+		auto cache = CreateCache(3);
+		for (auto i = 1u; i <= 3; ++i)
+			cache.insert(CreateBlockElement(Height(i)));
+
+		// Act: element is larger than two elements without transactions but smaller than three
+		auto pBlockElement = CreateBlockElement(Height(4), 1);
+		cache.insert(pBlockElement);
+
+		// Sanity:
+		auto blockElementSize = GetMemorySize(*CreateBlockElement(Height(1)));
+		EXPECT_LT(blockElementSize, GetMemorySize(*pBlockElement));
+		EXPECT_GT(2 * blockElementSize, GetMemorySize(*pBlockElement));
+
+		// Assert:
+		EXPECT_EQ(2u, cache.size());
+		AssertCachedHeights(cache, { Height(3), Height(4) }, Height(4));
+	}
+
+	// endregion
+
+	// region removeAfter
+
+	TEST(TEST_CLASS, RemoveAfterRemovesAllBlockElementsWithGreaterHeights) {
+		// Arrange:
+		auto cache = CreateCache(10);
+		for (auto i = 1u; i <= 7; ++i)
+			cache.insert(CreateBlockElement(Height(i)));
+
+		// Act:
+		cache.removeAfter(Height(4));
+
+		// Assert:
+		EXPECT_EQ(4u, cache.size());
+		EXPECT_EQ(utils::FileSize::FromBytes(4 * GetMemorySize(*CreateBlockElement(Height(1)))), cache.memorySize());
+		AssertCachedHeights(cache, { Height(1), Height(2), Height(3), Height(4) }, Height(7));
+	}
+
+	TEST(TEST_CLASS, RemoveAfterZeroRemovesAllBlockElements) {
+		// Arrange:
+		auto cache = CreateCache(10);
+		for (auto i = 1u; i <= 7; ++i)
+			cache.insert(CreateBlockElement(Height(i)));
+
+		// Act:
+		cache.removeAfter(Height(0));
+
+		// Assert:
+		EXPECT_EQ(0u, cache.size());
+		EXPECT_EQ(utils::FileSize(), cache.memorySize());
+	}
+
+	// endregion
+}}
@@ -0,0 +1,385 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/local/recovery/BlockElementPrefetcher.h"
+#include "sdk/src/extensions/BlockExtensions.h"
+#include "catapult/model/BlockUtils.h"
+#include "catapult/model/EntityHasher.h"
+#include "catapult/model/NotificationPublisher.h"
+#include "tests/test/core/BlockTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
+#include "tests/test/core/TransactionTestUtils.h"
+#include "tests/test/core/mocks/MockTransaction.h"
+#include "tests/test/nodeps/KeyTestUtils.h"
+#include "tests/TestHarness.h"
+#include <thread>
+
+namespace catapult { namespace local {
+
+#define TEST_CLASS BlockElementPrefetcherTests
+
+	// region CreateBlockElementVerifier
+
+	namespace {
+		class VerifierTestContext {
+		public:
+			VerifierTestContext()
+					: m_signer(test::GenerateKeyPair())
+					, m_transactionRegistry(mocks::CreateDefaultTransactionRegistry())
+					, m_pBlock(test::GenerateBlockWithTransactions(m_signer, test::GenerateRandomTransactions(3))) {
+				signFullBlock();
+			}
+
+		public:
+			model::Block& block() {
+				return *m_pBlock;
+			}
+
+			model::BlockElement& blockElement() {
+				return *m_pBlockElement;
+			}
+
+		public:
+			void resignBlock() {
+				model::SignBlockHeader(m_signer, *m_pBlock);
+				m_pBlockElement->EntityHash = model::CalculateHash(*m_pBlock);
+			}
+
+			void corruptTransactionSignature(size_t index) {
+				auto transactions = m_pBlock->Transactions();
+				auto iter = transactions.begin();
+				std::advance(iter, static_cast<std::ptrdiff_t>(index));
+				iter->Signature[0] ^= 0xFF;
+
+				// recalculate all hashes and resign the block so that only the transaction signature is invalid
+				signFullBlock();
+			}
+
+			void verify() const {
+				auto pPublisher = model::CreateNotificationPublisher(m_transactionRegistry, UnresolvedMosaicId(), Height());
+				const auto& generationHashSeed = test::GetDefaultGenerationHashSeed();
+				CreateBlockElementVerifier(m_transactionRegistry, generationHashSeed, std::move(pPublisher))(*m_pBlockElement);
+			}
+
+		private:
+			void signFullBlock() {
+				extensions(m_transactionRegistry).signFullBlock(m_signer, *m_pBlock);
+				m_pBlockElement = std::make_unique<model::BlockElement>(
+						extensions(m_transactionRegistry).convertBlockToBlockElement(*m_pBlock, GenerationHash()));
+			}
+
+		private:
+			static extensions::BlockExtensions extensions(const model::TransactionRegistry& transactionRegistry) {
+				return extensions::BlockExtensions(test::GetDefaultGenerationHashSeed(), transactionRegistry);
+			}
+
+		private:
+			crypto::KeyPair m_signer;
+			model::TransactionRegistry m_transactionRegistry;
+			std::unique_ptr<model::Block> m_pBlock;
+			std::unique_ptr<model::BlockElement> m_pBlockElement;
+		};
+	}
+
+	TEST(TEST_CLASS, VerifierAcceptsValidBlockElement) {
+		// Arrange:
+		VerifierTestContext context;
+
+		// Act + Assert:
+		EXPECT_NO_THROW(context.verify());
+	}
+
+	TEST(TEST_CLASS, VerifierRejectsBlockElementWithInvalidBlockHash) {
+		// Arrange:
+		VerifierTestContext context;
+		test::FillWithRandomData(context.blockElement().EntityHash);
+
+		// Act + Assert:
+		EXPECT_THROW(context.verify(), catapult_runtime_error);
+	}
+
+	TEST(TEST_CLASS, VerifierRejectsBlockElementWithInvalidBlockSignature) {
+		// Arrange: corrupt the signature but keep the block hash consistent
+		VerifierTestContext context;
+		context.block().Signature[Signature::Size - 1] ^= 0xFF;
+		context.blockElement().EntityHash = model::CalculateHash(context.block());
+
+		// Act + Assert:
+		EXPECT_THROW(context.verify(), catapult_runtime_error);
+	}
+
+	TEST(TEST_CLASS, VerifierRejectsBlockElementWithInvalidTransactionHash) {
+		// Arrange:
+		VerifierTestContext context;
+		test::FillWithRandomData(context.blockElement().Transactions[1].EntityHash);
+
+		// Act + Assert:
+		EXPECT_THROW(context.verify(), catapult_runtime_error);
+	}
+
+	TEST(TEST_CLASS, VerifierRejectsBlockElementWithInvalidTransactionMerkleComponentHash) {
+		// Arrange:
+		VerifierTestContext context;
+		test::FillWithRandomData(context.blockElement().Transactions[1].MerkleComponentHash);
+
+		// Act + Assert:
+		EXPECT_THROW(context.verify(), catapult_runtime_error);
+	}
+
+	TEST(TEST_CLASS, VerifierRejectsBlockElementWithInvalidTransactionSignature) {
+		// Arrange: all hashes and the block signature are consistent
+		VerifierTestContext context;
+		context.corruptTransactionSignature(1);
+
+		// Act + Assert:
+		EXPECT_THROW(context.verify(), catapult_runtime_error);
+	}
+
+	TEST(TEST_CLASS, VerifierRejectsBlockElementWithInvalidBlockTransactionsHash) {
+		// Arrange: change the transactions hash but keep the block signature and hash consistent
+		VerifierTestContext context;
+		test::FillWithRandomData(context.block().TransactionsHash);
+		context.resignBlock();
+
+		// Act + Assert:
+		EXPECT_THROW(context.verify(), catapult_runtime_error);
+	}
+
+	// endregion
+
+	// region BlockElementPrefetcher
+
+	namespace {
+		constexpr auto Start_Height = Height(3);
+		constexpr auto End_Height = Height(12);
+
+		class PrefetcherTestContext {
+		public:
+			explicit PrefetcherTestContext(uint32_t numThreads = 4)
+					: m_pPool(test::CreateStartedIoThreadPool(numThreads))
+					, m_numLoads(0)
+					, m_numVerifies(0) {
+				for (auto height = Start_Height; height <= End_Height; height = height + Height(1))
+					m_blocks.push_back(test::GenerateBlockWithTransactions(0, height));
+			}
+
+		public:
+			auto& ioContext() {
+				return m_pPool->ioContext();
+			}
+
+			size_t numLoads() const {
+				return m_numLoads;
+			}
+
+			size_t numVerifies() const {
+				return m_numVerifies;
+			}
+
+		public:
+			BlockElementLoader createLoader(Height failureHeight = Height()) {
+				return [this, failureHeight](auto height) {
+					++m_numLoads;
+					if (failureHeight == height)
+						CATAPULT_THROW_RUNTIME_ERROR("load failed");
+
+					// delay early loads in order to simulate out of order completion
+					if (height < Start_Height + Height(3))
+						std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+					return std::make_shared<model::BlockElement>(*m_blocks[(height - Start_Height).unwrap()]);
+				};
+			}
+
+			BlockElementVerifier createVerifier(Height failureHeight = Height()) {
+				return [this, failureHeight](const auto& blockElement) {
+					++m_numVerifies;
+					if (failureHeight == blockElement.Block.Height)
+						CATAPULT_THROW_RUNTIME_ERROR("verify failed");
+				};
+			}
+
+		private:
+			std::unique_ptr<thread::IoThreadPool> m_pPool;
+			std::vector<std::unique_ptr<model::Block>> m_blocks;
+			std::atomic<size_t> m_numLoads;
+			std::atomic<size_t> m_numVerifies;
+		};
+	}
+
+	TEST(TEST_CLASS, CannotCreatePrefetcherWithZeroMaxPrefetchedBlocks) {
+		// Arrange:
+		PrefetcherTestContext context;
+
+		// Act + Assert:
+		EXPECT_THROW(
+				BlockElementPrefetcher(context.ioContext(), Start_Height, End_Height, 0, context.createLoader(), context.createVerifier()),
+				catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, CanLoadAllBlockElementsInOrder) {
+		// Arrange:
+		PrefetcherTestContext context;
+		BlockElementPrefetcher prefetcher(
+				context.ioContext(),
+				Start_Height,
+				End_Height,
+				4,
+				context.createLoader(),
+				context.createVerifier());
+
+		// Act:
+		std::vector<Height> heights;
+		for (auto i = 0u; i < 10; ++i)
+			heights.push_back(prefetcher.next()->Block.Height);
+
+		// Assert:
+		std::vector<Height> expectedHeights;
+		for (auto height = Start_Height; height <= End_Height; height = height + Height(1))
+			expectedHeights.push_back(height);
+
+		EXPECT_EQ(expectedHeights, heights);
+		EXPECT_EQ(10u, context.numLoads());
+		EXPECT_EQ(10u, context.numVerifies());
+	}
+
+	TEST(TEST_CLASS, CanLoadAllBlockElementsWithoutVerifier) {
+		// Arrange:
+		PrefetcherTestContext context;
+		BlockElementPrefetcher prefetcher(
+				context.ioContext(),
+				Start_Height,
+				End_Height,
+				4,
+				context.createLoader(),
+				BlockElementVerifier());
+
+		// Act:
+		for (auto i = 0u; i < 10; ++i)
+			EXPECT_EQ(Start_Height + Height(i), prefetcher.next()->Block.Height);
+
+		// Assert:
+		EXPECT_EQ(10u, context.numLoads());
+		EXPECT_EQ(0u, context.numVerifies());
+	}
+
+	TEST(TEST_CLASS, CannotLoadMoreBlockElementsThanAvailable) {
+		// Arrange:
+		PrefetcherTestContext context;
+		BlockElementPrefetcher prefetcher(
+				context.ioContext(),
+				Start_Height,
+				End_Height,
+				4,
+				context.createLoader(),
+				context.createVerifier());
+
+		for (auto i = 0u; i < 10; ++i)
+			prefetcher.next();
+
+		// Act + Assert:
+		EXPECT_THROW(prefetcher.next(), catapult_out_of_range);
+	}
+
+	TEST(TEST_CLASS, PrefetcherDoesNotLoadMoreThanMaxPrefetchedBlocksAheadOfConsumption) {
+		// Arrange:
+		PrefetcherTestContext context;
+		BlockElementPrefetcher prefetcher(
+				context.ioContext(),
+				Start_Height,
+				End_Height,
+				4,
+				context.createLoader(),
+				context.createVerifier());
+
+		// Act: wait for initial loads
+		WAIT_FOR_VALUE_EXPR(4u, context.numLoads());
+		std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+		// Assert: no additional loads were started
+		EXPECT_EQ(4u, context.numLoads());
+
+		// Act: consume two block elements
+		prefetcher.next();
+		prefetcher.next();
+
+		// Assert: two additional loads were started
+		WAIT_FOR_VALUE_EXPR(6u, context.numLoads());
+	}
+
+	TEST(TEST_CLASS, NextRethrowsLoaderException) {
+		// Arrange:
+		PrefetcherTestContext context;
+		BlockElementPrefetcher prefetcher(
+				context.ioContext(),
+				Start_Height,
+				End_Height,
+				4,
+				context.createLoader(Height(6)),
+				context.createVerifier());
+
+		// Act + Assert: block elements before failure height are loaded successfully
+		for (auto height = Start_Height; height < Height(6); height = height + Height(1))
+			EXPECT_EQ(height, prefetcher.next()->Block.Height);
+
+		EXPECT_THROW(prefetcher.next(), catapult_runtime_error);
+	}
+
+	TEST(TEST_CLASS, NextRethrowsVerifierException) {
+		// Arrange:
+		PrefetcherTestContext context;
+		BlockElementPrefetcher prefetcher(
+				context.ioContext(),
+				Start_Height,
+				End_Height,
+				4,
+				context.createLoader(),
+				context.createVerifier(Height(6)));
+
+		// Act + Assert: block elements before failure height are loaded successfully
+		for (auto height = Start_Height; height < Height(6); height = height + Height(1))
+			EXPECT_EQ(height, prefetcher.next()->Block.Height);
+
+		EXPECT_THROW(prefetcher.next(), catapult_runtime_error);
+	}
+
+	TEST(TEST_CLASS, DestructorWaitsForOutstandingLoads) {
+		// Arrange: use a single thread so that loads are delayed
+		PrefetcherTestContext context(1);
+
+		// Act:
+		{
+			BlockElementPrefetcher prefetcher(
+				context.ioContext(),
+				Start_Height,
+				End_Height,
+				4,
+				context.createLoader(),
+				context.createVerifier());
+		}
+
+		// Assert: all scheduled loads completed before the prefetcher was destroyed
+		EXPECT_EQ(4u, context.numLoads());
+		EXPECT_EQ(4u, context.numVerifies());
+	}
+
+	// endregion
+}}
@@ -26,6 +26,7 @@
 #include "catapult/subscribers/StateChangeInfo.h"
 #include "tests/test/core/BlockTestUtils.h"
 #include "tests/test/core/ResolverTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/core/mocks/MockMemoryBlockStorage.h"
 #include "tests/test/local/BlockStateHash.h"
 #include "tests/test/local/FilechainTestUtils.h"
@@ -177,12 +178,21 @@ namespace catapult { namespace local {
 			}
 
 			model::ChainScore load(Height startHeight) {
+				return load(startHeight, nullptr);
+			}
+
+			model::ChainScore load(Height startHeight, const BlockLoadPipeline& pipeline) {
+				return load(startHeight, &pipeline);
+			}
+
+		private:
+			model::ChainScore load(Height startHeight, const BlockLoadPipeline* pPipeline) {
 				auto observerFactory = [this](const auto& block) {
 					this->m_factoryHeights.push_back(block.Height);
 					return std::make_unique<mocks::MockBlockHeightCapturingNotificationObserver>(this->m_observerBlockHeights);
 				};
 
-				auto score = LoadBlockchain(observerFactory, m_pluginManager, m_state.ref(), startHeight, [this](const auto& status) {
+				auto statusConsumer = [this](const auto& status) {
 					// check status for internal consistency
 					auto newComputedScore = m_statusScore;
 					newComputedScore += status.StateChangeInfo.ScoreDelta;
@@ -192,7 +202,11 @@ namespace catapult { namespace local {
 
 					m_statusScore = newComputedScore;
 					m_statusHeights.push_back(status.BlockElement.Block.Height);
-				});
+				};
+
+				auto score = pPipeline
+						? LoadBlockchain(observerFactory, m_pluginManager, m_state.ref(), startHeight, *pPipeline, statusConsumer)
+						: LoadBlockchain(observerFactory, m_pluginManager, m_state.ref(), startHeight, statusConsumer);
 
 				// check score for consistency
 				EXPECT_EQ(m_statusScore, score);
@@ -287,6 +301,70 @@ namespace catapult { namespace local {
 		EXPECT_EQ(expectedHeights, context.statusHeights());
 	}
 
+	TEST(TEST_CLASS, LoadBlockchainWithPipelineLoadsZeroBlocksWhenStorageHeightIsOne) {
+		// Arrange:
+		LoadBlockchainTestContext context;
+		auto pPool = test::CreateStartedIoThreadPool(2);
+
+		// Act:
+		auto score = context.load(Height(2), { *pPool, 3, BlockElementVerifier() });
+
+		// Assert:
+		EXPECT_EQ(model::ChainScore(), score);
+		EXPECT_EQ(0u, context.observerBlockHeights().size());
+		EXPECT_EQ(0u, context.factoryHeights().size());
+		EXPECT_EQ(0u, context.statusHeights().size());
+	}
+
+	TEST(TEST_CLASS, LoadBlockchainWithPipelineLoadsMultipleBlocksStartingAtArbitraryHeight) {
+		// Arrange: create a storage with 7 blocks
+		LoadBlockchainTestContext context;
+		context.setStorageChainHeight(Height(7));
+
+		std::vector<Height> verifiedHeights;
+		std::mutex mutex;
+		auto verifier = [&verifiedHeights, &mutex](const auto& blockElement) {
+			std::lock_guard<std::mutex> guard(mutex);
+			verifiedHeights.push_back(blockElement.Block.Height);
+		};
+		auto pPool = test::CreateStartedIoThreadPool(2);
+
+		// Act: load blocks 4-7
+		auto score = context.load(Height(4), { *pPool, 3, verifier });
+
+		// Assert: blocks are executed in order
+		auto expectedHeights = std::vector<Height>{ Height(4), Height(5), Height(6), Height(7) };
+		EXPECT_EQ(model::ChainScore(CalculateExpectedScore(7) - CalculateExpectedScore(3)), score);
+		EXPECT_EQ(4u, context.observerBlockHeights().size());
+		EXPECT_EQ(expectedHeights, context.observerBlockHeights());
+		EXPECT_EQ(expectedHeights, context.factoryHeights());
+		EXPECT_EQ(expectedHeights, context.statusHeights());
+
+		// - all blocks are verified (in any order)
+		std::sort(verifiedHeights.begin(), verifiedHeights.end());
+		EXPECT_EQ(expectedHeights, verifiedHeights);
+	}
+
+	TEST(TEST_CLASS, LoadBlockchainWithPipelineStopsAtFirstBlockFailingVerification) {
+		// Arrange: create a storage with 7 blocks
+		LoadBlockchainTestContext context;
+		context.setStorageChainHeight(Height(7));
+
+		auto verifier = [](const auto& blockElement) {
+			if (Height(5) == blockElement.Block.Height)
+				CATAPULT_THROW_RUNTIME_ERROR("verify failed");
+		};
+		auto pPool = test::CreateStartedIoThreadPool(2);
+
+		// Act:
+		EXPECT_THROW(context.load(Height(2), { *pPool, 3, verifier }), catapult_runtime_error);
+
+		// Assert: only blocks before failing block were executed
+		auto expectedHeights = std::vector<Height>{ Height(2), Height(3), Height(4) };
+		EXPECT_EQ(expectedHeights, context.observerBlockHeights());
+		EXPECT_EQ(expectedHeights, context.statusHeights());
+	}
+
 	// endregion
 
 	// region LoadBlockchain - state enabled
@@ -437,4 +437,57 @@ namespace catapult { namespace model {
 	}
 
 	// endregion
+
+	// region UpdateHashes (transaction elements)
+
+	namespace {
+		void AssertUpdateHashesMatchesSingleElementVariant(size_t numTransactions) {
+			// Arrange:
+			auto pPlugin = mocks::CreateMockTransactionPluginWithCustomBuffers(
+					mocks::OffsetRange{ 6, 10 },
+					std::vector<mocks::OffsetRange>{ { 7, 11 } });
+			auto registry = TransactionRegistry();
+			registry.registerPlugin(std::move(pPlugin));
+
+			auto transactions = test::GenerateRandomTransactions(numTransactions);
+			auto generationHashSeed = test::GenerateRandomByteArray<GenerationHashSeed>();
+
+			std::vector<TransactionElement> expectedTransactionElements;
+			std::vector<TransactionElement> transactionElements;
+			for (const auto& pTransaction : transactions) {
+				expectedTransactionElements.emplace_back(*pTransaction);
+				UpdateHashes(registry, generationHashSeed, expectedTransactionElements.back());
+
+				transactionElements.emplace_back(*pTransaction);
+			}
+
+			std::vector<TransactionElement*> transactionElementPointers;
+			for (auto& transactionElement : transactionElements)
+				transactionElementPointers.push_back(&transactionElement);
+
+			// Act:
+			UpdateHashes(registry, generationHashSeed, transactionElementPointers);
+
+			// Assert:
+			for (auto i = 0u; i < numTransactions; ++i) {
+				EXPECT_EQ(expectedTransactionElements[i].EntityHash, transactionElements[i].EntityHash) << "at index " << i;
+				EXPECT_EQ(expectedTransactionElements[i].MerkleComponentHash, transactionElements[i].MerkleComponentHash)
+						<< "at index " << i;
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, UpdateHashes_CanUpdateZeroTransactionElements) {
+		AssertUpdateHashesMatchesSingleElementVariant(0);
+	}
+
+	TEST(TEST_CLASS, UpdateHashes_CanUpdateSingleTransactionElement) {
+		AssertUpdateHashesMatchesSingleElementVariant(1);
+	}
+
+	TEST(TEST_CLASS, UpdateHashes_CanUpdateMultipleTransactionElements) {
+		AssertUpdateHashesMatchesSingleElementVariant(13);
+	}
+
+	// endregion
 }}
@@ -22,9 +22,14 @@
 #include "catapult/plugins/PluginManager.h"
 #include "sdk/src/extensions/ConversionExtensions.h"
 #include "catapult/cache/CatapultCache.h"
+#include "catapult/cache_db/PatriciaTreeNodeCache.h"
+#include "catapult/cache_db/RocksBackgroundWriter.h"
+#include "catapult/cache_db/RocksDatabase.h"
+#include "catapult/thread/IoThreadPool.h"
 #include "tests/test/cache/SimpleCache.h"
 #include "tests/test/core/mocks/MockNotificationSubscriber.h"
 #include "tests/test/core/mocks/MockTransaction.h"
+#include "tests/test/nodeps/Filesystem.h"
 #include "tests/test/nodeps/NumericTestUtils.h"
 #include "tests/test/plugins/PluginManagerFactory.h"
 #include "tests/test/plugins/ValidatorTestUtils.h"
@@ -44,6 +49,7 @@ namespace catapult { namespace plugins {
 		EXPECT_FALSE(config.PreferCacheDatabase);
 		EXPECT_TRUE(config.CacheDatabaseDirectory.empty());
 		EXPECT_EQ(utils::FileSize::FromKilobytes(0), config.CacheDatabaseConfig.MaxWriteBatchSize);
+		EXPECT_EQ(0u, config.MaxStatePathKeysPerRequest);
 	}
 
 	TEST(TEST_CLASS, CanCreateManager) {
@@ -100,6 +106,244 @@ namespace catapult { namespace plugins {
 		assertCacheConfiguration(manager.cacheConfig("bar"), "abc/bar");
 	}
 
+	namespace {
+		void AssertSharedBlockCache(
+				bool preferCacheDatabase,
+				bool enableSharedBlockCache,
+				uint32_t blockCacheSizeMb,
+				bool expectedShared) {
+			// Arrange:
+			auto storageConfig = StorageConfiguration();
+			storageConfig.PreferCacheDatabase = preferCacheDatabase;
+			storageConfig.CacheDatabaseDirectory = "abc";
+			storageConfig.CacheDatabaseConfig.EnableSharedBlockCache = enableSharedBlockCache;
+			storageConfig.CacheDatabaseConfig.BlockCacheSize = utils::FileSize::FromMegabytes(blockCacheSizeMb);
+
+			// Act:
+			PluginManager manager(
+					model::BlockchainConfiguration::Uninitialized(),
+					storageConfig,
+					config::UserConfiguration::Uninitialized(),
+					config::InflationConfiguration::Uninitialized());
+
+			auto fooCacheConfig = manager.cacheConfig("foo");
+			auto barCacheConfig = manager.cacheConfig("bar");
+
+			// Assert:
+			if (!expectedShared) {
+				EXPECT_FALSE(!!fooCacheConfig.pSharedBlockCache);
+				EXPECT_FALSE(!!barCacheConfig.pSharedBlockCache);
+				return;
+			}
+
+			ASSERT_TRUE(!!fooCacheConfig.pSharedBlockCache);
+			EXPECT_EQ(fooCacheConfig.pSharedBlockCache, barCacheConfig.pSharedBlockCache);
+			EXPECT_EQ(utils::FileSize::FromMegabytes(blockCacheSizeMb), fooCacheConfig.pSharedBlockCache->capacity());
+		}
+	}
+
+	TEST(TEST_CLASS, CacheConfigurationsShareBlockCacheWhenEnabled) {
+		AssertSharedBlockCache(true, true, 12, true);
+	}
+
+	TEST(TEST_CLASS, CacheConfigurationsDoNotShareBlockCacheWhenDisabled) {
+		AssertSharedBlockCache(false, true, 12, false);
+		AssertSharedBlockCache(true, false, 12, false);
+		AssertSharedBlockCache(true, true, 0, false);
+	}
+
+	namespace {
+		void AssertSharedDatabase(bool preferCacheDatabase, bool enableSharedDatabase, bool expectedShared) {
+			// Arrange:
+			test::TempDirectoryGuard dbDirGuard;
+			auto storageConfig = StorageConfiguration();
+			storageConfig.PreferCacheDatabase = preferCacheDatabase;
+			storageConfig.CacheDatabaseDirectory = dbDirGuard.name();
+			storageConfig.CacheDatabaseConfig.EnableSharedDatabase = enableSharedDatabase;
+			storageConfig.CacheDatabaseConfig.BlockCacheSize = utils::FileSize::FromMegabytes(12);
+
+			// Act:
+			PluginManager manager(
+					model::BlockchainConfiguration::Uninitialized(),
+					storageConfig,
+					config::UserConfiguration::Uninitialized(),
+					config::InflationConfiguration::Uninitialized());
+
+			auto fooCacheConfig = manager.cacheConfig("foo");
+			auto barCacheConfig = manager.cacheConfig("bar");
+
+			// Assert:
+			if (!expectedShared) {
+				EXPECT_FALSE(!!fooCacheConfig.pSharedDatabase);
+				EXPECT_FALSE(!!barCacheConfig.pSharedDatabase);
+				return;
+			}
+
+			// - shared database implies shared block cache
+			ASSERT_TRUE(!!fooCacheConfig.pSharedDatabase);
+			EXPECT_EQ(fooCacheConfig.pSharedDatabase, barCacheConfig.pSharedDatabase);
+			EXPECT_EQ(dbDirGuard.name(), fooCacheConfig.pSharedDatabase->databaseDirectory());
+
+			ASSERT_TRUE(!!fooCacheConfig.pSharedBlockCache);
+			EXPECT_EQ(fooCacheConfig.pSharedBlockCache, barCacheConfig.pSharedBlockCache);
+		}
+	}
+
+	TEST(TEST_CLASS, CacheConfigurationsShareDatabaseWhenEnabled) {
+		AssertSharedDatabase(true, true, true);
+	}
+
+	TEST(TEST_CLASS, CacheConfigurationsDoNotShareDatabaseWhenDisabled) {
+		AssertSharedDatabase(false, true, false);
+		AssertSharedDatabase(true, false, false);
+	}
+
+	namespace {
+		void AssertBackgroundWriter(bool preferCacheDatabase, bool enableAsyncCommit, bool expectedWriter) {
+			// Arrange:
+			auto storageConfig = StorageConfiguration();
+			storageConfig.PreferCacheDatabase = preferCacheDatabase;
+			storageConfig.CacheDatabaseConfig.EnableAsyncCommit = enableAsyncCommit;
+			storageConfig.CacheDatabaseConfig.MaxPendingWrites = 17;
+
+			// Act:
+			PluginManager manager(
+					model::BlockchainConfiguration::Uninitialized(),
+					storageConfig,
+					config::UserConfiguration::Uninitialized(),
+					config::InflationConfiguration::Uninitialized());
+
+			auto fooCacheConfig = manager.cacheConfig("foo");
+			auto barCacheConfig = manager.cacheConfig("bar");
+
+			// Assert:
+			if (!expectedWriter) {
+				EXPECT_FALSE(!!fooCacheConfig.pBackgroundWriter);
+				EXPECT_FALSE(!!barCacheConfig.pBackgroundWriter);
+				return;
+			}
+
+			ASSERT_TRUE(!!fooCacheConfig.pBackgroundWriter);
+			EXPECT_EQ(fooCacheConfig.pBackgroundWriter, barCacheConfig.pBackgroundWriter);
+			EXPECT_EQ(17u, fooCacheConfig.pBackgroundWriter->maxPendingOperations());
+		}
+	}
+
+	TEST(TEST_CLASS, CacheConfigurationsShareBackgroundWriterWhenAsyncCommitIsEnabled) {
+		AssertBackgroundWriter(true, true, true);
+	}
+
+	TEST(TEST_CLASS, CacheConfigurationsDoNotHaveBackgroundWriterWhenAsyncCommitIsDisabled) {
+		AssertBackgroundWriter(false, true, false);
+		AssertBackgroundWriter(true, false, false);
+	}
+
+	namespace {
+		void AssertStateHashPool(bool preferCacheDatabase, bool enableVerifiableState, uint32_t numThreads, bool expectedPool) {
+			// Arrange:
+			auto config = model::BlockchainConfiguration::Uninitialized();
+			config.EnableVerifiableState = enableVerifiableState;
+
+			auto storageConfig = StorageConfiguration();
+			storageConfig.PreferCacheDatabase = preferCacheDatabase;
+			storageConfig.CacheDatabaseConfig.StateHashThreadCount = numThreads;
+
+			// Act:
+			PluginManager manager(
+					config,
+					storageConfig,
+					config::UserConfiguration::Uninitialized(),
+					config::InflationConfiguration::Uninitialized());
+
+			auto fooCacheConfig = manager.cacheConfig("foo");
+			auto barCacheConfig = manager.cacheConfig("bar");
+
+			// Assert:
+			if (!expectedPool) {
+				EXPECT_FALSE(!!fooCacheConfig.pStateHashPool);
+				EXPECT_FALSE(!!barCacheConfig.pStateHashPool);
+				return;
+			}
+
+			ASSERT_TRUE(!!fooCacheConfig.pStateHashPool);
+			EXPECT_EQ(fooCacheConfig.pStateHashPool, barCacheConfig.pStateHashPool);
+			EXPECT_EQ(numThreads, fooCacheConfig.pStateHashPool->numWorkerThreads());
+		}
+	}
+
+	TEST(TEST_CLASS, CacheConfigurationsShareStateHashPoolWhenStateHashThreadsAreEnabled) {
+		AssertStateHashPool(true, true, 3, true);
+	}
+
+	TEST(TEST_CLASS, CacheConfigurationsDoNotHaveStateHashPoolWhenStateHashThreadsAreDisabled) {
+		AssertStateHashPool(false, true, 3, false);
+		AssertStateHashPool(true, false, 3, false);
+		AssertStateHashPool(true, true, 0, false);
+	}
+
+	namespace {
+		PluginManager CreatePluginManagerWithTreeNodeCache(bool preferCacheDatabase, bool enableVerifiableState, uint32_t cacheSize) {
+			auto config = model::BlockchainConfiguration::Uninitialized();
+			config.EnableVerifiableState = enableVerifiableState;
+
+			auto storageConfig = StorageConfiguration();
+			storageConfig.PreferCacheDatabase = preferCacheDatabase;
+			storageConfig.CacheDatabaseConfig.TreeNodeCacheSize = cacheSize;
+			storageConfig.CacheDatabaseConfig.TreeNodeCachePinnedLevels = 2;
+
+			return PluginManager(
+					config,
+					storageConfig,
+					config::UserConfiguration::Uninitialized(),
+					config::InflationConfiguration::Uninitialized());
+		}
+
+		void AssertTreeNodeCache(bool preferCacheDatabase, bool enableVerifiableState, uint32_t cacheSize, bool expectedCache) {
+			// Act:
+			auto manager = CreatePluginManagerWithTreeNodeCache(preferCacheDatabase, enableVerifiableState, cacheSize);
+
+			auto fooCacheConfig = manager.cacheConfig("foo");
+			auto barCacheConfig = manager.cacheConfig("bar");
+
+			// Assert:
+			if (!expectedCache) {
+				EXPECT_FALSE(!!fooCacheConfig.pTreeNodeCache);
+				EXPECT_FALSE(!!barCacheConfig.pTreeNodeCache);
+				return;
+			}
+
+			ASSERT_TRUE(!!fooCacheConfig.pTreeNodeCache);
+			EXPECT_EQ(fooCacheConfig.pTreeNodeCache, barCacheConfig.pTreeNodeCache);
+			EXPECT_EQ(cacheSize, fooCacheConfig.pTreeNodeCache->maxSize());
+			EXPECT_EQ(2u, fooCacheConfig.pTreeNodeCache->numPinnedLevels());
+		}
+	}
+
+	TEST(TEST_CLASS, CacheConfigurationsShareTreeNodeCacheWhenTreeNodeCacheIsEnabled) {
+		AssertTreeNodeCache(true, true, 1000, true);
+	}
+
+	TEST(TEST_CLASS, CacheConfigurationsDoNotHaveTreeNodeCacheWhenTreeNodeCacheIsDisabled) {
+		AssertTreeNodeCache(false, true, 1000, false);
+		AssertTreeNodeCache(true, false, 1000, false);
+		AssertTreeNodeCache(true, true, 0, false);
+	}
+
+	TEST(TEST_CLASS, TreeNodeCacheDiagnosticCountersAreAddedWhenTreeNodeCacheIsEnabled) {
+		// Arrange:
+		auto manager = CreatePluginManagerWithTreeNodeCache(true, true, 1000);
+
+		// Act:
+		std::vector<utils::DiagnosticCounter> counters;
+		manager.addDiagnosticCounters(counters, manager.createCache());
+
+		// Assert:
+		ASSERT_EQ(3u, counters.size());
+		EXPECT_EQ("TREE C HIT", counters[0].id().name());
+		EXPECT_EQ("TREE C MISS", counters[1].id().name());
+		EXPECT_EQ("TREE C SIZE", counters[2].id().name());
+	}
+
 	// endregion
 
 	// region tx plugins
@@ -189,6 +189,143 @@ namespace catapult { namespace thread {
 
 	// endregion
 
+	// region CalculateWeightedPartitions
+
+	namespace {
+		void AssertWeightedPartitions(
+				const std::vector<std::pair<size_t, size_t>>& expectedPartitions,
+				const std::vector<detail::WeightedPartition>& partitions) {
+			ASSERT_EQ(expectedPartitions.size(), partitions.size());
+
+			for (auto i = 0u; i < expectedPartitions.size(); ++i) {
+				EXPECT_EQ(expectedPartitions[i].first, partitions[i].StartIndex) << "partition at " << i;
+				EXPECT_EQ(expectedPartitions[i].second, partitions[i].Size) << "partition at " << i;
+			}
+		}
+
+		auto IdentityWeight(ItemType item) {
+			return item;
+		}
+	}
+
+	TEST(TEST_CLASS, CalculateWeightedPartitionsReturnsNoPartitionsWhenThereAreNoItems) {
+		// Act:
+		auto partitions = detail::CalculateWeightedPartitions(std::vector<ItemType>(), 3, 1, IdentityWeight);
+
+		// Assert:
+		EXPECT_TRUE(partitions.empty());
+	}
+
+	TEST(TEST_CLASS, CalculateWeightedPartitionsCreatesEqualSizePartitionsWhenWeightsAreEqual) {
+		// Act:
+		auto partitions = detail::CalculateWeightedPartitions(std::vector<ItemType>(12, 1), 3, 1, IdentityWeight);
+
+		// Assert:
+		AssertWeightedPartitions({ { 0, 4 }, { 4, 4 }, { 8, 4 } }, partitions);
+	}
+
+	TEST(TEST_CLASS, CalculateWeightedPartitionsCreatesSmallerPartitionsForHeavierItems) {
+		// Act:
+		auto partitions = detail::CalculateWeightedPartitions(std::vector<ItemType>{ 9, 1, 1, 1, 1, 1, 1, 1, 1, 1 }, 3, 1, IdentityWeight);
+
+		// Assert:
+		AssertWeightedPartitions({ { 0, 1 }, { 1, 4 }, { 5, 5 } }, partitions);
+	}
+
+	TEST(TEST_CLASS, CalculateWeightedPartitionsRespectsMinPartitionSize) {
+		// Act:
+		auto partitions = detail::CalculateWeightedPartitions(std::vector<ItemType>{ 9, 1, 1, 1, 1, 1, 1, 1, 1, 1 }, 3, 3, IdentityWeight);
+
+		// Assert:
+		AssertWeightedPartitions({ { 0, 3 }, { 3, 3 }, { 6, 4 } }, partitions);
+	}
+
+	TEST(TEST_CLASS, CalculateWeightedPartitionsReducesNumberOfPartitionsWhenMinPartitionSizeCannotBeSatisfied) {
+		// Act:
+		auto partitions = detail::CalculateWeightedPartitions(std::vector<ItemType>(10, 1), 4, 4, IdentityWeight);
+
+		// Assert:
+		AssertWeightedPartitions({ { 0, 5 }, { 5, 5 } }, partitions);
+	}
+
+	TEST(TEST_CLASS, CalculateWeightedPartitionsCreatesSinglePartitionWhenThereAreFewerItemsThanMinPartitionSize) {
+		// Act:
+		auto partitions = detail::CalculateWeightedPartitions(std::vector<ItemType>(3, 1), 4, 8, IdentityWeight);
+
+		// Assert:
+		AssertWeightedPartitions({ { 0, 3 } }, partitions);
+	}
+
+	TEST(TEST_CLASS, CalculateWeightedPartitionsTreatsZeroMinPartitionSizeAsOne) {
+		// Act:
+		auto partitions = detail::CalculateWeightedPartitions(std::vector<ItemType>(3, 1), 4, 0, IdentityWeight);
+
+		// Assert:
+		AssertWeightedPartitions({ { 0, 1 }, { 1, 1 }, { 2, 1 } }, partitions);
+	}
+
+	// endregion
+
+	// region WeightedParallelForPartition
+
+	CONTAINER_TEST(CanProcessWeightedPartitionsConcurrently_ZeroItems) {
+		// Arrange:
+		BasicTestContext<typename TTraits::ContainerType> context;
+		auto items = typename TTraits::ContainerType();
+
+		// Act:
+		std::atomic<size_t> counter(0);
+		WeightedParallelForPartition(context.pPool->ioContext(), items, context.NumThreads, 1, IdentityWeight, [&counter](
+				auto,
+				auto,
+				auto,
+				auto) {
+			++counter;
+		}).get();
+
+		// Assert: the partition callback was not called
+		EXPECT_EQ(0u, counter);
+	}
+
+	CONTAINER_TEST(CanProcessWeightedPartitionsConcurrently) {
+		// Arrange:
+		BasicTestContext<typename TTraits::ContainerType> context;
+		auto& ioContext = context.pPool->ioContext();
+
+		// Act:
+		PartitionAggregateCapture capture(context.Items.size(), context.NumThreads);
+		auto partitionAggregate = CreatePartitionAggregate(capture);
+		WeightedParallelForPartition(ioContext, context.Items, context.NumThreads, 1, IdentityWeight, partitionAggregate).get();
+
+		// Assert: all items were processed exactly once
+		EXPECT_EQ(context.ItemsSum, capture.Sum);
+		EXPECT_EQ(std::vector<uint8_t>(context.Items.size(), 1), capture.IndexFlags);
+		EXPECT_EQ(std::vector<uint8_t>(context.NumThreads, 1), capture.BatchIndexFlags);
+	}
+
+	CONTAINER_TEST(CanProcessWeightedPartitionsConcurrently_MinPartitionSize) {
+		// Arrange: require partitions to be large enough that only two can be created
+		BasicTestContext<typename TTraits::ContainerType> context;
+		auto& ioContext = context.pPool->ioContext();
+		auto minPartitionSize = context.NumItems / 2;
+
+		// Act:
+		PartitionAggregateCapture capture(context.Items.size(), context.NumThreads);
+		auto partitionAggregate = CreatePartitionAggregate(capture);
+		auto numThreads = context.NumThreads;
+		WeightedParallelForPartition(ioContext, context.Items, numThreads, minPartitionSize, IdentityWeight, partitionAggregate).get();
+
+		// Assert: all items were processed exactly once by two partitions
+		auto expectedBatchIndexFlags = std::vector<uint8_t>(context.NumThreads, 0);
+		expectedBatchIndexFlags[0] = expectedBatchIndexFlags[1] = 1;
+
+		EXPECT_EQ(context.ItemsSum, capture.Sum);
+		EXPECT_EQ(std::vector<uint8_t>(context.Items.size(), 1), capture.IndexFlags);
+		EXPECT_EQ(expectedBatchIndexFlags, capture.BatchIndexFlags);
+	}
+
+	// endregion
+
 	// region ParallelFor basic
 
 	CONTAINER_TEST(CanProcessMultipleItemsConcurrently_ZeroItems) {
@@ -0,0 +1,393 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/thread/WorkStealingParallelFor.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
+#include "tests/TestHarness.h"
+#include <numeric>
+
+namespace catapult { namespace thread {
+
+#define TEST_CLASS WorkStealingParallelForTests
+
+	namespace {
+		using ItemType = uint32_t;
+
+		std::vector<ItemType> CreateIncrementingValues(size_t size) {
+			auto items = std::vector<ItemType>(size);
+			std::iota(items.begin(), items.end(), static_cast<ItemType>(1));
+			return items;
+		}
+
+		struct BasicTestContext {
+		public:
+			explicit BasicTestContext(size_t numItemsAdjustment = 0)
+					: pPool(test::CreateStartedIoThreadPool())
+					, NumThreads(pPool->numWorkerThreads())
+					, NumItems(NumThreads * 5 + numItemsAdjustment)
+					, ItemsSum((NumItems * (NumItems + 1)) / 2)
+					, Items(CreateIncrementingValues(NumItems))
+			{}
+
+		public:
+			std::unique_ptr<thread::IoThreadPool> pPool;
+			size_t NumThreads;
+			size_t NumItems;
+			size_t ItemsSum;
+			std::vector<ItemType> Items;
+		};
+
+		struct Chunk {
+			size_t Begin;
+			size_t End;
+		};
+
+		Chunk Next(detail::WorkStealingRanges& ranges, size_t workerId) {
+			Chunk chunk{ 0, 0 };
+			EXPECT_TRUE(ranges.next(workerId, chunk.Begin, chunk.End)) << "worker " << workerId;
+			return chunk;
+		}
+
+		void AssertChunk(size_t expectedBegin, size_t expectedEnd, const Chunk& chunk) {
+			EXPECT_EQ(expectedBegin, chunk.Begin);
+			EXPECT_EQ(expectedEnd, chunk.End);
+		}
+	}
+
+	// region WorkStealingRanges
+
+	TEST(TEST_CLASS, RangesCannotBeCreatedWithTooManyItems) {
+		// Arrange:
+		auto numItems = static_cast<size_t>(std::numeric_limits<uint32_t>::max()) + 1;
+
+		// Act + Assert:
+		EXPECT_THROW(detail::WorkStealingRanges(numItems, 4, 1), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, RangesNextClaimsShrinkingChunksFromOwnRange) {
+		// Arrange: worker 0 owns [0, 50), worker 1 owns [50, 100)
+		detail::WorkStealingRanges ranges(100, 2, 1);
+
+		// Act + Assert: each chunk is a quarter of the remaining owned range
+		AssertChunk(0, 12, Next(ranges, 0));
+		AssertChunk(12, 21, Next(ranges, 0));
+		AssertChunk(50, 62, Next(ranges, 1));
+		AssertChunk(21, 28, Next(ranges, 0));
+	}
+
+	TEST(TEST_CLASS, RangesNextRespectsMinGrainSize) {
+		// Arrange:
+		detail::WorkStealingRanges ranges(100, 2, 20);
+
+		// Act + Assert: chunks are at least min grain size unless fewer items remain
+		AssertChunk(0, 20, Next(ranges, 0));
+		AssertChunk(20, 40, Next(ranges, 0));
+		AssertChunk(40, 50, Next(ranges, 0));
+	}
+
+	TEST(TEST_CLASS, RangesNextStealsBackHalfOfLargestRangeWhenOwnRangeIsEmpty) {
+		// Arrange: worker 0 owns [0, 10), worker 1 owns [10, 20), worker 2 owns [20, 30)
+		detail::WorkStealingRanges ranges(30, 3, 10);
+		AssertChunk(0, 10, Next(ranges, 0));
+		AssertChunk(10, 20, Next(ranges, 1));
+
+		// Act: worker 0 steals from worker 2 (the only worker with a nonempty range)
+		auto chunk = Next(ranges, 0);
+
+		// Assert: the whole range was stolen because splitting it would produce chunks smaller than min grain size
+		AssertChunk(20, 30, chunk);
+
+		size_t begin, end;
+		EXPECT_FALSE(ranges.next(2, begin, end));
+	}
+
+	TEST(TEST_CLASS, RangesNextSplitsLargestRangeWhenStealing) {
+		// Arrange: worker 0 owns [0, 8), worker 1 owns [8, 16), worker 2 owns [16, 24)
+		detail::WorkStealingRanges ranges(24, 3, 4);
+		AssertChunk(16, 20, Next(ranges, 2));
+		AssertChunk(8, 12, Next(ranges, 1));
+		AssertChunk(12, 16, Next(ranges, 1));
+
+		// Act: worker 1 steals from worker 0 (which has the most remaining items)
+		auto chunk = Next(ranges, 1);
+
+		// Assert: back half of worker 0 range was stolen and claimed
+		AssertChunk(4, 8, chunk);
+		AssertChunk(0, 4, Next(ranges, 0));
+		AssertChunk(20, 24, Next(ranges, 2));
+	}
+
+	TEST(TEST_CLASS, RangesNextReturnsFalseWhenAllItemsAreClaimed) {
+		// Arrange:
+		detail::WorkStealingRanges ranges(10, 2, 1);
+
+		// Act: drain all items using a single worker
+		size_t numItems = 0;
+		size_t begin, end;
+		while (ranges.next(1, begin, end))
+			numItems += end - begin;
+
+		// Assert:
+		EXPECT_EQ(10u, numItems);
+		EXPECT_FALSE(ranges.next(0, begin, end));
+		EXPECT_FALSE(ranges.next(1, begin, end));
+	}
+
+	// endregion
+
+	// region WorkStealingParallelForPartition
+
+	TEST(TEST_CLASS, CanProcessMultiplePartitionsConcurrently_ZeroItems) {
+		// Arrange:
+		BasicTestContext context;
+		auto items = std::vector<ItemType>();
+
+		// Act:
+		std::atomic<size_t> counter(0);
+		WorkStealingParallelForPartition(context.pPool->ioContext(), items, context.NumThreads, 1, [&counter](auto, auto, auto, auto) {
+			++counter;
+		}).get();
+
+		// Assert: the partition callback was not called
+		EXPECT_EQ(0u, counter);
+	}
+
+	namespace {
+		struct PartitionAggregateCapture {
+		public:
+			PartitionAggregateCapture(size_t numItems, size_t numWorkers)
+					: Sum(0)
+					, NumWorkers(numWorkers)
+					, IndexFlags(numItems, 0)
+			{}
+
+		public:
+			std::atomic<size_t> Sum;
+			size_t NumWorkers;
+
+			// use vector of uint8_t instead of bool because latter does not guarantee that
+			// different elements in the same container can be modified concurrently by different threads
+			std::vector<uint8_t> IndexFlags;
+		};
+
+		auto CreatePartitionAggregate(PartitionAggregateCapture& capture) {
+			return [&capture](auto itBegin, auto itEnd, auto startIndex, auto workerId) {
+				// Sanity: fail if any index is too large
+				ASSERT_GT(capture.IndexFlags.size(), startIndex) << "unexpected start index " << startIndex;
+				ASSERT_GT(capture.NumWorkers, workerId) << "unexpected worker id " << workerId;
+
+				// Act:
+				for (auto iter = itBegin; itEnd != iter; ++iter) {
+					++capture.IndexFlags[startIndex++]; // use start index to visit all items
+					capture.Sum += *iter;
+				}
+			};
+		}
+
+		void AssertCanProcessMultiplePartitionsConcurrently(int numItemsAdjustment, size_t minGrainSize) {
+			// Arrange:
+			BasicTestContext context(static_cast<size_t>(numItemsAdjustment));
+
+			// Act:
+			PartitionAggregateCapture capture(context.Items.size(), context.NumThreads);
+			WorkStealingParallelForPartition(
+					context.pPool->ioContext(),
+					context.Items,
+					context.NumThreads,
+					minGrainSize,
+					CreatePartitionAggregate(capture)).get();
+
+			// Assert: every item was processed exactly once
+			EXPECT_EQ(context.ItemsSum, capture.Sum);
+			EXPECT_EQ(std::vector<uint8_t>(context.Items.size(), 1), capture.IndexFlags);
+		}
+	}
+
+	TEST(TEST_CLASS, CanProcessMultiplePartitionsConcurrently_OneItem) {
+		// Arrange:
+		BasicTestContext context;
+		auto items = std::vector<ItemType>{ 7 };
+
+		// Act:
+		PartitionAggregateCapture capture(1, 1);
+		auto& ioContext = context.pPool->ioContext();
+		WorkStealingParallelForPartition(ioContext, items, context.NumThreads, 1, CreatePartitionAggregate(capture)).get();
+
+		// Assert: the callback was only called once by the only worker (since there is only one item)
+		EXPECT_EQ(7u, capture.Sum);
+		EXPECT_EQ(std::vector<uint8_t>(1, 1), capture.IndexFlags);
+	}
+
+	TEST(TEST_CLASS, CanProcessMultiplePartitionsConcurrently_MinusOne) {
+		AssertCanProcessMultiplePartitionsConcurrently(-1, 1);
+	}
+
+	TEST(TEST_CLASS, CanProcessMultiplePartitionsConcurrently) {
+		AssertCanProcessMultiplePartitionsConcurrently(0, 1);
+	}
+
+	TEST(TEST_CLASS, CanProcessMultiplePartitionsConcurrently_PlusOne) {
+		AssertCanProcessMultiplePartitionsConcurrently(1, 1);
+	}
+
+	TEST(TEST_CLASS, CanProcessMultiplePartitionsConcurrently_LargeGrain) {
+		AssertCanProcessMultiplePartitionsConcurrently(1, 7);
+	}
+
+	TEST(TEST_CLASS, CanModifyMultiplePartitionsConcurrently) {
+		// Arrange:
+		BasicTestContext context;
+
+		// Act:
+		WorkStealingParallelForPartition(context.pPool->ioContext(), context.Items, context.NumThreads, 1, [](
+				auto itBegin,
+				auto itEnd,
+				auto,
+				auto) {
+			for (auto iter = itBegin; itEnd != iter; ++iter)
+				*iter = *iter * *iter + 1;
+		}).get();
+
+		// Assert: all values should have been modified
+		auto i = 1u;
+		for (auto value : context.Items) {
+			EXPECT_EQ(i * i + 1u, value) << "item at " << i;
+			++i;
+		}
+	}
+
+	TEST(TEST_CLASS, IdleWorkerStealsItemsFromBlockedWorker) {
+		// Arrange: use two workers, each initially owning half of the items
+		constexpr auto Num_Items = 100u;
+		auto pPool = test::CreateStartedIoThreadPool(2);
+		auto items = CreateIncrementingValues(Num_Items);
+
+		// Act: block the worker processing the first item until all items outside of its current chunk are processed
+		std::atomic<size_t> numItemsProcessed(0);
+		std::atomic<size_t> blockedWorkerId(0);
+		std::atomic<size_t> blockedChunkSize(0);
+		std::vector<size_t> workerIds(Num_Items, 0);
+		auto partitionCallback = [&](auto itBegin, auto itEnd, auto startIndex, auto workerId) {
+			if (0 == startIndex) {
+				auto chunkSize = static_cast<size_t>(std::distance(itBegin, itEnd));
+				blockedWorkerId = workerId;
+				blockedChunkSize = chunkSize;
+				WAIT_FOR_VALUE_EXPR(Num_Items - chunkSize, numItemsProcessed.load());
+			}
+
+			for (auto iter = itBegin; itEnd != iter; ++iter) {
+				workerIds[startIndex++] = workerId;
+				++numItemsProcessed;
+			}
+		};
+		WorkStealingParallelForPartition(pPool->ioContext(), items, 2, 1, partitionCallback).get();
+
+		// Assert: all items were processed
+		EXPECT_EQ(Num_Items, numItemsProcessed);
+
+		// - the blocked worker claimed fewer items than its initial half
+		EXPECT_GT(Num_Items / 2, blockedChunkSize.load());
+
+		// - all remaining items were processed by the other worker, including items stolen from the blocked worker
+		for (auto i = blockedChunkSize.load(); i < Num_Items; ++i)
+			EXPECT_NE(blockedWorkerId.load(), workerIds[i]) << "item at " << i;
+	}
+
+	// endregion
+
+	// region WorkStealingParallelFor
+
+	TEST(TEST_CLASS, CanProcessMultipleItemsConcurrently_ZeroItems) {
+		// Arrange:
+		BasicTestContext context;
+		auto items = std::vector<ItemType>();
+
+		// Act:
+		std::atomic<size_t> counter(0);
+		WorkStealingParallelFor(context.pPool->ioContext(), items, context.NumThreads, [&counter](auto, auto) {
+			++counter;
+			return true;
+		}).get();
+
+		// Assert: the item callback was not called
+		EXPECT_EQ(0u, counter);
+	}
+
+	TEST(TEST_CLASS, CanProcessMultipleItemsConcurrently) {
+		// Arrange:
+		BasicTestContext context(1);
+
+		// Act:
+		std::atomic<size_t> sum(0);
+		std::vector<uint8_t> indexFlags(context.NumItems, 0);
+		WorkStealingParallelFor(context.pPool->ioContext(), context.Items, context.NumThreads, [&sum, &indexFlags](
+				auto value,
+				auto index) {
+			sum += value;
+			++indexFlags[index];
+			return true;
+		}).get();
+
+		// Assert:
+		EXPECT_EQ(context.ItemsSum, sum);
+		EXPECT_EQ(std::vector<uint8_t>(context.NumItems, 1), indexFlags);
+	}
+
+	TEST(TEST_CLASS, CanShortCircuitItemProcessing) {
+		// Arrange:
+		BasicTestContext context;
+
+		// Act:
+		std::atomic<size_t> sum(0);
+		WorkStealingParallelFor(context.pPool->ioContext(), context.Items, context.NumThreads, [&sum, itemsSum = context.ItemsSum](
+				auto value,
+				auto) {
+			sum += value;
+			return itemsSum < sum;
+		}).get();
+
+		// Assert: processing stopped before all items were processed
+		EXPECT_GT(context.ItemsSum, sum);
+	}
+
+	TEST(TEST_CLASS, CorrectIndexesAreAssociatedWithItems) {
+		// Arrange:
+		BasicTestContext context;
+
+		// Act: capture all values by their index
+		std::vector<uint32_t> capturedValues(context.NumItems, 0);
+		WorkStealingParallelFor(context.pPool->ioContext(), context.Items, context.NumThreads, [&capturedValues](auto value, auto index) {
+			// Sanity: fail if any index is too large
+			EXPECT_GT(capturedValues.size(), index) << "unexpected index " << index;
+			if (capturedValues.size() <= index)
+				return false;
+
+			capturedValues[index] = value;
+			return true;
+		}).get();
+
+		// Assert: values start at 1
+		for (auto i = 0u; i < capturedValues.size(); ++i)
+			EXPECT_EQ(i + 1, capturedValues[i]) << "i " << i;
+	}
+
+	// endregion
+}}
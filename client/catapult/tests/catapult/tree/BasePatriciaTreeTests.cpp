@@ -161,6 +161,29 @@ namespace catapult { namespace tree {
 		EXPECT_NE(nodePathLeaf.value(), result.first);
 	}
 
+	TEST(TEST_CLASS, BatchLookupForwardsToUnderlyingTree) {
+		// Arrange:
+		MemoryDataSource dataSource;
+		MemoryBasePatriciaTree tree(dataSource);
+		SeedTreeWithFourNodes(tree);
+
+		// Act:
+		PatriciaTreeBatchProof proof;
+		auto results = tree.lookup(std::vector<uint32_t>{ 0x64'6F'67'65, 0x64'6F'67'64 }, proof);
+
+		// Assert:
+		ASSERT_EQ(2u, results.size());
+		EXPECT_TRUE(results[0].second);
+		EXPECT_FALSE(results[1].second);
+
+		// - both keys share all nodes, including leaf `0x64'6F'67'65`
+		EXPECT_EQ(4u, proof.Nodes.size());
+		ASSERT_EQ(2u, proof.NodeIndexPaths.size());
+		EXPECT_EQ(std::vector<uint32_t>({ 0, 1, 2, 3 }), proof.NodeIndexPaths[0]);
+		EXPECT_EQ(std::vector<uint32_t>({ 0, 1, 2, 3 }), proof.NodeIndexPaths[1]);
+		EXPECT_EQ(results[0].first, proof.Nodes[3].asLeafNode().value());
+	}
+
 	// endregion
 
 	// region loading
@@ -623,6 +646,78 @@ namespace catapult { namespace tree {
 
 	// endregion
 
+	// region setBatch
+
+	namespace {
+		template<typename TCreateDelta>
+		void AssertSetBatchUsesTreeNodesHasher(TCreateDelta createDelta) {
+			// Arrange:
+			MemoryDataSource dataSource;
+			size_t numHashedNodes = 0;
+			MemoryBasePatriciaTree tree(dataSource, [&numHashedNodes](auto& nodes) {
+				numHashedNodes += nodes.size();
+			});
+			SeedTreeWithFourNodes(tree);
+
+			// Act:
+			auto pDeltaTree = createDelta(tree);
+			pDeltaTree->setBatch({
+				MemoryBasePatriciaTree::DeltaType::Encode(0x64'6F'00'00, "noun"),
+				MemoryBasePatriciaTree::DeltaType::Encode(0x64'6F'67'00, "kitten"),
+				MemoryBasePatriciaTree::DeltaType::Encode(0x26'54'32'10, "alpha")
+			});
+
+			// Assert: root links 0x2 and 0x6 are changed
+			auto expectedRoot = CalculateRootHash({
+				{ 0x64'6F'00'00, "noun" },
+				{ 0x64'6F'67'00, "kitten" },
+				{ 0x64'6F'67'65, "coin" },
+				{ 0x68'6F'72'73, "stallion" },
+				{ 0x26'54'32'10, "alpha" }
+			});
+
+			EXPECT_EQ(expectedRoot, pDeltaTree->root());
+			EXPECT_EQ(2u, numHashedNodes);
+		}
+	}
+
+	TEST(TEST_CLASS, SetBatchOfRebasedDeltaUsesTreeNodesHasher) {
+		AssertSetBatchUsesTreeNodesHasher([](auto& tree) { return tree.rebase(); });
+	}
+
+	TEST(TEST_CLASS, SetBatchOfDetachedDeltaUsesTreeNodesHasher) {
+		AssertSetBatchUsesTreeNodesHasher([](const auto& tree) { return tree.rebaseDetached(); });
+	}
+
+	TEST(TEST_CLASS, CanCommitChangesSetInBatch) {
+		// Arrange:
+		MemoryDataSource dataSource;
+		MemoryBasePatriciaTree tree(dataSource);
+		SeedTreeWithFourNodes(tree);
+
+		// Act:
+		auto pDeltaTree = tree.rebase();
+		pDeltaTree->setBatch({
+			MemoryBasePatriciaTree::DeltaType::Encode(0x64'6F'67'00, "kitten"),
+			MemoryBasePatriciaTree::DeltaType::Encode(0x26'54'32'10, "alpha")
+		});
+		pDeltaTree->unset(0x64'6F'67'65);
+		tree.commit();
+
+		// Assert:
+		auto expectedRoot = CalculateRootHash({
+			{ 0x64'6F'00'00, "verb" },
+			{ 0x64'6F'67'00, "kitten" },
+			{ 0x68'6F'72'73, "stallion" },
+			{ 0x26'54'32'10, "alpha" }
+		});
+
+		EXPECT_EQ(expectedRoot, tree.root());
+		EXPECT_EQ(expectedRoot, pDeltaTree->root());
+	}
+
+	// endregion
+
 	// region custom hasher
 
 	namespace {
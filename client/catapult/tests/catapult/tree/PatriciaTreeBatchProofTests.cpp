@@ -0,0 +1,149 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/tree/PatriciaTreeBatchProof.h"
+#include "catapult/tree/PatriciaTreeSerializer.h"
+#include "catapult/exceptions.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace tree {
+
+#define TEST_CLASS PatriciaTreeBatchProofTests
+
+	using Serializer = PatriciaTreeBatchProofSerializer;
+
+	namespace {
+		PatriciaTreeBatchProof CreateProof() {
+			auto branchNode = BranchTreeNode(TreeNodePath(0x64'6F));
+			branchNode.setLink(test::GenerateRandomByteArray<Hash256>(), 4);
+			branchNode.setLink(test::GenerateRandomByteArray<Hash256>(), 9);
+
+			PatriciaTreeBatchProof proof;
+			proof.Nodes.push_back(TreeNode(branchNode));
+			proof.Nodes.push_back(TreeNode(LeafTreeNode(TreeNodePath(0x67'65).subpath(1), test::GenerateRandomByteArray<Hash256>())));
+			proof.Nodes.push_back(TreeNode(LeafTreeNode(TreeNodePath(0x72'73), test::GenerateRandomByteArray<Hash256>())));
+			proof.NodeIndexPaths = { { 0, 1 }, {}, { 0, 2 }, { 0, 1 } };
+			return proof;
+		}
+
+		size_t CalculateExpectedSize(const PatriciaTreeBatchProof& proof) {
+			auto size = 2 * sizeof(uint32_t);
+			for (const auto& node : proof.Nodes)
+				size += sizeof(uint16_t) + PatriciaTreeSerializer::SerializeValue(node).size();
+
+			for (const auto& nodeIndexPath : proof.NodeIndexPaths)
+				size += sizeof(uint8_t) + nodeIndexPath.size() * sizeof(uint32_t);
+
+			return size;
+		}
+
+		void AssertEqual(const PatriciaTreeBatchProof& expected, const PatriciaTreeBatchProof& actual) {
+			ASSERT_EQ(expected.Nodes.size(), actual.Nodes.size());
+			for (auto i = 0u; i < expected.Nodes.size(); ++i) {
+				EXPECT_EQ(expected.Nodes[i].isLeaf(), actual.Nodes[i].isLeaf()) << "node at " << i;
+				EXPECT_EQ(expected.Nodes[i].path(), actual.Nodes[i].path()) << "node at " << i;
+				EXPECT_EQ(expected.Nodes[i].hash(), actual.Nodes[i].hash()) << "node at " << i;
+			}
+
+			EXPECT_EQ(expected.NodeIndexPaths, actual.NodeIndexPaths);
+		}
+
+		std::vector<uint8_t> ToBytes(const std::string& str) {
+			return std::vector<uint8_t>(str.cbegin(), str.cend());
+		}
+	}
+
+	TEST(TEST_CLASS, CanSerializeEmptyProof) {
+		// Act:
+		auto result = Serializer::Serialize(PatriciaTreeBatchProof());
+
+		// Assert:
+		ASSERT_EQ(2 * sizeof(uint32_t), result.size());
+		EXPECT_EQ(std::string(2 * sizeof(uint32_t), '\0'), result);
+	}
+
+	TEST(TEST_CLASS, CanSerializeProof) {
+		// Arrange:
+		auto proof = CreateProof();
+
+		// Act:
+		auto result = Serializer::Serialize(proof);
+
+		// Assert:
+		ASSERT_EQ(CalculateExpectedSize(proof), result.size());
+
+		const auto* pData = reinterpret_cast<const uint8_t*>(result.data());
+		EXPECT_EQ(3u, reinterpret_cast<const uint32_t&>(*pData));
+		EXPECT_EQ(4u, reinterpret_cast<const uint32_t&>(*(pData + sizeof(uint32_t))));
+		pData += 2 * sizeof(uint32_t);
+
+		for (const auto& node : proof.Nodes) {
+			auto expectedSerializedNode = PatriciaTreeSerializer::SerializeValue(node);
+			ASSERT_EQ(expectedSerializedNode.size(), reinterpret_cast<const uint16_t&>(*pData));
+			EXPECT_EQ_MEMORY(expectedSerializedNode.data(), pData + sizeof(uint16_t), expectedSerializedNode.size());
+			pData += sizeof(uint16_t) + expectedSerializedNode.size();
+		}
+
+		for (const auto& nodeIndexPath : proof.NodeIndexPaths) {
+			ASSERT_EQ(nodeIndexPath.size(), *pData);
+			EXPECT_EQ_MEMORY(nodeIndexPath.data(), pData + sizeof(uint8_t), nodeIndexPath.size() * sizeof(uint32_t));
+			pData += sizeof(uint8_t) + nodeIndexPath.size() * sizeof(uint32_t);
+		}
+	}
+
+	TEST(TEST_CLASS, CanRoundtripProof) {
+		// Arrange:
+		auto proof = CreateProof();
+
+		// Act:
+		auto result = Serializer::Deserialize(ToBytes(Serializer::Serialize(proof)));
+
+		// Assert:
+		AssertEqual(proof, result);
+	}
+
+	TEST(TEST_CLASS, CannotDeserializeTruncatedProof) {
+		// Arrange:
+		auto buffer = ToBytes(Serializer::Serialize(CreateProof()));
+		buffer.pop_back();
+
+		// Act + Assert:
+		EXPECT_THROW(Serializer::Deserialize(buffer), catapult_file_io_error);
+	}
+
+	TEST(TEST_CLASS, CannotDeserializeProofWithTrailingData) {
+		// Arrange:
+		auto buffer = ToBytes(Serializer::Serialize(CreateProof()));
+		buffer.push_back(0);
+
+		// Act + Assert:
+		EXPECT_THROW(Serializer::Deserialize(buffer), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, CannotDeserializeProofWithOutOfRangeNodeIndex) {
+		// Arrange: point last index of last path to nonexistent node
+		auto buffer = ToBytes(Serializer::Serialize(CreateProof()));
+		reinterpret_cast<uint32_t&>(buffer[buffer.size() - sizeof(uint32_t)]) = 3;
+
+		// Act + Assert:
+		EXPECT_THROW(Serializer::Deserialize(buffer), catapult_invalid_argument);
+	}
+}}
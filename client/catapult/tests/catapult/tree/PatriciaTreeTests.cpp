@@ -22,6 +22,7 @@
 #include "catapult/tree/PatriciaTree.h"
 #include "catapult/tree/MemoryDataSource.h"
 #include "tests/test/tree/PatriciaTreeTests.h"
+#include <set>
 
 namespace catapult { namespace tree {
 
@@ -51,4 +52,203 @@ namespace catapult { namespace tree {
 	}
 
 	DEFINE_PATRICIA_TREE_TESTS(MemoryTraits)
+
+	// region setBatch - hasher
+
+	namespace {
+		using MemoryPatriciaTree = PatriciaTree<test::PassThroughEncoder, MemoryDataSource>;
+
+		std::vector<MemoryPatriciaTree::EncodedPair> EncodePairs(const std::vector<std::pair<uint32_t, std::string>>& pairs) {
+			std::vector<MemoryPatriciaTree::EncodedPair> encodedPairs;
+			for (const auto& pair : pairs)
+				encodedPairs.push_back(MemoryPatriciaTree::Encode(pair.first, pair.second));
+
+			return encodedPairs;
+		}
+
+		std::vector<std::vector<Hash256>> SetBatchWithHasher(const std::vector<std::pair<uint32_t, std::string>>& pairs, Hash256& root) {
+			// Arrange:
+			MemoryDataSource dataSource;
+			MemoryPatriciaTree tree(dataSource);
+
+			std::vector<std::vector<Hash256>> hasherCalls;
+			auto hasher = [&hasherCalls](auto& nodes) {
+				std::vector<Hash256> hashes;
+				for (const auto& node : nodes)
+					hashes.push_back(node.hash());
+
+				hasherCalls.push_back(hashes);
+			};
+
+			// Act:
+			tree.setBatch(EncodePairs(pairs), hasher);
+			root = tree.root();
+			return hasherCalls;
+		}
+
+		Hash256 CalculateExpectedRoot(const std::vector<std::pair<uint32_t, std::string>>& pairs) {
+			MemoryDataSource dataSource;
+			MemoryPatriciaTree tree(dataSource);
+			for (const auto& pair : pairs)
+				tree.set(pair.first, pair.second);
+
+			return tree.root();
+		}
+	}
+
+	TEST(TEST_CLASS, SetBatchPassesIndependentChangedSubtreesToHasher) {
+		// Arrange:
+		std::vector<std::pair<uint32_t, std::string>> pairs{
+			{ 0x10'00'00'00, "alpha" },
+			{ 0x20'00'00'00, "beta" },
+			{ 0x20'00'00'01, "gamma" },
+			{ 0x30'00'00'00, "delta" }
+		};
+
+		// Act:
+		Hash256 root;
+		auto hasherCalls = SetBatchWithHasher(pairs, root);
+
+		// Assert: subtrees linked to the root branch node are hashed together
+		EXPECT_EQ(CalculateExpectedRoot(pairs), root);
+		ASSERT_EQ(1u, hasherCalls.size());
+		EXPECT_EQ(3u, hasherCalls[0].size());
+	}
+
+	TEST(TEST_CLASS, SetBatchDefersHashingToFirstBranchNodeWithMultipleChangedSubtrees) {
+		// Arrange: all pairs are in the same subtree of the root branch node
+		std::vector<std::pair<uint32_t, std::string>> pairs{
+			{ 0x10'00'00'00, "alpha" },
+			{ 0x20'00'00'00, "beta" },
+			{ 0x20'10'00'00, "gamma" },
+			{ 0x20'20'00'01, "delta" },
+			{ 0x20'30'00'00, "epsilon" }
+		};
+
+		MemoryDataSource dataSource;
+		MemoryPatriciaTree tree(dataSource);
+		tree.set(pairs[0].first, pairs[0].second);
+		tree.set(pairs[1].first, pairs[1].second);
+
+		std::vector<size_t> hasherCallSizes;
+		auto hasher = [&hasherCallSizes](auto& nodes) {
+			hasherCallSizes.push_back(nodes.size());
+		};
+
+		// Act:
+		tree.setBatch(EncodePairs({ pairs[2], pairs[3], pairs[4] }), hasher);
+
+		// Assert: the subtrees below 0x2 are hashed together
+		EXPECT_EQ(CalculateExpectedRoot(pairs), tree.root());
+		EXPECT_EQ(std::vector<size_t>({ 4 }), hasherCallSizes);
+	}
+
+	TEST(TEST_CLASS, SetBatchDoesNotCallHasherWhenSingleValueIsChanged) {
+		// Act:
+		Hash256 root;
+		auto hasherCalls = SetBatchWithHasher({ { 0x10'00'00'00, "alpha" } }, root);
+
+		// Assert:
+		EXPECT_EQ(CalculateExpectedRoot({ { 0x10'00'00'00, "alpha" } }), root);
+		EXPECT_TRUE(hasherCalls.empty());
+	}
+
+	// endregion
+
+	// region lookup - batch
+
+	namespace {
+		void SeedTreeForBatchLookup(MemoryPatriciaTree& tree) {
+			tree.set(0x64'6F'00'00, "verb");
+			tree.set(0x64'6F'67'00, "puppy");
+			tree.set(0x64'6F'67'65, "coin");
+			tree.set(0x68'6F'72'73, "stallion");
+		}
+
+		void AssertBatchLookupMatchesSingleLookups(const std::vector<uint32_t>& keys) {
+			// Arrange:
+			MemoryDataSource dataSource;
+			MemoryPatriciaTree tree(dataSource);
+			SeedTreeForBatchLookup(tree);
+
+			// Act:
+			PatriciaTreeBatchProof proof;
+			auto results = tree.lookup(keys, proof);
+
+			// Assert:
+			ASSERT_EQ(keys.size(), results.size());
+			ASSERT_EQ(keys.size(), proof.NodeIndexPaths.size());
+			for (auto i = 0u; i < keys.size(); ++i) {
+				std::vector<TreeNode> expectedNodePath;
+				auto expectedResult = tree.lookup(keys[i], expectedNodePath);
+
+				auto message = "key " + std::to_string(keys[i]);
+				EXPECT_EQ(expectedResult, results[i]) << message;
+				ASSERT_EQ(expectedNodePath.size(), proof.NodeIndexPaths[i].size()) << message;
+				for (auto j = 0u; j < expectedNodePath.size(); ++j)
+					EXPECT_EQ(expectedNodePath[j].hash(), proof.Nodes[proof.NodeIndexPaths[i][j]].hash()) << message << " at " << j;
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, BatchLookupReturnsEmptyPathsWhenTreeIsEmpty) {
+		// Arrange:
+		MemoryDataSource dataSource;
+		MemoryPatriciaTree tree(dataSource);
+
+		// Act:
+		PatriciaTreeBatchProof proof;
+		auto results = tree.lookup(std::vector<uint32_t>{ 0x64'6F'67'00, 0x64'6F'67'65 }, proof);
+
+		// Assert:
+		ASSERT_EQ(2u, results.size());
+		EXPECT_FALSE(results[0].second);
+		EXPECT_FALSE(results[1].second);
+
+		EXPECT_TRUE(proof.Nodes.empty());
+		ASSERT_EQ(2u, proof.NodeIndexPaths.size());
+		EXPECT_TRUE(proof.NodeIndexPaths[0].empty());
+		EXPECT_TRUE(proof.NodeIndexPaths[1].empty());
+	}
+
+	TEST(TEST_CLASS, BatchLookupMatchesSingleLookupsWhenAllKeysAreInTree) {
+		AssertBatchLookupMatchesSingleLookups({ 0x64'6F'00'00, 0x64'6F'67'00, 0x64'6F'67'65, 0x68'6F'72'73 });
+	}
+
+	TEST(TEST_CLASS, BatchLookupMatchesSingleLookupsWhenNoKeysAreInTree) {
+		AssertBatchLookupMatchesSingleLookups({ 0x54'6F'67'00, 0x65'6F'67'00, 0x64'6F'77'65, 0x64'6F'67'44 });
+	}
+
+	TEST(TEST_CLASS, BatchLookupMatchesSingleLookupsWhenSomeKeysAreInTree) {
+		AssertBatchLookupMatchesSingleLookups({ 0x64'6F'67'65, 0x54'6F'67'00, 0x64'6F'00'00, 0x64'6F'67'44, 0x64'6F'67'65 });
+	}
+
+	TEST(TEST_CLASS, BatchLookupDeduplicatesSharedNodes) {
+		// Arrange:
+		MemoryDataSource dataSource;
+		MemoryPatriciaTree tree(dataSource);
+		SeedTreeForBatchLookup(tree);
+
+		// Act:
+		PatriciaTreeBatchProof proof;
+		tree.lookup(std::vector<uint32_t>{ 0x64'6F'00'00, 0x64'6F'67'00, 0x64'6F'67'65, 0x68'6F'72'73 }, proof);
+
+		// Assert: root branch, 0x64'6F branch, 0x64'6F'67 branch and four leaves
+		ASSERT_EQ(7u, proof.Nodes.size());
+		EXPECT_EQ(tree.root(), proof.Nodes[0].hash());
+
+		std::set<Hash256> uniqueHashes;
+		for (const auto& node : proof.Nodes)
+			uniqueHashes.insert(node.hash());
+
+		EXPECT_EQ(7u, uniqueHashes.size());
+
+		// - all paths start at the (shared) root
+		for (const auto& nodeIndexPath : proof.NodeIndexPaths) {
+			ASSERT_FALSE(nodeIndexPath.empty());
+			EXPECT_EQ(0u, nodeIndexPath[0]);
+		}
+	}
+
+	// endregion
 }}
@@ -0,0 +1,180 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/tree/TreeNodeArena.h"
+#include "tests/TestHarness.h"
+#include <set>
+
+namespace catapult { namespace tree {
+
+#define TEST_CLASS TreeNodeArenaTests
+
+	namespace {
+		struct Node {
+			uint64_t Value;
+			std::array<uint8_t, 100> Data;
+		};
+	}
+
+	// region TreeNodeArena
+
+	TEST(TEST_CLASS, CanCreateEmptyArena) {
+		// Act:
+		TreeNodeArena arena;
+
+		// Assert:
+		EXPECT_EQ(0u, arena.slotSize());
+		EXPECT_EQ(0u, arena.numBlocks());
+		EXPECT_EQ(0u, arena.numActiveSlots());
+		EXPECT_EQ(0u, arena.numFreeSlots());
+	}
+
+	TEST(TEST_CLASS, FirstAllocationDeterminesSlotSize) {
+		// Arrange:
+		TreeNodeArena arena;
+
+		// Act:
+		auto* pData = arena.allocate(sizeof(Node), alignof(Node));
+
+		// Assert:
+		EXPECT_EQ(sizeof(Node), arena.slotSize());
+		EXPECT_EQ(1u, arena.numBlocks());
+		EXPECT_EQ(1u, arena.numActiveSlots());
+		EXPECT_EQ(0u, arena.numFreeSlots());
+		EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(pData) % alignof(Node));
+	}
+
+	TEST(TEST_CLASS, CanAllocateManySlotsFromSameBlock) {
+		// Arrange:
+		TreeNodeArena arena(10 * sizeof(Node));
+
+		// Act:
+		std::set<void*> allocations;
+		for (auto i = 0u; i < 5; ++i)
+			allocations.insert(arena.allocate(sizeof(Node), alignof(Node)));
+
+		// Assert:
+		EXPECT_EQ(5u, allocations.size());
+		EXPECT_EQ(1u, arena.numBlocks());
+		EXPECT_EQ(5u, arena.numActiveSlots());
+	}
+
+	TEST(TEST_CLASS, DeallocatedSlotsAreReused) {
+		// Arrange:
+		TreeNodeArena arena;
+		auto* pData1 = arena.allocate(sizeof(Node), alignof(Node));
+		auto* pData2 = arena.allocate(sizeof(Node), alignof(Node));
+
+		// Act:
+		arena.deallocate(pData1, sizeof(Node), alignof(Node));
+		arena.deallocate(pData2, sizeof(Node), alignof(Node));
+
+		// Assert:
+		EXPECT_EQ(0u, arena.numActiveSlots());
+		EXPECT_EQ(2u, arena.numFreeSlots());
+
+		// Act: most recently released slots are reused first
+		auto* pData3 = arena.allocate(sizeof(Node), alignof(Node));
+		auto* pData4 = arena.allocate(sizeof(Node), alignof(Node));
+
+		// Assert:
+		EXPECT_EQ(pData2, pData3);
+		EXPECT_EQ(pData1, pData4);
+		EXPECT_EQ(1u, arena.numBlocks());
+		EXPECT_EQ(2u, arena.numActiveSlots());
+		EXPECT_EQ(0u, arena.numFreeSlots());
+	}
+
+	TEST(TEST_CLASS, AllocationsWithOtherSizesBypassArena) {
+		// Arrange:
+		TreeNodeArena arena;
+		auto* pData1 = arena.allocate(sizeof(Node), alignof(Node));
+
+		// Act:
+		auto* pData2 = arena.allocate(2 * sizeof(Node), alignof(Node));
+		arena.deallocate(pData2, 2 * sizeof(Node), alignof(Node));
+
+		// Assert:
+		EXPECT_EQ(1u, arena.numBlocks());
+		EXPECT_EQ(1u, arena.numActiveSlots());
+		EXPECT_EQ(0u, arena.numFreeSlots());
+
+		arena.deallocate(pData1, sizeof(Node), alignof(Node));
+	}
+
+	// endregion
+
+	// region TreeNodeArenaAllocator
+
+	TEST(TEST_CLASS, AllocatorsAroundSameArenaAreEqual) {
+		// Arrange:
+		auto pArena1 = std::make_shared<TreeNodeArena>();
+		auto pArena2 = std::make_shared<TreeNodeArena>();
+
+		// Act + Assert:
+		EXPECT_EQ(TreeNodeArenaAllocator<Node>(pArena1), TreeNodeArenaAllocator<uint64_t>(pArena1));
+		EXPECT_NE(TreeNodeArenaAllocator<Node>(pArena1), TreeNodeArenaAllocator<uint64_t>(pArena2));
+	}
+
+	TEST(TEST_CLASS, CanAllocateSharedObjectsFromArena) {
+		// Arrange:
+		auto pArena = std::make_shared<TreeNodeArena>();
+		TreeNodeArenaAllocator<Node> allocator(pArena);
+
+		// Act:
+		auto pNode1 = std::allocate_shared<Node>(allocator, Node{ 123, {} });
+		auto pNode2 = std::allocate_shared<Node>(allocator, Node{ 234, {} });
+
+		// Assert:
+		EXPECT_EQ(123u, pNode1->Value);
+		EXPECT_EQ(234u, pNode2->Value);
+		EXPECT_EQ(2u, pArena->numActiveSlots());
+
+		// Act:
+		pNode1.reset();
+
+		// Assert:
+		EXPECT_EQ(1u, pArena->numActiveSlots());
+		EXPECT_EQ(1u, pArena->numFreeSlots());
+	}
+
+	TEST(TEST_CLASS, SharedObjectsKeepArenaAlive) {
+		// Arrange:
+		auto pArena = std::make_shared<TreeNodeArena>();
+		auto pNode = std::allocate_shared<Node>(TreeNodeArenaAllocator<Node>(pArena), Node{ 123, {} });
+		std::weak_ptr<TreeNodeArena> pWeakArena = pArena;
+
+		// Act:
+		pArena.reset();
+
+		// Assert:
+		EXPECT_FALSE(pWeakArena.expired());
+		EXPECT_EQ(123u, pNode->Value);
+
+		// Act:
+		pNode.reset();
+
+		// Assert:
+		EXPECT_TRUE(pWeakArena.expired());
+	}
+
+	// endregion
+}}
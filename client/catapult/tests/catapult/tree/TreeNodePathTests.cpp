@@ -83,6 +83,28 @@ namespace catapult { namespace tree {
 		AssertPath(path, 0, {});
 	}
 
+	TEST(TEST_CLASS, CanCreatePathAroundMaxSizeKey) {
+		// Arrange:
+		std::vector<uint8_t> key(TreeNodePath::Max_Key_Size, 0xA5);
+		key.back() = 0x37;
+
+		// Act:
+		TreeNodePath path(key);
+
+		// Assert:
+		AssertPath(path, 2 * TreeNodePath::Max_Key_Size, { 0xA, 5, 0xA, 5 });
+		EXPECT_EQ(3u, path.nibbleAt(path.size() - 2));
+		EXPECT_EQ(7u, path.nibbleAt(path.size() - 1));
+	}
+
+	TEST(TEST_CLASS, CannotCreatePathAroundKeyLargerThanMaxSize) {
+		// Arrange:
+		std::vector<uint8_t> key(TreeNodePath::Max_Key_Size + 1);
+
+		// Act + Assert:
+		EXPECT_THROW(TreeNodePath path(key), catapult_invalid_argument);
+	}
+
 	// endregion
 
 	// region equality
@@ -291,6 +313,30 @@ namespace catapult { namespace tree {
 		AssertPath(joinedPath2, 12, { 4, 3, 7, 0xE, 0, 1, 2, 3, 4, 5, 9, 6 });
 	}
 
+	TEST(TEST_CLASS, CanJoinPathsWithMaxSize) {
+		// Arrange:
+		TreeNodePath path1(std::vector<uint8_t>(TreeNodePath::Max_Key_Size / 2, 0x11));
+		TreeNodePath path2(std::vector<uint8_t>(TreeNodePath::Max_Key_Size / 2, 0x22));
+
+		// Act:
+		auto joinedPath = TreeNodePath::Join(path1.subpath(1), 0xDE, path2);
+
+		// Assert:
+		ASSERT_EQ(2 * TreeNodePath::Max_Key_Size, joinedPath.size());
+		EXPECT_EQ(path1.subpath(1), joinedPath.subpath(0, path1.size() - 1));
+		EXPECT_EQ(0xEu, joinedPath.nibbleAt(path1.size() - 1));
+		EXPECT_EQ(path2, joinedPath.subpath(path1.size()));
+	}
+
+	TEST(TEST_CLASS, CannotJoinPathsLargerThanMaxSize) {
+		// Arrange:
+		TreeNodePath path1(std::vector<uint8_t>(TreeNodePath::Max_Key_Size / 2, 0x11));
+		TreeNodePath path2(std::vector<uint8_t>(TreeNodePath::Max_Key_Size / 2, 0x22));
+
+		// Act + Assert:
+		EXPECT_THROW(TreeNodePath::Join(path1, 0xDE, path2), catapult_invalid_argument);
+	}
+
 	// endregion
 
 	// region insertion operator
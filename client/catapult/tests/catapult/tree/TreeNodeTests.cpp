@@ -21,6 +21,7 @@
 
 #include "catapult/tree/TreeNode.h"
 #include "catapult/crypto/Hashes.h"
+#include "catapult/tree/TreeNodeArena.h"
 #include "tests/TestHarness.h"
 
 namespace catapult { namespace tree {
@@ -483,6 +484,67 @@ namespace catapult { namespace tree {
 		EXPECT_EQ(expectedHash, node.hash());
 	}
 
+	TEST(TEST_CLASS, BranchTreeNodeCanSetNodeLinksAllocatedFromArena) {
+		// Arrange:
+		auto pArena = std::make_shared<TreeNodeArena>();
+		auto path = TreeNodePath(0x64'6F'67'00);
+		auto links = NodeLinkTraits::GenerateLinks(2);
+		auto node = BranchTreeNode(path);
+
+		// Act:
+		node.setLink(links[0], 6, pArena);
+		node.setLink(links[1], 11, pArena);
+
+		// Assert: linked nodes were allocated from arena
+		EXPECT_EQ(2u, pArena->numActiveSlots());
+
+		EXPECT_EQ(path, node.path());
+		AssertTwoLinks<NodeLinkTraits>(node, links[0].hash(), links[1].hash());
+
+		auto expectedHash = CalculateTwoLinkHash({ 0x00, 0x64, 0x6F, 0x67, 0x00 }, links[0].hash(), links[1].hash());
+		EXPECT_EQ(expectedHash, node.hash());
+	}
+
+	TEST(TEST_CLASS, BranchTreeNodeReleasesNodeLinksAllocatedFromArena) {
+		// Arrange:
+		auto pArena = std::make_shared<TreeNodeArena>();
+		auto links = NodeLinkTraits::GenerateLinks(2);
+		auto node = BranchTreeNode(TreeNodePath(0x64'6F'67'00));
+		node.setLink(links[0], 6, pArena);
+		node.setLink(links[1], 11, pArena);
+
+		// Act:
+		node.clearLink(6);
+		node.compactLinks();
+
+		// Assert: linked node slots were returned to arena
+		EXPECT_EQ(0u, pArena->numActiveSlots());
+		EXPECT_EQ(2u, pArena->numFreeSlots());
+		AssertHashLink(node, 11, links[1].hash());
+	}
+
+	TEST(TEST_CLASS, BranchTreeNodeLinksAllocatedFromArenaKeepArenaAlive) {
+		// Arrange:
+		auto pArena = std::make_shared<TreeNodeArena>();
+		auto node = BranchTreeNode(TreeNodePath(0x64'6F'67'00));
+		auto link = LeafTreeNode(TreeNodePath(0x12'34), test::GenerateRandomByteArray<Hash256>());
+		node.setLink(TreeNode(link), 6, pArena);
+
+		// Act:
+		std::weak_ptr<TreeNodeArena> pWeakArena = pArena;
+		pArena.reset();
+
+		// Assert:
+		EXPECT_FALSE(pWeakArena.expired());
+		EXPECT_EQ(link.hash(), node.linkedNode(6).hash());
+
+		// Act: release linked node
+		node.clearLink(6);
+
+		// Assert:
+		EXPECT_TRUE(pWeakArena.expired());
+	}
+
 	// endregion
 
 	// region BranchTreeNode - highestLinkIndex
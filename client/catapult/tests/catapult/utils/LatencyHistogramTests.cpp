@@ -0,0 +1,185 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/utils/LatencyHistogram.h"
+#include "tests/TestHarness.h"
+#include <thread>
+
+namespace catapult { namespace utils {
+
+#define TEST_CLASS LatencyHistogramTests
+
+	namespace {
+		void AssertPercentiles(const LatencyHistogram& histogram, const std::vector<std::pair<uint32_t, uint64_t>>& expectedPairs) {
+			for (const auto& pair : expectedPairs)
+				EXPECT_EQ(pair.second, histogram.percentile(pair.first)) << "percentile " << pair.first;
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreateEmptyHistogram) {
+		// Act:
+		LatencyHistogram histogram;
+
+		// Assert:
+		EXPECT_EQ(0u, histogram.count());
+		EXPECT_EQ(0u, histogram.sum());
+		EXPECT_EQ(0u, histogram.max());
+		AssertPercentiles(histogram, { { 0, 0 }, { 50, 0 }, { 100, 0 } });
+	}
+
+	// endregion
+
+	// region record
+
+	TEST(TEST_CLASS, CanRecordSingleValue) {
+		// Arrange:
+		LatencyHistogram histogram;
+
+		// Act:
+		histogram.record(7);
+
+		// Assert:
+		EXPECT_EQ(1u, histogram.count());
+		EXPECT_EQ(7u, histogram.sum());
+		EXPECT_EQ(7u, histogram.max());
+		AssertPercentiles(histogram, { { 0, 7 }, { 50, 7 }, { 100, 7 } });
+	}
+
+	TEST(TEST_CLASS, CanRecordMultipleValues) {
+		// Arrange:
+		LatencyHistogram histogram;
+
+		// Act:
+		for (auto value : { 3u, 9u, 1u, 12u })
+			histogram.record(value);
+
+		// Assert:
+		EXPECT_EQ(4u, histogram.count());
+		EXPECT_EQ(25u, histogram.sum());
+		EXPECT_EQ(12u, histogram.max());
+	}
+
+	TEST(TEST_CLASS, CanRecordZero) {
+		// Arrange:
+		LatencyHistogram histogram;
+
+		// Act:
+		histogram.record(0);
+		histogram.record(0);
+
+		// Assert:
+		EXPECT_EQ(2u, histogram.count());
+		EXPECT_EQ(0u, histogram.sum());
+		EXPECT_EQ(0u, histogram.max());
+		AssertPercentiles(histogram, { { 50, 0 }, { 100, 0 } });
+	}
+
+	TEST(TEST_CLASS, CanRecordMaxValue) {
+		// Arrange:
+		LatencyHistogram histogram;
+
+		// Act:
+		histogram.record(std::numeric_limits<uint64_t>::max());
+
+		// Assert:
+		EXPECT_EQ(1u, histogram.count());
+		EXPECT_EQ(std::numeric_limits<uint64_t>::max(), histogram.max());
+		AssertPercentiles(histogram, { { 50, std::numeric_limits<uint64_t>::max() } });
+	}
+
+	TEST(TEST_CLASS, CanRecordValuesConcurrently) {
+		// Arrange:
+		constexpr auto Num_Threads = 4u;
+		constexpr auto Num_Values_Per_Thread = 10'000u;
+		LatencyHistogram histogram;
+
+		// Act:
+		std::vector<std::thread> threads;
+		for (auto i = 0u; i < Num_Threads; ++i) {
+			threads.emplace_back([&histogram, i]() {
+				for (auto j = 0u; j < Num_Values_Per_Thread; ++j)
+					histogram.record(i * Num_Values_Per_Thread + j);
+			});
+		}
+
+		for (auto& thread : threads)
+			thread.join();
+
+		// Assert:
+		constexpr uint64_t Num_Values = Num_Threads * Num_Values_Per_Thread;
+		EXPECT_EQ(Num_Values, histogram.count());
+		EXPECT_EQ(Num_Values * (Num_Values - 1) / 2, histogram.sum());
+		EXPECT_EQ(Num_Values - 1, histogram.max());
+	}
+
+	// endregion
+
+	// region percentile
+
+	TEST(TEST_CLASS, PercentileIsExactForSmallValues) {
+		// Arrange: record values 1..10
+		LatencyHistogram histogram;
+		for (auto i = 1u; i <= 10; ++i)
+			histogram.record(i);
+
+		// Act + Assert:
+		AssertPercentiles(histogram, { { 0, 1 }, { 10, 1 }, { 11, 2 }, { 50, 5 }, { 51, 6 }, { 90, 9 }, { 99, 10 }, { 100, 10 } });
+	}
+
+	TEST(TEST_CLASS, PercentileReturnsBucketUpperBoundForLargeValues) {
+		// Arrange: 1000 is in bucket [992, 1023] and 5000 is in bucket [4864, 5119]
+		LatencyHistogram histogram;
+		histogram.record(1000);
+		histogram.record(5000);
+		histogram.record(10000);
+
+		// Act + Assert: last percentile is capped by max
+		AssertPercentiles(histogram, { { 33, 1023 }, { 34, 5119 }, { 66, 5119 }, { 67, 10000 }, { 100, 10000 } });
+	}
+
+	TEST(TEST_CLASS, PercentileHasBoundedRelativeError) {
+		// Arrange:
+		LatencyHistogram histogram;
+		for (auto i = 1u; i <= 100'000; ++i)
+			histogram.record(i);
+
+		// Act + Assert:
+		for (auto percentile : { 1u, 25u, 50u, 75u, 90u, 99u }) {
+			auto expectedValue = 1000u * percentile;
+			auto value = histogram.percentile(percentile);
+			EXPECT_LE(expectedValue, value) << "percentile " << percentile;
+			EXPECT_GE(expectedValue + expectedValue / LatencyHistogram::Num_Sub_Buckets, value) << "percentile " << percentile;
+		}
+	}
+
+	TEST(TEST_CLASS, CannotCalculatePercentileGreaterThanOneHundred) {
+		// Arrange:
+		LatencyHistogram histogram;
+		histogram.record(7);
+
+		// Act + Assert:
+		EXPECT_THROW(histogram.percentile(101), catapult_invalid_argument);
+	}
+
+	// endregion
+}}
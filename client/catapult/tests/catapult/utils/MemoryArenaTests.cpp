@@ -0,0 +1,202 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/utils/MemoryArena.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace utils {
+
+#define TEST_CLASS MemoryArenaTests
+
+	// region MemoryArena
+
+	namespace {
+		bool IsAligned(const void* pData, size_t alignment) {
+			return 0 == reinterpret_cast<uintptr_t>(pData) % alignment;
+		}
+	}
+
+	TEST(TEST_CLASS, ArenaIsInitiallyEmpty) {
+		// Act:
+		MemoryArena arena;
+
+		// Assert:
+		EXPECT_EQ(0u, arena.numBlocks());
+		EXPECT_EQ(0u, arena.size());
+	}
+
+	TEST(TEST_CLASS, CanAllocateMultipleSmallAllocationsFromSingleBlock) {
+		// Arrange:
+		MemoryArena arena(1024);
+
+		// Act:
+		auto* pData1 = static_cast<uint8_t*>(arena.allocate(10, 1));
+		auto* pData2 = static_cast<uint8_t*>(arena.allocate(20, 1));
+		auto* pData3 = static_cast<uint8_t*>(arena.allocate(30, 1));
+
+		// Assert: allocations are contiguous
+		EXPECT_EQ(1u, arena.numBlocks());
+		EXPECT_EQ(60u, arena.size());
+		EXPECT_EQ(pData1 + 10, pData2);
+		EXPECT_EQ(pData2 + 20, pData3);
+	}
+
+	TEST(TEST_CLASS, AllocationsRespectAlignment) {
+		// Arrange:
+		MemoryArena arena(1024);
+
+		// Act:
+		arena.allocate(3, 1);
+		auto* pData1 = arena.allocate(8, 8);
+		arena.allocate(1, 1);
+		auto* pData2 = arena.allocate(16, 16);
+
+		// Assert:
+		EXPECT_EQ(1u, arena.numBlocks());
+		EXPECT_EQ(28u, arena.size());
+		EXPECT_TRUE(IsAligned(pData1, 8));
+		EXPECT_TRUE(IsAligned(pData2, 16));
+	}
+
+	TEST(TEST_CLASS, NewBlockIsAllocatedWhenCurrentBlockIsExhausted) {
+		// Arrange:
+		MemoryArena arena(100);
+		arena.allocate(40, 1);
+		arena.allocate(40, 1);
+
+		// Act:
+		auto* pData = static_cast<uint8_t*>(arena.allocate(40, 1));
+		auto* pDataNext = static_cast<uint8_t*>(arena.allocate(10, 1));
+
+		// Assert: the last allocation is serviced by the new block
+		EXPECT_EQ(2u, arena.numBlocks());
+		EXPECT_EQ(130u, arena.size());
+		EXPECT_EQ(pData + 40, pDataNext);
+	}
+
+	TEST(TEST_CLASS, LargeAllocationIsServicedByDedicatedBlock) {
+		// Arrange:
+		MemoryArena arena(100);
+		auto* pData1 = static_cast<uint8_t*>(arena.allocate(10, 1));
+
+		// Act:
+		auto* pLargeData = arena.allocate(1000, 8);
+		auto* pData2 = static_cast<uint8_t*>(arena.allocate(10, 1));
+
+		// Assert: the current block is still used for small allocations
+		EXPECT_EQ(2u, arena.numBlocks());
+		EXPECT_EQ(1020u, arena.size());
+		EXPECT_TRUE(IsAligned(pLargeData, 8));
+		EXPECT_EQ(pData1 + 10, pData2);
+	}
+
+	TEST(TEST_CLASS, CanResetArena) {
+		// Arrange:
+		MemoryArena arena(100);
+		arena.allocate(60, 1);
+		arena.allocate(60, 1);
+
+		// Act:
+		arena.reset();
+
+		// Assert:
+		EXPECT_EQ(0u, arena.numBlocks());
+		EXPECT_EQ(0u, arena.size());
+	}
+
+	TEST(TEST_CLASS, CanAllocateAfterReset) {
+		// Arrange:
+		MemoryArena arena(100);
+		arena.allocate(60, 1);
+		arena.reset();
+
+		// Act:
+		arena.allocate(30, 1);
+
+		// Assert:
+		EXPECT_EQ(1u, arena.numBlocks());
+		EXPECT_EQ(30u, arena.size());
+	}
+
+	// endregion
+
+	// region ArenaAllocator
+
+	TEST(TEST_CLASS, DefaultAllocatorIsNotAssociatedWithArena) {
+		// Act:
+		ArenaAllocator<uint32_t> allocator;
+
+		// Assert:
+		EXPECT_FALSE(!!allocator.arena());
+	}
+
+	TEST(TEST_CLASS, DefaultAllocatorCanBeUsedWithContainer) {
+		// Act:
+		std::vector<uint32_t, ArenaAllocator<uint32_t>> values{ 1, 2, 3 };
+		values.push_back(4);
+
+		// Assert:
+		EXPECT_EQ(std::vector<uint32_t>({ 1, 2, 3, 4 }), std::vector<uint32_t>(values.cbegin(), values.cend()));
+	}
+
+	TEST(TEST_CLASS, ArenaAllocatorAllocatesFromArena) {
+		// Arrange:
+		MemoryArena arena;
+		ArenaAllocator<uint32_t> allocator(arena);
+
+		// Act:
+		std::vector<uint32_t, ArenaAllocator<uint32_t>> values(allocator);
+		values.reserve(10);
+		for (auto i = 0u; i < 10; ++i)
+			values.push_back(i * i);
+
+		// Assert:
+		EXPECT_EQ(&arena, allocator.arena());
+		EXPECT_EQ(1u, arena.numBlocks());
+		EXPECT_EQ(10 * sizeof(uint32_t), arena.size());
+		EXPECT_EQ(std::vector<uint32_t>({ 0, 1, 4, 9, 16, 25, 36, 49, 64, 81 }), std::vector<uint32_t>(values.cbegin(), values.cend()));
+	}
+
+	TEST(TEST_CLASS, ArenaAllocatorRejectsTooLargeAllocation) {
+		// Arrange:
+		MemoryArena arena;
+		ArenaAllocator<uint64_t> allocator(arena);
+
+		// Act + Assert:
+		EXPECT_THROW(allocator.allocate(SIZE_MAX / 4), std::bad_array_new_length);
+	}
+
+	TEST(TEST_CLASS, ArenaAllocatorsAreEqualOnlyWhenAssociatedWithSameArena) {
+		// Arrange:
+		MemoryArena arena1;
+		MemoryArena arena2;
+
+		// Act + Assert:
+		EXPECT_EQ(ArenaAllocator<uint32_t>(arena1), ArenaAllocator<uint32_t>(arena1));
+		EXPECT_EQ(ArenaAllocator<uint32_t>(arena1), ArenaAllocator<uint8_t>(arena1));
+		EXPECT_EQ(ArenaAllocator<uint32_t>(), ArenaAllocator<uint32_t>());
+
+		EXPECT_NE(ArenaAllocator<uint32_t>(arena1), ArenaAllocator<uint32_t>(arena2));
+		EXPECT_NE(ArenaAllocator<uint32_t>(arena1), ArenaAllocator<uint32_t>());
+	}
+
+	// endregion
+}}
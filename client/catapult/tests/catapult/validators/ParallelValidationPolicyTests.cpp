@@ -20,6 +20,7 @@
 **/
 
 #include "catapult/validators/ParallelValidationPolicy.h"
+#include "catapult/thread/ParallelFor.h"
 #include "tests/catapult/validators/test/ValidationPolicyTestUtils.h"
 #include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/nodeps/BasicMultiThreadedState.h"
@@ -35,9 +36,10 @@ namespace catapult { namespace validators {
 		public:
 			PoolValidationPolicyPair(
 					std::unique_ptr<thread::IoThreadPool>&& pPool,
-					const std::shared_ptr<const StatelessEntityValidator>& pValidator)
+					const std::shared_ptr<const StatelessEntityValidator>& pValidator,
+					thread::ParallelForStrategy strategy)
 					: m_pPool(std::move(pPool))
-					, m_pValidationPolicy(CreateParallelValidationPolicy(*m_pPool, pValidator))
+					, m_pValidationPolicy(CreateParallelValidationPolicy(*m_pPool, pValidator, strategy))
 					, m_isReleased(false)
 			{}
 
@@ -141,9 +143,12 @@ namespace catapult { namespace validators {
 			return std::make_shared<MockStatelessEntityValidator>(results, pWait);
 		}
 
-		auto CreatePolicy(const std::shared_ptr<const StatelessEntityValidator>& pValidator, uint32_t numThreads = 0) {
+		auto CreatePolicy(
+				const std::shared_ptr<const StatelessEntityValidator>& pValidator,
+				uint32_t numThreads = 0,
+				thread::ParallelForStrategy strategy = thread::ParallelForStrategy::Static) {
 			auto pPool = numThreads > 0 ? test::CreateStartedIoThreadPool(numThreads) : test::CreateStartedIoThreadPool();
-			return PoolValidationPolicyPair(std::move(pPool), pValidator);
+			return PoolValidationPolicyPair(std::move(pPool), pValidator, strategy);
 		}
 	}
 
@@ -386,7 +391,7 @@ namespace catapult { namespace validators {
 		const auto Num_Default_Threads = test::GetNumDefaultPoolThreads();
 
 		template<typename TTraits, typename TAssertState>
-		void ValidateMany(size_t numEntities, TAssertState assertState) {
+		void ValidateMany(size_t numEntities, thread::ParallelForStrategy strategy, TAssertState assertState) {
 			// Arrange:
 			if (0 == numEntities) {
 				// (Num_Default_Threads is 2 * cores, so Num_Default_Threads / 4 is nonzero when there are at least two cores)
@@ -399,7 +404,7 @@ namespace catapult { namespace validators {
 			// - create a validator
 			std::atomic_bool shouldBlock(true);
 			auto pValidator = CreateValidator({ ValidationResult::Success }, &shouldBlock);
-			auto pPolicy = CreatePolicy(pValidator);
+			auto pPolicy = CreatePolicy(pValidator, 0, strategy);
 
 			// Act:
 			auto entityInfos = test::CreateEntityInfos(numEntities);
@@ -417,9 +422,11 @@ namespace catapult { namespace validators {
 		}
 
 		template<typename TTraits>
-		void AssertCanHandleManyValidatorsAndEntities(size_t numEntities) {
+		void AssertCanHandleManyValidatorsAndEntities(
+				size_t numEntities,
+				thread::ParallelForStrategy strategy = thread::ParallelForStrategy::Static) {
 			// Act:
-			ValidateMany<TTraits>(numEntities, [numEntities](const auto& state) {
+			ValidateMany<TTraits>(numEntities, strategy, [numEntities](const auto& state) {
 				// Assert: validator was called numEntities times (with a unique entity)
 				EXPECT_EQ(numEntities, state.counter());
 				EXPECT_EQ(numEntities, state.numUniqueItems());
@@ -429,7 +436,7 @@ namespace catapult { namespace validators {
 		template<typename TTraits>
 		void AssertCanDistributeWorkEvenly(size_t numEntities) {
 			// Act:
-			ValidateMany<TTraits>(numEntities, [numEntities](const auto& state) {
+			ValidateMany<TTraits>(numEntities, thread::ParallelForStrategy::Static, [numEntities](const auto& state) {
 				// Assert: validator was called numEntities times (with a unique entity)
 				auto minWorkPerThread = numEntities / Num_Default_Threads;
 				EXPECT_EQ(numEntities, state.counter());
@@ -464,4 +471,57 @@ namespace catapult { namespace validators {
 	}
 
 	// endregion
+
+	// region work stealing
+
+	PARALLEL_POLICY_TEST(ValidateInvokesValidateOnEachEntity_WorkStealing) {
+		// Arrange:
+		auto pValidator = CreateValidator({ ValidationResult::Success });
+		auto pPolicy = CreatePolicy(pValidator, 0, thread::ParallelForStrategy::Work_Stealing);
+
+		// Act:
+		auto entityInfos = test::CreateEntityInfos(3);
+		TTraits::Validate(*pPolicy, entityInfos.toVector()).get();
+
+		// Assert:
+		EXPECT_EQ(3u, pValidator->numValidateCalls());
+	}
+
+	TEST(TEST_CLASS, FailureShortCircuitsSubsequentValidationsForSubsequentEntities_ShortCircuit_WorkStealing) {
+		// Arrange:
+		auto pValidator = CreateValidator(CreateAlternatingResults());
+		auto pPolicy = CreatePolicy(pValidator, 1, thread::ParallelForStrategy::Work_Stealing);
+
+		// Act:
+		auto entityInfos = test::CreateEntityInfos(5);
+		auto result = ShortCircuitTraits::Validate(*pPolicy, entityInfos.toVector()).get();
+
+		// Assert: notice that the first entity that fails validation short circuits validation of all subsequent entities
+		EXPECT_EQ(2u, pValidator->numValidateCalls());
+		EXPECT_EQ(ValidationResult::Failure, result);
+	}
+
+	TEST(TEST_CLASS, FailureDoesNotShortCircuitSubsequentValidationsForSubsequentEntities_All_WorkStealing) {
+		// Arrange:
+		auto pValidator = CreateValidator(CreateAlternatingResults());
+		auto pPolicy = CreatePolicy(pValidator, 1, thread::ParallelForStrategy::Work_Stealing);
+
+		// Act:
+		auto entityInfos = test::CreateEntityInfos(5);
+		auto results = AllTraits::Validate(*pPolicy, entityInfos.toVector()).get();
+
+		// Assert: notice that an independent result for each entity is returned
+		EXPECT_EQ(5u, pValidator->numValidateCalls());
+		EXPECT_EQ(CreateAlternatingResults(), results);
+	}
+
+	PARALLEL_POLICY_TEST(CanHandleManyValidatorsAndEntitiesWhenEntitiesAreMultipleOfThreads_WorkStealing) {
+		AssertCanHandleManyValidatorsAndEntities<TTraits>(Num_Default_Threads * 20, thread::ParallelForStrategy::Work_Stealing);
+	}
+
+	PARALLEL_POLICY_TEST(CanHandleManyValidatorsAndEntitiesWhenEntitiesAreNotMultipleOfThreads_WorkStealing) {
+		AssertCanHandleManyValidatorsAndEntities<TTraits>(Num_Default_Threads / 4 * 81, thread::ParallelForStrategy::Work_Stealing);
+	}
+
+	// endregion
 }}
@@ -79,6 +79,8 @@ namespace catapult { namespace local {
 		EXPECT_TRUE(test::HasCounter(counters, "NODES")) << "node container counters";
 		EXPECT_TRUE(test::HasCounter(counters, "BAN ACT")) << "banned nodes container counters";
 		EXPECT_TRUE(test::HasCounter(counters, "BAN ALL")) << "banned nodes container counters";
+		EXPECT_TRUE(test::HasCounter(counters, "BLK C HIT")) << "block storage counters";
+		EXPECT_TRUE(test::HasCounter(counters, "BLK C MEM")) << "block storage counters";
 	}
 
 	// endregion
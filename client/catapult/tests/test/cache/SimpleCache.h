@@ -26,7 +26,7 @@
 #include "catapult/cache/SynchronizedCache.h"
 #include "catapult/io/PodIoUtils.h"
 #include "catapult/io/Stream.h"
-#include "catapult/tree/TreeNode.h"
+#include "catapult/tree/PatriciaTreeBatchProof.h"
 #include "tests/test/nodeps/Atomics.h"
 #include <numeric>
 #include <unordered_set>
@@ -153,6 +153,12 @@ namespace catapult { namespace test {
 			return std::make_pair(Hash256(), false);
 		}
 
+		/// Tries to find the values associated with (keys) in the tree and stores deduplicated proofs of existence or not in (proof).
+		/// \note This is just a placeholder and not implemented.
+		std::vector<std::pair<Hash256, bool>> tryLookup(const std::vector<uint64_t>& keys, tree::PatriciaTreeBatchProof&) const {
+			return std::vector<std::pair<Hash256, bool>>(keys.size(), std::make_pair(Hash256(), false));
+		}
+
 	private:
 		SimpleCacheViewMode m_mode;
 		const Hash256& m_merkleRoot;
@@ -74,6 +74,16 @@ namespace catapult { namespace test {
 			CATAPULT_THROW_RUNTIME_ERROR("prune is not supported");
 		}
 
+		[[noreturn]]
+		void prefetch(const cache::StatePrefetchKeys&) override {
+			CATAPULT_THROW_RUNTIME_ERROR("prefetch is not supported");
+		}
+
+		[[noreturn]]
+		cache::StatePrefetchLoader createPrefetchLoader() const override {
+			CATAPULT_THROW_RUNTIME_ERROR("createPrefetchLoader is not supported");
+		}
+
 		[[noreturn]]
 		const void* asReadOnly() const override {
 			CATAPULT_THROW_RUNTIME_ERROR("asReadOnly is not supported");
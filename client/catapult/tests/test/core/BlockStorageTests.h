@@ -415,6 +415,102 @@ namespace catapult { namespace test {
 
 		// endregion
 
+		// region saveBlocks
+
+	private:
+		static std::vector<model::BlockElement> CreateBlockElementsForSaveTests(
+				const std::vector<std::unique_ptr<model::Block>>& blocks,
+				const std::vector<bool>& hasStatements) {
+			std::vector<model::BlockElement> blockElements;
+			for (auto i = 0u; i < blocks.size(); ++i) {
+				auto blockElement = CreateBlockElementForSaveTests(*blocks[i]);
+				if (hasStatements[i])
+					blockElement.OptionalStatement = GenerateRandomStatements({ 2, 1, 3 });
+
+				blockElements.push_back(blockElement);
+			}
+
+			return blockElements;
+		}
+
+		static std::vector<std::unique_ptr<model::Block>> GenerateBlocks(Height startHeight, size_t numBlocks) {
+			std::vector<std::unique_ptr<model::Block>> blocks;
+			for (auto i = 0u; i < numBlocks; ++i)
+				blocks.push_back(GenerateBlockWithTransactions(5, startHeight + Height(i)));
+
+			return blocks;
+		}
+
+	public:
+		static void AssertCanSaveMultipleBlocks() {
+			// Arrange:
+			auto pStorage = PrepareStorageWithBlocks(10);
+
+			auto blocks = GenerateBlocks(Height(11), 5);
+			auto expectedBlockElements = CreateBlockElementsForSaveTests(blocks, { true, false, false, true, true });
+
+			// Act:
+			pStorage->saveBlocks(expectedBlockElements);
+
+			// Assert:
+			EXPECT_EQ(Height(15), pStorage->chainHeight());
+
+			for (auto i = 0u; i < expectedBlockElements.size(); ++i) {
+				auto pBlockElement = LoadBlockElementWithStatements(*pStorage, Height(11 + i));
+				AssertEqual(expectedBlockElements[i], *pBlockElement);
+			}
+
+			auto hashes = pStorage->loadHashesFrom(Height(11), 5);
+			ASSERT_EQ(5u, hashes.size());
+
+			auto i = 0u;
+			for (const auto& hash : hashes)
+				EXPECT_EQ(expectedBlockElements[i++].EntityHash, hash);
+		}
+
+		static void AssertCanSaveMultipleBlocksAfterDroppingBlocks() {
+			// Arrange:
+			auto pStorage = PrepareStorageWithBlocks(10);
+			pStorage->dropBlocksAfter(Height(7));
+
+			auto blocks = GenerateBlocks(Height(8), 3);
+			auto expectedBlockElements = CreateBlockElementsForSaveTests(blocks, { true, true, true });
+
+			// Act:
+			pStorage->saveBlocks(expectedBlockElements);
+
+			// Assert:
+			EXPECT_EQ(Height(10), pStorage->chainHeight());
+
+			for (auto i = 0u; i < expectedBlockElements.size(); ++i)
+				AssertEqual(expectedBlockElements[i], *LoadBlockElementWithStatements(*pStorage, Height(8 + i)));
+		}
+
+		static void AssertSavingZeroBlocksIsNoOp() {
+			// Arrange:
+			auto pStorage = PrepareStorageWithBlocks(10);
+
+			// Act:
+			pStorage->saveBlocks({});
+
+			// Assert:
+			EXPECT_EQ(Height(10), pStorage->chainHeight());
+		}
+
+		static void AssertCannotSaveMultipleBlocksNotStartingAfterChainHeight() {
+			// Arrange:
+			auto pStorage = PrepareStorageWithBlocks(10);
+
+			auto blocks = GenerateBlocks(Height(12), 3);
+			auto blockElements = CreateBlockElementsForSaveTests(blocks, { true, true, true });
+
+			// Act + Assert:
+			EXPECT_THROW(pStorage->saveBlocks(blockElements), catapult_invalid_argument);
+			EXPECT_EQ(Height(10), pStorage->chainHeight());
+		}
+
+		// endregion
+
 		// region dropBlocksAfter
 
 		static void AssertCanDropBlocksAfterHeight() {
@@ -665,6 +761,11 @@ namespace catapult { namespace test {
 	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, CannotSaveBlockAtChainHeight) \
 	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, CannotSaveBlockMoreThanOneHeightBeyondChainHeight) \
 	\
+	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, CanSaveMultipleBlocks) \
+	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, CanSaveMultipleBlocksAfterDroppingBlocks) \
+	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, SavingZeroBlocksIsNoOp) \
+	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, CannotSaveMultipleBlocksNotStartingAfterChainHeight) \
+	\
 	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, CanDropBlocksAfterHeight) \
 	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, CanDropBlocksAfterHeightAndSaveBlock) \
 	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, CanDropAllBlocks) \
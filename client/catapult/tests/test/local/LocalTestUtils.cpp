@@ -56,6 +56,7 @@ namespace catapult { namespace test {
 			config.MaxHashesPerSyncAttempt = 4 * 100;
 			config.MaxBlocksPerSyncAttempt = 2 * 100;
 			config.MaxChainBytesPerSyncAttempt = utils::FileSize::FromKilobytes(8 * 512);
+			config.StateHashCalculationInterval = 1;
 
 			config.ShortLivedCacheMaxSize = 10;
 
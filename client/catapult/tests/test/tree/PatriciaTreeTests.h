@@ -1484,6 +1484,183 @@ namespace catapult { namespace test {
 
 		// endregion
 
+		// region setBatch
+
+	private:
+		using PairsVector = std::vector<std::pair<uint32_t, std::string>>;
+		using TreeType = tree::PatriciaTree<PassThroughEncoder, DataSource>;
+
+		static std::vector<typename TreeType::EncodedPair> EncodePairs(const PairsVector& pairs) {
+			std::vector<typename TreeType::EncodedPair> encodedPairs;
+			for (const auto& pair : pairs)
+				encodedPairs.push_back(TreeType::Encode(pair.first, pair.second));
+
+			return encodedPairs;
+		}
+
+		static Hash256 CalculateExpectedHashForSetBatch(const PairsVector& seedPairs, const PairsVector& batchPairs) {
+			TestContext context(tree::DataSourceVerbosity::Off);
+			for (const auto& pairs : { seedPairs, batchPairs }) {
+				for (const auto& pair : pairs)
+					context.tree().set(pair.first, pair.second);
+			}
+
+			return context.tree().root();
+		}
+
+		static void AssertSetBatchIsEquivalentToSet(const PairsVector& seedPairs, const PairsVector& batchPairs) {
+			// Arrange:
+			auto expectedHash = CalculateExpectedHashForSetBatch(seedPairs, batchPairs);
+
+			TestContext context(tree::DataSourceVerbosity::Off);
+			for (const auto& pair : seedPairs)
+				context.tree().set(pair.first, pair.second);
+
+			// Act:
+			context.tree().setBatch(EncodePairs(batchPairs));
+
+			// Assert:
+			EXPECT_EQ(expectedHash, context.tree().root());
+			AssertLeaves(context.tree(), batchPairs);
+		}
+
+	public:
+		static void AssertSetBatchHasNoEffectWhenBatchIsEmpty() {
+			// Arrange:
+			TestContext context;
+			for (const auto& pair : GetPuppyTreeWithRootExtensionNodePairs())
+				context.tree().set(pair.first, pair.second);
+
+			auto expectedHash = context.tree().root();
+
+			// Act:
+			context.tree().setBatch({});
+
+			// Assert:
+			EXPECT_EQ(expectedHash, context.tree().root());
+		}
+
+		static void AssertSetBatchCanInsertSingleValue() {
+			AssertSetBatchIsEquivalentToSet({}, { { 0x64'6F'67'00, "alpha" } });
+		}
+
+		static void AssertSetBatchCanCreatePuppyTreeWithRootExtensionNode_AnyOrder() {
+			// Arrange:
+			size_t i = 0u;
+			auto pairs = GetPuppyTreeWithRootExtensionNodePairs();
+			Hash256 expectedHash;
+			{
+				TestContext context(tree::DataSourceVerbosity::Off);
+				expectedHash = CreateCheckerForCanCreatePuppyTreeWithRootExtensionNode(context.dataSource()).get("root");
+			}
+
+			for (; 0 == i || std::next_permutation(pairs.begin(), pairs.end());) {
+				TestContext context(tree::DataSourceVerbosity::Off);
+
+				// Act:
+				context.tree().setBatch(EncodePairs(pairs));
+
+				// Assert:
+				EXPECT_EQ(expectedHash, context.tree().root()) << "permutation " << i;
+				++i;
+			}
+
+			// Sanity: 4!
+			EXPECT_EQ(24u, i);
+		}
+
+		static void AssertSetBatchCanInsertValuesIntoTreeWithRootLeafNode() {
+			AssertSetBatchIsEquivalentToSet({ { 0x64'6F'67'00, "alpha" } }, {
+				{ 0x64'6F'67'01, "beta" },
+				{ 0x64'6F'00'00, "gamma" },
+				{ 0x12'34'56'78, "delta" }
+			});
+		}
+
+		static void AssertSetBatchCanReplaceValueOfRootLeafNode() {
+			AssertSetBatchIsEquivalentToSet({ { 0x64'6F'67'00, "alpha" } }, {
+				{ 0x64'6F'67'00, "beta" },
+				{ 0x64'6F'67'01, "gamma" }
+			});
+		}
+
+		static void AssertSetBatchCanInsertAndUpdateValuesInBranchNode() {
+			AssertSetBatchIsEquivalentToSet(GetPuppyTreeWithRootExtensionNodePairs(), {
+				{ 0x64'6F'00'00, "noun" },
+				{ 0x64'6F'67'01, "dog" },
+				{ 0x64'6F'11'11, "cat" },
+				{ 0x68'6F'72'73, "horse" },
+				{ 0x68'00'00'00, "mule" }
+			});
+		}
+
+		static void AssertSetBatchCanSplitExtensionNode() {
+			AssertSetBatchIsEquivalentToSet(GetPuppyTreeWithRootExtensionNodePairs(), {
+				{ 0x12'34'56'78, "alpha" },
+				{ 0x64'00'00'00, "beta" },
+				{ 0x7F'FF'FF'FF, "gamma" }
+			});
+		}
+
+		static void AssertSetBatchUsesLastValueWhenKeyIsDuplicated() {
+			// Arrange:
+			auto expectedHash = CalculateExpectedHashForSetBatch({}, { { 0x64'6F'67'00, "gamma" }, { 0x64'6F'67'65, "delta" } });
+
+			TestContext context(tree::DataSourceVerbosity::Off);
+
+			// Act:
+			context.tree().setBatch(EncodePairs({
+				{ 0x64'6F'67'00, "alpha" },
+				{ 0x64'6F'67'65, "delta" },
+				{ 0x64'6F'67'00, "beta" },
+				{ 0x64'6F'67'00, "gamma" }
+			}));
+
+			// Assert:
+			EXPECT_EQ(expectedHash, context.tree().root());
+		}
+
+		static void AssertSetBatchCanUpdateTreeLoadedFromDataSource() {
+			// Arrange: save a tree to the data source
+			TestContext context(tree::DataSourceVerbosity::Off);
+			for (const auto& pair : GetPuppyTreeWithRootExtensionNodePairs())
+				context.tree().set(pair.first, pair.second);
+
+			context.tree().saveAll();
+
+			PairsVector batchPairs{ { 0x64'6F'67'01, "dog" }, { 0x68'6F'72'73, "horse" }, { 0x12'34'56'78, "cat" } };
+			auto expectedHash = CalculateExpectedHashForSetBatch(GetPuppyTreeWithRootExtensionNodePairs(), batchPairs);
+
+			// - load a new tree from the data source so that all linked nodes need to be loaded
+			TreeType tree(context.dataSource());
+			tree.tryLoad(context.tree().root());
+
+			// Act:
+			tree.setBatch(EncodePairs(batchPairs));
+
+			// Assert:
+			EXPECT_EQ(expectedHash, tree.root());
+			AssertLeaves(tree, batchPairs);
+		}
+
+		static void AssertSetBatchIsEquivalentToSetForManyValues() {
+			// Arrange: keys are unique because they end with the iteration index; every other batch pair updates a seed pair
+			PairsVector seedPairs;
+			PairsVector batchPairs;
+			for (auto i = 0u; i < 1000; ++i) {
+				auto key = static_cast<uint32_t>((Random() & 0xFFFF'F000) | i);
+				if (0 == i % 2)
+					seedPairs.emplace_back(key, std::to_string(i));
+				else
+					batchPairs.emplace_back(1 == i % 4 ? seedPairs.back().first : key, std::to_string(i));
+			}
+
+			// Act + Assert:
+			AssertSetBatchIsEquivalentToSet(seedPairs, batchPairs);
+		}
+
+		// endregion
+
 		// region tryLoad
 
 	private:
@@ -1704,6 +1881,17 @@ namespace catapult { namespace test {
 	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, CanCreatePuppyTreeWithRootExtensionNode_AnyOrder) \
 	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, CanUndoPuppyTreeWithRootExtensionNode_AnyOrder) \
 	\
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, SetBatchHasNoEffectWhenBatchIsEmpty) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, SetBatchCanInsertSingleValue) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, SetBatchCanCreatePuppyTreeWithRootExtensionNode_AnyOrder) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, SetBatchCanInsertValuesIntoTreeWithRootLeafNode) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, SetBatchCanReplaceValueOfRootLeafNode) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, SetBatchCanInsertAndUpdateValuesInBranchNode) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, SetBatchCanSplitExtensionNode) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, SetBatchUsesLastValueWhenKeyIsDuplicated) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, SetBatchCanUpdateTreeLoadedFromDataSource) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, SetBatchIsEquivalentToSetForManyValues) \
+	\
 	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, CanLoadTreeAroundLatestRootHash) \
 	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, CanLoadTreeAroundPreviousRootHash) \
 	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, CanLoadTreeAroundNonRootHash) \
@@ -25,6 +25,7 @@
 #include "catapult/crypto/Signer.h"
 #include "catapult/thread/IoThreadPool.h"
 #include "catapult/thread/ParallelFor.h"
+#include "catapult/thread/WorkStealingParallelFor.h"
 #include "catapult/utils/StackLogger.h"
 
 namespace catapult { namespace tools { namespace benchmark {
@@ -55,17 +56,24 @@ namespace catapult { namespace tools { namespace benchmark {
 				optionsBuilder("data size,s",
 						OptionsValue<uint32_t>(m_dataSize)->default_value(148),
 						"size of the data to generate");
+				optionsBuilder("work stealing,w",
+						OptionsSwitch(),
+						"true to balance operations across threads by work stealing");
 			}
 
-			int run(const Options&) override {
+			int run(const Options& options) override {
 				m_numThreads = 0 != m_numThreads ? m_numThreads : std::thread::hardware_concurrency();
 				m_numPartitions = 0 != m_numPartitions ? m_numPartitions : m_numThreads;
+				m_strategy = options["work stealing"].as<bool>()
+						? thread::ParallelForStrategy::Work_Stealing
+						: thread::ParallelForStrategy::Static;
 
 				CATAPULT_LOG(info)
 						<< "num threads (" << m_numThreads
 						<< "), num partitions (" << m_numPartitions
 						<< "), ops / partition (" << m_opsPerPartition
-						<< "), data size (" << m_dataSize << ")";
+						<< "), data size (" << m_dataSize
+						<< "), work stealing (" << (thread::ParallelForStrategy::Work_Stealing == m_strategy) << ")";
 
 				auto keyPair = GenerateRandomKeyPair();
 				auto entries = std::vector<BenchmarkEntry>(m_numPartitions * m_opsPerPartition);
@@ -100,10 +108,15 @@ namespace catapult { namespace tools { namespace benchmark {
 					TAction action) const {
 				utils::StackLogger logger(testName, utils::LogLevel::info);
 				utils::StackTimer stopwatch;
-				thread::ParallelFor(pool.ioContext(), entries, m_numPartitions, [action](auto& entry, auto) {
+				auto entryCallback = [action](auto& entry, auto) {
 					action(entry);
 					return true;
-				}).get();
+				};
+
+				if (thread::ParallelForStrategy::Work_Stealing == m_strategy)
+					thread::WorkStealingParallelFor(pool.ioContext(), entries, m_numPartitions, entryCallback).get();
+				else
+					thread::ParallelFor(pool.ioContext(), entries, m_numPartitions, entryCallback).get();
 
 				auto elapsedMillis = stopwatch.millis();
 				auto elapsedMicrosPerOp = elapsedMillis * 1000u / entries.size();
@@ -119,6 +132,7 @@ namespace catapult { namespace tools { namespace benchmark {
 			uint32_t m_numPartitions;
 			uint32_t m_opsPerPartition;
 			uint32_t m_dataSize;
+			thread::ParallelForStrategy m_strategy;
 		};
 	}
 }}}
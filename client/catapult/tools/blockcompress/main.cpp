@@ -0,0 +1,155 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "tools/ToolMain.h"
+#include "tools/Random.h"
+#include "catapult/io/FileBlockStorage.h"
+#include "catapult/io/MoveBlockFiles.h"
+#include "catapult/utils/StackLogger.h"
+#include <filesystem>
+
+namespace catapult { namespace tools { namespace blockcompress {
+
+	namespace {
+		void CreatePlaceholderHashesFile(const std::string& dataDirectory) {
+			auto blockVersionedDirectory = std::filesystem::path(dataDirectory) / "00000";
+			std::filesystem::create_directories(blockVersionedDirectory);
+
+			io::RawFile hashesFile((blockVersionedDirectory / "hashes.dat").generic_string(), io::OpenMode::Read_Write);
+			hashesFile.write(Hash256());
+			hashesFile.write(Hash256());
+		}
+
+		uint64_t GetDirectorySize(const std::string& directory) {
+			uint64_t size = 0;
+			for (const auto& entry : std::filesystem::recursive_directory_iterator(directory)) {
+				if (entry.is_regular_file())
+					size += entry.file_size();
+			}
+
+			return size;
+		}
+
+		void MeasureReadLatency(const char* storageName, const io::BlockStorage& storage, uint32_t numSamples) {
+			utils::StackTimer stopwatch;
+
+			auto chainHeight = storage.chainHeight().unwrap();
+			for (auto i = 0u; i < numSamples; ++i) {
+				auto height = Height(1 + Random() % chainHeight);
+				storage.loadBlockElement(height);
+				storage.loadBlockStatementData(height);
+			}
+
+			auto elapsedMillis = stopwatch.millis();
+			CATAPULT_LOG(info)
+					<< storageName << " random reads: " << elapsedMillis * 1000u / numSamples << "us/op "
+					<< "(elapsed time " << elapsedMillis << "ms, " << numSamples << " samples)";
+		}
+
+		class BlockCompressTool : public Tool {
+		public:
+			std::string name() const override {
+				return "Block Compress Tool";
+			}
+
+			void prepareOptions(OptionsBuilder& optionsBuilder, OptionsPositional&) override {
+				optionsBuilder("source,s",
+						OptionsValue<std::string>(m_sourceDirectory),
+						"path to the data directory containing block storage to migrate");
+				optionsBuilder("destination,d",
+						OptionsValue<std::string>(m_destinationDirectory),
+						"path to the (new) data directory that will contain migrated block storage");
+				optionsBuilder("level,c",
+						OptionsValue<uint32_t>(m_compressionLevel)->default_value(3),
+						"compression level of migrated block storage (zero disables compression)");
+				optionsBuilder("batchSize,b",
+						OptionsValue<uint32_t>(m_fileDatabaseBatchSize)->default_value(100),
+						"file database batch size of source and migrated block storage");
+				optionsBuilder("samples,n",
+						OptionsValue<uint32_t>(m_numSamples)->default_value(10'000),
+						"number of random reads used to compare source and migrated block storage (zero disables comparison)");
+			}
+
+			int run(const Options&) override {
+				if (!std::filesystem::exists(m_sourceDirectory))
+					CATAPULT_THROW_INVALID_ARGUMENT_1("source directory does not exist", m_sourceDirectory);
+
+				if (std::filesystem::exists(m_destinationDirectory) && !std::filesystem::is_empty(m_destinationDirectory))
+					CATAPULT_THROW_INVALID_ARGUMENT_1("destination directory is not empty", m_destinationDirectory);
+
+				// only block storage is migrated, so the destination is prepared like a nemesis seed directory
+				CreatePlaceholderHashesFile(m_destinationDirectory);
+
+				// enable compression when reading source so that both compressed and uncompressed payloads can be read
+				io::FileBlockStorage sourceStorage(
+						m_sourceDirectory,
+						m_fileDatabaseBatchSize,
+						io::FileBlockStorageMode::Hash_Index,
+						io::FileBlockStorageReadMode::Copy,
+						1);
+				io::FileBlockStorage destinationStorage(
+						m_destinationDirectory,
+						m_fileDatabaseBatchSize,
+						io::FileBlockStorageMode::Hash_Index,
+						io::FileBlockStorageReadMode::Copy,
+						m_compressionLevel);
+
+				auto chainHeight = sourceStorage.chainHeight();
+				if (Height(0) == chainHeight)
+					CATAPULT_THROW_RUNTIME_ERROR_1("source directory does not contain any blocks", m_sourceDirectory);
+
+				CATAPULT_LOG(info)
+						<< "migrating " << chainHeight << " blocks from " << m_sourceDirectory << " to " << m_destinationDirectory
+						<< " with compression level " << m_compressionLevel;
+
+				{
+					utils::StackLogger logger("migration", utils::LogLevel::info);
+					io::CopyBlockFiles(sourceStorage, destinationStorage, Height(1));
+				}
+
+				auto sourceSize = GetDirectorySize(m_sourceDirectory);
+				auto destinationSize = GetDirectorySize(m_destinationDirectory);
+				CATAPULT_LOG(info)
+						<< "disk footprint: " << sourceSize << " -> " << destinationSize << " bytes ("
+						<< (0 == sourceSize ? 0 : destinationSize * 100 / sourceSize) << "%)";
+
+				if (0 != m_numSamples) {
+					MeasureReadLatency("source", sourceStorage, m_numSamples);
+					MeasureReadLatency("destination", destinationStorage, m_numSamples);
+				}
+
+				return 0;
+			}
+
+		private:
+			std::string m_sourceDirectory;
+			std::string m_destinationDirectory;
+			uint32_t m_compressionLevel;
+			uint32_t m_fileDatabaseBatchSize;
+			uint32_t m_numSamples;
+		};
+	}
+}}}
+
+int main(int argc, const char** argv) {
+	catapult::tools::blockcompress::BlockCompressTool tool;
+	return catapult::tools::ToolMain(argc, argv, tool);
+}
@@ -285,6 +285,7 @@ class UbuntuSystem:
 			'libgflags-dev',
 			'libsnappy-dev',
 			'libtool',
+			'libzstd-dev',
 			'make',
 			'ninja-build',
 			'pkg-config',
@@ -335,6 +336,7 @@ class FedoraSystem:
 			'gflags-devel',
 			'git',
 			'libunwind-devel',
+			'libzstd-devel',
 			'make',
 			'ninja-build',
 			'perl-core',
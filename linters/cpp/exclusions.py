@@ -80,6 +80,7 @@ SPECIAL_INCLUDES = (
 	re.compile(r'<sys/file.h>'),
 	re.compile(r'<sys/resource.h>'),
 	re.compile(r'<sys/time.h>'),
+	re.compile(r'<sys/uio.h>'),
 	re.compile(r'<unistd.h>'),
 	re.compile(r'<windows.h>')
 )
@@ -94,6 +95,7 @@ CORE_FIRSTINCLUDES = {
 	'src/catapult/consumers/HashCheckConsumer.cpp': 'BlockConsumers.h',
 	'src/catapult/consumers/NewBlockConsumer.cpp': 'BlockConsumers.h',
 	'src/catapult/consumers/NewTransactionsConsumer.cpp': 'TransactionConsumers.h',
+	'src/catapult/consumers/StatePrefetchConsumer.cpp': 'BlockConsumers.h',
 	'src/catapult/consumers/StatelessValidationConsumer.cpp': 'BlockConsumers.h',
 
 	'src/catapult/ionet/IoEnums.cpp': 'ConnectResult.h',
@@ -115,6 +117,7 @@ CORE_FIRSTINCLUDES = {
 	'tests/catapult/consumers/HashCheckConsumerTests.cpp': 'catapult/consumers/BlockConsumers.h',
 	'tests/catapult/consumers/NewBlockConsumerTests.cpp': 'catapult/consumers/BlockConsumers.h',
 	'tests/catapult/consumers/NewTransactionsConsumerTests.cpp': 'catapult/consumers/TransactionConsumers.h',
+	'tests/catapult/consumers/StatePrefetchConsumerTests.cpp': 'catapult/consumers/BlockConsumers.h',
 	'tests/catapult/consumers/StatelessValidationConsumerTests.cpp': 'catapult/consumers/BlockConsumers.h',
 
 	'tests/catapult/deltaset/MapVirtualizedTests.cpp': 'tests/catapult/deltaset/test/BaseSetDeltaTests.h',
@@ -123,6 +126,8 @@ CORE_FIRSTINCLUDES = {
 	'tests/catapult/deltaset/SetVirtualizedTests.cpp': 'tests/catapult/deltaset/test/BaseSetDeltaTests.h',
 	'tests/catapult/deltaset/UnorderedMapTests.cpp': 'tests/catapult/deltaset/test/BaseSetDeltaTests.h',
 	'tests/catapult/deltaset/UnorderedTests.cpp': 'tests/catapult/deltaset/test/BaseSetDeltaTests.h',
+	'tests/catapult/io/CompressedFileBlockStorageTests.cpp': 'catapult/io/FileBlockStorage.h',
+	'tests/catapult/io/MemoryMappedFileBlockStorageTests.cpp': 'catapult/io/FileBlockStorage.h',
 	'tests/catapult/thread/FutureSharedStateTests.cpp': 'catapult/thread/detail/FutureSharedState.h',
 	'tests/catapult/utils/CatapultExceptionTests.cpp': 'catapult/exceptions.h',
 	'tests/catapult/utils/CatapultTypesTests.cpp': 'catapult/types.h',